@@ -0,0 +1,120 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/ECS/ECS.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
+
+namespace {
+
+struct BenchmarkEvent {
+  size_t value{};
+};
+
+class BenchmarkEventsListener : public EventsListener<BenchmarkEvent> {
+ public:
+  EventProcessStatus receiveEvent(const BenchmarkEvent& event) override
+  {
+    m_valuesSum += event.value;
+
+    return EventProcessStatus::Processed;
+  }
+
+  [[nodiscard]] size_t getValuesSum() const
+  {
+    return m_valuesSum;
+  }
+
+ private:
+  size_t m_valuesSum{};
+};
+
+}
+
+TEST_CASE("game_objects_creation_and_removal", "[!benchmark][ECS]")
+{
+  constexpr size_t OBJECTS_COUNT = 10000;
+
+  auto gameWorld = GameWorld::createInstance();
+  std::vector<GameObject> objects(OBJECTS_COUNT);
+
+  BENCHMARK(fmt::format("create_remove_{}_objects", OBJECTS_COUNT)) {
+    for (GameObject& object : objects) {
+      object = gameWorld->createGameObject();
+      object.addComponent<TransformComponent>();
+    }
+
+    for (GameObject& object : objects) {
+      gameWorld->removeGameObject(object);
+    }
+  };
+
+  BENCHMARK(fmt::format("create_remove_{}_named_objects", OBJECTS_COUNT)) {
+    for (size_t objectIndex = 0; objectIndex < OBJECTS_COUNT; objectIndex++) {
+      objects[objectIndex] = gameWorld->createGameObject("object_" + std::to_string(objectIndex));
+    }
+
+    for (GameObject& object : objects) {
+      gameWorld->removeGameObject(object);
+    }
+  };
+}
+
+TEST_CASE("game_objects_components_iteration", "[!benchmark][ECS]")
+{
+  constexpr size_t OBJECTS_COUNT = 100000;
+
+  auto gameWorld = GameWorld::createInstance();
+
+  for (size_t objectIndex = 0; objectIndex < OBJECTS_COUNT; objectIndex++) {
+    GameObject object = gameWorld->createGameObject();
+
+    // Half of the objects does not match the view, so the iterators skipping is measured too
+    if (objectIndex % 2 == 0) {
+      object.addComponent<TransformComponent>()->getTransform().setPosition(float(objectIndex), 0.0f, 0.0f);
+    }
+  }
+
+  BENCHMARK(fmt::format("iterate_all_{}_objects", OBJECTS_COUNT)) {
+    size_t objectsCount = 0;
+
+    for (GameObject object : gameWorld->all()) {
+      objectsCount += object.isAlive() ? 1 : 0;
+    }
+
+    return objectsCount;
+  };
+
+  BENCHMARK(fmt::format("iterate_transforms_of_{}_objects", OBJECTS_COUNT)) {
+    float positionsSum = 0.0f;
+
+    for (GameObject object : gameWorld->allWith<TransformComponent>()) {
+      positionsSum += object.getComponent<TransformComponent>()->getTransform().getPosition().x;
+    }
+
+    return positionsSum;
+  };
+}
+
+TEST_CASE("game_world_events_dispatching", "[!benchmark][ECS]")
+{
+  constexpr size_t EVENTS_COUNT = 10000;
+  constexpr size_t LISTENERS_COUNT = 16;
+
+  auto gameWorld = GameWorld::createInstance();
+  std::vector<BenchmarkEventsListener> listeners(LISTENERS_COUNT);
+
+  for (BenchmarkEventsListener& listener : listeners) {
+    gameWorld->subscribeEventsListener<BenchmarkEvent>(&listener);
+  }
+
+  BENCHMARK(fmt::format("emit_{}_events_to_{}_listeners", EVENTS_COUNT, LISTENERS_COUNT)) {
+    for (size_t eventIndex = 0; eventIndex < EVENTS_COUNT; eventIndex++) {
+      gameWorld->emitEvent(BenchmarkEvent{.value = eventIndex});
+    }
+
+    return listeners.front().getValuesSum();
+  };
+
+  for (BenchmarkEventsListener& listener : listeners) {
+    gameWorld->unsubscribeEventsListener<BenchmarkEvent>(&listener);
+  }
+}
@@ -0,0 +1,135 @@
+#include <catch2/catch.hpp>
+
+#include <sstream>
+
+#include <Engine/Modules/ECS/ECS.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
+
+namespace {
+
+std::shared_ptr<GameWorld> createSavingBenchmarkGameWorld()
+{
+  auto gameWorld = GameWorld::createInstance();
+
+  gameWorld->registerComponentBinderFactory<TransformComponent>(
+    std::make_shared<GameObjectsComponentsGenericBindersFactory<TransformComponent, TransformComponentBinder>>());
+
+  return gameWorld;
+}
+
+void fillSavingBenchmarkGameWorld(GameWorld& gameWorld, size_t objectsCount)
+{
+  for (size_t objectIndex = 0; objectIndex < objectsCount; objectIndex++) {
+    GameObject gameObject = gameWorld.createGameObject("object_" + std::to_string(objectIndex));
+    gameObject.markAsSerializable(true);
+
+    auto transformComponent = gameObject.addComponent<TransformComponent>();
+    transformComponent->getTransform().setPosition(float(objectIndex), 0.0f, -float(objectIndex));
+    transformComponent->setLevelId("benchmark_level");
+  }
+}
+
+}
+
+TEST_CASE("game_world_saving_formats", "[!benchmark][saving]")
+{
+  constexpr size_t OBJECTS_COUNT = 10000;
+
+  auto gameWorld = createSavingBenchmarkGameWorld();
+  fillSavingBenchmarkGameWorld(*gameWorld, OBJECTS_COUNT);
+
+  std::string xmlSaveData;
+
+  {
+    std::ostringstream saveStream;
+    cereal::XMLOutputArchive saveArchive(saveStream);
+    saveArchive(*gameWorld);
+    xmlSaveData = saveStream.str();
+  }
+
+  std::string binarySaveData;
+
+  {
+    std::ostringstream saveStream;
+    cereal::BinaryOutputArchive saveArchive(saveStream);
+    saveArchive(gameWorld->createSnapshot());
+    binarySaveData = saveStream.str();
+  }
+
+  // Delta against the unchanged baseline with 1% of modified objects
+  GameWorldSnapshot baseline = gameWorld->createSnapshot();
+
+  for (size_t objectIndex = 0; objectIndex < OBJECTS_COUNT; objectIndex += 100) {
+    gameWorld->findGameObject("object_" + std::to_string(objectIndex))
+      .getComponent<TransformComponent>()->getTransform().move(1.0f, 1.0f, 1.0f);
+  }
+
+  std::string deltaSaveData;
+
+  {
+    std::ostringstream saveStream;
+    cereal::BinaryOutputArchive saveArchive(saveStream);
+    saveArchive(gameWorld->createSnapshot().createDelta(baseline));
+    deltaSaveData = saveStream.str();
+  }
+
+  WARN(fmt::format("Save size for {} objects: xml = {} bytes, binary = {} bytes, binary delta = {} bytes",
+    OBJECTS_COUNT, xmlSaveData.size(), binarySaveData.size(), deltaSaveData.size()));
+
+  BENCHMARK("save_xml") {
+    std::ostringstream saveStream;
+    cereal::XMLOutputArchive saveArchive(saveStream);
+    saveArchive(*gameWorld);
+
+    return saveStream.tellp();
+  };
+
+  BENCHMARK("save_binary") {
+    std::ostringstream saveStream;
+    cereal::BinaryOutputArchive saveArchive(saveStream);
+    saveArchive(gameWorld->createSnapshot());
+
+    return saveStream.tellp();
+  };
+
+  BENCHMARK("save_binary_snapshot_only") {
+    return gameWorld->createSnapshot().getDataSize();
+  };
+
+  BENCHMARK("save_binary_delta") {
+    std::ostringstream saveStream;
+    cereal::BinaryOutputArchive saveArchive(saveStream);
+    saveArchive(gameWorld->createSnapshot().createDelta(baseline));
+
+    return saveStream.tellp();
+  };
+
+  BENCHMARK_ADVANCED("load_xml")(Catch::Benchmark::Chronometer meter) {
+    std::vector<std::shared_ptr<GameWorld>> gameWorlds(meter.runs());
+    std::generate(gameWorlds.begin(), gameWorlds.end(), createSavingBenchmarkGameWorld);
+
+    meter.measure([&gameWorlds, &xmlSaveData](int runIndex) {
+      std::istringstream loadStream(xmlSaveData);
+      cereal::XMLInputArchive loadArchive(loadStream);
+      loadArchive(*gameWorlds[runIndex]);
+    });
+  };
+
+  BENCHMARK_ADVANCED("load_binary")(Catch::Benchmark::Chronometer meter) {
+    std::vector<std::shared_ptr<GameWorld>> gameWorlds(meter.runs());
+    std::generate(gameWorlds.begin(), gameWorlds.end(), createSavingBenchmarkGameWorld);
+
+    meter.measure([&gameWorlds, &binarySaveData](int runIndex) {
+      std::istringstream loadStream(binarySaveData);
+      cereal::BinaryInputArchive loadArchive(loadStream);
+
+      GameWorldSnapshot snapshot;
+      loadArchive(snapshot);
+
+      gameWorlds[runIndex]->restoreSnapshot(snapshot);
+    });
+  };
+
+  CHECK(binarySaveData.size() < xmlSaveData.size());
+  CHECK(deltaSaveData.size() < binarySaveData.size());
+}
@@ -0,0 +1,72 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/Graphics/GraphicsSystem/Animation/AnimationClipInstance.h>
+
+#include "utility/BenchmarkGameWorldGenerator.h"
+
+TEST_CASE("skeletal_animation_poses", "[!benchmark][graphics]")
+{
+  constexpr uint8_t BONES_COUNT = 64;
+  constexpr size_t INSTANCES_COUNT = 100;
+  constexpr float FRAME_DELTA = 1.0f / 60.0f;
+
+  auto resourcesManager = BenchmarkGameWorldGenerator::buildResourcesManager();
+
+  auto skeleton = resourcesManager->createResourceInPlace<Skeleton>(
+    BenchmarkGameWorldGenerator::generateSkeleton(BONES_COUNT));
+  auto walkClip = resourcesManager->createResourceInPlace<AnimationClip>(
+    BenchmarkGameWorldGenerator::generateAnimationClip("walk", BONES_COUNT, 1.0f));
+  auto runClip = resourcesManager->createResourceInPlace<AnimationClip>(
+    BenchmarkGameWorldGenerator::generateAnimationClip("run", BONES_COUNT, 2.0f));
+
+  std::vector<AnimationClipInstance> walkInstances;
+  std::vector<AnimationClipInstance> runInstances;
+
+  for (size_t instanceIndex = 0; instanceIndex < INSTANCES_COUNT; instanceIndex++) {
+    walkInstances.emplace_back(skeleton, walkClip);
+    walkInstances.back().setEndBehaviour(AnimationClipEndBehaviour::Repeat);
+    walkInstances.back().start();
+
+    runInstances.emplace_back(skeleton, runClip);
+    runInstances.back().setEndBehaviour(AnimationClipEndBehaviour::Repeat);
+    runInstances.back().start();
+  }
+
+  BENCHMARK(fmt::format("sample_{}_poses_{}_bones", INSTANCES_COUNT, BONES_COUNT)) {
+    size_t bonesCount = 0;
+
+    for (AnimationClipInstance& instance : walkInstances) {
+      RETURN_VALUE_UNUSED(instance.increaseCurrentTime(FRAME_DELTA));
+      bonesCount += instance.getAnimationPose().getMatrixPalette().bonesTransforms.size();
+    }
+
+    return bonesCount;
+  };
+
+  std::vector<AnimationPose> blendedPoses(INSTANCES_COUNT, AnimationPose(skeleton));
+
+  BENCHMARK(fmt::format("blend_{}_poses_{}_bones", INSTANCES_COUNT, BONES_COUNT)) {
+    for (size_t instanceIndex = 0; instanceIndex < INSTANCES_COUNT; instanceIndex++) {
+      AnimationPose::interpolate(walkInstances[instanceIndex].getAnimationPose(),
+        runInstances[instanceIndex].getAnimationPose(), 0.5f, blendedPoses[instanceIndex]);
+    }
+
+    return blendedPoses.back().getBonesCount();
+  };
+
+  BENCHMARK(fmt::format("sample_blend_skin_{}_poses_{}_bones", INSTANCES_COUNT, BONES_COUNT)) {
+    size_t bonesCount = 0;
+
+    for (size_t instanceIndex = 0; instanceIndex < INSTANCES_COUNT; instanceIndex++) {
+      RETURN_VALUE_UNUSED(walkInstances[instanceIndex].increaseCurrentTime(FRAME_DELTA));
+      RETURN_VALUE_UNUSED(runInstances[instanceIndex].increaseCurrentTime(FRAME_DELTA));
+
+      AnimationPose::interpolate(walkInstances[instanceIndex].getAnimationPose(),
+        runInstances[instanceIndex].getAnimationPose(), 0.5f, blendedPoses[instanceIndex]);
+
+      bonesCount += blendedPoses[instanceIndex].getMatrixPalette().bonesTransforms.size();
+    }
+
+    return bonesCount;
+  };
+}
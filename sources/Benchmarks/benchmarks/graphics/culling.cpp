@@ -0,0 +1,127 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <Engine/Modules/Graphics/GraphicsSystem/Culling/LinearSceneStructure.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/Culling/OcclusionCuller.h>
+
+#include "utility/BenchmarkGameWorldGenerator.h"
+
+TEST_CASE("scene_frustum_culling", "[!benchmark][graphics]")
+{
+  constexpr std::array<size_t, 3> OBJECTS_COUNTS = {1000, 10000, 100000};
+
+  for (size_t objectsCount : OBJECTS_COUNTS) {
+    auto gameWorld = GameWorld::createInstance();
+    std::vector<GameObject> objects = BenchmarkGameWorldGenerator::createSceneObjects(*gameWorld, objectsCount);
+
+    LinearSceneStructure sceneStructure;
+    sceneStructure.buildFromObjectsList(objects);
+
+    Camera camera;
+    BenchmarkGameWorldGenerator::setupSceneCamera(camera, objectsCount);
+
+    std::vector<GameObject> visibleObjects;
+    visibleObjects.reserve(objectsCount);
+
+    BENCHMARK(fmt::format("query_visible_objects_{}_objects", objectsCount)) {
+      visibleObjects.clear();
+      sceneStructure.queryVisibleObjects(camera, visibleObjects);
+
+      return visibleObjects.size();
+    };
+
+    BENCHMARK(fmt::format("update_dynamic_objects_{}_objects", objectsCount)) {
+      sceneStructure.update();
+    };
+
+    CHECK_FALSE(visibleObjects.empty());
+    CHECK(visibleObjects.size() < objectsCount);
+  }
+}
+
+TEST_CASE("scene_occlusion_culling", "[!benchmark][graphics]")
+{
+  constexpr size_t WALLS_COUNT = 256;
+  constexpr size_t BOXES_COUNT = 10000;
+
+  // The walls are subdivided into grids of quads to get the realistic occluders triangles count
+  constexpr size_t WALL_GRID_SIZE = 4;
+
+  std::vector<glm::vec3> wallVertices;
+  std::vector<uint32_t> wallIndices;
+
+  for (size_t y = 0; y <= WALL_GRID_SIZE; y++) {
+    for (size_t x = 0; x <= WALL_GRID_SIZE; x++) {
+      wallVertices.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+    }
+  }
+
+  for (size_t y = 0; y < WALL_GRID_SIZE; y++) {
+    for (size_t x = 0; x < WALL_GRID_SIZE; x++) {
+      auto bottomLeft = static_cast<uint32_t>(y * (WALL_GRID_SIZE + 1) + x);
+      auto topLeft = static_cast<uint32_t>(bottomLeft + WALL_GRID_SIZE + 1);
+
+      wallIndices.insert(wallIndices.end(),
+        {bottomLeft, bottomLeft + 1, topLeft, topLeft, bottomLeft + 1, topLeft + 1});
+    }
+  }
+
+  std::vector<glm::mat4> wallsTransforms;
+
+  for (size_t wallIndex = 0; wallIndex < WALLS_COUNT; wallIndex++) {
+    glm::vec3 position(static_cast<float>(wallIndex % 16) * 6.0f - 48.0f, -2.0f,
+      -10.0f - static_cast<float>(wallIndex / 16) * 4.0f);
+
+    wallsTransforms.push_back(glm::translate(glm::identity<glm::mat4>(), position));
+  }
+
+  std::vector<AABB> boxes;
+
+  for (size_t boxIndex = 0; boxIndex < BOXES_COUNT; boxIndex++) {
+    glm::vec3 position(static_cast<float>(boxIndex % 100) - 50.0f, 0.0f,
+      -12.0f - static_cast<float>(boxIndex / 100) * 0.8f);
+
+    boxes.emplace_back(position - glm::vec3(0.5f), position + glm::vec3(0.5f));
+  }
+
+  glm::mat4 viewProjection = glm::perspective(glm::radians(75.0f), 16.0f / 9.0f, 0.1f, 200.0f) *
+    glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+  for (size_t workersCount : {size_t(0), size_t(3)}) {
+    OcclusionCuller occlusionCuller(OcclusionCullingOptions{.workersCount = workersCount});
+
+    auto rasterizeWalls = [&]() {
+      occlusionCuller.beginFrame(viewProjection);
+
+      for (const glm::mat4& wallTransform : wallsTransforms) {
+        occlusionCuller.addOccluder(wallVertices, wallIndices, wallTransform);
+      }
+
+      occlusionCuller.rasterizeOccluders();
+    };
+
+    BENCHMARK(fmt::format("rasterize_{}_occluders_{}_workers", WALLS_COUNT, workersCount)) {
+      rasterizeWalls();
+
+      return occlusionCuller.getOccludersTrianglesCount();
+    };
+
+    rasterizeWalls();
+
+    size_t visibleBoxesCount = 0;
+
+    BENCHMARK(fmt::format("test_{}_boxes", BOXES_COUNT)) {
+      visibleBoxesCount = static_cast<size_t>(std::count_if(boxes.begin(), boxes.end(), [&](const AABB& box) {
+        return occlusionCuller.isAABBVisible(box);
+      }));
+
+      return visibleBoxesCount;
+    };
+
+    CHECK(visibleBoxesCount < BOXES_COUNT);
+  }
+}
@@ -0,0 +1,25 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/LevelsManagement/LevelsManager.h>
+#include <Engine/Modules/LevelsManagement/GameObjectsGenericClassLoader.h>
+#include <Engine/Modules/ResourceManagement/ResourceManagementModule.h>
+
+TEST_CASE("levels_loading", "[!benchmark][levels_management]")
+{
+  std::shared_ptr<GameWorld> gameWorld = GameWorld::createInstance();
+
+  auto resourceManagementModule = std::make_shared<ResourceManagementModule>();
+
+  auto levelsManager = std::make_shared<LevelsManager>(gameWorld, resourceManagementModule->getResourceManager());
+  levelsManager->getObjectsLoader()
+    .registerClassLoader("generic", std::make_unique<GameObjectsGenericClassLoader>(levelsManager));
+
+  // The first loading is not measured, so the resources of the level are already cached
+  levelsManager->loadLevel("test");
+  levelsManager->unloadLevel();
+
+  BENCHMARK("load_unload_test_level") {
+    levelsManager->loadLevel("test");
+    levelsManager->unloadLevel();
+  };
+}
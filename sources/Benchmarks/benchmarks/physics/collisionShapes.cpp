@@ -0,0 +1,89 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/ECS/ECS.h>
+#include <Engine/Modules/Physics/PhysicsSystem.h>
+#include <Engine/Modules/Physics/Resources/CollisionShapeResourceManager.h>
+#include <Engine/Modules/Physics/BulletBackend/BulletCollisionShapesCache.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
+
+namespace {
+
+CollisionShapeTriangleMesh createTerrainTriangleMesh(size_t gridSize)
+{
+  std::vector<glm::vec3> vertices;
+  std::vector<uint32_t> indices;
+
+  for (size_t z = 0; z <= gridSize; z++) {
+    for (size_t x = 0; x <= gridSize; x++) {
+      vertices.emplace_back(float(x), std::sin(float(x) * 0.3f) * std::cos(float(z) * 0.2f), float(z));
+    }
+  }
+
+  for (size_t z = 0; z < gridSize; z++) {
+    for (size_t x = 0; x < gridSize; x++) {
+      auto vertexIndex = static_cast<uint32_t>(z * (gridSize + 1) + x);
+      auto rowSize = static_cast<uint32_t>(gridSize + 1);
+
+      indices.insert(indices.end(), {vertexIndex, vertexIndex + rowSize, vertexIndex + 1});
+      indices.insert(indices.end(), {vertexIndex + 1, vertexIndex + rowSize, vertexIndex + rowSize + 1});
+    }
+  }
+
+  return CollisionShapeTriangleMesh(std::move(vertices), std::move(indices));
+}
+
+std::shared_ptr<GameWorld> createLevelGameWorld(ResourceHandle<CollisionShape> levelPieceShape, size_t piecesCount)
+{
+  auto gameWorld = GameWorld::createInstance();
+  gameWorld->getGameSystemsGroup()->addGameSystem(std::make_shared<PhysicsSystem>());
+
+  for (size_t pieceIndex = 0; pieceIndex < piecesCount; pieceIndex++) {
+    GameObject levelPiece = gameWorld->createGameObject();
+    levelPiece.addComponent<TransformComponent>()->getTransform().setPosition(
+      float(pieceIndex % 32) * 70.0f, 0.0f, float(pieceIndex / 32) * 70.0f);
+
+    levelPiece.addComponent<RigidBodyComponent>(RigidBodyComponent(0.0f, levelPieceShape));
+  }
+
+  return gameWorld;
+}
+
+}
+
+TEST_CASE("physics_level_collision_shapes_setup", "[!benchmark][physics]")
+{
+  constexpr size_t LEVEL_PIECES_COUNT = 500;
+
+  auto resourcesManager = std::make_shared<ResourcesManager>();
+  resourcesManager->registerResourceType<CollisionShape>("collision",
+    std::make_unique<CollisionShapeResourceManager>(resourcesManager.get()));
+
+  CollisionShapeTriangleMesh triangleMesh = createTerrainTriangleMesh(64);
+
+  CollisionShapeTriangleMesh bakedTriangleMesh = triangleMesh;
+  bakedTriangleMesh.setOptimizedBvhData(BulletCollisionShapesCache::bakeOptimizedBvh(triangleMesh));
+
+  ResourceHandle<CollisionShape> levelPieceShape =
+    resourcesManager->createResourceInPlace<CollisionShape>(triangleMesh);
+  ResourceHandle<CollisionShape> bakedLevelPieceShape =
+    resourcesManager->createResourceInPlace<CollisionShape>(bakedTriangleMesh);
+
+  BENCHMARK(fmt::format("setup_{}_shared_mesh_pieces_runtime_bvh", LEVEL_PIECES_COUNT)) {
+    return createLevelGameWorld(levelPieceShape, LEVEL_PIECES_COUNT);
+  };
+
+  BENCHMARK(fmt::format("setup_{}_shared_mesh_pieces_baked_bvh", LEVEL_PIECES_COUNT)) {
+    return createLevelGameWorld(bakedLevelPieceShape, LEVEL_PIECES_COUNT);
+  };
+
+  auto gameWorld = createLevelGameWorld(bakedLevelPieceShape, LEVEL_PIECES_COUNT);
+
+  // Without sharing every piece owns a mesh copy and a BVH, so the memory grows with the pieces count
+  size_t triangleMeshesMemorySize = BulletCollisionShapesCache::getTriangleMeshesMemorySize();
+
+  spdlog::info("Level collision meshes: {} shared meshes, {} bytes, {} bytes without sharing",
+    BulletCollisionShapesCache::getTriangleMeshesCount(), triangleMeshesMemorySize,
+    triangleMeshesMemorySize * LEVEL_PIECES_COUNT);
+
+  REQUIRE(BulletCollisionShapesCache::getTriangleMeshesCount() == 1);
+}
@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+
+#include <thread>
+
+#include <Engine/Modules/ECS/ECS.h>
+#include <Engine/Modules/Physics/PhysicsSystem.h>
+#include <Engine/Modules/Physics/Resources/CollisionShapeResourceManager.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
+
+namespace {
+
+std::shared_ptr<GameWorld> createPhysicsStressGameWorld(ResourcesManager& resourcesManager,
+  const PhysicsSimulationSettings& simulationSettings,
+  size_t bodiesCount)
+{
+  auto gameWorld = GameWorld::createInstance();
+
+  auto physicsSystem = std::make_shared<PhysicsSystem>(simulationSettings);
+  gameWorld->getGameSystemsGroup()->addGameSystem(physicsSystem);
+  physicsSystem->setGravity({0.0f, -10.0f, 0.0f});
+
+  GameObject floorBody = gameWorld->createGameObject();
+  floorBody.addComponent<TransformComponent>();
+  floorBody.addComponent<RigidBodyComponent>(RigidBodyComponent(0.0f,
+    resourcesManager.createResourceInPlace<CollisionShape>(CollisionShapeBox({500.0f, 0.5f, 500.0f}))));
+
+  ResourceHandle<CollisionShape> bodyShape =
+    resourcesManager.createResourceInPlace<CollisionShape>(CollisionShapeSphere(0.5f));
+
+  // Columns of spheres produce a lot of contacts and simulation islands
+  constexpr size_t COLUMN_HEIGHT = 10;
+  auto rowSize = static_cast<size_t>(std::ceil(std::sqrt(float(bodiesCount / COLUMN_HEIGHT + 1))));
+
+  for (size_t bodyIndex = 0; bodyIndex < bodiesCount; bodyIndex++) {
+    size_t columnIndex = bodyIndex / COLUMN_HEIGHT;
+
+    GameObject body = gameWorld->createGameObject();
+    body.addComponent<TransformComponent>()->getTransform().setPosition(
+      float(columnIndex % rowSize) * 3.0f,
+      1.0f + float(bodyIndex % COLUMN_HEIGHT) * 1.05f,
+      float(columnIndex / rowSize) * 3.0f);
+
+    body.addComponent<RigidBodyComponent>(RigidBodyComponent(1.0f, bodyShape));
+  }
+
+  return gameWorld;
+}
+
+}
+
+TEST_CASE("physics_simulation_threads_scaling", "[!benchmark][physics]")
+{
+  constexpr size_t BODIES_COUNT = 4000;
+
+  auto resourcesManager = std::make_shared<ResourcesManager>();
+  resourcesManager->registerResourceType<CollisionShape>("collision",
+    std::make_unique<CollisionShapeResourceManager>(resourcesManager.get()));
+
+  std::vector<size_t> threadsCounts = {1, 2, 4};
+  size_t hardwareThreadsCount = std::thread::hardware_concurrency();
+
+  if (hardwareThreadsCount > threadsCounts.back()) {
+    threadsCounts.push_back(hardwareThreadsCount);
+  }
+
+  {
+    auto gameWorld = createPhysicsStressGameWorld(*resourcesManager, PhysicsSimulationSettings(), BODIES_COUNT);
+
+    BENCHMARK(fmt::format("step_{}_bodies_single_threaded_world", BODIES_COUNT)) {
+      gameWorld->update(1.0f / 60.0f);
+    };
+  }
+
+  for (size_t threadsCount : threadsCounts) {
+    PhysicsSimulationSettings simulationSettings;
+    simulationSettings.isMultithreadingEnabled = true;
+    simulationSettings.workerThreadsCount = threadsCount;
+
+    auto gameWorld = createPhysicsStressGameWorld(*resourcesManager, simulationSettings, BODIES_COUNT);
+
+    BENCHMARK(fmt::format("step_{}_bodies_{}_threads", BODIES_COUNT, threadsCount)) {
+      gameWorld->update(1.0f / 60.0f);
+    };
+  }
+
+  // The whole frame is measured, the dedicated thread simulation overlaps the rendering stage
+  PhysicsSimulationSettings dedicatedThreadSettings;
+  dedicatedThreadSettings.isMultithreadingEnabled = true;
+  dedicatedThreadSettings.isDedicatedThreadEnabled = true;
+
+  auto gameWorld = createPhysicsStressGameWorld(*resourcesManager, dedicatedThreadSettings, BODIES_COUNT);
+
+  BENCHMARK(fmt::format("frame_{}_bodies_dedicated_thread", BODIES_COUNT)) {
+    gameWorld->update(1.0f / 60.0f);
+    gameWorld->beforeRender();
+    gameWorld->render();
+    gameWorld->afterRender();
+  };
+}
@@ -0,0 +1,80 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/ECS/ECS.h>
+#include <Engine/Modules/Scripting/ScriptingSystem.h>
+
+namespace {
+
+// Dialogue and quest handlers in the style of the game scripts, stored in tables and called by name
+constexpr std::string_view ACTIONS_SCRIPT = R"(
+benchmark_quests = { stages = {}, completed = 0 }
+benchmark_dialogues = { replies = 0 }
+
+function benchmark_quests.on_talk(initiator, target)
+  local stage = benchmark_quests.stages[target] or 0
+  benchmark_quests.stages[target] = stage + 1
+
+  if stage > 3 then
+    benchmark_quests.completed = benchmark_quests.completed + 1
+  end
+end
+
+function benchmark_dialogues.on_reply(initiator)
+  benchmark_dialogues.replies = benchmark_dialogues.replies + string.len(initiator)
+end
+)";
+
+}
+
+TEST_CASE("scripting_action_handlers", "[!benchmark][scripting]")
+{
+  constexpr size_t ACTIONS_COUNT = 1000;
+
+  std::shared_ptr<GameWorld> gameWorld = GameWorld::createInstance();
+
+  auto scriptingSystem = std::make_shared<ScriptingSystem>(gameWorld);
+  gameWorld->getGameSystemsGroup()->addGameSystem(scriptingSystem);
+
+  sol::state& luaState = scriptingSystem->getScriptsExecutor()->getLuaState();
+  luaState.script(ACTIONS_SCRIPT);
+
+  GameObject initiator = gameWorld->createGameObject("player");
+  GameObject target = gameWorld->createGameObject("trader");
+
+  // The handlers are resolved by name on every call, as the scripting system did before the handlers caching
+  BENCHMARK(fmt::format("{}_actions_resolved_by_name", ACTIONS_COUNT)) {
+    for (size_t actionIndex = 0; actionIndex < ACTIONS_COUNT; actionIndex++) {
+      sol::protected_function talkHandler = luaState.load("return benchmark_quests.on_talk")();
+      talkHandler(initiator.getName(), target.getName());
+
+      sol::protected_function replyHandler = luaState.load("return benchmark_dialogues.on_reply")();
+      replyHandler(initiator.getName());
+    }
+  };
+
+  BENCHMARK(fmt::format("{}_actions_cached_handlers", ACTIONS_COUNT)) {
+    for (size_t actionIndex = 0; actionIndex < ACTIONS_COUNT; actionIndex++) {
+      gameWorld->emitEvent(ExecuteScriptDirectedActionCommand{
+        .initiator = initiator, .target = target, .actionName = "benchmark_quests.on_talk"});
+      gameWorld->emitEvent(ExecuteScriptUndirectedActionCommand{
+        .initiator = initiator, .actionName = "benchmark_dialogues.on_reply"});
+    }
+  };
+}
+
+TEST_CASE("scripting_chunks_loading", "[!benchmark][scripting]")
+{
+  sol::state luaState;
+  luaState.open_libraries(sol::lib::base, sol::lib::string);
+
+  auto sourceChunk = luaState.load(ACTIONS_SCRIPT).get<sol::protected_function>();
+  sol::bytecode bytecode = sourceChunk.dump();
+
+  BENCHMARK("compile_from_source") {
+    return luaState.load(ACTIONS_SCRIPT, "actions", sol::load_mode::text).valid();
+  };
+
+  BENCHMARK("load_from_bytecode") {
+    return luaState.load(bytecode.as_string_view(), "actions", sol::load_mode::binary).valid();
+  };
+}
@@ -0,0 +1,3 @@
+#define SDL_MAIN_HANDLED
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch2/catch.hpp>
@@ -0,0 +1,122 @@
+#include "BenchmarkGameWorldGenerator.h"
+
+#include <cmath>
+
+#include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/GraphicsScene.h>
+#include <Engine/Modules/Graphics/Resources/SkeletonResourceManager.h>
+#include <Engine/Modules/Graphics/Resources/SkeletalAnimationResourceManager.h>
+#include <Engine/Modules/Math/MathUtils.h>
+
+namespace {
+
+size_t getSceneGridRowSize(size_t objectsCount)
+{
+  return static_cast<size_t>(std::ceil(std::sqrt(float(objectsCount))));
+}
+
+}
+
+std::vector<GameObject> BenchmarkGameWorldGenerator::createSceneObjects(GameWorld& gameWorld, size_t objectsCount)
+{
+  std::vector<GameObject> objects;
+  objects.reserve(objectsCount);
+
+  size_t rowSize = getSceneGridRowSize(objectsCount);
+  float halfRowLength = float(rowSize) * SCENE_OBJECTS_SPACING * 0.5f;
+
+  for (size_t objectIndex = 0; objectIndex < objectsCount; objectIndex++) {
+    GameObject object = gameWorld.createGameObject();
+
+    auto transformComponent = object.addComponent<TransformComponent>();
+    transformComponent->setStaticMode(objectIndex % 4 != 0);
+    transformComponent->setBounds(AABB({-0.5f, 0.0f, -0.5f}, {0.5f, 2.0f, 0.5f}));
+
+    Transform& transform = transformComponent->getTransform();
+    transform.setPosition(float(objectIndex % rowSize) * SCENE_OBJECTS_SPACING - halfRowLength,
+      0.0f,
+      float(objectIndex / rowSize) * SCENE_OBJECTS_SPACING - halfRowLength);
+
+    transformComponent->updateBounds(transform.getTransformationMatrix());
+
+    object.addComponent<ObjectSceneNodeComponent>(true);
+
+    objects.push_back(object);
+  }
+
+  return objects;
+}
+
+void BenchmarkGameWorldGenerator::setupSceneCamera(Camera& camera, size_t objectsCount)
+{
+  float halfRowLength = float(getSceneGridRowSize(objectsCount)) * SCENE_OBJECTS_SPACING * 0.5f;
+
+  camera.setAspectRatio(16.0f / 9.0f);
+  camera.setFOVy(glm::radians(60.0f));
+  camera.setNearClipDistance(0.1f);
+  camera.setFarClipDistance(halfRowLength * 2.0f);
+
+  // The frustum covers only a part of the grid, so both visible and culled objects are tested
+  camera.getTransform()->setPosition(0.0f, 10.0f, halfRowLength);
+  camera.getTransform()->lookAt(0.0f, 0.0f, 0.0f);
+}
+
+std::shared_ptr<ResourcesManager> BenchmarkGameWorldGenerator::buildResourcesManager()
+{
+  auto resourcesManager = std::make_shared<ResourcesManager>();
+
+  resourcesManager->registerResourceType<Skeleton>("skeleton",
+    std::make_unique<SkeletonResourceManager>(resourcesManager.get()));
+  resourcesManager->registerResourceType<AnimationClip>("animation",
+    std::make_unique<SkeletalAnimationResourceManager>(resourcesManager.get()));
+
+  return resourcesManager;
+}
+
+Skeleton BenchmarkGameWorldGenerator::generateSkeleton(uint8_t bonesCount)
+{
+  std::vector<Bone> bones;
+  bones.reserve(bonesCount);
+
+  for (uint8_t boneIndex = 0; boneIndex < bonesCount; boneIndex++) {
+    // Bones form chains growing from the root bone, like limbs of a character
+    uint8_t parentId = Bone::ROOT_BONE_PARENT_ID;
+
+    if (boneIndex > 0) {
+      parentId = (boneIndex % SKELETON_CHAIN_LENGTH == 1) ? uint8_t(0) : uint8_t(boneIndex - 1);
+    }
+
+    bones.emplace_back("bone_" + std::to_string(boneIndex), parentId,
+      glm::inverse(MathUtils::getTranslationMatrix({0.0f, float(boneIndex % SKELETON_CHAIN_LENGTH), 0.0f})));
+  }
+
+  return Skeleton(bones);
+}
+
+AnimationClip BenchmarkGameWorldGenerator::generateAnimationClip(const std::string& name, uint8_t bonesCount,
+  float amplitude)
+{
+  constexpr size_t FRAMES_COUNT = 30;
+  constexpr float FRAMES_INTERVAL = 2.0f;
+
+  std::vector<BoneAnimationChannel> bonesAnimationChannels;
+  bonesAnimationChannels.reserve(bonesCount);
+
+  for (uint8_t boneIndex = 0; boneIndex < bonesCount; boneIndex++) {
+    std::vector<BoneAnimationPositionFrame> positionFrames;
+    std::vector<BoneAnimationOrientationFrame> orientationFrames;
+
+    for (size_t frameIndex = 0; frameIndex <= FRAMES_COUNT; frameIndex++) {
+      float time = float(frameIndex) * FRAMES_INTERVAL;
+      float phase = std::sin(float(frameIndex + boneIndex) * 0.5f) * amplitude;
+
+      positionFrames.push_back(BoneAnimationPositionFrame{time, {0.0f, 1.0f + phase * 0.1f, 0.0f}});
+      orientationFrames.push_back(BoneAnimationOrientationFrame{time,
+        glm::angleAxis(glm::radians(phase * 45.0f), MathUtils::AXIS_X)});
+    }
+
+    bonesAnimationChannels.emplace_back(positionFrames, orientationFrames);
+  }
+
+  return AnimationClip(name, float(FRAMES_COUNT) * FRAMES_INTERVAL, 30.0f, bonesAnimationChannels);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <Engine/Modules/ECS/ECS.h>
+#include <Engine/Modules/ResourceManagement/ResourcesManagement.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/Camera.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/Animation/Skeleton.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/Animation/AnimationClip.h>
+
+/*!
+ * \brief Synthetic worlds and assets for the benchmarks
+ *
+ * The generated content is deterministic, so the results of different builds are comparable.
+ */
+class BenchmarkGameWorldGenerator {
+ public:
+  /*!
+   * \brief Creates drawable objects with bounds, laid out on a square grid around the origin
+   *
+   * Every fourth object is dynamic, the rest objects are static.
+   */
+  static std::vector<GameObject> createSceneObjects(GameWorld& gameWorld, size_t objectsCount);
+
+  /*!
+   * \brief Sets up the camera at the scene grid border, looking at the grid center
+   */
+  static void setupSceneCamera(Camera& camera, size_t objectsCount);
+
+  static std::shared_ptr<ResourcesManager> buildResourcesManager();
+
+  /*!
+   * \brief Generates the skeleton with bones chains of the specified length
+   */
+  static Skeleton generateSkeleton(uint8_t bonesCount);
+
+  static AnimationClip generateAnimationClip(const std::string& name, uint8_t bonesCount, float amplitude);
+
+ public:
+  static constexpr float SCENE_OBJECTS_SPACING = 4.0f;
+  static constexpr uint8_t SKELETON_CHAIN_LENGTH = 8;
+};
@@ -0,0 +1,81 @@
+#include "JSONBenchmarksReporter.h"
+
+#include <chrono>
+
+#include <cereal/archives/json.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
+#include <Engine/swdebug.h>
+
+namespace {
+
+template<class Duration>
+double getNanoseconds(const Duration& duration)
+{
+  return std::chrono::duration<double, std::nano>(duration).count();
+}
+
+}
+
+JSONBenchmarksReporter::JSONBenchmarksReporter(const Catch::ReporterConfig& config)
+  : StreamingReporterBase(config)
+{
+
+}
+
+std::string JSONBenchmarksReporter::getDescription()
+{
+  return "Reports benchmarks estimations as a JSON document";
+}
+
+void JSONBenchmarksReporter::assertionStarting(const Catch::AssertionInfo& assertionInfo)
+{
+  ARG_UNUSED(assertionInfo);
+}
+
+bool JSONBenchmarksReporter::assertionEnded(const Catch::AssertionStats& assertionStats)
+{
+  ARG_UNUSED(assertionStats);
+
+  return true;
+}
+
+void JSONBenchmarksReporter::benchmarkEnded(const Catch::BenchmarkStats<>& benchmarkStats)
+{
+  m_results.push_back(BenchmarkResult{
+    .testCase = currentTestCaseInfo->name,
+    .name = benchmarkStats.info.name,
+    .samplesCount = static_cast<size_t>(benchmarkStats.info.samples),
+    .iterationsCount = static_cast<size_t>(benchmarkStats.info.iterations),
+    .mean = getNanoseconds(benchmarkStats.mean.point),
+    .meanLowerBound = getNanoseconds(benchmarkStats.mean.lower_bound),
+    .meanUpperBound = getNanoseconds(benchmarkStats.mean.upper_bound),
+    .standardDeviation = getNanoseconds(benchmarkStats.standardDeviation.point),
+    .outliersCount = static_cast<size_t>(benchmarkStats.outliers.total()),
+    .outliersVariance = benchmarkStats.outlierVariance,
+  });
+}
+
+void JSONBenchmarksReporter::benchmarkFailed(const std::string& error)
+{
+  m_failedBenchmarks.push_back(currentTestCaseInfo->name + ": " + error);
+}
+
+void JSONBenchmarksReporter::testRunEnded(const Catch::TestRunStats& testRunStats)
+{
+  {
+    // The document is closed on the archive destruction
+    cereal::JSONOutputArchive archive(stream);
+
+    archive(cereal::make_nvp("run", testRunStats.runInfo.name),
+      cereal::make_nvp("benchmarks", m_results),
+      cereal::make_nvp("failed_benchmarks", m_failedBenchmarks));
+  }
+
+  stream << std::endl;
+
+  StreamingReporterBase::testRunEnded(testRunStats);
+}
+
+CATCH_REGISTER_REPORTER("json", JSONBenchmarksReporter)
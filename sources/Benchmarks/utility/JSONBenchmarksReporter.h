@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <cereal/cereal.hpp>
+
+struct BenchmarkResult {
+  std::string testCase;
+  std::string name;
+
+  size_t samplesCount{};
+  size_t iterationsCount{};
+
+  // Times are in nanoseconds per iteration
+  double mean{};
+  double meanLowerBound{};
+  double meanUpperBound{};
+  double standardDeviation{};
+
+  size_t outliersCount{};
+  double outliersVariance{};
+
+  template<class Archive>
+  void serialize(Archive& archive)
+  {
+    archive(
+      cereal::make_nvp("test_case", testCase),
+      cereal::make_nvp("name", name),
+      cereal::make_nvp("samples", samplesCount),
+      cereal::make_nvp("iterations", iterationsCount),
+      cereal::make_nvp("mean_ns", mean),
+      cereal::make_nvp("mean_lower_bound_ns", meanLowerBound),
+      cereal::make_nvp("mean_upper_bound_ns", meanUpperBound),
+      cereal::make_nvp("standard_deviation_ns", standardDeviation),
+      cereal::make_nvp("outliers", outliersCount),
+      cereal::make_nvp("outliers_variance", outliersVariance));
+  };
+};
+
+/*!
+ * \brief Catch reporter that writes the benchmarks estimations as a JSON document
+ *
+ * The reporter is selected with "--reporter json", the results are written to the
+ * reporter output stream once the run is finished, so "--out <path>" produces a file
+ * that can be compared between builds.
+ */
+class JSONBenchmarksReporter : public Catch::StreamingReporterBase<JSONBenchmarksReporter> {
+ public:
+  explicit JSONBenchmarksReporter(const Catch::ReporterConfig& config);
+  ~JSONBenchmarksReporter() override = default;
+
+  static std::string getDescription();
+
+  void assertionStarting(const Catch::AssertionInfo& assertionInfo) override;
+  bool assertionEnded(const Catch::AssertionStats& assertionStats) override;
+
+  void benchmarkEnded(const Catch::BenchmarkStats<>& benchmarkStats) override;
+  void benchmarkFailed(const std::string& error) override;
+
+  void testRunEnded(const Catch::TestRunStats& testRunStats) override;
+
+ private:
+  std::vector<BenchmarkResult> m_results;
+  std::vector<std::string> m_failedBenchmarks;
+};
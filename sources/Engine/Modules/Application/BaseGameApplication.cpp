@@ -20,6 +20,7 @@
 #include "Modules/Graphics/Resources/SkeletalAnimationResourceManager.h"
 #include "Modules/Graphics/Resources/AnimationStatesMachineResourceManager.h"
 
+#include "Modules/Physics/PhysicsBackendFactory.h"
 #include "Modules/Physics/Resources/CollisionShapeResourceManager.h"
 #include "Modules/Audio/Resources/AudioClipResourceManager.h"
 
@@ -118,6 +119,10 @@ int BaseGameApplication::execute()
 
     performRender();
 
+    CPUProfiler::finishFrame();
+    MemoryTracker::finishFrame();
+    FrameArena::finishFrame();
+
     bool isFrameRateUnlimited = m_inputModule->isActionActive("unlimited_framerate");
 
     if (!isFrameRateUnlimited) {
@@ -163,6 +168,34 @@ EventProcessStatus BaseGameApplication::receiveEvent(const GameConsoleCommandEve
 
     return EventProcessStatus::Processed;
   }
+  else if (event.command == "profiler-frame") {
+    printProfilerFrameStatistics();
+
+    return EventProcessStatus::Processed;
+  }
+  else if (event.command == "memory-stats") {
+    printMemoryStatistics();
+
+    return EventProcessStatus::Processed;
+  }
+  else if (event.command == "profiler-trace-start") {
+    CPUProfiler::startTraceCapture();
+    m_gameConsole->print("Profiler trace capture is started");
+
+    return EventProcessStatus::Processed;
+  }
+  else if (event.command == "profiler-trace-stop") {
+    CPUProfiler::stopTraceCapture();
+
+    if (CPUProfiler::exportChromeTrace(std::string(FileUtils::PROFILER_TRACE_PATH))) {
+      m_gameConsole->print("Profiler trace is written to " + std::string(FileUtils::PROFILER_TRACE_PATH));
+    }
+    else {
+      m_gameConsole->print("Profiler trace can not be written");
+    }
+
+    return EventProcessStatus::Processed;
+  }
 
   return EventProcessStatus::Skipped;
 }
@@ -265,6 +298,9 @@ void BaseGameApplication::initializePlatform(int argc,
 
 void BaseGameApplication::initializeEngine()
 {
+  // Physics objects could be created by any of the modules, so the backend is prepared first
+  PhysicsBackendFactory::initializeBackend();
+
   m_inputModule = std::make_shared<InputModule>(m_mainWindow);
 
   m_graphicsModule = std::make_shared<GraphicsModule>(m_mainWindow);
@@ -321,6 +357,11 @@ void BaseGameApplication::initializeEngine()
                                                                 MeshRendererComponentBinder,
                                                                 GameObjectsComponentsBinderInjectParameters::ResourcesManager>>(
       resourceManager));
+  m_gameWorld->registerComponentBinderFactory<OccluderComponent>(
+    std::make_shared<GameObjectsComponentsGenericBindersFactory<OccluderComponent,
+                                                                OccluderComponentBinder,
+                                                                GameObjectsComponentsBinderInjectParameters::ResourcesManager>>(
+      resourceManager));
   m_gameWorld->registerComponentBinderFactory<SkeletalAnimationComponent>(
     std::make_shared<GameObjectsComponentsGenericBindersFactory<SkeletalAnimationComponent,
                                                                 AnimationComponentBinder,
@@ -500,6 +541,8 @@ void BaseGameApplication::performUnload()
 
 void BaseGameApplication::performUpdate(float delta)
 {
+  SW_PROFILE_SCOPE("BaseGameApplication::update");
+
   m_gameWorld->update(delta);
   m_screenManager->update(delta);
 
@@ -508,6 +551,8 @@ void BaseGameApplication::performUpdate(float delta)
 
 void BaseGameApplication::performRender()
 {
+  SW_PROFILE_SCOPE("BaseGameApplication::render");
+
   GLGraphicsContext* graphicsContext = m_graphicsModule->getGraphicsContext().get();
 
   m_graphicsScene->getFrameStats().reset();
@@ -524,9 +569,50 @@ void BaseGameApplication::performRender()
   DebugPainter::resetRenderQueue();
 
   m_gameWorld->afterRender();
+
+  SW_PROFILE_SCOPE("GLGraphicsContext::swapBuffers");
   graphicsContext->swapBuffers();
 }
 
+void BaseGameApplication::printProfilerFrameStatistics()
+{
+  if (!CPUProfiler::isEnabled()) {
+    m_gameConsole->print("Profiler is disabled");
+    return;
+  }
+
+  m_gameConsole->print(fmt::format("Frame: {:.3f} ms", static_cast<double>(CPUProfiler::getFrameTime()) / 1e6));
+
+  for (const ProfilerScopeStatistics& scopeStatistics : CPUProfiler::getFrameStatistics()) {
+    m_gameConsole->print(fmt::format("{}{}: {:.3f} ms ({})",
+      std::string(2 * (scopeStatistics.depth + 1), ' '),
+      CPUProfiler::getScopeName(scopeStatistics.scopeId),
+      static_cast<double>(scopeStatistics.totalTime) / 1e6,
+      scopeStatistics.callsCount));
+  }
+}
+
+void BaseGameApplication::printMemoryStatistics()
+{
+  m_gameConsole->print(fmt::format("Heap allocations: {} in the last frame, {} total",
+    MemoryTracker::getFrameHeapAllocationsCount(), MemoryTracker::getHeapAllocationsCount()));
+
+  m_gameConsole->print(fmt::format("Frame arena: {:.2f} KB in the last frame",
+    static_cast<double>(FrameArena::getLastFrameAllocatedSize()) / 1024.0));
+
+  size_t countersCount = MemoryTracker::getCountersCount();
+
+  for (MemoryCounterId counterId = 0; counterId < countersCount; counterId++) {
+    MemoryCounterStatistics counterStatistics = MemoryTracker::getCounterStatistics(counterId);
+
+    m_gameConsole->print(fmt::format("  {}: {:.2f} KB in {} blocks, {} allocations in the last frame",
+      MemoryTracker::getCounterName(counterId),
+      static_cast<double>(counterStatistics.liveBytes) / 1024.0,
+      counterStatistics.liveAllocationsCount,
+      counterStatistics.frameAllocationsCount));
+  }
+}
+
 void BaseGameApplication::handleAppTerminate()
 {
   auto trace = boost::stacktrace::stacktrace();
@@ -31,6 +31,9 @@
 #include "Modules/LevelsManagement/GameObjectsSpawnSystem.h"
 
 #include "Modules/Scripting/ScriptingSystem.h"
+#include "Modules/Profiling/CPUProfiler.h"
+#include "Modules/Profiling/MemoryTracker.h"
+#include "Utility/FrameArena.h"
 
 #include "GameConsole.h"
 
@@ -67,6 +70,16 @@ class BaseGameApplication : public EventsListener<GameConsoleCommandEvent>,
   void performUpdate(float delta);
   void performRender();
 
+  /*!
+   * \brief Prints the calls hierarchy of the last frame to the game console
+   */
+  void printProfilerFrameStatistics();
+
+  /*!
+   * \brief Prints the live memory and the allocations counts of the subsystems to the game console
+   */
+  void printMemoryStatistics();
+
   static void handleAppTerminate();
 
  protected:
@@ -3,25 +3,72 @@
 #pragma hdrstop
 
 #include "AudioClip.h"
+
+#include <utility>
+
 #include "ALDebug.h"
 
 AudioClip::AudioClip(AudioClipFormat format, const std::byte* samples, size_t samplesSize, uint32_t frequency)
+  : m_format(format),
+    m_frequency(frequency),
+    m_framesCount(samplesSize / AUDIO_CLIP_FRAME_SIZE_LOOKUP_TABLE[static_cast<size_t>(format)])
 {
   AL_CALL(alGenBuffers(1, &m_buffer));
 
   AL_CALL(alBufferData(m_buffer,
-    AUDIO_CLIP_FORMAT_LOOKUP_TABLE[static_cast<size_t>(format)],
+    getALFormat(),
     samples,
     static_cast<ALsizei>(samplesSize),
     static_cast<ALsizei>(frequency)));
 }
 
+AudioClip::AudioClip(AudioClipFormat format, std::string streamPath, size_t framesCount, uint32_t frequency)
+  : m_format(format),
+    m_frequency(frequency),
+    m_framesCount(framesCount),
+    m_streamPath(std::move(streamPath))
+{
+
+}
+
 AudioClip::~AudioClip()
 {
-  AL_CALL(alDeleteBuffers(1, &m_buffer));
+  if (m_buffer != 0) {
+    AL_CALL(alDeleteBuffers(1, &m_buffer));
+  }
+}
+
+bool AudioClip::isStreamed() const
+{
+  return m_buffer == 0;
+}
+
+AudioClipFormat AudioClip::getFormat() const
+{
+  return m_format;
+}
+
+uint32_t AudioClip::getFrequency() const
+{
+  return m_frequency;
+}
+
+const std::string& AudioClip::getStreamPath() const
+{
+  return m_streamPath;
+}
+
+float AudioClip::getDuration() const
+{
+  return static_cast<float>(m_framesCount) / static_cast<float>(m_frequency);
 }
 
 ALuint AudioClip::getALBuffer() const
 {
   return m_buffer;
 }
+
+ALenum AudioClip::getALFormat() const
+{
+  return AUDIO_CLIP_FORMAT_LOOKUP_TABLE[static_cast<size_t>(m_format)];
+}
@@ -2,6 +2,7 @@
 
 #include <span>
 #include <array>
+#include <string>
 
 #include <AL/al.h>
 #include <AL/alc.h>
@@ -17,18 +18,45 @@ enum class AudioClipFormat {
 };
 
 class AudioSource;
+class AudioStream;
 
+/*!
+ * \brief Audio clip resource
+ *
+ * Short clips are fully decoded into the single AL buffer. Long clips are streamed, they keep only the source
+ * file path, and every playing source decodes its own stream incrementally.
+ */
 class AudioClip : public Resource {
  public:
   AudioClip(AudioClipFormat format, const std::byte* samples, size_t samplesSize, uint32_t frequency);
+  AudioClip(AudioClipFormat format, std::string streamPath, size_t framesCount, uint32_t frequency);
   ~AudioClip() override;
 
+  [[nodiscard]] bool isStreamed() const;
+
+  [[nodiscard]] AudioClipFormat getFormat() const;
+  [[nodiscard]] uint32_t getFrequency() const;
+
+  [[nodiscard]] const std::string& getStreamPath() const;
+
+  /*!
+   * \brief Returns the duration of the clip in seconds
+   */
+  [[nodiscard]] float getDuration() const;
+
  private:
   [[nodiscard]] ALuint getALBuffer() const;
+  [[nodiscard]] ALenum getALFormat() const;
 
  private:
   ALuint m_buffer = 0;
 
+  AudioClipFormat m_format;
+  uint32_t m_frequency;
+  size_t m_framesCount;
+
+  std::string m_streamPath;
+
  private:
   static constexpr std::array<ALenum, 4> AUDIO_CLIP_FORMAT_LOOKUP_TABLE = {
     AL_FORMAT_MONO8,
@@ -37,6 +65,9 @@ class AudioClip : public Resource {
     AL_FORMAT_STEREO16
   };
 
+  static constexpr std::array<size_t, 4> AUDIO_CLIP_FRAME_SIZE_LOOKUP_TABLE = {1, 2, 2, 4};
+
  private:
   friend class AudioSource;
+  friend class AudioStream;
 };
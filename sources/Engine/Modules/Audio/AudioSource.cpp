@@ -5,91 +5,73 @@
 #include "AudioSource.h"
 
 #include <utility>
+#include <cmath>
 
 #include "ALDebug.h"
-
-// TODO: do not generate AL sources in constructors. Create and use sources pool instead.
+#include "AudioStreamer.h"
 
 AudioSource::AudioSource(ResourceHandle<AudioClip> clip)
+  : m_audioClip(std::move(clip))
 {
-  AL_CALL(alGenSources(1, &m_source));
-
-  AL_CALL_BLOCK_BEGIN();
-  setClip(clip);
-
-  setPitch(1.0f);
-  setVolume(1.0f);
-  setPosition({0.0f, 0.0f, 0.0f});
-  setVelocity({0.0, 0.0f, 0.0f});
-  setLooped(false);
 
-  SW_ASSERT(alIsSource(m_source));
-  AL_CALL_BLOCK_END();
 }
 
-
 AudioSource::AudioSource(const AudioSource& source)
+  : m_audioClip(source.m_audioClip),
+    m_pitch(source.m_pitch),
+    m_volume(source.m_volume),
+    m_position(source.m_position),
+    m_velocity(source.m_velocity),
+    m_isLooped(source.m_isLooped),
+    m_isRelativeToListener(source.m_isRelativeToListener),
+    m_maxDistance(source.m_maxDistance),
+    m_priority(source.m_priority)
 {
-  AL_CALL(alGenSources(1, &m_source));
-
-  AL_CALL_BLOCK_BEGIN();
-  setClip(source.getClip());
-
-  setPitch(source.getPitch());
-  setVolume(source.getVolume());
-  setPosition(source.getPosition());
-  setVelocity(source.getVelocity());
-  setLooped(source.isLooped());
-  setRelativeToListenerMode(source.isRelativeToListener());
-
-  SW_ASSERT(alIsSource(m_source));
-  AL_CALL_BLOCK_END();
 
 }
 
 AudioSource::~AudioSource()
 {
-  if (m_source != 0) {
-    alDeleteSources(1, &m_source);
-  }
-}
-
-ALuint AudioSource::getALSource() const
-{
-  return m_source;
+  detachVoice();
 }
 
 void AudioSource::setPitch(float pitch)
 {
-  alSourcef(m_source, AL_PITCH, pitch);
+  fixPlaybackTime();
+  m_pitch = pitch;
+
+  if (m_voice != nullptr) {
+    alSourcef(m_voice->source, AL_PITCH, pitch);
+  }
 }
 
 float AudioSource::getPitch() const
 {
-  float pitch;
-  alGetSourcef(m_source, AL_PITCH, &pitch);
-
-  return pitch;
+  return m_pitch;
 }
 
 void AudioSource::setVolume(float volume)
 {
-  alSourcef(m_source, AL_GAIN, volume);
+  m_volume = volume;
+
+  if (m_voice != nullptr) {
+    alSourcef(m_voice->source, AL_GAIN, volume);
+  }
 }
 
 float AudioSource::getVolume() const
 {
-  float volume;
-  alGetSourcef(m_source, AL_GAIN, &volume);
-
-  return volume;
+  return m_volume;
 }
 
 void AudioSource::setClip(ResourceHandle<AudioClip> clip)
 {
-  m_audioClip = std::move(clip);
+  // The voice is attached again with the new clip on the next update if the source is playing
+  detachVoice();
 
-  alSourcei(m_source, AL_BUFFER, m_audioClip->getALBuffer());
+  m_audioClip = std::move(clip);
+  m_playbackTime = 0.0f;
+  m_playbackClockStamp = s_playbackClock;
 }
 
 ResourceHandle<AudioClip> AudioSource::getClip() const
@@ -99,44 +81,110 @@ ResourceHandle<AudioClip> AudioSource::getClip() const
 
 void AudioSource::setPosition(const glm::vec3& position)
 {
-  alSource3f(m_source, AL_POSITION, position.x, position.y, position.z);
+  // The voice is updated by the audio system once per frame with the other changed sources
+  if (m_position != position) {
+    m_position = position;
+    m_isSpatialStateChanged = true;
+  }
 }
 
 glm::vec3 AudioSource::getPosition() const
 {
-  glm::vec3 position;
-  alGetSource3f(m_source, AL_POSITION, &position.x, &position.y, &position.z);
-
-  return position;
+  return m_position;
 }
 
 void AudioSource::setVelocity(const glm::vec3& velocity)
 {
-  alSource3f(m_source, AL_VELOCITY, velocity.x, velocity.y, velocity.z);
+  if (m_velocity != velocity) {
+    m_velocity = velocity;
+    m_isSpatialStateChanged = true;
+  }
 }
 
 glm::vec3 AudioSource::getVelocity() const
 {
-  glm::vec3 velocity;
-  alGetSource3f(m_source, AL_VELOCITY, &velocity.x, &velocity.y, &velocity.z);
+  return m_velocity;
+}
+
+void AudioSource::setLooped(bool isLooped)
+{
+  m_isLooped = isLooped;
+
+  if (m_voice != nullptr) {
+    // Streamed clips are looped by the stream
+    alSourcei(m_voice->source, AL_LOOPING, m_isLooped && !m_audioClip->isStreamed());
+  }
 
-  return velocity;
+  if (m_stream != nullptr) {
+    m_stream->setLooped(m_isLooped);
+  }
+}
+
+bool AudioSource::isLooped() const
+{
+  return m_isLooped;
+}
+
+void AudioSource::setRelativeToListenerMode(bool relativeToListener)
+{
+  m_isRelativeToListener = relativeToListener;
+
+  if (m_voice != nullptr) {
+    alSourcei(m_voice->source, AL_SOURCE_RELATIVE, relativeToListener);
+  }
+}
+
+bool AudioSource::isRelativeToListener() const
+{
+  return m_isRelativeToListener;
+}
+
+void AudioSource::setMaxDistance(float distance)
+{
+  m_maxDistance = distance;
+
+  if (m_voice != nullptr) {
+    alSourcef(m_voice->source, AL_MAX_DISTANCE, distance);
+  }
+}
+
+float AudioSource::getMaxDistance() const
+{
+  return m_maxDistance;
+}
+
+void AudioSource::setPriority(int priority)
+{
+  m_priority = priority;
+}
+
+int AudioSource::getPriority() const
+{
+  return m_priority;
 }
 
 void AudioSource::play()
 {
-  AL_CALL(alSourcePlay(m_source));
+  if (m_sourceState != AudioSourceState::Paused) {
+    // The restarted source gets a voice again on the next update
+    detachVoice();
+    m_playbackTime = 0.0f;
+  }
+
   m_sourceState = AudioSourceState::Playing;
+  m_playbackClockStamp = s_playbackClock;
 }
 
 bool AudioSource::isPlaying() const
 {
-  return m_sourceState == AudioSourceState::Playing;
+  return m_sourceState == AudioSourceState::Playing && !isPlaybackFinished();
 }
 
 void AudioSource::pause()
 {
-  AL_CALL(alSourcePause(m_source));
+  fixPlaybackTime();
+  detachVoice();
+
   m_sourceState = AudioSourceState::Paused;
 }
 
@@ -147,84 +195,215 @@ bool AudioSource::isPaused() const
 
 void AudioSource::stop()
 {
-  AL_CALL(alSourceStop(m_source));
+  detachVoice();
+
   m_sourceState = AudioSourceState::Stopped;
+  m_playbackTime = 0.0f;
 }
 
 bool AudioSource::isStopped() const
 {
-  return m_sourceState == AudioSourceState::Stopped;
+  return m_sourceState == AudioSourceState::Stopped ||
+    (m_sourceState == AudioSourceState::Playing && isPlaybackFinished());
 }
 
-void AudioSource::updateInternalState()
+bool AudioSource::isVirtual() const
 {
-  ALint sourceState{};
-  alGetSourcei(m_source, AL_SOURCE_STATE, &sourceState);
+  return isPlaying() && m_voice == nullptr;
+}
 
-  switch (sourceState) {
-    case AL_PLAYING:
-      m_sourceState = AudioSourceState::Playing;
-      break;
-    case AL_PAUSED:
-      m_sourceState = AudioSourceState::Paused;
-      break;
-    case AL_INITIAL:
-    case AL_STOPPED:
-      m_sourceState = AudioSourceState::Stopped;
-      break;
-    default:
-      SW_ASSERT(false);
-      break;
-  }
+float AudioSource::getPlaybackTime() const
+{
+  return evaluatePlaybackTime();
+}
+
+void AudioSource::playOnce(ResourceHandle<AudioClip> clip)
+{
+  // Finished one-shots of the sources out of the listener range are not collected by the audio system
+  m_subSources.remove_if([](const AudioSource& subSource) {
+    return subSource.isStopped();
+  });
+
+  // One-shots are logical sources too, so they reuse the pooled voices
+  AudioSource& subSource = m_subSources.emplace_back(*this);
+  subSource.setLooped(false);
+  subSource.setClip(std::move(clip));
+
+  subSource.play();
+}
 
-  auto sourcesIt = m_subSources.begin();
+void AudioSource::updatePlayback()
+{
+  if (m_sourceState == AudioSourceState::Playing) {
+    float duration = m_audioClip->getDuration();
+    float playbackTime = m_playbackTime + static_cast<float>(s_playbackClock - m_playbackClockStamp) * m_pitch;
+
+    if (playbackTime >= duration) {
+      if (m_isLooped) {
+        // The time is wrapped to keep the clock offset small
+        fixPlaybackTime();
+      }
+      else {
+        bool isVoicePlaying = false;
+
+        // The voice state is queried only near the clip end, the voice could be a little behind the tracked time
+        if (m_voice != nullptr) {
+          ALint voiceState{};
+          alGetSourcei(m_voice->source, AL_SOURCE_STATE, &voiceState);
+
+          isVoicePlaying = voiceState == AL_PLAYING;
+        }
+
+        if (!isVoicePlaying) {
+          stop();
+        }
+      }
+    }
+  }
 
-  while (sourcesIt != m_subSources.end())
-  {
-    sourcesIt->updateInternalState();
+  for (auto subSourceIt = m_subSources.begin(); subSourceIt != m_subSources.end();) {
+    subSourceIt->updatePlayback();
 
-    if (sourcesIt->isStopped())
-    {
-      sourcesIt = m_subSources.erase(sourcesIt);
+    if (subSourceIt->isStopped()) {
+      subSourceIt = m_subSources.erase(subSourceIt);
     }
-    else
-    {
-      ++sourcesIt;
+    else {
+      ++subSourceIt;
     }
   }
 }
 
-void AudioSource::setLooped(bool isLooped)
+void AudioSource::collectPlayingSources(std::vector<AudioSource*>& sources)
 {
-  alSourcei(m_source, AL_LOOPING, isLooped);
+  if (isPlaying()) {
+    sources.push_back(this);
+  }
+
+  for (AudioSource& subSource : m_subSources) {
+    if (subSource.isPlaying()) {
+      sources.push_back(&subSource);
+    }
+  }
 }
 
-bool AudioSource::isLooped() const
+void AudioSource::attachVoice(AudioVoice& voice)
 {
-  ALint isLooped{};
-  alGetSourcei(m_source, AL_LOOPING, &isLooped);
+  SW_ASSERT(m_voice == nullptr && voice.owner == this);
+
+  m_voice = &voice;
+  ALuint source = voice.source;
+
+  AL_CALL_BLOCK_BEGIN();
+  float playbackTime = evaluatePlaybackTime();
 
-  return static_cast<bool>(isLooped);
+  alSourcef(source, AL_PITCH, m_pitch);
+  alSourcef(source, AL_GAIN, m_volume);
+  alSource3f(source, AL_POSITION, m_position.x, m_position.y, m_position.z);
+  alSource3f(source, AL_VELOCITY, m_velocity.x, m_velocity.y, m_velocity.z);
+  alSourcei(source, AL_SOURCE_RELATIVE, m_isRelativeToListener);
+  alSourcef(source, AL_MAX_DISTANCE, m_maxDistance);
+  alSourcei(source, AL_LOOPING, m_isLooped && !m_audioClip->isStreamed());
+
+  if (m_audioClip->isStreamed()) {
+    alSourcei(source, AL_BUFFER, 0);
+
+    m_stream = std::make_unique<AudioStream>(*m_audioClip, source);
+    m_stream->setLooped(m_isLooped);
+    m_stream->start(static_cast<size_t>(playbackTime * static_cast<float>(m_audioClip->getFrequency())));
+
+    AudioStreamer::addStream(m_stream.get());
+  }
+  else {
+    alSourcei(source, AL_BUFFER, static_cast<ALint>(m_audioClip->getALBuffer()));
+
+    // The offset of the not playing source is applied on the playback start
+    alSourcef(source, AL_SEC_OFFSET, playbackTime);
+  }
+
+  alSourcePlay(source);
+  AL_CALL_BLOCK_END();
+
+  m_isSpatialStateChanged = false;
 }
 
-void AudioSource::setRelativeToListenerMode(bool relativeToListener)
+void AudioSource::detachVoice()
 {
-  alSourcei(m_source, AL_SOURCE_RELATIVE, relativeToListener);
+  if (m_voice == nullptr) {
+    return;
+  }
+
+  ALuint source = m_voice->source;
+
+  if (m_stream != nullptr) {
+    AudioStreamer::removeStream(m_stream.get());
+    m_stream.reset();
+  }
+  else if (isPlaying()) {
+    // The tracked time is corrected by the voice, so the virtual playback continues from the real position
+    ALint voiceState{};
+    alGetSourcei(source, AL_SOURCE_STATE, &voiceState);
+
+    if (voiceState == AL_PLAYING) {
+      alGetSourcef(source, AL_SEC_OFFSET, &m_playbackTime);
+      m_playbackClockStamp = s_playbackClock;
+    }
+  }
+
+  alSourceStop(source);
+  alSourcei(source, AL_BUFFER, 0);
+
+  m_voice->pool->releaseVoice(*m_voice);
+  m_voice = nullptr;
 }
 
-bool AudioSource::isRelativeToListener() const
+void AudioSource::flushSpatialState()
 {
-  ALint isRelativeToListener{};
-  alGetSourcei(m_source, AL_SOURCE_RELATIVE, &isRelativeToListener);
+  if (m_voice == nullptr || !m_isSpatialStateChanged) {
+    return;
+  }
 
-  return static_cast<bool>(isRelativeToListener);
+  alSource3f(m_voice->source, AL_POSITION, m_position.x, m_position.y, m_position.z);
+  alSource3f(m_voice->source, AL_VELOCITY, m_velocity.x, m_velocity.y, m_velocity.z);
+
+  m_isSpatialStateChanged = false;
 }
 
-void AudioSource::playOnce(ResourceHandle<AudioClip> clip)
+float AudioSource::evaluatePlaybackTime() const
 {
-  m_subSources.emplace_back(*this);
-  m_subSources.rbegin()->setLooped(false);
-  m_subSources.rbegin()->setClip(std::move(clip));
+  if (m_sourceState != AudioSourceState::Playing) {
+    return m_playbackTime;
+  }
+
+  float playbackTime = m_playbackTime + static_cast<float>(s_playbackClock - m_playbackClockStamp) * m_pitch;
 
-  m_subSources.rbegin()->play();
+  if (m_isLooped) {
+    float duration = m_audioClip->getDuration();
+
+    if (duration > 0.0f && playbackTime >= duration) {
+      playbackTime = std::fmod(playbackTime, duration);
+    }
+  }
+
+  return playbackTime;
+}
+
+bool AudioSource::isPlaybackFinished() const
+{
+  // The end of the source with a voice is detected by the voice state on the update
+  if (m_isLooped || m_voice != nullptr) {
+    return false;
+  }
+
+  return evaluatePlaybackTime() >= m_audioClip->getDuration();
+}
+
+void AudioSource::fixPlaybackTime()
+{
+  m_playbackTime = evaluatePlaybackTime();
+  m_playbackClockStamp = s_playbackClock;
+}
+
+void AudioSource::advancePlaybackClock(float delta)
+{
+  s_playbackClock += static_cast<double>(delta);
 }
@@ -2,16 +2,27 @@
 
 #include <memory>
 #include <list>
+#include <vector>
 
 #include <glm/vec3.hpp>
 
 #include "Modules/ResourceManagement/ResourcesManagement.h"
 #include "AudioClip.h"
+#include "AudioStream.h"
+#include "AudioVoicePool.h"
 
 enum class AudioSourceState {
   Playing, Paused, Stopped
 };
 
+/*!
+ * \brief Logical audio source
+ *
+ * The source does not own an AL source, the audio system attaches pooled voices to the most audible playing
+ * sources on update. The playback time of the sources without voices is evaluated from the audio system clock
+ * on demand, so the sources that are out of the listener range cost nothing until they are audible again.
+ * The playback starts on the next audio system update after the play call.
+ */
 class AudioSource {
  public:
   explicit AudioSource(ResourceHandle<AudioClip> clip);
@@ -40,6 +51,18 @@ class AudioSource {
   void setRelativeToListenerMode(bool relativeToListener);
   [[nodiscard]] bool isRelativeToListener() const;
 
+  /*!
+   * \brief Sets the distance beyond which the source is inaudible and never gets a voice
+   */
+  void setMaxDistance(float distance);
+  [[nodiscard]] float getMaxDistance() const;
+
+  /*!
+   * \brief Sets the priority of the source, higher priority sources get voices before more audible ones
+   */
+  void setPriority(int priority);
+  [[nodiscard]] int getPriority() const;
+
   void play();
   [[nodiscard]] bool isPlaying() const;
 
@@ -49,21 +72,76 @@ class AudioSource {
   void stop();
   [[nodiscard]] bool isStopped() const;
 
+  [[nodiscard]] bool isVirtual() const;
+
+  /*!
+   * \brief Returns the playback position in seconds, it is tracked for the virtual sources too
+   */
+  [[nodiscard]] float getPlaybackTime() const;
+
   void playOnce(ResourceHandle<AudioClip> clip);
 
  private:
-  [[nodiscard]] ALuint getALSource() const;
+  /*!
+   * \brief Advances the playback time and finishes the ended sources and one-shots
+   */
+  void updatePlayback();
+  void collectPlayingSources(std::vector<AudioSource*>& sources);
+
+  void attachVoice(AudioVoice& voice);
+  void detachVoice();
 
-  void updateInternalState();
+  /*!
+   * \brief Pushes the changed position and velocity to the attached voice
+   */
+  void flushSpatialState();
+
+  [[nodiscard]] float evaluatePlaybackTime() const;
+  [[nodiscard]] bool isPlaybackFinished() const;
+
+  /*!
+   * \brief Stores the current playback time, it should be done before the playback rate change
+   */
+  void fixPlaybackTime();
+
+  static void advancePlaybackClock(float delta);
 
  private:
-  ALuint m_source{};
+  ResourceHandle<AudioClip> m_audioClip;
   AudioSourceState m_sourceState{AudioSourceState::Stopped};
 
-  ResourceHandle<AudioClip> m_audioClip;
+  float m_pitch = 1.0f;
+  float m_volume = 1.0f;
+  glm::vec3 m_position{};
+  glm::vec3 m_velocity{};
+  bool m_isLooped = false;
+  bool m_isRelativeToListener = false;
+  float m_maxDistance = DEFAULT_MAX_DISTANCE;
+  int m_priority = 0;
+
+  // Playback position in seconds at the clock stamp, it is synchronized with the voice on the detach
+  float m_playbackTime = 0.0f;
+  double m_playbackClockStamp = 0.0;
+
+  // Position or velocity are changed after the last push to the voice
+  bool m_isSpatialStateChanged = false;
+
+  // Audibility is evaluated by the audio system to select the sources that get voices
+  float m_audibility = 0.0f;
+  size_t m_audibilityUpdateIndex = 0;
+
+  AudioVoice* m_voice = nullptr;
+  std::unique_ptr<AudioStream> m_stream;
 
   std::list<AudioSource> m_subSources;
 
+ private:
+  static constexpr float DEFAULT_MAX_DISTANCE = 100.0f;
+
+  // Time of the audio system updates in seconds, it is shared by all sources as the AL context is
+  static inline double s_playbackClock = 0.0;
+
  private:
   friend class AudioSystem;
+  friend class AudioVoicePool;
 };
@@ -0,0 +1,142 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "AudioStream.h"
+
+#include "Utility/helpers.h"
+
+DISABLE_WARNINGS()
+#define STB_VORBIS_HEADER_ONLY
+#include <stb_vorbis.c>
+ENABLE_WARNINGS()
+
+#include "Exceptions/exceptions.h"
+#include "ALDebug.h"
+
+AudioStream::AudioStream(const AudioClip& clip, ALuint source)
+  : m_source(source),
+    m_format(clip.getALFormat()),
+    m_frequency(clip.getFrequency())
+{
+  SW_ASSERT(clip.isStreamed());
+
+  int error = 0;
+  m_decoder = stb_vorbis_open_filename(clip.getStreamPath().c_str(), &error, nullptr);
+
+  if (m_decoder == nullptr) {
+    THROW_EXCEPTION(EngineRuntimeException,
+      fmt::format("Trying to stream invalid sound file {}", clip.getStreamPath()));
+  }
+
+  m_channelsCount = stb_vorbis_get_info(m_decoder).channels;
+  m_decodedSamples.resize(BUFFER_FRAMES_COUNT * static_cast<size_t>(m_channelsCount));
+
+  AL_CALL(alGenBuffers(static_cast<ALsizei>(m_buffers.size()), m_buffers.data()));
+}
+
+AudioStream::~AudioStream()
+{
+  // Buffers can not be deleted while they are queued
+  alSourceStop(m_source);
+  alSourcei(m_source, AL_BUFFER, 0);
+
+  alDeleteBuffers(static_cast<ALsizei>(m_buffers.size()), m_buffers.data());
+
+  stb_vorbis_close(m_decoder);
+}
+
+void AudioStream::start(size_t startFrame)
+{
+  // All buffers of the stopped source are processed, so they could be unqueued at once
+  AL_CALL(alSourcei(m_source, AL_BUFFER, 0));
+
+  if (startFrame == 0) {
+    stb_vorbis_seek_start(m_decoder);
+  }
+  else {
+    stb_vorbis_seek(m_decoder, static_cast<unsigned int>(startFrame));
+  }
+
+  m_isFinished = false;
+
+  for (ALuint buffer : m_buffers) {
+    if (!fillBuffer(buffer)) {
+      break;
+    }
+
+    AL_CALL(alSourceQueueBuffers(m_source, 1, &buffer));
+  }
+}
+
+void AudioStream::update()
+{
+  if (m_isFinished) {
+    return;
+  }
+
+  ALint processedBuffersCount = 0;
+  alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processedBuffersCount);
+
+  for (ALint bufferIndex = 0; bufferIndex < processedBuffersCount && !m_isFinished; bufferIndex++) {
+    ALuint buffer = 0;
+    alSourceUnqueueBuffers(m_source, 1, &buffer);
+
+    if (fillBuffer(buffer)) {
+      alSourceQueueBuffers(m_source, 1, &buffer);
+    }
+  }
+
+  if (processedBuffersCount == static_cast<ALint>(m_buffers.size())) {
+    // The whole ring was played before the refill, so the source is stopped and should be restarted
+    ALint sourceState = 0;
+    alGetSourcei(m_source, AL_SOURCE_STATE, &sourceState);
+
+    ALint queuedBuffersCount = 0;
+    alGetSourcei(m_source, AL_BUFFERS_QUEUED, &queuedBuffersCount);
+
+    if (sourceState == AL_STOPPED && queuedBuffersCount > 0) {
+      alSourcePlay(m_source);
+    }
+  }
+}
+
+void AudioStream::setLooped(bool isLooped)
+{
+  m_isLooped = isLooped;
+}
+
+bool AudioStream::fillBuffer(ALuint buffer)
+{
+  size_t framesCount = 0;
+  bool isRewound = false;
+
+  while (framesCount < BUFFER_FRAMES_COUNT) {
+    int decodedFramesCount = stb_vorbis_get_samples_short_interleaved(m_decoder, m_channelsCount,
+      m_decodedSamples.data() + framesCount * static_cast<size_t>(m_channelsCount),
+      static_cast<int>((BUFFER_FRAMES_COUNT - framesCount) * static_cast<size_t>(m_channelsCount)));
+
+    if (decodedFramesCount > 0) {
+      framesCount += static_cast<size_t>(decodedFramesCount);
+      isRewound = false;
+    }
+    else if (m_isLooped && !isRewound) {
+      stb_vorbis_seek_start(m_decoder);
+      isRewound = true;
+    }
+    else {
+      break;
+    }
+  }
+
+  if (framesCount == 0) {
+    m_isFinished = true;
+    return false;
+  }
+
+  alBufferData(buffer, m_format, m_decodedSamples.data(),
+    static_cast<ALsizei>(framesCount * static_cast<size_t>(m_channelsCount) * sizeof(short)),
+    static_cast<ALsizei>(m_frequency));
+
+  return true;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <atomic>
+
+#include <AL/al.h>
+
+#include "AudioClip.h"
+
+struct stb_vorbis;
+
+/*!
+ * \brief Incremental decoder of a streamed audio clip attached to an AL source
+ *
+ * Decoded chunks are queued to the source through the small ring of AL buffers,
+ * processed buffers are refilled by the audio streaming thread.
+ */
+class AudioStream {
+ public:
+  AudioStream(const AudioClip& clip, ALuint source);
+  ~AudioStream();
+
+  AudioStream(const AudioStream&) = delete;
+  AudioStream& operator=(const AudioStream&) = delete;
+
+  /*!
+   * \brief Seeks the decoder to the frame and fills the whole buffers ring, the source should be stopped
+   */
+  void start(size_t startFrame = 0);
+
+  /*!
+   * \brief Refills and queues the processed buffers, it is called from the streaming thread
+   */
+  void update();
+
+  void setLooped(bool isLooped);
+
+ public:
+  static constexpr size_t BUFFERS_COUNT = 4;
+  static constexpr size_t BUFFER_FRAMES_COUNT = 8192;
+
+ private:
+  /*!
+   * \brief Decodes the next chunk into the buffer, returns false if the non-looped stream is ended
+   */
+  bool fillBuffer(ALuint buffer);
+
+ private:
+  ALuint m_source;
+  std::array<ALuint, BUFFERS_COUNT> m_buffers{};
+
+  stb_vorbis* m_decoder = nullptr;
+  ALenum m_format;
+  uint32_t m_frequency;
+  int m_channelsCount = 0;
+
+  std::vector<short> m_decodedSamples;
+
+  std::atomic<bool> m_isLooped = false;
+  bool m_isFinished = false;
+};
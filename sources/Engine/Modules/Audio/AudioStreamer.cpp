@@ -0,0 +1,74 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "AudioStreamer.h"
+
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
+
+#include "AudioStream.h"
+
+namespace {
+
+// The interval is much shorter than the duration of the streams buffers ring
+constexpr std::chrono::milliseconds STREAMS_UPDATE_INTERVAL(20);
+
+std::mutex g_streamsMutex;
+std::condition_variable g_streamingCondition;
+std::vector<AudioStream*> g_streams;
+
+std::thread g_streamingThread;
+bool g_isStopRequested = false;
+
+}
+
+void AudioStreamer::start()
+{
+  SW_ASSERT(!g_streamingThread.joinable());
+
+  g_isStopRequested = false;
+  g_streamingThread = std::thread(&AudioStreamer::streamingThreadLoop);
+}
+
+void AudioStreamer::stop()
+{
+  if (!g_streamingThread.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(g_streamsMutex);
+    g_isStopRequested = true;
+  }
+
+  g_streamingCondition.notify_all();
+  g_streamingThread.join();
+}
+
+void AudioStreamer::addStream(AudioStream* stream)
+{
+  std::lock_guard<std::mutex> lock(g_streamsMutex);
+
+  g_streams.push_back(stream);
+}
+
+void AudioStreamer::removeStream(AudioStream* stream)
+{
+  std::lock_guard<std::mutex> lock(g_streamsMutex);
+
+  std::erase(g_streams, stream);
+}
+
+void AudioStreamer::streamingThreadLoop()
+{
+  std::unique_lock<std::mutex> lock(g_streamsMutex);
+
+  while (!g_streamingCondition.wait_for(lock, STREAMS_UPDATE_INTERVAL, [] { return g_isStopRequested; })) {
+    for (AudioStream* stream : g_streams) {
+      stream->update();
+    }
+  }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+class AudioStream;
+
+/*!
+ * \brief Background thread that refills the buffers of the playing audio streams
+ *
+ * OpenAL context is shared between threads, so the streams are updated without the main thread
+ * participation. The stream should be removed before it is restarted or destroyed.
+ */
+class AudioStreamer {
+ public:
+  AudioStreamer() = delete;
+
+  static void start();
+  static void stop();
+
+  static void addStream(AudioStream* stream);
+  static void removeStream(AudioStream* stream);
+
+ private:
+  static void streamingThreadLoop();
+};
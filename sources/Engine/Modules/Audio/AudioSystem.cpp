@@ -5,14 +5,21 @@
 #include "AudioSystem.h"
 
 #include <utility>
+#include <algorithm>
+#include <array>
 #include <spdlog/spdlog.h>
 
 #include "Modules/Graphics/GraphicsSystem/TransformComponent.h"
 #include "Exceptions/exceptions.h"
 #include "ALDebug.h"
-
-AudioSystem::AudioSystem(std::shared_ptr<GraphicsScene> environmentState)
-  : m_environmentState(std::move(environmentState))
+#include "AudioStreamer.h"
+
+AudioSystem::AudioSystem(std::shared_ptr<GraphicsScene> environmentState,
+  size_t voicesCount,
+  AudioOutputType outputType)
+  : m_outputType(outputType),
+    m_environmentState(std::move(environmentState)),
+    m_voicesCount(voicesCount)
 {
 
 }
@@ -20,6 +27,7 @@ AudioSystem::AudioSystem(std::shared_ptr<GraphicsScene> environmentState)
 AudioSystem::~AudioSystem()
 {
   SW_ASSERT(m_audioListener == nullptr);
+  SW_ASSERT(m_voicePool == nullptr);
   SW_ASSERT(m_audioContext == nullptr);
   SW_ASSERT(m_audioDevice == nullptr);
 }
@@ -28,6 +36,41 @@ void AudioSystem::configure()
 {
   spdlog::info("Configure audio system");
 
+  if (m_outputType == AudioOutputType::Loopback) {
+    openLoopbackAudioDevice();
+  }
+  else {
+    openAudioDevice();
+  }
+
+  AL_CALL_BLOCK_BEGIN();
+  bool contextMakingCurrentStatus = alcMakeContextCurrent(m_audioContext);
+  AL_CALL_BLOCK_END();
+
+  if (!contextMakingCurrentStatus) {
+    THROW_EXCEPTION(EngineRuntimeException, "Audio context can not be set as current");
+  }
+
+  if (alIsExtensionPresent("AL_SOFT_deferred_updates")) {
+    m_alDeferUpdates = reinterpret_cast<LPALDEFERUPDATESSOFT>(alGetProcAddress("alDeferUpdatesSOFT"));
+    m_alProcessUpdates = reinterpret_cast<LPALPROCESSUPDATESSOFT>(alGetProcAddress("alProcessUpdatesSOFT"));
+  }
+  else {
+    spdlog::info("Audio deferred updates are not supported, sources state is updated immediately");
+  }
+
+  m_audioListener = std::make_unique<AudioListener>();
+  m_voicePool = std::make_unique<AudioVoicePool>(m_voicesCount);
+
+  AudioStreamer::start();
+
+  getGameWorld()->subscribeEventsListener<GameObjectAddComponentEvent<AudioSourceComponent>>(this);
+  getGameWorld()->subscribeEventsListener<GameObjectRemoveComponentEvent<AudioSourceComponent>>(this);
+  getGameWorld()->subscribeEventsListener<GameObjectOnlineStatusChangeEvent>(this);
+}
+
+void AudioSystem::openAudioDevice()
+{
   AL_CALL_BLOCK_BEGIN();
   m_audioDevice = alcOpenDevice(nullptr);
   AL_CALL_BLOCK_END();
@@ -43,26 +86,68 @@ void AudioSystem::configure()
   if (m_audioContext == nullptr) {
     THROW_EXCEPTION(EngineRuntimeException, "Audio context can not be created");
   }
+}
 
-  AL_CALL_BLOCK_BEGIN();
-  bool contextMakingCurrentStatus = alcMakeContextCurrent(m_audioContext);
-  AL_CALL_BLOCK_END();
+void AudioSystem::openLoopbackAudioDevice()
+{
+  if (!alcIsExtensionPresent(nullptr, "ALC_SOFT_loopback")) {
+    THROW_EXCEPTION(EngineRuntimeException, "Audio loopback output is not supported");
+  }
 
-  if (!contextMakingCurrentStatus) {
-    THROW_EXCEPTION(EngineRuntimeException, "Audio context can not be set as current");
+  auto alcLoopbackOpenDevice =
+    reinterpret_cast<LPALCLOOPBACKOPENDEVICESOFT>(alcGetProcAddress(nullptr, "alcLoopbackOpenDeviceSOFT"));
+  m_alcRenderSamples = reinterpret_cast<LPALCRENDERSAMPLESSOFT>(alcGetProcAddress(nullptr, "alcRenderSamplesSOFT"));
+
+  m_audioDevice = alcLoopbackOpenDevice(nullptr);
+
+  if (m_audioDevice == nullptr) {
+    THROW_EXCEPTION(EngineRuntimeException, "Audio loopback device can not be opened");
   }
 
-  m_audioListener = std::make_unique<AudioListener>();
+  std::array<ALCint, 7> contextAttributes = {
+    ALC_FORMAT_CHANNELS_SOFT, ALC_STEREO_SOFT,
+    ALC_FORMAT_TYPE_SOFT, ALC_SHORT_SOFT,
+    ALC_FREQUENCY, LOOPBACK_FREQUENCY,
+    0
+  };
 
-  getGameWorld()->subscribeEventsListener<GameObjectAddComponentEvent<AudioSourceComponent>>(this);
+  m_audioContext = alcCreateContext(m_audioDevice, contextAttributes.data());
+
+  if (m_audioContext == nullptr) {
+    THROW_EXCEPTION(EngineRuntimeException, "Audio loopback context can not be created");
+  }
+}
+
+void AudioSystem::renderLoopbackFrames(size_t framesCount)
+{
+  SW_ASSERT(m_outputType == AudioOutputType::Loopback && m_alcRenderSamples != nullptr);
+
+  m_loopbackSamples.resize(framesCount * LOOPBACK_CHANNELS_COUNT);
+  m_alcRenderSamples(m_audioDevice, m_loopbackSamples.data(), static_cast<ALCsizei>(framesCount));
 }
 
 void AudioSystem::unconfigure()
 {
   spdlog::info("Unconfigure audio system");
 
+  getGameWorld()->unsubscribeEventsListener<GameObjectOnlineStatusChangeEvent>(this);
+  getGameWorld()->unsubscribeEventsListener<GameObjectRemoveComponentEvent<AudioSourceComponent>>(this);
   getGameWorld()->unsubscribeEventsListener<GameObjectAddComponentEvent<AudioSourceComponent>>(this);
 
+  AudioStreamer::stop();
+
+  // Sources that are still alive become virtual
+  m_voicePool.reset();
+  m_playingSources.clear();
+
+  m_staticEmitters.clear();
+  m_trackedEmitters.clear();
+  m_pendingEmitters.clear();
+
+  m_alDeferUpdates = nullptr;
+  m_alProcessUpdates = nullptr;
+  m_alcRenderSamples = nullptr;
+
   m_audioListener.reset();
 
   alcMakeContextCurrent(nullptr);
@@ -76,34 +161,147 @@ void AudioSystem::unconfigure()
 
 void AudioSystem::update(float delta)
 {
-  ARG_UNUSED(delta);
+  AudioSource::advancePlaybackClock(delta);
 
   std::shared_ptr<Camera> activeCamera = m_environmentState->getActiveCamera();
+  glm::vec3 listenerPosition;
 
   if (activeCamera) {
     const Transform& currentCameraTransform = *m_environmentState->getActiveCamera()->getTransform();
 
     m_audioListener->setPosition(currentCameraTransform.getPosition());
     m_audioListener->setOrientation(currentCameraTransform.getOrientation());
+
+    listenerPosition = currentCameraTransform.getPosition();
+  }
+  else {
+    listenerPosition = m_audioListener->getPosition();
+  }
+
+  m_updateIndex++;
+  m_playingSources.clear();
+  m_voicesStatistics = AudioVoicesStatistics{};
+
+  indexPendingEmitters();
+
+  for (const TrackedEmitter& emitter : m_trackedEmitters) {
+    if (emitter.isTransformFollowed) {
+      emitter.source->setPosition(
+        emitter.gameObject.getComponent<TransformComponent>()->getTransform().getPosition());
+    }
+
+    processEmitter(*emitter.source, listenerPosition);
+  }
+
+  m_staticEmittersQueryResult.clear();
+  m_staticEmitters.queryObjectsInRadius(listenerPosition, m_staticEmittersCullingRadius, m_staticEmittersQueryResult);
+
+  for (GameObject emitterObject : m_staticEmittersQueryResult) {
+    processEmitter(emitterObject.getComponent<AudioSourceComponent>()->getSource(), listenerPosition);
   }
 
-  for (auto object : getGameWorld()->allWith<AudioSourceComponent>()) {
-    auto transformComponent = object.getComponent<TransformComponent>();
-    auto& audioSource = object.getComponent<AudioSourceComponent>()->getSource();
+  m_voicesStatistics.processedEmittersCount = m_trackedEmitters.size() + m_staticEmittersQueryResult.size();
 
-    if (transformComponent->isOnline()) {
-      audioSource.updateInternalState();
+  assignVoices();
+  flushVoicesSpatialState();
+}
+
+void AudioSystem::processEmitter(AudioSource& source, const glm::vec3& listenerPosition)
+{
+  size_t firstSourceIndex = m_playingSources.size();
+
+  source.updatePlayback();
+  source.collectPlayingSources(m_playingSources);
+
+  for (size_t sourceIndex = firstSourceIndex; sourceIndex < m_playingSources.size(); sourceIndex++) {
+    AudioSource& playingSource = *m_playingSources[sourceIndex];
 
-      if (!transformComponent->isStatic()) {
-        audioSource.setPosition(transformComponent->getTransform().getPosition());
+    playingSource.m_audibility = evaluateAudibility(playingSource, listenerPosition);
+    playingSource.m_audibilityUpdateIndex = m_updateIndex;
+  }
+}
+
+void AudioSystem::assignVoices()
+{
+  // Voices of the sources that are not processed on the update are released first, e.g. the sources that have left
+  // the culling radius or stopped. Such sources are virtual until they are found around the listener again.
+  for (AudioVoice& voice : m_voicePool->getVoices()) {
+    if (voice.owner != nullptr && voice.owner->m_audibilityUpdateIndex != m_updateIndex) {
+      voice.owner->detachVoice();
+    }
+  }
+
+  std::sort(m_playingSources.begin(), m_playingSources.end(), [](const AudioSource* lhs, const AudioSource* rhs) {
+    if (lhs->m_priority != rhs->m_priority) {
+      return lhs->m_priority > rhs->m_priority;
+    }
+
+    return lhs->m_audibility > rhs->m_audibility;
+  });
+
+  size_t voicesCount = m_voicePool->getVoicesCount();
+
+  // Voices are released first, so they are available for the selected sources
+  for (size_t sourceIndex = 0; sourceIndex < m_playingSources.size(); sourceIndex++) {
+    AudioSource& source = *m_playingSources[sourceIndex];
+    bool isAudible = source.m_audibility >= INAUDIBLE_GAIN;
+
+    if (source.m_voice != nullptr && (sourceIndex >= voicesCount || !isAudible)) {
+      source.detachVoice();
+
+      if (isAudible) {
+        m_voicesStatistics.stolenVoicesCount++;
       }
     }
+  }
+
+  for (size_t sourceIndex = 0; sourceIndex < m_playingSources.size(); sourceIndex++) {
+    AudioSource& source = *m_playingSources[sourceIndex];
+
+    if (sourceIndex < voicesCount && source.m_audibility >= INAUDIBLE_GAIN && source.m_voice == nullptr) {
+      source.attachVoice(*m_voicePool->acquireVoice(source));
+    }
+
+    if (source.m_voice != nullptr) {
+      m_voicesStatistics.activeVoicesCount++;
+    }
     else {
-      audioSource.stop();
+      m_voicesStatistics.virtualVoicesCount++;
     }
   }
 }
 
+void AudioSystem::flushVoicesSpatialState()
+{
+  // The deferred changes are applied by the mixer atomically, instead of a mix per AL call
+  if (m_alDeferUpdates != nullptr) {
+    m_alDeferUpdates();
+  }
+
+  for (AudioVoice& voice : m_voicePool->getVoices()) {
+    if (voice.owner != nullptr) {
+      voice.owner->flushSpatialState();
+    }
+  }
+
+  if (m_alProcessUpdates != nullptr) {
+    m_alProcessUpdates();
+  }
+}
+
+float AudioSystem::evaluateAudibility(const AudioSource& source, const glm::vec3& listenerPosition)
+{
+  float distance = (source.isRelativeToListener()) ? glm::length(source.getPosition()) :
+    glm::distance(source.getPosition(), listenerPosition);
+
+  if (distance > source.getMaxDistance()) {
+    return 0.0f;
+  }
+
+  // Inverse distance clamped attenuation with the default reference distance and rolloff factor
+  return source.getVolume() / std::max(distance, 1.0f);
+}
+
 const AudioListener& AudioSystem::getListener() const
 {
   return *m_audioListener;
@@ -114,12 +312,125 @@ AudioListener& AudioSystem::getListener()
   return *m_audioListener;
 }
 
+const AudioVoicesStatistics& AudioSystem::getVoicesStatistics() const
+{
+  return m_voicesStatistics;
+}
+
+void AudioSystem::setStaticEmittersCullingRadius(float radius)
+{
+  m_staticEmittersCullingRadius = radius;
+}
+
+float AudioSystem::getStaticEmittersCullingRadius() const
+{
+  return m_staticEmittersCullingRadius;
+}
+
+size_t AudioSystem::getEmittersCount() const
+{
+  return m_staticEmitters.getObjectsCount() + m_trackedEmitters.size();
+}
+
 EventProcessStatus AudioSystem::receiveEvent(const GameObjectAddComponentEvent<AudioSourceComponent>& event)
 {
-  auto& transform = event.gameObject.getComponent<TransformComponent>()->getTransform();
+  auto transformComponent = event.gameObject.getComponent<TransformComponent>();
   auto source = event.component->getSourcePtr();
 
-  source->setPosition(transform.getPosition());
+  source->setPosition(transformComponent->getTransform().getPosition());
+
+  if (transformComponent->isOnline()) {
+    registerEmitter(event.gameObject);
+  }
 
   return EventProcessStatus::Processed;
 }
+
+EventProcessStatus AudioSystem::receiveEvent(const GameObjectRemoveComponentEvent<AudioSourceComponent>& event)
+{
+  unregisterEmitter(event.gameObject);
+
+  return EventProcessStatus::Processed;
+}
+
+EventProcessStatus AudioSystem::receiveEvent(const GameObjectOnlineStatusChangeEvent& event)
+{
+  GameObject affectedObject = event.gameObject;
+
+  if (!affectedObject.hasComponent<AudioSourceComponent>()) {
+    return EventProcessStatus::Skipped;
+  }
+
+  if (event.makeOnline) {
+    registerEmitter(affectedObject);
+  }
+  else {
+    // Offline objects are not processed, so their sources are stopped instead of being virtualized forever
+    affectedObject.getComponent<AudioSourceComponent>()->getSource().stop();
+    unregisterEmitter(affectedObject);
+  }
+
+  return EventProcessStatus::Processed;
+}
+
+void AudioSystem::registerEmitter(GameObject gameObject)
+{
+  if (std::find(m_pendingEmitters.begin(), m_pendingEmitters.end(), gameObject) == m_pendingEmitters.end()) {
+    m_pendingEmitters.push_back(gameObject);
+  }
+}
+
+void AudioSystem::indexPendingEmitters()
+{
+  for (GameObject gameObject : m_pendingEmitters) {
+    if (!gameObject.isAlive() || !gameObject.hasComponent<AudioSourceComponent>()) {
+      continue;
+    }
+
+    bool isStatic = gameObject.getComponent<TransformComponent>()->isStatic();
+    AudioSource* source = gameObject.getComponent<AudioSourceComponent>()->getSourcePtr();
+
+    // Listener relative sources are audible wherever the listener is, so they are never culled
+    if (isStatic && !source->isRelativeToListener()) {
+      if (!m_staticEmitters.hasObject(gameObject)) {
+        m_staticEmitters.insertObject(gameObject, source->getPosition());
+      }
+
+      continue;
+    }
+
+    auto emitterIt = std::find_if(m_trackedEmitters.begin(), m_trackedEmitters.end(),
+      [&gameObject](const TrackedEmitter& emitter) {
+        return emitter.gameObject == gameObject;
+      });
+
+    if (emitterIt == m_trackedEmitters.end()) {
+      m_trackedEmitters.push_back(TrackedEmitter{.gameObject = gameObject,
+        .source = source,
+        .isTransformFollowed = !isStatic});
+    }
+  }
+
+  m_pendingEmitters.clear();
+}
+
+void AudioSystem::unregisterEmitter(GameObject gameObject)
+{
+  std::erase(m_pendingEmitters, gameObject);
+
+  if (m_staticEmitters.hasObject(gameObject)) {
+    m_staticEmitters.removeObject(gameObject);
+    return;
+  }
+
+  auto emitterIt = std::find_if(m_trackedEmitters.begin(), m_trackedEmitters.end(),
+    [&gameObject](const TrackedEmitter& emitter) {
+      return emitter.gameObject == gameObject;
+    });
+
+  if (emitterIt != m_trackedEmitters.end()) {
+    // The order of emitters does not matter, so the array is kept compact by moving the last emitter
+    *emitterIt = m_trackedEmitters.back();
+    m_trackedEmitters.pop_back();
+  }
+}
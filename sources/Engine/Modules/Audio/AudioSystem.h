@@ -1,15 +1,39 @@
 #pragma once
 
+#include <AL/alext.h>
+
 #include "Modules/ECS/ECS.h"
+#include "Modules/ECS/OnlineManagementSystem.h"
 #include "Modules/Graphics/GraphicsSystem/GraphicsScene.h"
+#include "Modules/Graphics/GraphicsSystem/Culling/SpatialHashGrid.h"
 
 #include "AudioSourceComponent.h"
 #include "AudioListener.h"
+#include "AudioVoicePool.h"
+
+enum class AudioOutputType {
+  // The mix is played by the default audio device
+  Device,
+
+  // The mix is rendered only on demand, e.g. for the offline rendering and tests
+  Loopback
+};
 
+/*!
+ * \brief Audio system that renders the most important audible sources with the pooled voices
+ *
+ * Static emitters are indexed by position, so only the emitters in the culling radius around the listener
+ * are processed on update. Dynamic and listener relative emitters are kept in a compact array and processed
+ * every update. Changed spatial state of the voiced sources is pushed to AL once per update.
+ */
 class AudioSystem : public GameSystem,
-                    public EventsListener<GameObjectAddComponentEvent<AudioSourceComponent>> {
+                    public EventsListener<GameObjectAddComponentEvent<AudioSourceComponent>>,
+                    public EventsListener<GameObjectRemoveComponentEvent<AudioSourceComponent>>,
+                    public EventsListener<GameObjectOnlineStatusChangeEvent> {
  public:
-  explicit AudioSystem(std::shared_ptr<GraphicsScene> environmentState);
+  explicit AudioSystem(std::shared_ptr<GraphicsScene> environmentState,
+    size_t voicesCount = DEFAULT_VOICES_COUNT,
+    AudioOutputType outputType = AudioOutputType::Device);
   ~AudioSystem() override;
 
   void configure() override;
@@ -20,14 +44,110 @@ class AudioSystem : public GameSystem,
   [[nodiscard]] const AudioListener& getListener() const;
   [[nodiscard]] AudioListener& getListener();
 
+  [[nodiscard]] const AudioVoicesStatistics& getVoicesStatistics() const;
+
+  /*!
+   * \brief Sets the radius around the listener to search the static emitters in
+   *
+   * Static sources with the max distance greater than the radius are audible only inside the radius.
+   */
+  void setStaticEmittersCullingRadius(float radius);
+  [[nodiscard]] float getStaticEmittersCullingRadius() const;
+
+  [[nodiscard]] size_t getEmittersCount() const;
+
+  /*!
+   * \brief Mixes the next frames of the loopback output, the loopback playback is advanced only by this call
+   */
+  void renderLoopbackFrames(size_t framesCount);
+
+ private:
+  struct TrackedEmitter {
+    GameObject gameObject;
+    AudioSource* source;
+
+    // The source position follows the transform of the dynamic object
+    bool isTransformFollowed;
+  };
+
  private:
   EventProcessStatus receiveEvent(const GameObjectAddComponentEvent<AudioSourceComponent>& event) override;
+  EventProcessStatus receiveEvent(const GameObjectRemoveComponentEvent<AudioSourceComponent>& event) override;
+  EventProcessStatus receiveEvent(const GameObjectOnlineStatusChangeEvent& event) override;
+
+  /*!
+   * \brief Adds the emitter to the pending list, it is indexed on the next update after the source is set up
+   */
+  void registerEmitter(GameObject gameObject);
+
+  void openAudioDevice();
+  void openLoopbackAudioDevice();
+
+  void indexPendingEmitters();
+
+  void unregisterEmitter(GameObject gameObject);
+
+  /*!
+   * \brief Collects the playing audible sources of the emitter to assign voices
+   */
+  void processEmitter(AudioSource& source, const glm::vec3& listenerPosition);
+
+  /*!
+   * \brief Attaches the pooled voices to the most important audible sources and virtualizes the rest
+   */
+  void assignVoices();
+
+  /*!
+   * \brief Pushes the changed positions and velocities of the voiced sources as one AL update
+   */
+  void flushVoicesSpatialState();
+
+  [[nodiscard]] static float evaluateAudibility(const AudioSource& source, const glm::vec3& listenerPosition);
 
  private:
+  AudioOutputType m_outputType;
+
   ALCdevice* m_audioDevice{};
   ALCcontext* m_audioContext{};
 
+  // ALC_SOFT_loopback entry point, it is used only for the loopback output
+  LPALCRENDERSAMPLESSOFT m_alcRenderSamples{};
+  std::vector<int16_t> m_loopbackSamples;
+
+  // AL_SOFT_deferred_updates entry points, they are not available for some implementations
+  LPALDEFERUPDATESSOFT m_alDeferUpdates{};
+  LPALPROCESSUPDATESSOFT m_alProcessUpdates{};
+
   std::shared_ptr<GraphicsScene> m_environmentState;
 
   std::unique_ptr<AudioListener> m_audioListener;
+
+  size_t m_voicesCount;
+  std::unique_ptr<AudioVoicePool> m_voicePool;
+  AudioVoicesStatistics m_voicesStatistics;
+
+  SpatialHashGrid m_staticEmitters{STATIC_EMITTERS_GRID_CELL_SIZE};
+  float m_staticEmittersCullingRadius = STATIC_EMITTERS_DEFAULT_CULLING_RADIUS;
+
+  std::vector<TrackedEmitter> m_trackedEmitters;
+  std::vector<GameObject> m_pendingEmitters;
+
+  std::vector<GameObject> m_staticEmittersQueryResult;
+  std::vector<AudioSource*> m_playingSources;
+
+  // Sources are marked by the index to release voices of the sources that are not processed on the update
+  size_t m_updateIndex = 0;
+
+ private:
+  static constexpr size_t DEFAULT_VOICES_COUNT = 64;
+
+  // Loopback output is rendered as 16-bit stereo
+  static constexpr ALCint LOOPBACK_FREQUENCY = 44100;
+  static constexpr size_t LOOPBACK_CHANNELS_COUNT = 2;
+
+  // Sources with the lower gain are virtualized even if there are free voices
+  static constexpr float INAUDIBLE_GAIN = 1e-3f;
+
+  static constexpr float STATIC_EMITTERS_GRID_CELL_SIZE = 16.0f;
+  static constexpr float STATIC_EMITTERS_DEFAULT_CULLING_RADIUS = 100.0f;
 };
@@ -0,0 +1,85 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "AudioVoicePool.h"
+
+#include <spdlog/spdlog.h>
+
+#include "AudioSource.h"
+#include "ALDebug.h"
+
+AudioVoicePool::AudioVoicePool(size_t voicesCount)
+{
+  m_voices.reserve(voicesCount);
+
+  for (size_t voiceIndex = 0; voiceIndex < voicesCount; voiceIndex++) {
+    ALuint source = 0;
+
+    alGetError();
+    alGenSources(1, &source);
+
+    // The device could support less sources than requested
+    if (alGetError() != AL_NO_ERROR) {
+      spdlog::warn("Audio voices pool is limited to {} voices by the audio device", voiceIndex);
+      break;
+    }
+
+    m_voices.push_back(AudioVoice{.source = source, .owner = nullptr, .pool = this});
+  }
+
+  m_freeVoices.reserve(m_voices.size());
+
+  // Voices are acquired from the back, so the first voices are used first
+  for (auto voiceIt = m_voices.rbegin(); voiceIt != m_voices.rend(); voiceIt++) {
+    m_freeVoices.push_back(&*voiceIt);
+  }
+}
+
+AudioVoicePool::~AudioVoicePool()
+{
+  for (AudioVoice& voice : m_voices) {
+    if (voice.owner != nullptr) {
+      voice.owner->detachVoice();
+    }
+
+    alDeleteSources(1, &voice.source);
+  }
+}
+
+AudioVoice* AudioVoicePool::acquireVoice(AudioSource& owner)
+{
+  if (m_freeVoices.empty()) {
+    return nullptr;
+  }
+
+  AudioVoice* voice = m_freeVoices.back();
+  m_freeVoices.pop_back();
+
+  voice->owner = &owner;
+
+  return voice;
+}
+
+void AudioVoicePool::releaseVoice(AudioVoice& voice)
+{
+  SW_ASSERT(voice.pool == this && voice.owner != nullptr);
+
+  voice.owner = nullptr;
+  m_freeVoices.push_back(&voice);
+}
+
+std::span<AudioVoice> AudioVoicePool::getVoices()
+{
+  return m_voices;
+}
+
+size_t AudioVoicePool::getVoicesCount() const
+{
+  return m_voices.size();
+}
+
+size_t AudioVoicePool::getFreeVoicesCount() const
+{
+  return m_freeVoices.size();
+}
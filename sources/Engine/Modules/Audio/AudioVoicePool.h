@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+#include <span>
+
+#include <AL/al.h>
+
+class AudioSource;
+class AudioVoicePool;
+
+/*!
+ * \brief Real AL source that is temporarily attached to a playing logical audio source
+ */
+struct AudioVoice {
+  ALuint source = 0;
+  AudioSource* owner = nullptr;
+  AudioVoicePool* pool = nullptr;
+};
+
+struct AudioVoicesStatistics {
+  // Playing sources that are attached to the voices
+  size_t activeVoicesCount = 0;
+
+  // Playing sources in the listener range without voices, the sources out of the range are not counted
+  size_t virtualVoicesCount = 0;
+
+  // Emitters that are found around the listener and checked during the last update
+  size_t processedEmittersCount = 0;
+
+  // Voices detached from audible sources in favour of higher priority ones during the last update
+  size_t stolenVoicesCount = 0;
+};
+
+/*!
+ * \brief Fixed set of AL sources shared between logical audio sources
+ */
+class AudioVoicePool {
+ public:
+  explicit AudioVoicePool(size_t voicesCount);
+  ~AudioVoicePool();
+
+  AudioVoicePool(const AudioVoicePool&) = delete;
+  AudioVoicePool& operator=(const AudioVoicePool&) = delete;
+
+  /*!
+   * \brief Returns a free voice or nullptr if all voices are used
+   */
+  [[nodiscard]] AudioVoice* acquireVoice(AudioSource& owner);
+  void releaseVoice(AudioVoice& voice);
+
+  [[nodiscard]] std::span<AudioVoice> getVoices();
+
+  [[nodiscard]] size_t getVoicesCount() const;
+  [[nodiscard]] size_t getFreeVoicesCount() const;
+
+ private:
+  std::vector<AudioVoice> m_voices;
+  std::vector<AudioVoice*> m_freeVoices;
+};
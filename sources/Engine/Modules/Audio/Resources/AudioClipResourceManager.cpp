@@ -29,43 +29,60 @@ void AudioClipResourceManager::parseConfig(size_t resourceIndex, pugi::xml_node
     THROW_EXCEPTION(EngineRuntimeException,
       fmt::format("Audio clip resource refer to not existing file", resourceConfig->resourcePath));
   }
-}
 
+  if (configNode.child("streaming")) {
+    resourceConfig->streamingMode = ResourceDeclHelpers::getFilteredParameterValue(configNode, "streaming", {
+      {"auto", AudioClipStreamingMode::Auto},
+      {"always", AudioClipStreamingMode::Always},
+      {"never", AudioClipStreamingMode::Never},
+    }, AudioClipStreamingMode::Auto);
+  }
+}
 
 void AudioClipResourceManager::load(size_t resourceIndex)
 {
   AudioClipResourceConfig* config = getResourceConfig(resourceIndex);
 
-  std::byte* audioData;
-  int channelsCount = 0;
-  int sampleRate = 0;
-
-  // NOTE: dataLength is number of samples in the audio file
-  int dataLength = stb_vorbis_decode_filename(config->resourcePath.c_str(),
-    &channelsCount,
-    &sampleRate,
-    reinterpret_cast<short**>(&audioData));
+  int error = 0;
+  stb_vorbis* decoder = stb_vorbis_open_filename(config->resourcePath.c_str(), &error, nullptr);
 
-  if (dataLength <= 0) {
+  if (decoder == nullptr) {
     THROW_EXCEPTION(EngineRuntimeException,
       fmt::format("Trying to load invalid sound file {}", config->resourcePath));
   }
 
-  AudioClipFormat format;
+  stb_vorbis_info info = stb_vorbis_get_info(decoder);
+  size_t framesCount = stb_vorbis_stream_length_in_samples(decoder);
 
-  if (channelsCount == 1) {
-    format = AudioClipFormat::MONO_16;
-    dataLength *= 2;
-  }
-  else if (channelsCount == 2) {
-    format = AudioClipFormat::STEREO_16;
-    dataLength *= 2 * 2;
+  if (framesCount == 0 || (info.channels != 1 && info.channels != 2)) {
+    stb_vorbis_close(decoder);
+
+    THROW_EXCEPTION(EngineRuntimeException,
+      fmt::format("Trying to load invalid sound file {}", config->resourcePath));
   }
-  else {
-    THROW_EXCEPTION(EngineRuntimeException, "Audio file has invalid number of audio channels");
+
+  AudioClipFormat format = (info.channels == 1) ? AudioClipFormat::MONO_16 : AudioClipFormat::STEREO_16;
+  auto channelsCount = static_cast<size_t>(info.channels);
+
+  size_t samplesSize = framesCount * channelsCount * sizeof(short);
+
+  bool isStreamed = config->streamingMode == AudioClipStreamingMode::Always ||
+    (config->streamingMode == AudioClipStreamingMode::Auto && samplesSize > STREAMING_CLIP_SIZE_THRESHOLD);
+
+  if (isStreamed) {
+    stb_vorbis_close(decoder);
+
+    allocateResource<AudioClip>(resourceIndex, format, config->resourcePath, framesCount, info.sample_rate);
+    return;
   }
 
-  allocateResource<AudioClip>(resourceIndex, format, audioData, dataLength, sampleRate);
+  std::vector<short> samples(framesCount * channelsCount);
+
+  int decodedFramesCount = stb_vorbis_get_samples_short_interleaved(decoder, info.channels,
+    samples.data(), static_cast<int>(samples.size()));
+
+  stb_vorbis_close(decoder);
 
-  free(audioData);
+  allocateResource<AudioClip>(resourceIndex, format, reinterpret_cast<const std::byte*>(samples.data()),
+    static_cast<size_t>(decodedFramesCount) * channelsCount * sizeof(short), info.sample_rate);
 }
@@ -6,10 +6,18 @@
 #include "Modules/ResourceManagement/ResourcesManagement.h"
 #include "Modules/Audio/AudioClip.h"
 
+enum class AudioClipStreamingMode {
+  // The clip is streamed if its decoded size exceeds the streaming threshold
+  Auto,
+  Always,
+  Never
+};
+
 struct AudioClipResourceConfig {
   AudioClipResourceConfig() = default;
 
   std::string resourcePath;
+  AudioClipStreamingMode streamingMode = AudioClipStreamingMode::Auto;
 };
 
 class AudioClipResourceManager : public ResourceManager<AudioClip, AudioClipResourceConfig> {
@@ -19,4 +27,8 @@ class AudioClipResourceManager : public ResourceManager<AudioClip, AudioClipReso
 
   void load(size_t resourceIndex) override;
   void parseConfig(size_t resourceIndex, pugi::xml_node configNode) override;
+
+ public:
+  // About 24 seconds of 16-bit stereo 44.1 kHz audio
+  static constexpr size_t STREAMING_CLIP_SIZE_THRESHOLD = 4 * 1024 * 1024;
 };
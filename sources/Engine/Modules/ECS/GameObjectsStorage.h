@@ -7,6 +7,8 @@
 #include "Utility/DynamicObjectsPool.h"
 #include "Utility/DataArchive.h"
 
+#include <cereal/archives/binary.hpp>
+
 #include "GameObject.h"
 #include "GameObjectsFactory.h"
 
@@ -16,6 +18,9 @@ struct ComponentTypeData {
   bool isSerializable{};
   std::function<void(cereal::XMLOutputArchive&, const void*)> saveProxy{};
   std::function<void(cereal::XMLInputArchive&, GameObject&, BaseGameObjectsComponentsBindersFactory&)> loadProxy{};
+  std::function<void(cereal::BinaryOutputArchive&, const void*)> binarySaveProxy{};
+  std::function<void(cereal::BinaryInputArchive&, GameObject&,
+    BaseGameObjectsComponentsBindersFactory&)> binaryLoadProxy{};
 };
 
 struct ComponentsTypeInfo {
@@ -31,36 +36,10 @@ struct ComponentsTypeInfo {
   static size_t getNextTypeIndex()
   {
     s_componentsData[s_typeIndex].isSerializable = T::s_isSerializable;
-    s_componentsData[s_typeIndex].saveProxy = [](cereal::XMLOutputArchive& archive, const void* componentInstanceData) {
-      if constexpr (T::s_isSerializable) {
-        const T* componentInstance = static_cast<const T*>(componentInstanceData);
-        archive(componentInstance->getBindingParameters());
-      }
-      else {
-        ARG_UNUSED(archive);
-        ARG_UNUSED(componentInstanceData);
-        SW_ASSERT(false);
-      }
-    };
-    s_componentsData[s_typeIndex].loadProxy = [](cereal::XMLInputArchive& archive, GameObject& gameObject,
-      BaseGameObjectsComponentsBindersFactory& bindersFactory) {
-      if constexpr (T::s_isSerializable) {
-        typename T::BindingParameters bindingParameters{};
-        archive(bindingParameters);
-
-        auto& componentBindersFactory = dynamic_cast<GameObjectsComponentsBindersFactory<T>&>(bindersFactory);
-        std::unique_ptr<GameObjectsComponentBinder<T>>
-          binder = componentBindersFactory.createBinder(bindingParameters);
-
-        binder->bindToObject(gameObject);
-      }
-      else {
-        ARG_UNUSED(archive);
-        ARG_UNUSED(gameObject);
-        ARG_UNUSED(bindersFactory);
-        SW_ASSERT(false);
-      }
-    };
+    s_componentsData[s_typeIndex].saveProxy = &saveComponentData<T, cereal::XMLOutputArchive>;
+    s_componentsData[s_typeIndex].loadProxy = &loadComponentData<T, cereal::XMLInputArchive>;
+    s_componentsData[s_typeIndex].binarySaveProxy = &saveComponentData<T, cereal::BinaryOutputArchive>;
+    s_componentsData[s_typeIndex].binaryLoadProxy = &loadComponentData<T, cereal::BinaryInputArchive>;
 
     return s_typeIndex++;
   }
@@ -78,6 +57,14 @@ struct ComponentsTypeInfo {
     s_componentsData[componentTypeIndex].saveProxy(archive, componentInstanceData);
   }
 
+  static void performSave(cereal::BinaryOutputArchive& archive,
+    size_t componentTypeIndex,
+    const void* componentInstanceData)
+  {
+    SW_ASSERT(isSerializable(componentTypeIndex));
+    s_componentsData[componentTypeIndex].binarySaveProxy(archive, componentInstanceData);
+  }
+
   static void performLoad(cereal::XMLInputArchive& archive, size_t componentTypeIndex, GameObject& gameObject,
     BaseGameObjectsComponentsBindersFactory& bindersFactory)
   {
@@ -85,6 +72,49 @@ struct ComponentsTypeInfo {
     s_componentsData[componentTypeIndex].loadProxy(archive, gameObject, bindersFactory);
   }
 
+  static void performLoad(cereal::BinaryInputArchive& archive, size_t componentTypeIndex, GameObject& gameObject,
+    BaseGameObjectsComponentsBindersFactory& bindersFactory)
+  {
+    SW_ASSERT(isSerializable(componentTypeIndex));
+    s_componentsData[componentTypeIndex].binaryLoadProxy(archive, gameObject, bindersFactory);
+  }
+
+  template<class T, class Archive>
+  static void saveComponentData(Archive& archive, const void* componentInstanceData)
+  {
+    if constexpr (T::s_isSerializable) {
+      const T* componentInstance = static_cast<const T*>(componentInstanceData);
+      archive(componentInstance->getBindingParameters());
+    }
+    else {
+      ARG_UNUSED(archive);
+      ARG_UNUSED(componentInstanceData);
+      SW_ASSERT(false);
+    }
+  }
+
+  template<class T, class Archive>
+  static void loadComponentData(Archive& archive, GameObject& gameObject,
+    BaseGameObjectsComponentsBindersFactory& bindersFactory)
+  {
+    if constexpr (T::s_isSerializable) {
+      typename T::BindingParameters bindingParameters{};
+      archive(bindingParameters);
+
+      auto& componentBindersFactory = dynamic_cast<GameObjectsComponentsBindersFactory<T>&>(bindersFactory);
+      std::unique_ptr<GameObjectsComponentBinder<T>>
+        binder = componentBindersFactory.createBinder(bindingParameters);
+
+      binder->bindToObject(gameObject);
+    }
+    else {
+      ARG_UNUSED(archive);
+      ARG_UNUSED(gameObject);
+      ARG_UNUSED(bindersFactory);
+      SW_ASSERT(false);
+    }
+  }
+
   static size_t s_typeIndex;
   static ComponentTypeData s_componentsData[GameObjectData::MAX_COMPONENTS_COUNT];
 };
@@ -337,6 +367,29 @@ class GameObjectsStorage {
     return m_gameObjects[gameObject.m_id].componentsMask.test(typeId);
   }
 
+  /*!
+   * \brief Finds the component of the game object by its ID without creating handles
+   *
+   * \param gameObjectId game object ID
+   * \return the component or nullptr if the object is removed or does not have the component
+   */
+  template<class T>
+  [[nodiscard]] inline T* findComponent(GameObjectId gameObjectId)
+  {
+    if (gameObjectId >= m_gameObjects.size()) {
+      return nullptr;
+    }
+
+    size_t typeId = ComponentsTypeInfo::getTypeIndex<T>();
+
+    // Components of removed objects are freed, so their masks are empty
+    if (!m_gameObjects[gameObjectId].componentsMask.test(typeId)) {
+      return nullptr;
+    }
+
+    return static_cast<T*>(m_componentsDataPools[typeId]->getObject(gameObjectId));
+  }
+
   template<class ComponentType>
   void registerComponentBinderFactory(std::shared_ptr<BaseGameObjectsComponentsBindersFactory> bindersFactory)
   {
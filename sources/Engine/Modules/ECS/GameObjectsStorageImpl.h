@@ -41,7 +41,7 @@ inline GameObjectComponentHandle<T> GameObjectsStorage::assignComponent(GameObje
   size_t typeId = ComponentsTypeInfo::getTypeIndex<T>();
 
   if (m_componentsDataPools[typeId] == nullptr) {
-    m_componentsDataPools[typeId] = new ComponentsPool<T>(8192);
+    m_componentsDataPools[typeId] = new ComponentsPool<T>(8192, MemoryCounters::ECS);
     m_componentsUtilities[typeId] = new GameObjectGenericComponentsUtility<T>(m_gameWorld, this);
   }
 
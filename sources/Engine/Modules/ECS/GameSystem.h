@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Modules/Profiling/CPUProfiler.h"
+
 class GameWorld;
 
 class GameSystemsGroup;
@@ -98,6 +100,9 @@ class GameSystem {
 
   GameWorld* m_gameWorld{};
 
+  // The scope is named after the system type, it is registered once the system is added to a group
+  ProfilerScopeId m_profilerScopeId{};
+
  private:
   friend class GameSystemsGroup;
 };
@@ -5,6 +5,7 @@
 #include "GameSystemsGroup.h"
 
 #include <algorithm>
+#include <boost/core/demangle.hpp>
 
 #include "GameWorld.h"
 
@@ -54,6 +55,7 @@ void GameSystemsGroup::beforeRender()
   }
 
   for (auto& system : m_gameSystems) {
+    SW_PROFILE_SCOPE_ID(system->m_profilerScopeId);
     system->beforeRender();
   }
 }
@@ -66,6 +68,7 @@ void GameSystemsGroup::render()
 
   for (auto& system : m_gameSystems) {
     if (system->isActive()) {
+      SW_PROFILE_SCOPE_ID(system->m_profilerScopeId);
       system->render();
     }
   }
@@ -79,6 +82,7 @@ void GameSystemsGroup::afterRender()
 
   for (auto& system : m_gameSystems) {
     if (system->isActive()) {
+      SW_PROFILE_SCOPE_ID(system->m_profilerScopeId);
       system->afterRender();
     }
   }
@@ -92,6 +96,7 @@ void GameSystemsGroup::fixedUpdate(float delta)
 
   for (auto& system : m_gameSystems) {
     if (system->isActive()) {
+      SW_PROFILE_SCOPE_ID(system->m_profilerScopeId);
       system->fixedUpdate(delta);
     }
   }
@@ -105,6 +110,7 @@ void GameSystemsGroup::update(float delta)
 
   for (auto& system : m_gameSystems) {
     if (system->isActive()) {
+      SW_PROFILE_SCOPE_ID(system->m_profilerScopeId);
       system->update(delta);
     }
   }
@@ -132,6 +138,7 @@ void GameSystemsGroup::addGameSystem(std::shared_ptr<GameSystem> system)
   SW_ASSERT(m_gameWorld != nullptr && "Parent game system group should be added to other group");
 
   system->m_gameWorld = m_gameWorld;
+  system->m_profilerScopeId = CPUProfiler::registerScope(boost::core::demangle(typeid(*system).name()));
 
   m_gameSystems.push_back(system);
 
@@ -6,11 +6,13 @@
 #include <typeindex>
 #include <memory>
 #include <utility>
+#include <sstream>
 
 #include "GameSystemsGroup.h"
 #include "GameObject.h"
 #include "GameObjectsFactory.h"
 #include "GameObjectsStorage.h"
+#include "GameWorldSnapshot.h"
 
 #include "GameObjectsSequentialView.h"
 #include "GameObjectsComponentsView.h"
@@ -66,6 +68,7 @@ class GameWorld {
  */
   void fixedUpdate(float delta)
   {
+    SW_PROFILE_SCOPE("GameWorld::fixedUpdate");
     m_gameSystemsGroup->fixedUpdate(delta);
   }
 
@@ -79,6 +82,7 @@ class GameWorld {
    */
   void update(float delta)
   {
+    SW_PROFILE_SCOPE("GameWorld::update");
     m_gameSystemsGroup->update(delta);
   }
 
@@ -87,6 +91,7 @@ class GameWorld {
    */
   void render()
   {
+    SW_PROFILE_SCOPE("GameWorld::render");
     m_gameSystemsGroup->render();
   }
 
@@ -95,6 +100,7 @@ class GameWorld {
    */
   void beforeRender()
   {
+    SW_PROFILE_SCOPE("GameWorld::beforeRender");
     m_gameSystemsGroup->beforeRender();
   }
 
@@ -103,6 +109,7 @@ class GameWorld {
    */
   void afterRender()
   {
+    SW_PROFILE_SCOPE("GameWorld::afterRender");
     m_gameSystemsGroup->afterRender();
   }
 
@@ -225,6 +232,15 @@ class GameWorld {
   template<class ComponentType>
   GameObjectsComponentsView<ComponentType> allWith();
 
+  /*!
+   * \brief Finds the component of the game object by its ID, it is intended for bulk updates of components
+   *
+   * \param gameObjectId game object ID
+   * \return the component or nullptr if the object is removed or does not have the component
+   */
+  template<class ComponentType>
+  [[nodiscard]] ComponentType* findComponent(GameObjectId gameObjectId);
+
   /*!
    * \brief Subscribes the event listener for the specified event
    *
@@ -312,14 +328,7 @@ class GameWorld {
       std::string objectName;
       archive(objectName);
 
-      GameObject gameObject{};
-
-      if (objectName.empty()) {
-        gameObject = createGameObject();
-      }
-      else {
-        gameObject = createGameObject(objectName);
-      }
+      GameObject gameObject = objectName.empty() ? createGameObject() : createGameObject(objectName);
 
       std::bitset<GameObjectData::MAX_COMPONENTS_COUNT> componentsMask;
       archive(componentsMask);
@@ -335,6 +344,73 @@ class GameWorld {
     }
   }
 
+  /*!
+   * \brief Captures binary serialized data of all serializable game objects
+   *
+   * The snapshot does not reference the game world, so it could be processed
+   * and written to disk asynchronously.
+   *
+   * \return the game world snapshot
+   */
+  [[nodiscard]] GameWorldSnapshot createSnapshot() const
+  {
+    GameWorldSnapshot snapshot;
+    std::ostringstream componentStream;
+
+    for (GameObject gameObject : all()) {
+      if (!gameObject.isAlive() || !gameObject.isSerializable()) {
+        continue;
+      }
+
+      GameObjectSnapshot& objectSnapshot = snapshot.getGameObjects().emplace_back();
+      objectSnapshot.name = gameObject.getName();
+
+      std::bitset<GameObjectData::MAX_COMPONENTS_COUNT> componentsMask = gameObject.getComponentsMask();
+
+      for (size_t componentBitIndex = 0; componentBitIndex < componentsMask.size(); componentBitIndex++) {
+        if (componentsMask.test(componentBitIndex) && ComponentsTypeInfo::isSerializable(componentBitIndex)) {
+          componentStream.str(std::string());
+
+          {
+            cereal::BinaryOutputArchive componentArchive(componentStream);
+            ComponentsTypeInfo::performSave(componentArchive, componentBitIndex,
+              m_gameObjectsStorage->getComponentRawData(gameObject, componentBitIndex));
+          }
+
+          objectSnapshot.components.push_back({
+            .typeIndex = static_cast<uint32_t>(componentBitIndex),
+            .isInherited = false,
+            .data = componentStream.str()});
+        }
+      }
+    }
+
+    return snapshot;
+  }
+
+  /*!
+   * \brief Creates game objects from the snapshot data
+   *
+   * \param snapshot complete (non-delta) game world snapshot
+   */
+  void restoreSnapshot(const GameWorldSnapshot& snapshot)
+  {
+    SW_ASSERT(!snapshot.isDelta());
+
+    for (const GameObjectSnapshot& objectSnapshot : snapshot.getGameObjects()) {
+      GameObject gameObject = objectSnapshot.name.empty() ?
+                              createGameObject() : createGameObject(objectSnapshot.name);
+
+      for (const GameObjectComponentSnapshot& componentSnapshot : objectSnapshot.components) {
+        std::istringstream componentStream(componentSnapshot.data);
+        cereal::BinaryInputArchive componentArchive(componentStream);
+
+        ComponentsTypeInfo::performLoad(componentArchive, componentSnapshot.typeIndex,
+          gameObject, m_gameObjectsStorage->getComponentBinderFactory(componentSnapshot.typeIndex));
+      }
+    }
+  }
+
   template<class ComponentType>
   void registerComponentBinderFactory(std::shared_ptr<BaseGameObjectsComponentsBindersFactory> bindersFactory)
   {
@@ -387,6 +463,12 @@ inline GameObjectsComponentsView<ComponentType> GameWorld::allWith()
   return GameObjectsComponentsView<ComponentType>(begin, end);
 }
 
+template<class ComponentType>
+inline ComponentType* GameWorld::findComponent(GameObjectId gameObjectId)
+{
+  return m_gameObjectsStorage->template findComponent<ComponentType>(gameObjectId);
+}
+
 template<class T>
 inline void GameWorld::subscribeEventsListener(EventsListener<T>* listener)
 {
@@ -0,0 +1,129 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "GameWorldSnapshot.h"
+
+#include "Exceptions/exceptions.h"
+
+std::vector<GameObjectSnapshot>& GameWorldSnapshot::getGameObjects()
+{
+  return m_gameObjects;
+}
+
+const std::vector<GameObjectSnapshot>& GameWorldSnapshot::getGameObjects() const
+{
+  return m_gameObjects;
+}
+
+GameWorldSnapshot GameWorldSnapshot::createDelta(const GameWorldSnapshot& baseline) const
+{
+  SW_ASSERT(!baseline.m_isDelta);
+
+  std::unordered_map<std::string_view, const GameObjectSnapshot*> baselineObjects;
+
+  for (const GameObjectSnapshot& baselineObject : baseline.m_gameObjects) {
+    if (!baselineObject.name.empty()) {
+      baselineObjects.insert({baselineObject.name, &baselineObject});
+    }
+  }
+
+  GameWorldSnapshot delta;
+  delta.m_isDelta = true;
+  delta.m_gameObjects.reserve(m_gameObjects.size());
+
+  for (const GameObjectSnapshot& gameObject : m_gameObjects) {
+    GameObjectSnapshot& deltaObject = delta.m_gameObjects.emplace_back();
+    deltaObject.name = gameObject.name;
+    deltaObject.components.reserve(gameObject.components.size());
+
+    auto baselineObjectIt = gameObject.name.empty() ? baselineObjects.end() : baselineObjects.find(gameObject.name);
+
+    for (const GameObjectComponentSnapshot& component : gameObject.components) {
+      bool isComponentChanged = true;
+
+      if (baselineObjectIt != baselineObjects.end()) {
+        for (const GameObjectComponentSnapshot& baselineComponent : baselineObjectIt->second->components) {
+          if (baselineComponent.typeIndex == component.typeIndex) {
+            isComponentChanged = baselineComponent.data != component.data;
+            break;
+          }
+        }
+      }
+
+      if (isComponentChanged) {
+        deltaObject.components.push_back(component);
+      }
+      else {
+        deltaObject.components.push_back({.typeIndex = component.typeIndex, .isInherited = true, .data = {}});
+      }
+    }
+  }
+
+  return delta;
+}
+
+void GameWorldSnapshot::applyBaseline(const GameWorldSnapshot& baseline)
+{
+  SW_ASSERT(!baseline.m_isDelta);
+
+  std::unordered_map<std::string_view, const GameObjectSnapshot*> baselineObjects;
+
+  for (const GameObjectSnapshot& baselineObject : baseline.m_gameObjects) {
+    if (!baselineObject.name.empty()) {
+      baselineObjects.insert({baselineObject.name, &baselineObject});
+    }
+  }
+
+  for (GameObjectSnapshot& gameObject : m_gameObjects) {
+    for (GameObjectComponentSnapshot& component : gameObject.components) {
+      if (!component.isInherited) {
+        continue;
+      }
+
+      auto baselineObjectIt = baselineObjects.find(gameObject.name);
+
+      if (baselineObjectIt == baselineObjects.end()) {
+        THROW_EXCEPTION(EngineRuntimeException,
+          fmt::format("Game object {} is not found in the baseline snapshot", gameObject.name));
+      }
+
+      auto& baselineComponents = baselineObjectIt->second->components;
+      auto baselineComponentIt = std::find_if(baselineComponents.begin(), baselineComponents.end(),
+        [&component](const GameObjectComponentSnapshot& baselineComponent) {
+          return baselineComponent.typeIndex == component.typeIndex;
+        });
+
+      if (baselineComponentIt == baselineComponents.end()) {
+        THROW_EXCEPTION(EngineRuntimeException,
+          fmt::format("Component {} of game object {} is not found in the baseline snapshot",
+            component.typeIndex, gameObject.name));
+      }
+
+      component.data = baselineComponentIt->data;
+      component.isInherited = false;
+    }
+  }
+
+  m_isDelta = false;
+}
+
+bool GameWorldSnapshot::isDelta() const
+{
+  return m_isDelta;
+}
+
+size_t GameWorldSnapshot::getDataSize() const
+{
+  size_t dataSize = 0;
+
+  for (const GameObjectSnapshot& gameObject : m_gameObjects) {
+    dataSize += gameObject.name.size();
+
+    for (const GameObjectComponentSnapshot& component : gameObject.components) {
+      dataSize += component.data.size();
+    }
+  }
+
+  return dataSize;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
+/*!
+ * \brief Serialized data of a single game object component
+ *
+ * Inherited components do not store any data, it should be taken
+ * from the baseline snapshot the delta was built against.
+ */
+struct GameObjectComponentSnapshot {
+  uint32_t typeIndex{};
+  bool isInherited{};
+  std::string data;
+
+  template<class Archive>
+  void serialize(Archive& archive)
+  {
+    archive(typeIndex, isInherited, data);
+  }
+};
+
+struct GameObjectSnapshot {
+  std::string name;
+  std::vector<GameObjectComponentSnapshot> components;
+
+  template<class Archive>
+  void serialize(Archive& archive)
+  {
+    archive(name, components);
+  }
+};
+
+/*!
+ * \brief Class for representing an immutable copy of serializable game world data
+ *
+ * The snapshot stores binary serialized components data of game objects, so
+ * it could be written to disk without access to the game world, e.g. from
+ * a background thread.
+ */
+class GameWorldSnapshot {
+ public:
+  GameWorldSnapshot() = default;
+
+  [[nodiscard]] std::vector<GameObjectSnapshot>& getGameObjects();
+  [[nodiscard]] const std::vector<GameObjectSnapshot>& getGameObjects() const;
+
+  /*!
+   * \brief Builds a delta snapshot that contains only components changed since the baseline
+   *
+   * Unnamed game objects can not be matched with the baseline, so they are always stored completely.
+   *
+   * \param baseline baseline snapshot
+   * \return delta snapshot
+   */
+  [[nodiscard]] GameWorldSnapshot createDelta(const GameWorldSnapshot& baseline) const;
+
+  /*!
+   * \brief Restores inherited components data from the baseline snapshot
+   *
+   * \param baseline baseline snapshot the delta was built against
+   */
+  void applyBaseline(const GameWorldSnapshot& baseline);
+
+  [[nodiscard]] bool isDelta() const;
+
+  /*!
+   * \brief Returns total size of the stored components data
+   *
+   * \return size of the stored components data in bytes
+   */
+  [[nodiscard]] size_t getDataSize() const;
+
+  template<class Archive>
+  void serialize(Archive& archive)
+  {
+    archive(m_isDelta, m_gameObjects);
+  }
+
+ private:
+  std::vector<GameObjectSnapshot> m_gameObjects;
+  bool m_isDelta = false;
+};
@@ -0,0 +1,119 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "GUIDrawList.h"
+
+bool GUIDrawState::isBatchableWith(const GUIDrawState& other) const
+{
+  return color == other.color &&
+    backgroundTexture.get() == other.backgroundTexture.get() &&
+    alphaTexture.get() == other.alphaTexture.get() &&
+    scissorsRect.getOrigin() == other.scissorsRect.getOrigin() &&
+    scissorsRect.getSize() == other.scissorsRect.getSize();
+}
+
+void GUIDrawList::addQuad(const GUIDrawState& state,
+  const glm::vec2& topLeft, const glm::vec2& bottomRight,
+  const glm::vec2& uvTopLeft, const glm::vec2& uvBottomRight)
+{
+  // Vertices are stored in the clockwise order starting from the top left corner
+  m_positions.emplace_back(topLeft.x, topLeft.y, 0.0f);
+  m_positions.emplace_back(bottomRight.x, topLeft.y, 0.0f);
+  m_positions.emplace_back(bottomRight.x, bottomRight.y, 0.0f);
+  m_positions.emplace_back(topLeft.x, bottomRight.y, 0.0f);
+
+  m_uv.emplace_back(uvTopLeft.x, uvTopLeft.y);
+  m_uv.emplace_back(uvBottomRight.x, uvTopLeft.y);
+  m_uv.emplace_back(uvBottomRight.x, uvBottomRight.y);
+  m_uv.emplace_back(uvTopLeft.x, uvBottomRight.y);
+
+  addQuadsToCommand(state, 1);
+}
+
+void GUIDrawList::addGlyphQuads(const GUIDrawState& state, std::span<const GUIGlyphQuad> glyphs,
+  const glm::vec2& offset)
+{
+  if (glyphs.empty()) {
+    return;
+  }
+
+  size_t verticesOffset = m_positions.size();
+
+  m_positions.resize(verticesOffset + glyphs.size() * QUAD_VERTICES_COUNT);
+  m_uv.resize(m_positions.size());
+
+  glm::vec3* positions = m_positions.data() + verticesOffset;
+  glm::vec2* uv = m_uv.data() + verticesOffset;
+
+  for (const GUIGlyphQuad& glyph : glyphs) {
+    glm::vec2 topLeft = glyph.topLeft + offset;
+    glm::vec2 bottomRight = glyph.bottomRight + offset;
+
+    *positions++ = {topLeft.x, topLeft.y, 0.0f};
+    *positions++ = {bottomRight.x, topLeft.y, 0.0f};
+    *positions++ = {bottomRight.x, bottomRight.y, 0.0f};
+    *positions++ = {topLeft.x, bottomRight.y, 0.0f};
+
+    *uv++ = {glyph.uvTopLeft.x, glyph.uvTopLeft.y};
+    *uv++ = {glyph.uvBottomRight.x, glyph.uvTopLeft.y};
+    *uv++ = {glyph.uvBottomRight.x, glyph.uvBottomRight.y};
+    *uv++ = {glyph.uvTopLeft.x, glyph.uvBottomRight.y};
+  }
+
+  addQuadsToCommand(state, glyphs.size());
+}
+
+void GUIDrawList::append(const GUIDrawList& drawList)
+{
+  m_positions.insert(m_positions.end(), drawList.m_positions.begin(), drawList.m_positions.end());
+  m_uv.insert(m_uv.end(), drawList.m_uv.begin(), drawList.m_uv.end());
+
+  for (const GUIDrawCommand& command : drawList.m_commands) {
+    addQuadsToCommand(command.state, command.quadsCount);
+  }
+}
+
+void GUIDrawList::clear()
+{
+  m_positions.clear();
+  m_uv.clear();
+  m_commands.clear();
+}
+
+bool GUIDrawList::isEmpty() const
+{
+  return m_commands.empty();
+}
+
+size_t GUIDrawList::getQuadsCount() const
+{
+  return m_positions.size() / QUAD_VERTICES_COUNT;
+}
+
+const std::vector<glm::vec3>& GUIDrawList::getPositions() const
+{
+  return m_positions;
+}
+
+const std::vector<glm::vec2>& GUIDrawList::getUV() const
+{
+  return m_uv;
+}
+
+const std::vector<GUIDrawCommand>& GUIDrawList::getCommands() const
+{
+  return m_commands;
+}
+
+void GUIDrawList::addQuadsToCommand(const GUIDrawState& state, size_t quadsCount)
+{
+  if (!m_commands.empty() && m_commands.back().state.isBatchableWith(state)) {
+    m_commands.back().quadsCount += quadsCount;
+    return;
+  }
+
+  size_t firstQuadIndex = (m_commands.empty()) ? 0 : m_commands.back().firstQuadIndex + m_commands.back().quadsCount;
+
+  m_commands.push_back(GUIDrawCommand{.state = state, .firstQuadIndex = firstQuadIndex, .quadsCount = quadsCount});
+}
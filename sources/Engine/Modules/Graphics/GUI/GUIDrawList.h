@@ -0,0 +1,81 @@
+#pragma once
+
+#include <vector>
+#include <span>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include "Modules/Math/Rect.h"
+#include "Modules/ResourceManagement/ResourcesManagement.h"
+#include "Modules/Graphics/OpenGL/GLTexture.h"
+
+#include "GUITextLayout.h"
+
+/*!
+ * \brief Shading state of GUI quads, the quads with the same state are drawn at once
+ */
+struct GUIDrawState {
+  glm::vec4 color{};
+  ResourceHandle<GLTexture> backgroundTexture;
+  ResourceHandle<GLTexture> alphaTexture;
+  RectI scissorsRect;
+
+  [[nodiscard]] bool isBatchableWith(const GUIDrawState& other) const;
+};
+
+struct GUIDrawCommand {
+  GUIDrawState state;
+
+  size_t firstQuadIndex{};
+  size_t quadsCount{};
+};
+
+/*!
+ * \brief Screen space quads of GUI widgets grouped into draw commands
+ *
+ * Sequential quads with the same shading state are merged into one command, so the widgets that share
+ * a texture atlas (e.g. a font bitmap) and a scissors rectangle are drawn at once. The quads order is
+ * preserved, so the widgets are still drawn in the z-order.
+ */
+class GUIDrawList {
+ public:
+  GUIDrawList() = default;
+
+  void addQuad(const GUIDrawState& state,
+    const glm::vec2& topLeft, const glm::vec2& bottomRight,
+    const glm::vec2& uvTopLeft, const glm::vec2& uvBottomRight);
+
+  /*!
+   * \brief Writes the shaped glyphs run moved by the offset, the storage is grown once for the whole run
+   */
+  void addGlyphQuads(const GUIDrawState& state, std::span<const GUIGlyphQuad> glyphs, const glm::vec2& offset);
+
+  /*!
+   * \brief Appends the quads of other list, its first command is merged with the last one if possible
+   */
+  void append(const GUIDrawList& drawList);
+
+  void clear();
+
+  [[nodiscard]] bool isEmpty() const;
+  [[nodiscard]] size_t getQuadsCount() const;
+
+  [[nodiscard]] const std::vector<glm::vec3>& getPositions() const;
+  [[nodiscard]] const std::vector<glm::vec2>& getUV() const;
+  [[nodiscard]] const std::vector<GUIDrawCommand>& getCommands() const;
+
+ public:
+  static constexpr size_t QUAD_VERTICES_COUNT = 4;
+  static constexpr size_t QUAD_INDICES_COUNT = 6;
+
+ private:
+  void addQuadsToCommand(const GUIDrawState& state, size_t quadsCount);
+
+ private:
+  std::vector<glm::vec3> m_positions;
+  std::vector<glm::vec2> m_uv;
+
+  std::vector<GUIDrawCommand> m_commands;
+};
@@ -91,15 +91,16 @@ void GUIDropDownList::addItem(const std::string& text, const std::string& value)
   m_currentItemId = 0;
 
   m_isItemsLayoutOutdated = true;
+  resetRenderingCache();
 }
 
-void GUIDropDownList::render(GUISystem& guiSystem)
+void GUIDropDownList::render(GUISystem& guiSystem, GUIDrawList& drawList)
 {
   if (m_isItemsLayoutOutdated) {
     updateLayout();
   }
 
-  GUIWidgetRect::render(guiSystem);
+  GUIWidgetRect::render(guiSystem, drawList);
 }
 
 void GUIDropDownList::updateLayout()
@@ -125,6 +126,7 @@ void GUIDropDownList::setItemsMargin(const glm::ivec2& margin)
 {
   m_itemsMargin = margin;
   m_isItemsLayoutOutdated = true;
+  resetRenderingCache();
 }
 
 const glm::ivec2& GUIDropDownList::getItemsMargin() const
@@ -225,5 +227,6 @@ void GUIDropDownList::setCurrentItemById(int16_t id)
 
     m_currentItemId = id;
     m_isItemsLayoutOutdated = true;
+    resetRenderingCache();
   }
 }
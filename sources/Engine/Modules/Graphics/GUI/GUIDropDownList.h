@@ -32,7 +32,7 @@ class GUIDropDownList : public GUIWidgetRect {
   void applyStylesheetRuleToChildren(const GUIWidgetStylesheetRule& stylesheetRule,
     const std::vector<GUIWidgetStylesheetSelectorPart>& currentPath) override;
 
-  void render(GUISystem& guiSystem) override;
+  void render(GUISystem& guiSystem, GUIDrawList& drawList) override;
 
  public:
   static std::shared_ptr<GUIDropDownList> create();
@@ -0,0 +1,150 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "GUIHitTestingIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "GUIWidget.h"
+
+void GUIHitTestingIndex::build(GUIWidget& rootWidget)
+{
+  clear();
+
+  if (rootWidget.isShown()) {
+    collectEntries(rootWidget);
+  }
+
+  glm::ivec2 boundsMin(std::numeric_limits<int>::max());
+  glm::ivec2 boundsMax(std::numeric_limits<int>::min());
+
+  for (const Entry& entry : m_entries) {
+    boundsMin = glm::min(boundsMin, entry.rect.getOrigin());
+    boundsMax = glm::max(boundsMax, entry.rect.getOrigin() + entry.rect.getSize());
+  }
+
+  if (m_entries.empty() || boundsMin.x > boundsMax.x || boundsMin.y > boundsMax.y) {
+    return;
+  }
+
+  // Huge layouts are covered by larger cells to keep the grid memory bounded
+  glm::ivec2 boundsSize = boundsMax - boundsMin;
+  m_cellSize = std::max({DEFAULT_CELL_SIZE,
+    boundsSize.x / MAX_CELLS_PER_AXIS + 1,
+    boundsSize.y / MAX_CELLS_PER_AXIS + 1});
+
+  m_gridOrigin = boundsMin;
+  m_gridSize = boundsSize / m_cellSize + 1;
+
+  // The cells are filled in two passes to store all entries indices in a single array
+  m_cellsOffsets.assign(static_cast<size_t>(m_gridSize.x * m_gridSize.y) + 1, 0);
+
+  auto forEachEntryCell = [this](const Entry& entry, auto function) {
+    if (entry.rect.getWidth() < 0 || entry.rect.getHeight() < 0) {
+      return;
+    }
+
+    glm::ivec2 minCell = getCellCoordinates(entry.rect.getOrigin());
+    glm::ivec2 maxCell = getCellCoordinates(entry.rect.getOrigin() + entry.rect.getSize());
+
+    for (int y = minCell.y; y <= maxCell.y; y++) {
+      for (int x = minCell.x; x <= maxCell.x; x++) {
+        function(static_cast<size_t>(y * m_gridSize.x + x));
+      }
+    }
+  };
+
+  for (const Entry& entry : m_entries) {
+    forEachEntryCell(entry, [this](size_t cellIndex) {
+      m_cellsOffsets[cellIndex + 1]++;
+    });
+  }
+
+  for (size_t cellIndex = 1; cellIndex < m_cellsOffsets.size(); cellIndex++) {
+    m_cellsOffsets[cellIndex] += m_cellsOffsets[cellIndex - 1];
+  }
+
+  m_cellsEntries.resize(m_cellsOffsets.back());
+
+  std::vector<size_t> cellsFillSizes(m_cellsOffsets.size() - 1, 0);
+
+  // Entries are visited in the drawing order, so every cell list is z-ordered as well
+  for (size_t entryIndex = 0; entryIndex < m_entries.size(); entryIndex++) {
+    forEachEntryCell(m_entries[entryIndex], [this, entryIndex, &cellsFillSizes](size_t cellIndex) {
+      m_cellsEntries[m_cellsOffsets[cellIndex] + cellsFillSizes[cellIndex]++] = entryIndex;
+    });
+  }
+}
+
+void GUIHitTestingIndex::clear()
+{
+  m_entries.clear();
+  m_cellsOffsets.clear();
+  m_cellsEntries.clear();
+
+  m_gridOrigin = glm::ivec2(0);
+  m_gridSize = glm::ivec2(0);
+  m_cellSize = DEFAULT_CELL_SIZE;
+}
+
+void GUIHitTestingIndex::queryEntriesAtPoint(const glm::ivec2& point, std::vector<size_t>& result) const
+{
+  if (m_cellsOffsets.empty()) {
+    return;
+  }
+
+  glm::ivec2 cell = getCellCoordinates(point);
+
+  if (cell.x < 0 || cell.y < 0 || cell.x >= m_gridSize.x || cell.y >= m_gridSize.y) {
+    return;
+  }
+
+  auto cellIndex = static_cast<size_t>(cell.y * m_gridSize.x + cell.x);
+
+  for (size_t offset = m_cellsOffsets[cellIndex]; offset < m_cellsOffsets[cellIndex + 1]; offset++) {
+    size_t entryIndex = m_cellsEntries[offset];
+
+    if (m_entries[entryIndex].rect.isPointInRect(point)) {
+      result.push_back(entryIndex);
+    }
+  }
+}
+
+const std::vector<GUIHitTestingIndex::Entry>& GUIHitTestingIndex::getEntries() const
+{
+  return m_entries;
+}
+
+bool GUIHitTestingIndex::isEntryExclusive(size_t entryIndex, const std::vector<size_t>& queryResult) const
+{
+  auto nextEntryIt = std::upper_bound(queryResult.begin(), queryResult.end(), entryIndex);
+
+  return nextEntryIt == queryResult.end() || *nextEntryIt >= m_entries[entryIndex].subtreeEnd;
+}
+
+void GUIHitTestingIndex::collectEntries(GUIWidget& widget)
+{
+  size_t entryIndex = m_entries.size();
+  m_entries.push_back(Entry{.widget = &widget, .rect = widget.getRect()});
+
+  for (const auto& childWidget : widget.getChildrenWidgets()) {
+    if (childWidget->isShown()) {
+      collectEntries(*childWidget);
+    }
+  }
+
+  m_entries[entryIndex].subtreeEnd = m_entries.size();
+}
+
+glm::ivec2 GUIHitTestingIndex::getCellCoordinates(const glm::ivec2& point) const
+{
+  glm::ivec2 offset = point - m_gridOrigin;
+
+  // Points to the left or above the grid should not be rounded to the first cell
+  return {
+    (offset.x < 0) ? -1 : offset.x / m_cellSize,
+    (offset.y < 0) ? -1 : offset.y / m_cellSize,
+  };
+}
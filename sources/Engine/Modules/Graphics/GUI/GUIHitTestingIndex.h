@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/common.hpp>
+
+#include "Modules/Math/Rect.h"
+
+class GUIWidget;
+
+/*!
+ * \brief Flat z-ordered list of the shown widgets rectangles with a uniform grid over it
+ *
+ * The index is rebuilt only on the widgets layout change, so hover and click resolution
+ * touches only the widgets of one grid cell instead of the whole widgets tree.
+ */
+class GUIHitTestingIndex {
+ public:
+  struct Entry {
+    GUIWidget* widget{};
+    RectI rect;
+
+    // The widget descendants are stored in the [index + 1, subtreeEnd) entries range
+    size_t subtreeEnd{};
+  };
+
+ public:
+  GUIHitTestingIndex() = default;
+
+  /*!
+   * \brief Collects the shown widgets of the tree in the drawing order, hidden subtrees are skipped
+   */
+  void build(GUIWidget& rootWidget);
+  void clear();
+
+  /*!
+   * \brief Finds the entries with the rectangles containing the point
+   *
+   * \param point query point in the screen space
+   * \param result list of found entries indices in the drawing order, the topmost widget is the last one
+   */
+  void queryEntriesAtPoint(const glm::ivec2& point, std::vector<size_t>& result) const;
+
+  [[nodiscard]] const std::vector<Entry>& getEntries() const;
+
+  /*!
+   * \brief Checks whether any descendant of the entry widget is found by the same query
+   */
+  [[nodiscard]] bool isEntryExclusive(size_t entryIndex, const std::vector<size_t>& queryResult) const;
+
+ public:
+  static constexpr int DEFAULT_CELL_SIZE = 64;
+  static constexpr int MAX_CELLS_PER_AXIS = 128;
+
+ private:
+  void collectEntries(GUIWidget& widget);
+
+  [[nodiscard]] glm::ivec2 getCellCoordinates(const glm::ivec2& point) const;
+
+ private:
+  std::vector<Entry> m_entries;
+
+  glm::ivec2 m_gridOrigin{};
+  glm::ivec2 m_gridSize{};
+  int m_cellSize = DEFAULT_CELL_SIZE;
+
+  // Entries of i-th cell are stored in m_cellsEntries[m_cellsOffsets[i], m_cellsOffsets[i + 1]) range
+  std::vector<size_t> m_cellsOffsets;
+  std::vector<size_t> m_cellsEntries;
+};
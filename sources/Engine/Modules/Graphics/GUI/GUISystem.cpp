@@ -3,10 +3,12 @@
 #pragma hdrstop
 
 #include "GUISystem.h"
+#include "GUITextLayout.h"
 
 #include <spdlog/spdlog.h>
 
 #include <utility>
+#include <algorithm>
 
 GUISystem::GUISystem(
   std::shared_ptr<InputModule> inputModule,
@@ -18,31 +20,6 @@ GUISystem::GUISystem(
     m_graphicsContext(std::move(graphicsContext)),
     m_guiShadersPipeline(std::move(guiShadersPipeline))
 {
-  m_guiNDCQuad = std::make_unique<Mesh>();
-
-  m_guiNDCQuad->setVertices({
-    {0.0f, 1.0f, 1.0f},
-    {0.0f, 0.0f, 1.0f},
-    {1.0f, 1.0f, 1.0f},
-    {1.0f, 0.0f, 1.0f},
-  });
-
-  m_guiNDCQuad->setUV({
-    {0.0f, 1.0f},
-    {0.0f, 0.0f},
-    {1.0f, 1.0f},
-    {1.0f, 0.0f},
-  });
-
-  m_guiNDCQuad->setNormals({
-    {0.0f, 0.0f, 0.0f},
-    {0.0f, 0.0f, 0.0f},
-    {0.0f, 0.0f, 0.0f},
-    {0.0f, 0.0f, 0.0f},
-  });
-
-  m_guiNDCQuad->addSubMesh({0, 2, 1, 1, 2, 3});
-
   m_gpuStateParameters.setDepthTestMode(DepthTestMode::Disabled);
   m_gpuStateParameters.setBlendingMode(BlendingMode::Alpha_OneMinusAlpha);
   m_gpuStateParameters.setPolygonFillingMode(PolygonFillingMode::Fill);
@@ -70,6 +47,9 @@ void GUISystem::unconfigure()
 {
   m_widgetsLoader.reset();
 
+  // Fonts are identified by their addresses, so the layouts should not outlive the loaded fonts
+  GUITextLayoutCache::clear();
+
   GameWorld* gameWorld = getGameWorld();
 
   gameWorld->unsubscribeEventsListener<KeyboardEvent>(this);
@@ -80,10 +60,11 @@ void GUISystem::update(float delta)
 {
   ARG_UNUSED(delta);
 
-  m_eventsQueue.clear();
+  resetEventsQueue();
 
   if (m_activeLayout != nullptr) {
-    updateGUIWidget(m_activeLayout.get());
+    updateHitTestingIndex();
+    updateHoveredWidgets();
   }
 
   executeEventsQueue(m_eventsQueue);
@@ -91,14 +72,47 @@ void GUISystem::update(float delta)
 
 void GUISystem::render()
 {
-  if (m_activeLayout != nullptr) {
-    renderGUIWidget(m_activeLayout.get());
+  if (m_activeLayout == nullptr) {
+    return;
+  }
+
+  if (m_needDrawListUpdate || m_activeLayout->m_needSubtreeRenderingUpdate) {
+    m_drawList.clear();
+    buildGUIWidgetDrawList(m_activeLayout.get());
+
+    uploadDrawList();
+
+    m_needDrawListUpdate = false;
+  }
+
+  const std::vector<GUIDrawCommand>& drawCommands = m_drawList.getCommands();
+
+  for (size_t commandIndex = 0; commandIndex < drawCommands.size(); commandIndex++) {
+    const GUIDrawCommand& command = drawCommands[commandIndex];
+
+    if (command.firstQuadIndex >= m_drawListUploadedQuadsCount) {
+      break;
+    }
+
+    size_t quadsCount = std::min(command.quadsCount, m_drawListUploadedQuadsCount - command.firstQuadIndex);
+
+    m_graphicsContext->scheduleRenderTask(RenderTask{
+      .material = m_drawCommandsMaterials[commandIndex].get(),
+      .mesh = m_drawListMesh.get(),
+      .subMeshIndex = 0,
+      .transform = &m_drawListTransform,
+      .scissorsRect = command.state.scissorsRect,
+      .indicesOffset = command.firstQuadIndex * GUIDrawList::QUAD_INDICES_COUNT,
+      .indicesCount = quadsCount * GUIDrawList::QUAD_INDICES_COUNT,
+    });
   }
 }
 
 void GUISystem::setActiveLayout(std::shared_ptr<GUILayout> layout)
 {
   m_activeLayout = std::move(layout);
+  m_needDrawListUpdate = true;
+  m_needHitTestingIndexUpdate = true;
 }
 
 std::shared_ptr<GUILayout> GUISystem::getActiveLayout()
@@ -121,21 +135,21 @@ std::shared_ptr<GLGraphicsContext> GUISystem::getGraphicsContext() const
   return m_graphicsContext;
 }
 
-RenderTask GUISystem::getRenderTaskTemplate(GUIWidget* widget) const
+GUIDrawState GUISystem::getWidgetDrawState(const GUIWidget& widget) const
 {
   // Background
   GUIWidgetVisualState visualState = GUIWidgetVisualState::Default;
 
-  if (widget->isHovered()) {
+  if (widget.isHovered()) {
     visualState = GUIWidgetVisualState::Hover;
   }
 
-  if (widget->hasFocus()) {
+  if (widget.hasFocus()) {
     visualState = GUIWidgetVisualState::Focus;
   }
 
-  auto& currentVisualParameters = widget->getVisualParameters(visualState);
-  auto& defaultVisualParameters = widget->getVisualParameters(GUIWidgetVisualState::Default);
+  auto& currentVisualParameters = widget.getVisualParameters(visualState);
+  auto& defaultVisualParameters = widget.getVisualParameters(GUIWidgetVisualState::Default);
 
   auto backgroundColor = currentVisualParameters.getBackgroundColor();
 
@@ -149,35 +163,24 @@ RenderTask GUISystem::getRenderTaskTemplate(GUIWidget* widget) const
     backgroundTexture = defaultVisualParameters.getBackgroundImage();
   }
 
-  if (widget->m_renderingMaterial == nullptr) {
-    widget->m_renderingMaterial = std::make_shared<GLMaterial>(RenderingStage::GUI,
-      m_guiShadersPipeline,
-      m_gpuStateParameters,
-      std::make_unique<ShadingParametersGUI>());
-
-  }
-
-  auto& shadingParameters = dynamic_cast<ShadingParametersGUI&>(widget->m_renderingMaterial->getParametersSet());
-
-  shadingParameters.setBackgroundColor(backgroundColor.value());
-  shadingParameters.setBackgroundTexture(backgroundTexture.value_or(ResourceHandle<GLTexture>()));
-
-  // Render task
-  RenderTask renderTask{
-    .material = widget->m_renderingMaterial.get(),
-    .mesh = m_guiNDCQuad.get(),
-    .subMeshIndex = 0,
-    .transform = &widget->getTransformationMatrix(),
+  GUIDrawState drawState{
+    .color = backgroundColor.value(),
+    .backgroundTexture = backgroundTexture.value_or(ResourceHandle<GLTexture>()),
   };
 
-  if (widget->getParent() != nullptr) {
-    renderTask.scissorsRect = RectI(widget->getParent()->getAbsoluteOrigin(), widget->getParent()->getSize());
+  if (widget.getParent() != nullptr) {
+    drawState.scissorsRect = RectI(widget.getParent()->getAbsoluteOrigin(), widget.getParent()->getSize());
   }
   else {
-    renderTask.scissorsRect = RectI({ 0, 0 }, { getScreenWidth(), getScreenHeight() });
+    drawState.scissorsRect = RectI({ 0, 0 }, { getScreenWidth(), getScreenHeight() });
   }
 
-  return renderTask;
+  return drawState;
+}
+
+size_t GUISystem::getDrawCallsCount() const
+{
+  return (m_drawListUploadedQuadsCount == 0) ? 0 : m_drawList.getCommands().size();
 }
 
 int GUISystem::getScreenWidth() const
@@ -192,10 +195,11 @@ int GUISystem::getScreenHeight() const
 
 EventProcessStatus GUISystem::receiveEvent(const MouseButtonEvent& event)
 {
-  m_eventsQueue.clear();
+  resetEventsQueue();
 
   if (m_activeLayout != nullptr) {
-    processGUIWidgetMouseButtonEvent(m_activeLayout.get(), event);
+    updateHitTestingIndex();
+    processMouseButtonEvent(event);
 
     if (m_focusedWidget != nullptr) {
       if (!isMouseInWidgetArea(m_focusedWidget.get())) {
@@ -212,7 +216,7 @@ EventProcessStatus GUISystem::receiveEvent(const MouseButtonEvent& event)
 
 EventProcessStatus GUISystem::receiveEvent(const KeyboardEvent& event)
 {
-  m_eventsQueue.clear();
+  resetEventsQueue();
 
   if (m_focusedWidget != nullptr && m_focusedWidget->isShown()) {
     GUIKeyboardEvent guiEvent{};
@@ -231,51 +235,83 @@ EventProcessStatus GUISystem::receiveEvent(const KeyboardEvent& event)
   return EventProcessStatus::Processed;
 }
 
-void GUISystem::updateGUIWidget(GUIWidget* widget)
+void GUISystem::updateHitTestingIndex()
 {
-  if (!widget->isShown()) {
+  if (!m_needHitTestingIndexUpdate && !m_activeLayout->m_needHitTestingLayoutUpdate) {
     return;
   }
 
-  if (isMouseInWidgetArea(widget)) {
-    if (!widget->m_isHovered) {
-      widget->m_isHovered = true;
+  m_hitTestingIndex.build(*m_activeLayout);
 
-      GUIMouseEnterEvent event;
-      widget->triggerMouseEnterEvent(event, m_eventsQueue);
-    }
+  m_activeLayout->m_needHitTestingLayoutUpdate = false;
+  m_needHitTestingIndexUpdate = false;
+
+  m_needHoveredWidgetsUpdate = true;
+}
+
+void GUISystem::updateHoveredWidgets()
+{
+  glm::ivec2 mousePosition = getMousePosition();
+
+  if (!m_needHoveredWidgetsUpdate && mousePosition == m_hoverMousePosition) {
+    return;
   }
-  else {
-    if (widget->m_isHovered) {
+
+  m_hoverMousePosition = mousePosition;
+  m_needHoveredWidgetsUpdate = false;
+
+  m_hitEntriesBuffer.clear();
+  m_hitTestingIndex.queryEntriesAtPoint(mousePosition, m_hitEntriesBuffer);
+
+  m_hoveredWidgetsBuffer.clear();
+
+  for (size_t entryIndex : m_hitEntriesBuffer) {
+    m_hoveredWidgetsBuffer.push_back(m_hitTestingIndex.getEntries()[entryIndex].widget->shared_from_this());
+  }
+
+  // Only a few widgets are hovered at once, so the lists are compared directly
+  for (const auto& widget : m_hoveredWidgets) {
+    if (std::find(m_hoveredWidgetsBuffer.begin(), m_hoveredWidgetsBuffer.end(), widget) ==
+      m_hoveredWidgetsBuffer.end()) {
       widget->m_isHovered = false;
+      widget->resetRenderingCache();
 
       GUIMouseLeaveEvent event;
       widget->triggerMouseLeaveEvent(event, m_eventsQueue);
     }
   }
 
-  for (const auto& childWidget : widget->getChildrenWidgets()) {
-    updateGUIWidget(childWidget.get());
+  for (const auto& widget : m_hoveredWidgetsBuffer) {
+    if (!widget->m_isHovered) {
+      widget->m_isHovered = true;
+      widget->resetRenderingCache();
+
+      GUIMouseEnterEvent event;
+      widget->triggerMouseEnterEvent(event, m_eventsQueue);
+    }
   }
+
+  std::swap(m_hoveredWidgets, m_hoveredWidgetsBuffer);
 }
 
-void GUISystem::processGUIWidgetMouseButtonEvent(GUIWidget* widget, const MouseButtonEvent& event)
+void GUISystem::processMouseButtonEvent(const MouseButtonEvent& event)
 {
-  if (!widget->isShown()) {
-    return;
-  }
+  m_hitEntriesBuffer.clear();
+  m_hitTestingIndex.queryEntriesAtPoint(getMousePosition(), m_hitEntriesBuffer);
 
-  bool isExclusive = true;
+  // The widgets are collected before the events processing, as the processing could change the widgets tree
+  FrameVector<std::pair<std::shared_ptr<GUIWidget>, bool>> hitWidgets;
+  hitWidgets.reserve(m_hitEntriesBuffer.size());
 
-  for (const auto& childWidget : widget->getChildrenWidgets()) {
-    if (isMouseInWidgetArea(widget)) {
-      isExclusive = false;
-
-      processGUIWidgetMouseButtonEvent(childWidget.get(), event);
-    }
+  for (size_t entryIndex : m_hitEntriesBuffer) {
+    hitWidgets.emplace_back(m_hitTestingIndex.getEntries()[entryIndex].widget->shared_from_this(),
+      m_hitTestingIndex.isEntryExclusive(entryIndex, m_hitEntriesBuffer));
   }
 
-  if (isMouseInWidgetArea(widget)) {
+  // Descendants are processed before their parents, so the outermost focusable widget receives the focus
+  for (auto hitWidgetIt = hitWidgets.rbegin(); hitWidgetIt != hitWidgets.rend(); hitWidgetIt++) {
+    const auto& [widget, isExclusive] = *hitWidgetIt;
+
     if (widget->canHaveFocus()) {
       if (m_focusedWidget != nullptr) {
         m_focusedWidget->resetFocus();
@@ -283,7 +319,7 @@ void GUISystem::processGUIWidgetMouseButtonEvent(GUIWidget* widget, const MouseB
 
       widget->setFocus();
 
-      m_focusedWidget = widget->shared_from_this();
+      m_focusedWidget = widget;
     }
 
     GUIMouseButtonEvent mouseEvent;
@@ -295,25 +331,132 @@ void GUISystem::processGUIWidgetMouseButtonEvent(GUIWidget* widget, const MouseB
   }
 }
 
-bool GUISystem::isMouseInWidgetArea(const GUIWidget* widget) const
+glm::ivec2 GUISystem::getMousePosition() const
 {
   MousePosition mousePosition = m_inputModule->getMousePosition();
-  return widget->isPointInside({mousePosition.x, mousePosition.y});
+  return {mousePosition.x, mousePosition.y};
+}
+
+bool GUISystem::isMouseInWidgetArea(const GUIWidget* widget) const
+{
+  return widget->isPointInside(getMousePosition());
 }
 
-void GUISystem::renderGUIWidget(GUIWidget* widget)
+void GUISystem::buildGUIWidgetDrawList(GUIWidget* widget)
 {
   if (!widget->isShown()) {
+    widget->m_needSubtreeRenderingUpdate = false;
     return;
   }
 
-  widget->render(*this);
+  if (widget->m_needRenderingCacheUpdate) {
+    widget->m_renderingCache.clear();
+    widget->render(*this, widget->m_renderingCache);
+
+    widget->m_needRenderingCacheUpdate = false;
+  }
+
+  m_drawList.append(widget->m_renderingCache);
 
   for (const auto& childWidget : widget->getChildrenWidgets()) {
-    renderGUIWidget(childWidget.get());
+    buildGUIWidgetDrawList(childWidget.get());
+  }
+
+  widget->m_needSubtreeRenderingUpdate = false;
+}
+
+void GUISystem::uploadDrawList()
+{
+  size_t quadsCount = m_drawList.getQuadsCount();
+
+  if (quadsCount > MAX_DRAW_LIST_QUADS_CAPACITY) {
+    spdlog::warn("GUI quads count {} exceeds the limit {}, the rest quads are skipped",
+      quadsCount, MAX_DRAW_LIST_QUADS_CAPACITY);
+
+    quadsCount = MAX_DRAW_LIST_QUADS_CAPACITY;
+  }
+
+  m_drawListUploadedQuadsCount = quadsCount;
+
+  if (quadsCount == 0) {
+    return;
+  }
+
+  if (quadsCount > m_drawListMeshQuadsCapacity) {
+    createDrawListMesh(std::min(std::max({quadsCount, 2 * m_drawListMeshQuadsCapacity, MIN_DRAW_LIST_QUADS_CAPACITY}),
+      MAX_DRAW_LIST_QUADS_CAPACITY));
+  }
+
+  size_t verticesCount = quadsCount * GUIDrawList::QUAD_VERTICES_COUNT;
+
+  if (verticesCount == m_drawList.getPositions().size()) {
+    m_drawListMesh->setVertices(m_drawList.getPositions());
+    m_drawListMesh->setUV(m_drawList.getUV());
+  }
+  else {
+    m_drawListMesh->setVertices(std::vector<glm::vec3>(m_drawList.getPositions().begin(),
+      m_drawList.getPositions().begin() + static_cast<std::ptrdiff_t>(verticesCount)));
+    m_drawListMesh->setUV(std::vector<glm::vec2>(m_drawList.getUV().begin(),
+      m_drawList.getUV().begin() + static_cast<std::ptrdiff_t>(verticesCount)));
+  }
+
+  // Normals are not used by the GUI shaders, they are uploaded only to keep the vertex format
+  if (m_drawListNormals.size() != verticesCount) {
+    m_drawListNormals.resize(verticesCount);
+    m_drawListMesh->setNormals(m_drawListNormals);
+  }
+
+  const std::vector<GUIDrawCommand>& drawCommands = m_drawList.getCommands();
+
+  while (m_drawCommandsMaterials.size() < drawCommands.size()) {
+    m_drawCommandsMaterials.push_back(std::make_unique<GLMaterial>(RenderingStage::GUI,
+      m_guiShadersPipeline,
+      m_gpuStateParameters,
+      std::make_unique<ShadingParametersGUI>()));
+  }
+
+  for (size_t commandIndex = 0; commandIndex < drawCommands.size(); commandIndex++) {
+    const GUIDrawState& drawState = drawCommands[commandIndex].state;
+
+    auto& shadingParameters =
+      dynamic_cast<ShadingParametersGUI&>(m_drawCommandsMaterials[commandIndex]->getParametersSet());
+
+    shadingParameters.setBackgroundColor(drawState.color);
+    shadingParameters.setBackgroundTexture(drawState.backgroundTexture);
+    shadingParameters.setAlphaTexture(drawState.alphaTexture);
   }
 }
 
+void GUISystem::createDrawListMesh(size_t quadsCapacity)
+{
+  size_t verticesCapacity = quadsCapacity * GUIDrawList::QUAD_VERTICES_COUNT;
+
+  // Indices are the same for all frames, so only vertices are uploaded on the draw list change
+  std::vector<uint32_t> indices;
+  indices.reserve(quadsCapacity * GUIDrawList::QUAD_INDICES_COUNT);
+
+  for (size_t quadIndex = 0; quadIndex < quadsCapacity; quadIndex++) {
+    auto baseVertexIndex = static_cast<uint32_t>(quadIndex * GUIDrawList::QUAD_VERTICES_COUNT);
+
+    indices.push_back(baseVertexIndex + 1);
+    indices.push_back(baseVertexIndex);
+    indices.push_back(baseVertexIndex + 3);
+
+    indices.push_back(baseVertexIndex + 2);
+    indices.push_back(baseVertexIndex + 1);
+    indices.push_back(baseVertexIndex + 3);
+  }
+
+  m_drawListMesh = std::make_unique<Mesh>(true, verticesCapacity);
+  m_drawListMesh->setVertices(std::vector<glm::vec3>(verticesCapacity));
+  m_drawListMesh->setUV(std::vector<glm::vec2>(verticesCapacity));
+  m_drawListMesh->setNormals(std::vector<glm::vec3>(verticesCapacity));
+  m_drawListMesh->addSubMesh(indices);
+
+  m_drawListMeshQuadsCapacity = quadsCapacity;
+  m_drawListNormals.clear();
+}
+
 std::shared_ptr<GUILayout> GUISystem::loadScheme(const std::string& schemePath)
 {
   SW_ASSERT(m_widgetsLoader != nullptr);
@@ -337,9 +480,15 @@ GUIWidgetsLoader* GUISystem::getWidgetsLoader() const
   return m_widgetsLoader.get();
 }
 
-void GUISystem::executeEventsQueue(const std::vector<std::function<void()>>& queue)
+void GUISystem::resetEventsQueue()
+{
+  m_eventsQueue = GUIEventsQueue();
+}
+
+void GUISystem::executeEventsQueue(const GUIEventsQueue& queue)
 {
-  for (const auto& eventHandler : queue) {
-    eventHandler();
+  for (const GUIQueuedEvent& queuedEvent : queue) {
+    std::visit([&queuedEvent](const auto& event) { queuedEvent.widget->invokeEventCallback(event); },
+      queuedEvent.event);
   }
 }
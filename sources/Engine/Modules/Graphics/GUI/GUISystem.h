@@ -20,6 +20,7 @@
 #include "GUIDropDownList.h"
 
 #include "GUIWidgetsLoader.h"
+#include "GUIHitTestingIndex.h"
 
 class GUISystem : public std::enable_shared_from_this<GUISystem>,
                   public GameSystem,
@@ -44,7 +45,15 @@ class GUISystem : public std::enable_shared_from_this<GUISystem>,
   [[nodiscard]] ResourceHandle<BitmapFont> getDefaultFont() const;
 
   [[nodiscard]] std::shared_ptr<GLGraphicsContext> getGraphicsContext() const;
-  [[nodiscard]] RenderTask getRenderTaskTemplate(GUIWidget* widget) const;
+  /*!
+   * \brief Returns the shading state of the widget background in its current visual state
+   */
+  [[nodiscard]] GUIDrawState getWidgetDrawState(const GUIWidget& widget) const;
+
+  /*!
+   * \brief Returns the count of draw calls that are scheduled to render the GUI every frame
+   */
+  [[nodiscard]] size_t getDrawCallsCount() const;
 
   [[nodiscard]] int getScreenWidth() const;
   [[nodiscard]] int getScreenHeight() const;
@@ -61,17 +70,57 @@ class GUISystem : public std::enable_shared_from_this<GUISystem>,
   [[nodiscard]] GUIWidgetsLoader* getWidgetsLoader() const;
 
  private:
-  void updateGUIWidget(GUIWidget* widget);
-  void processGUIWidgetMouseButtonEvent(GUIWidget* widget, const MouseButtonEvent& event);
+  /*!
+   * \brief Rebuilds the hit testing index if the widgets rectangles, visibility or order are changed
+   */
+  void updateHitTestingIndex();
+
+  /*!
+   * \brief Updates the hover state of widgets, the widgets are tested only on the mouse movement or layout change
+   */
+  void updateHoveredWidgets();
+
+  void processMouseButtonEvent(const MouseButtonEvent& event);
 
+  [[nodiscard]] glm::ivec2 getMousePosition() const;
   bool isMouseInWidgetArea(const GUIWidget* widget) const;
 
-  void renderGUIWidget(GUIWidget* widget);
+  /*!
+   * \brief Collects the quads of the shown widgets, the cached quads of unchanged widgets are reused
+   */
+  void buildGUIWidgetDrawList(GUIWidget* widget);
 
-  void executeEventsQueue(const std::vector<std::function<void()>>& queue);
+  /*!
+   * \brief Uploads the frame draw list to the streaming mesh and sets up the draw commands materials
+   */
+  void uploadDrawList();
+  void createDrawListMesh(size_t quadsCapacity);
+
+  void resetEventsQueue();
+  void executeEventsQueue(const GUIEventsQueue& queue);
 
  private:
-  std::unique_ptr<Mesh> m_guiNDCQuad;
+  // All GUI quads of the frame are drawn from the single mesh with the static quads indices
+  GUIDrawList m_drawList;
+  std::unique_ptr<Mesh> m_drawListMesh;
+  size_t m_drawListMeshQuadsCapacity = 0;
+  size_t m_drawListUploadedQuadsCount = 0;
+  std::vector<glm::vec3> m_drawListNormals;
+
+  std::vector<std::unique_ptr<GLMaterial>> m_drawCommandsMaterials;
+  glm::mat4 m_drawListTransform = glm::identity<glm::mat4>();
+
+  bool m_needDrawListUpdate = true;
+
+  GUIHitTestingIndex m_hitTestingIndex;
+  bool m_needHitTestingIndexUpdate = true;
+
+  std::vector<size_t> m_hitEntriesBuffer;
+
+  std::vector<std::shared_ptr<GUIWidget>> m_hoveredWidgets;
+  std::vector<std::shared_ptr<GUIWidget>> m_hoveredWidgetsBuffer;
+  glm::ivec2 m_hoverMousePosition{};
+  bool m_needHoveredWidgetsUpdate = true;
 
   std::shared_ptr<GUILayout> m_activeLayout;
 
@@ -90,6 +139,13 @@ class GUISystem : public std::enable_shared_from_this<GUISystem>,
 
   std::unique_ptr<GUIWidgetsLoader> m_widgetsLoader;
 
-  std::vector<std::function<void()>> m_eventsQueue;
+  // The queue is allocated in the frame arena, so it is replaced instead of clearing
+  GUIEventsQueue m_eventsQueue;
+
+ private:
+  static constexpr size_t MIN_DRAW_LIST_QUADS_CAPACITY = 256;
+
+  // The limit of 16-bit indices
+  static constexpr size_t MAX_DRAW_LIST_QUADS_CAPACITY = 65536 / GUIDrawList::QUAD_VERTICES_COUNT;
 };
 
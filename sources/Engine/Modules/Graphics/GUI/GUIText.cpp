@@ -6,7 +6,6 @@
 
 #include <utility>
 
-#include <utility>
 #include "GUISystem.h"
 
 GUIText::GUIText()
@@ -27,8 +26,12 @@ GUIText::GUIText(ResourceHandle<BitmapFont> font, std::string text)
 
 void GUIText::setFont(ResourceHandle<BitmapFont> font)
 {
+  if (m_font.get() == font.get()) {
+    return;
+  }
+
   m_font = font;
-  resetTextGeometryCache();
+  resetTextLayout();
 }
 
 ResourceHandle<BitmapFont> GUIText::getFont() const
@@ -38,10 +41,12 @@ ResourceHandle<BitmapFont> GUIText::getFont() const
 
 void GUIText::setText(const std::string& text)
 {
-  if (m_text != text) {
-    m_text = text;
-    resetTextGeometryCache();
+  if (m_text == text) {
+    return;
   }
+
+  m_text = text;
+  resetTextLayout();
 }
 
 std::string GUIText::getText() const
@@ -63,8 +68,12 @@ void GUIText::setFontSize(int size)
 {
   SW_ASSERT(size >= 0);
 
+  if (m_fontSize == size) {
+    return;
+  }
+
   m_fontSize = size;
-  resetTextGeometryCache();
+  resetTextLayout();
 }
 
 int GUIText::getFontSize() const
@@ -72,163 +81,41 @@ int GUIText::getFontSize() const
   return m_fontSize;
 }
 
-void GUIText::render(GUISystem& guiSystem)
+void GUIText::render(GUISystem& guiSystem, GUIDrawList& drawList)
 {
   if (m_text.empty()) {
     return;
   }
 
-  RenderTask task = guiSystem.getRenderTaskTemplate(this);
+  updateTextLayout();
 
-  auto& shadingParameters = dynamic_cast<ShadingParametersGUI&>(task.material->getParametersSet());
-  shadingParameters.setAlphaTexture(m_font->getBitmapResource());
+  GUIDrawState drawState = guiSystem.getWidgetDrawState(*this);
+  drawState.alphaTexture = m_font->getBitmapResource();
 
-  task.mesh = updateAndGetGeometryStore();
-  guiSystem.getGraphicsContext()->scheduleRenderTask(task);
+  // The transformation is the translation to the absolute origin, so the glyphs are just moved by it
+  drawList.addGlyphQuads(drawState, m_layout->glyphs, glm::vec2(getTransformationMatrix()[3]));
 }
 
-Mesh* GUIText::updateAndGetGeometryStore()
+std::shared_ptr<const GUITextLayout> GUIText::acquireTextLayout() const
 {
-  if (m_needTextGeometryUpdate) {
-    auto geometryStoreParams = getStringGeometryStoreParams(m_text);
-
-    GUIWidget::setSize(std::get<3>(geometryStoreParams));
-
-    if (m_textGeometryCache == nullptr) {
-      m_textGeometryCache = std::make_unique<Mesh>(true, MIN_TEXT_BLOCK_VERTICES_STORAGE_SIZE);
-
-      auto& vertices = std::get<0>(geometryStoreParams);
-      auto& uv = std::get<1>(geometryStoreParams);
-      auto normals = std::vector<glm::vec3>(std::get<1>(geometryStoreParams).size());
-
-      m_textGeometryCache->setVertices(vertices);
-      m_textGeometryCache->setUV(uv);
-      m_textGeometryCache->setNormals(normals);
-
-      m_textGeometryCache->addSubMesh(std::get<2>(geometryStoreParams));
-    }
-    else {
-      m_textGeometryCache->setVertices(std::get<0>(geometryStoreParams));
-      m_textGeometryCache->setUV(std::get<1>(geometryStoreParams));
-      m_textGeometryCache->setNormals(std::vector<glm::vec3>(std::get<1>(geometryStoreParams).size()));
-
-      m_textGeometryCache->setIndices(std::get<2>(geometryStoreParams), 0);
-    }
-
-    m_needTextGeometryUpdate = false;
-  }
+  SW_ASSERT(m_font.get() != nullptr && "It is required to set font for the text line before rendering");
 
-  return m_textGeometryCache.get();
+  return GUITextLayoutCache::acquireLayout(*m_font.get(), m_fontSize, m_text);
 }
 
-void GUIText::resetTextGeometryCache()
+void GUIText::updateTextLayout()
 {
-  m_needTextGeometryUpdate = true;
-}
-
-std::tuple<std::vector<glm::vec3>,
-           std::vector<glm::vec2>,
-           std::vector<uint16_t>, glm::ivec2> GUIText::getStringGeometryStoreParams(const std::string& str) const
-{
-  SW_ASSERT(m_font.get() != nullptr && "It is required to set font for the text line before rendering");
-  SW_ASSERT(!str.empty() && "It is impossible to create geometry buffer for the empty text string");
-
-  std::vector<glm::vec3> positions;
-  std::vector<glm::vec2> uv;
-  std::vector<uint16_t> indices;
-
-  int bitmapWidth = m_font->getBitmap()->getWidth();
-  int bitmapHeight = m_font->getBitmap()->getHeight();
-
-  int cursorPosition = 0;
-  int cursorLineOffset = 0;
-
-  int maxHeight = 0;
-
-  for (char rawCharacter : str) {
-    auto character = static_cast<unsigned char>(rawCharacter);
+  if (m_layout == nullptr) {
+    m_layout = acquireTextLayout();
 
-    if (character == '\n') {
-      cursorPosition = 0;
-      cursorLineOffset += m_font->getHeight();
-
-      continue;
-    }
-
-    BitmapCharacter characterDescription = m_font->getCharacter(character);
-    glm::ivec2 atlasPosition = characterDescription.bitmapArea.getOrigin();
-    glm::ivec2 characterSize = characterDescription.bitmapArea.getSize();
-
-    glm::ivec2 originPosition(cursorPosition, cursorLineOffset);
-
-    auto verticesBaseSize = static_cast<uint16_t>(positions.size());
-
-    positions.emplace_back(
-      originPosition.x + characterDescription.xOffset,
-      originPosition.y + characterDescription.yOffset,
-      0.0f
-    );
-
-    uv.emplace_back(
-      static_cast<float>(atlasPosition.x) / static_cast<float>(bitmapWidth),
-      static_cast<float>(atlasPosition.y) / static_cast<float>(bitmapHeight)
-    );
-
-    positions.emplace_back(
-      originPosition.x + characterSize.x + characterDescription.xOffset,
-      originPosition.y + characterDescription.yOffset,
-      0.0f
-    );
-
-    uv.emplace_back(
-      static_cast<float>(atlasPosition.x + characterSize.x) / static_cast<float>(bitmapWidth),
-      static_cast<float>(atlasPosition.y) / static_cast<float>(bitmapHeight)
-    );
-
-    positions.emplace_back(
-      originPosition.x + characterSize.x + characterDescription.xOffset,
-      originPosition.y + characterSize.y + characterDescription.yOffset,
-      0.0f
-    );
-
-    uv.emplace_back(
-      static_cast<float>(atlasPosition.x + characterSize.x) / static_cast<float>(bitmapWidth),
-      static_cast<float>(atlasPosition.y + characterSize.y) / static_cast<float>(bitmapHeight)
-    );
-
-    positions.emplace_back(
-      originPosition.x + characterDescription.xOffset,
-      originPosition.y + characterSize.y + characterDescription.yOffset,
-      0.0f
-    );
-
-    uv.emplace_back(
-      static_cast<float>(atlasPosition.x) / static_cast<float>(bitmapWidth),
-      static_cast<float>(atlasPosition.y + characterSize.y) / static_cast<float>(bitmapHeight)
-    );
-
-    indices.push_back(verticesBaseSize + 1);
-    indices.push_back(verticesBaseSize);
-    indices.push_back(verticesBaseSize + 3);
-
-    indices.push_back(verticesBaseSize + 2);
-    indices.push_back(verticesBaseSize + 1);
-    indices.push_back(verticesBaseSize + 3);
-
-    cursorPosition += characterDescription.xAdvance;
-  }
-
-  float scaleFactor = static_cast<float>(m_fontSize) / static_cast<float>(m_font->getBaseSize());
-
-  for (glm::vec3& pos : positions) {
-    pos.x *= scaleFactor;
-    pos.y *= scaleFactor;
-
-    int vertexHeight = static_cast<int>(std::ceil(pos.y));
-    maxHeight = std::max(vertexHeight, maxHeight);
+    GUIWidget::setSize(m_layout->size);
   }
+}
 
-  return {positions, uv, indices, {cursorPosition, maxHeight}};
+void GUIText::resetTextLayout()
+{
+  m_layout.reset();
+  resetRenderingCache();
 }
 
 [[nodiscard]] glm::mat4 GUIText::updateTransformationMatrix()
@@ -304,7 +191,7 @@ void GUIText::applyStylesheetRule(const GUIWidgetStylesheetRule& stylesheetRule)
   });
 
   if (m_font.get() != nullptr && m_fontSize > 0 && !m_text.empty()) {
-    RETURN_VALUE_UNUSED(updateAndGetGeometryStore());
+    updateTextLayout();
   }
 }
 
@@ -316,10 +203,8 @@ void GUIText::setSize(const glm::ivec2& size)
 
 glm::ivec2 GUIText::getSize() const
 {
-  if (m_needTextGeometryUpdate) {
-    auto geometryStoreParams = getStringGeometryStoreParams(m_text);
-
-    return std::get<3>(geometryStoreParams);
+  if (m_layout == nullptr) {
+    return acquireTextLayout()->size;
   }
   else {
     return GUIWidget::getSize();
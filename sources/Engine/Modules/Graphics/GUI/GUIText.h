@@ -4,9 +4,9 @@
 #include <memory>
 
 #include "Modules/ResourceManagement/ResourcesManagement.h"
-#include "Modules/Graphics/OpenGL/GLGeometryStore.h"
 #include "GUIWidget.h"
 #include "BitmapFont.h"
+#include "GUITextLayout.h"
 
 class GUITextBox;
 
@@ -27,7 +27,7 @@ class GUIText : public GUIWidget {
   void setFontSize(int size);
   [[nodiscard]] int getFontSize() const;
 
-  void render(GUISystem& guiSystem) override;
+  void render(GUISystem& guiSystem, GUIDrawList& drawList) override;
 
   void applyStylesheetRule(const GUIWidgetStylesheetRule& stylesheetRule) override;
 
@@ -41,13 +41,10 @@ class GUIText : public GUIWidget {
   [[nodiscard]] glm::mat4 updateTransformationMatrix() override;
 
  private:
-  void resetTextGeometryCache();
+  void resetTextLayout();
 
-  std::tuple<std::vector<glm::vec3>,
-             std::vector<glm::vec2>,
-             std::vector<uint16_t>, glm::ivec2> getStringGeometryStoreParams(const std::string& str) const;
-
-  Mesh* updateAndGetGeometryStore();
+  [[nodiscard]] std::shared_ptr<const GUITextLayout> acquireTextLayout() const;
+  void updateTextLayout();
 
  private:
   ResourceHandle<BitmapFont> m_font;
@@ -56,11 +53,8 @@ class GUIText : public GUIWidget {
 
   int m_fontSize;
 
-  mutable std::unique_ptr<Mesh> m_textGeometryCache;
-  mutable bool m_needTextGeometryUpdate = true;
-
- private:
-  static constexpr size_t MIN_TEXT_BLOCK_VERTICES_STORAGE_SIZE = 512;
+  // Shaped glyphs in the widget space, the layout is shared with other texts with the same font, size and string
+  std::shared_ptr<const GUITextLayout> m_layout;
 
  private:
   friend class GUITextBox;
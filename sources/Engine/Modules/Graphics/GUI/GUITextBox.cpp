@@ -54,12 +54,10 @@ int GUITextBox::getTextFontSize() const
   return m_text->getFontSize();
 }
 
-void GUITextBox::render(GUISystem& guiSystem)
+void GUITextBox::render(GUISystem& guiSystem, GUIDrawList& drawList)
 {
-  RenderTask task = guiSystem.getRenderTaskTemplate(this);
-  guiSystem.getGraphicsContext()->scheduleRenderTask(task);
-
-  m_text->render(guiSystem);
+  // The text is rendered as the child widget
+  GUIWidgetRect::render(guiSystem, drawList);
 }
 
 bool GUITextBox::canHaveFocus() const
@@ -103,9 +101,7 @@ glm::mat4 GUITextBox::updateTransformationMatrix()
   }
 
   if (!m_text->getText().empty()) {
-    if (m_text->m_needTextGeometryUpdate) {
-      m_text->updateAndGetGeometryStore();
-    }
+    m_text->updateTextLayout();
 
     m_text->setOrigin({10, getSize().y / 2 - m_text->getSize().y / 2});
   }
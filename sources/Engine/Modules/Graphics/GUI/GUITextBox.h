@@ -24,7 +24,7 @@ class GUITextBox : public GUIWidgetRect {
   void setTextFontSize(int size);
   [[nodiscard]] int getTextFontSize() const;
 
-  void render(GUISystem& guiSystem) override;
+  void render(GUISystem& guiSystem, GUIDrawList& drawList) override;
 
   [[nodiscard]] bool canHaveFocus() const override;
 
@@ -0,0 +1,150 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "GUITextLayout.h"
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+struct TextLayoutKey {
+  const BitmapFont* font;
+  int fontSize;
+
+  // The view refers to the string stored in the cache entry
+  std::string_view text;
+
+  bool operator==(const TextLayoutKey& other) const
+  {
+    return font == other.font && fontSize == other.fontSize && text == other.text;
+  }
+};
+
+struct TextLayoutKeyHash {
+  size_t operator()(const TextLayoutKey& key) const
+  {
+    size_t hash = std::hash<std::string_view>()(key.text);
+
+    hash ^= std::hash<const BitmapFont*>()(key.font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<int>()(key.fontSize) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+    return hash;
+  }
+};
+
+struct TextLayoutEntry {
+  const BitmapFont* font;
+  int fontSize;
+  std::string text;
+
+  std::shared_ptr<const GUITextLayout> layout;
+};
+
+// The entries are ordered from the most recently used one
+std::list<TextLayoutEntry> g_layoutsEntries;
+std::unordered_map<TextLayoutKey, std::list<TextLayoutEntry>::iterator, TextLayoutKeyHash> g_layoutsLookup;
+
+}
+
+std::shared_ptr<const GUITextLayout> GUITextLayoutCache::acquireLayout(const BitmapFont& font, int fontSize,
+  std::string_view text)
+{
+  auto entryIt = g_layoutsLookup.find(TextLayoutKey{.font = &font, .fontSize = fontSize, .text = text});
+
+  if (entryIt != g_layoutsLookup.end()) {
+    g_layoutsEntries.splice(g_layoutsEntries.begin(), g_layoutsEntries, entryIt->second);
+
+    return entryIt->second->layout;
+  }
+
+  if (g_layoutsEntries.size() >= MAX_CACHED_LAYOUTS_COUNT) {
+    const TextLayoutEntry& leastRecentEntry = g_layoutsEntries.back();
+
+    g_layoutsLookup.erase(TextLayoutKey{.font = leastRecentEntry.font,
+      .fontSize = leastRecentEntry.fontSize,
+      .text = leastRecentEntry.text});
+
+    g_layoutsEntries.pop_back();
+  }
+
+  auto layout = std::allocate_shared<GUITextLayout>(TrackedAllocator<GUITextLayout, MemoryCounters::GUI>());
+  shapeText(font, fontSize, text, *layout);
+
+  TextLayoutEntry& entry = g_layoutsEntries.emplace_front(TextLayoutEntry{.font = &font,
+    .fontSize = fontSize,
+    .text = std::string(text),
+    .layout = layout});
+
+  g_layoutsLookup.emplace(TextLayoutKey{.font = &font, .fontSize = fontSize, .text = entry.text},
+    g_layoutsEntries.begin());
+
+  return layout;
+}
+
+size_t GUITextLayoutCache::getLayoutsCount()
+{
+  return g_layoutsEntries.size();
+}
+
+void GUITextLayoutCache::clear()
+{
+  g_layoutsLookup.clear();
+  g_layoutsEntries.clear();
+}
+
+void GUITextLayoutCache::shapeText(const BitmapFont& font, int fontSize, std::string_view text, GUITextLayout& layout)
+{
+  auto glyphsCount = static_cast<size_t>(std::count_if(text.begin(), text.end(), [](char character) {
+    return character != '\n';
+  }));
+
+  layout.glyphs.resize(glyphsCount);
+
+  auto bitmapSize = glm::vec2(static_cast<float>(font.getBitmap()->getWidth()),
+    static_cast<float>(font.getBitmap()->getHeight()));
+
+  // Glyphs are shaped in the base font size and scaled to the requested one in the same pass
+  float scaleFactor = static_cast<float>(fontSize) / static_cast<float>(font.getBaseSize());
+
+  int cursorPosition = 0;
+  int cursorLineOffset = 0;
+  int maxHeight = 0;
+
+  size_t glyphIndex = 0;
+
+  for (char rawCharacter : text) {
+    auto character = static_cast<unsigned char>(rawCharacter);
+
+    if (character == '\n') {
+      cursorPosition = 0;
+      cursorLineOffset += font.getHeight();
+
+      continue;
+    }
+
+    const BitmapCharacter& characterDescription = font.getCharacter(character);
+    glm::vec2 atlasPosition = characterDescription.bitmapArea.getOrigin();
+    glm::vec2 characterSize = characterDescription.bitmapArea.getSize();
+
+    glm::vec2 glyphOrigin(cursorPosition + characterDescription.xOffset,
+      cursorLineOffset + characterDescription.yOffset);
+
+    GUIGlyphQuad& glyph = layout.glyphs[glyphIndex++];
+    glyph.topLeft = glyphOrigin * scaleFactor;
+    glyph.bottomRight = (glyphOrigin + characterSize) * scaleFactor;
+    glyph.uvTopLeft = atlasPosition / bitmapSize;
+    glyph.uvBottomRight = (atlasPosition + characterSize) / bitmapSize;
+
+    maxHeight = std::max(maxHeight, static_cast<int>(std::ceil(glyph.bottomRight.y)));
+
+    cursorPosition += characterDescription.xAdvance;
+  }
+
+  // The width is not scaled to keep the previous layout behaviour
+  layout.size = {cursorPosition, maxHeight};
+}
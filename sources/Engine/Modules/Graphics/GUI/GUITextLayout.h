@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <string_view>
+
+#include <glm/vec2.hpp>
+
+#include "Modules/Profiling/MemoryTracker.h"
+
+#include "BitmapFont.h"
+
+struct GUIGlyphQuad {
+  glm::vec2 topLeft{};
+  glm::vec2 bottomRight{};
+
+  glm::vec2 uvTopLeft{};
+  glm::vec2 uvBottomRight{};
+};
+
+/*!
+ * \brief Shaped glyphs run of a text string in the text widget space
+ */
+struct GUITextLayout {
+  TrackedVector<GUIGlyphQuad, MemoryCounters::GUI> glyphs;
+  glm::ivec2 size{};
+};
+
+/*!
+ * \brief Cache of text layouts keyed by the font, the font size and the string
+ *
+ * The recently used layouts are kept even if no text widget refers to them, so the texts that
+ * switch between several strings (e.g. counters and prompts) are not shaped again. Fonts are
+ * identified by their addresses, so the cache should be cleared when the fonts are unloaded.
+ */
+class GUITextLayoutCache {
+ public:
+  GUITextLayoutCache() = delete;
+
+  [[nodiscard]] static std::shared_ptr<const GUITextLayout> acquireLayout(const BitmapFont& font, int fontSize,
+    std::string_view text);
+
+  [[nodiscard]] static size_t getLayoutsCount();
+
+  static void clear();
+
+ public:
+  static constexpr size_t MAX_CACHED_LAYOUTS_COUNT = 512;
+
+ private:
+  static void shapeText(const BitmapFont& font, int fontSize, std::string_view text, GUITextLayout& layout);
+};
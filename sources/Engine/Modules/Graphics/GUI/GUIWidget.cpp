@@ -24,6 +24,10 @@ GUIWidget::~GUIWidget()
 
 void GUIWidget::setOrigin(const glm::ivec2& origin)
 {
+  if (m_origin == origin) {
+    return;
+  }
+
   m_origin = origin;
   resetTransformationCache();
 }
@@ -35,19 +39,15 @@ glm::ivec2 GUIWidget::getOrigin() const
 
 glm::ivec2 GUIWidget::getAbsoluteOrigin() const
 {
-  glm::ivec2 origin = m_origin;
-
-  std::shared_ptr<GUIWidget> parent = m_parent.lock();
-
-  if (parent != nullptr) {
-    origin = origin + parent->getAbsoluteOrigin();
-  }
-
-  return origin;
+  return m_absoluteOrigin;
 }
 
 void GUIWidget::setSize(const glm::ivec2& size)
 {
+  if (m_size == size) {
+    return;
+  }
+
   m_size = size;
   resetTransformationCache();
 }
@@ -59,12 +59,22 @@ glm::ivec2 GUIWidget::getSize() const
 
 void GUIWidget::setWidth(int width)
 {
+  if (m_size.x == width) {
+    return;
+  }
+
   m_size.x = width;
+  resetTransformationCache();
 }
 
 void GUIWidget::setHeight(int height)
 {
+  if (m_size.y == height) {
+    return;
+  }
+
   m_size.y = height;
+  resetTransformationCache();
 }
 
 void GUIWidget::addChildWidget(std::shared_ptr<GUIWidget> widget)
@@ -74,12 +84,20 @@ void GUIWidget::addChildWidget(std::shared_ptr<GUIWidget> widget)
 
   orderChildrenByZIndex();
   updateChildStyles(widget);
+
+  // The widget could be rendered before with other parent scissors rectangle
+  widget->resetTransformationCache();
 }
 
 void GUIWidget::removeChildWidget(const std::shared_ptr<GUIWidget>& widget)
 {
   widget->setParent({});
   m_widgets.erase(std::remove(m_widgets.begin(), m_widgets.end(), widget), m_widgets.end());
+
+  widget->resetTransformationCache();
+
+  resetSubtreeRenderingCache();
+  resetHitTestingLayout();
 }
 
 const std::vector<std::shared_ptr<GUIWidget>>& GUIWidget::getChildrenWidgets() const
@@ -91,9 +109,13 @@ void GUIWidget::removeChildren()
 {
   for (const auto& widget : m_widgets) {
     widget->setParent({});
+    widget->resetTransformationCache();
   }
 
   m_widgets.clear();
+
+  resetSubtreeRenderingCache();
+  resetHitTestingLayout();
 }
 
 void GUIWidget::show()
@@ -131,10 +153,21 @@ void GUIWidget::update(float delta)
   ARG_UNUSED(delta);
 }
 
-void GUIWidget::render(GUISystem& guiSystem)
+void GUIWidget::render(GUISystem& guiSystem, GUIDrawList& drawList)
 {
-  RenderTask task = guiSystem.getRenderTaskTemplate(this);
-  guiSystem.getGraphicsContext()->scheduleRenderTask(task);
+  GUIDrawState drawState = guiSystem.getWidgetDrawState(*this);
+
+  // Fully transparent backgrounds, e.g. of the layouts, do not produce any quads
+  if (drawState.color.a == 0.0f && drawState.backgroundTexture.get() == nullptr) {
+    return;
+  }
+
+  const glm::mat4& transformationMatrix = getTransformationMatrix();
+
+  drawList.addQuad(drawState,
+    glm::vec2(transformationMatrix * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)),
+    glm::vec2(transformationMatrix * glm::vec4(1.0f, 1.0f, 0.0f, 1.0f)),
+    {0.0f, 0.0f}, {1.0f, 1.0f});
 }
 
 void GUIWidget::setZIndex(int zIndex)
@@ -184,10 +217,50 @@ void GUIWidget::setKeyboardEventCallback(EventCallback<GUIKeyboardEvent> callbac
 
 void GUIWidget::resetTransformationCache()
 {
+  std::shared_ptr<GUIWidget> parent = m_parent.lock();
+
+  resetSubtreeTransformationCache((parent != nullptr) ? parent->m_absoluteOrigin : glm::ivec2(0));
+
+  resetSubtreeRenderingCache();
+  resetHitTestingLayout();
+}
+
+void GUIWidget::resetSubtreeTransformationCache(const glm::ivec2& parentAbsoluteOrigin)
+{
+  m_absoluteOrigin = parentAbsoluteOrigin + m_origin;
+
   m_needTransformationMatrixCacheUpdate = true;
+  m_needRenderingCacheUpdate = true;
+  m_needSubtreeRenderingUpdate = true;
 
+  // The flags are propagated to the parents chain only once, by the widget that is changed itself
   for (const auto& childWidget : m_widgets) {
-    childWidget->resetTransformationCache();
+    childWidget->resetSubtreeTransformationCache(m_absoluteOrigin);
+  }
+}
+
+void GUIWidget::resetRenderingCache()
+{
+  m_needRenderingCacheUpdate = true;
+  resetSubtreeRenderingCache();
+}
+
+void GUIWidget::resetSubtreeRenderingCache()
+{
+  m_needSubtreeRenderingUpdate = true;
+
+  // Parents chains are short, so the flag is always propagated up to the root
+  for (auto parent = m_parent.lock(); parent != nullptr; parent = parent->m_parent.lock()) {
+    parent->m_needSubtreeRenderingUpdate = true;
+  }
+}
+
+void GUIWidget::resetHitTestingLayout()
+{
+  m_needHitTestingLayoutUpdate = true;
+
+  for (auto parent = m_parent.lock(); parent != nullptr; parent = parent->m_parent.lock()) {
+    parent->m_needHitTestingLayoutUpdate = true;
   }
 }
 
@@ -198,41 +271,70 @@ void GUIWidget::processKeyboardEvent(const GUIKeyboardEvent& event)
 
 void GUIWidget::triggerMouseButtonEvent(
   const GUIMouseButtonEvent& event,
-  std::vector<std::function<void()>>& eventsQueue)
+  GUIEventsQueue& eventsQueue)
 {
   processMouseButtonEvent(event);
 
   if (m_mouseButtonCallback) {
-    eventsQueue.emplace_back([this, event]() { m_mouseButtonCallback(event); });
+    eventsQueue.push_back(GUIQueuedEvent{.widget = this, .event = event});
   }
 }
 
 void GUIWidget::triggerMouseEnterEvent(
   const GUIMouseEnterEvent& event,
-  std::vector<std::function<void()>>& eventsQueue)
+  GUIEventsQueue& eventsQueue)
 {
   if (m_mouseEnterCallback) {
-    eventsQueue.emplace_back([this, event]() { m_mouseEnterCallback(event); });
+    eventsQueue.push_back(GUIQueuedEvent{.widget = this, .event = event});
   }
 }
 
 void GUIWidget::triggerMouseLeaveEvent(
   const GUIMouseLeaveEvent& event,
-  std::vector<std::function<void()>>& eventsQueue)
+  GUIEventsQueue& eventsQueue)
 {
   if (m_mouseLeaveCallback) {
-    eventsQueue.emplace_back([this, event]() { m_mouseLeaveCallback(event); });
+    eventsQueue.push_back(GUIQueuedEvent{.widget = this, .event = event});
   }
 }
 
 void GUIWidget::triggerKeyboardEvent(
   const GUIKeyboardEvent& event,
-  std::vector<std::function<void()>>& eventsQueue)
+  GUIEventsQueue& eventsQueue)
 {
   processKeyboardEvent(event);
 
   if (m_keyboardEventCallback) {
-    eventsQueue.emplace_back([this, event]() { m_keyboardEventCallback(event); });
+    eventsQueue.push_back(GUIQueuedEvent{.widget = this, .event = event});
+  }
+}
+
+void GUIWidget::invokeEventCallback(const GUIMouseButtonEvent& event)
+{
+  // The callback could be reset by the previous callbacks of the queue
+  if (m_mouseButtonCallback) {
+    m_mouseButtonCallback(event);
+  }
+}
+
+void GUIWidget::invokeEventCallback(const GUIMouseEnterEvent& event)
+{
+  if (m_mouseEnterCallback) {
+    m_mouseEnterCallback(event);
+  }
+}
+
+void GUIWidget::invokeEventCallback(const GUIMouseLeaveEvent& event)
+{
+  if (m_mouseLeaveCallback) {
+    m_mouseLeaveCallback(event);
+  }
+}
+
+void GUIWidget::invokeEventCallback(const GUIKeyboardEvent& event)
+{
+  if (m_keyboardEventCallback) {
+    m_keyboardEventCallback(event);
   }
 }
 
@@ -244,6 +346,7 @@ void GUIWidget::setParent(std::weak_ptr<GUIWidget> parent)
 void GUIWidget::setFocus()
 {
   m_hasFocus = true;
+  resetRenderingCache();
 
   onSetFocus();
 }
@@ -251,6 +354,7 @@ void GUIWidget::setFocus()
 void GUIWidget::resetFocus()
 {
   m_hasFocus = false;
+  resetRenderingCache();
 
   onLostFocus();
 }
@@ -262,6 +366,9 @@ void GUIWidget::orderChildrenByZIndex()
     [](std::shared_ptr<GUIWidget> widget1, std::shared_ptr<GUIWidget> widget2) {
       return widget1->getZIndex() < widget2->getZIndex();
     });
+
+  resetSubtreeRenderingCache();
+  resetHitTestingLayout();
 }
 
 std::shared_ptr<GUIWidget> GUIWidget::getParent() const
@@ -285,6 +392,11 @@ void GUIWidget::hideChildren(GUIWidget* parent)
 
   parent->m_isShown = false;
 
+  if (wasShown) {
+    parent->resetRenderingCache();
+    parent->resetHitTestingLayout();
+  }
+
   for (auto& childWidget : parent->getChildrenWidgets()) {
     hideChildren(childWidget.get());
   }
@@ -300,6 +412,11 @@ void GUIWidget::showChildren(GUIWidget* parent)
 
   parent->m_isShown = true;
 
+  if (!wasShown) {
+    parent->resetRenderingCache();
+    parent->resetHitTestingLayout();
+  }
+
   for (auto& childWidget : parent->getChildrenWidgets()) {
     showChildren(childWidget.get());
   }
@@ -323,6 +440,9 @@ const GUIWidgetVisualParameters& GUIWidget::getVisualParameters(GUIWidgetVisualS
 
 GUIWidgetVisualParameters& GUIWidget::getVisualParameters(GUIWidgetVisualState state)
 {
+  // The parameters are requested for modification
+  resetRenderingCache();
+
   return m_visualParameters[static_cast<size_t>(state)];
 }
 
@@ -7,12 +7,15 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <variant>
 
 #include "Modules/Input/InputEvents.h"
 #include "Modules/Graphics/OpenGL/GLTexture.h"
 #include "Modules/Graphics/OpenGL/GLGraphicsContext.h"
 #include "GUIWidgetVisualParameters.h"
 #include "GUIWidgetStylesheet.h"
+#include "GUIDrawList.h"
+#include "Utility/FrameArena.h"
 
 struct GUIEvent {
 };
@@ -46,6 +49,17 @@ struct GUIKeyboardEvent : GUIEvent {
 };
 
 class GUISystem;
+class GUIWidget;
+
+/*!
+ * \brief Widget event whose callback is deferred until the GUI system finishes the events processing
+ */
+struct GUIQueuedEvent {
+  GUIWidget* widget{};
+  std::variant<GUIMouseButtonEvent, GUIMouseEnterEvent, GUIMouseLeaveEvent, GUIKeyboardEvent> event;
+};
+
+using GUIEventsQueue = FrameVector<GUIQueuedEvent>;
 
 class GUIWidget : public std::enable_shared_from_this<GUIWidget> {
  public:
@@ -62,6 +76,9 @@ class GUIWidget : public std::enable_shared_from_this<GUIWidget> {
   void setOrigin(const glm::ivec2& origin);
   [[nodiscard]] glm::ivec2 getOrigin() const;
 
+  /*!
+   * \brief Returns the cached origin in the screen space, it is updated on the widget or its parents origin change
+   */
   [[nodiscard]] glm::ivec2 getAbsoluteOrigin() const;
 
   virtual void setSize(const glm::ivec2& size);
@@ -91,7 +108,13 @@ class GUIWidget : public std::enable_shared_from_this<GUIWidget> {
   [[nodiscard]] virtual bool canHaveFocus() const;
 
   virtual void update(float delta);
-  virtual void render(GUISystem& guiSystem);
+
+  /*!
+   * \brief Appends the widget quads to the draw list
+   *
+   * The quads are cached by the GUI system, so the method is called only after the widget rendering cache reset.
+   */
+  virtual void render(GUISystem& guiSystem, GUIDrawList& drawList);
 
   void setZIndex(int zIndex);
   [[nodiscard]] int getZIndex() const;
@@ -127,6 +150,11 @@ class GUIWidget : public std::enable_shared_from_this<GUIWidget> {
  protected:
   void resetTransformationCache();
 
+  /*!
+   * \brief Marks the widget quads as outdated, it should be called on any change of the widget appearance
+   */
+  void resetRenderingCache();
+
   [[nodiscard]] virtual glm::mat4 updateTransformationMatrix();
 
  protected:
@@ -144,11 +172,16 @@ class GUIWidget : public std::enable_shared_from_this<GUIWidget> {
   virtual void onLostFocus();
 
  private:
-  void triggerMouseButtonEvent(const GUIMouseButtonEvent& event, std::vector<std::function<void()>>& eventsQueue);
-  void triggerMouseEnterEvent(const GUIMouseEnterEvent& event, std::vector<std::function<void()>>& eventsQueue);
-  void triggerMouseLeaveEvent(const GUIMouseLeaveEvent& event, std::vector<std::function<void()>>& eventsQueue);
+  void triggerMouseButtonEvent(const GUIMouseButtonEvent& event, GUIEventsQueue& eventsQueue);
+  void triggerMouseEnterEvent(const GUIMouseEnterEvent& event, GUIEventsQueue& eventsQueue);
+  void triggerMouseLeaveEvent(const GUIMouseLeaveEvent& event, GUIEventsQueue& eventsQueue);
+
+  void triggerKeyboardEvent(const GUIKeyboardEvent& event, GUIEventsQueue& eventsQueue);
 
-  void triggerKeyboardEvent(const GUIKeyboardEvent& event, std::vector<std::function<void()>>& eventsQueue);
+  void invokeEventCallback(const GUIMouseButtonEvent& event);
+  void invokeEventCallback(const GUIMouseEnterEvent& event);
+  void invokeEventCallback(const GUIMouseLeaveEvent& event);
+  void invokeEventCallback(const GUIKeyboardEvent& event);
 
   void setParent(std::weak_ptr<GUIWidget> parent);
 
@@ -160,6 +193,15 @@ class GUIWidget : public std::enable_shared_from_this<GUIWidget> {
 
   void orderChildrenByZIndex();
 
+  void resetSubtreeRenderingCache();
+
+  void resetSubtreeTransformationCache(const glm::ivec2& parentAbsoluteOrigin);
+
+  /*!
+   * \brief Marks the widgets rectangles, visibility or order as changed for the GUI system hit testing
+   */
+  void resetHitTestingLayout();
+
  private:
   std::string m_className;
   std::string m_name;
@@ -167,6 +209,8 @@ class GUIWidget : public std::enable_shared_from_this<GUIWidget> {
   glm::ivec2 m_origin = glm::ivec2(0);
   glm::ivec2 m_size = glm::ivec2(0);
 
+  glm::ivec2 m_absoluteOrigin = glm::ivec2(0);
+
   std::vector<GUIWidgetVisualParameters> m_visualParameters =
     std::vector<GUIWidgetVisualParameters>(3, GUIWidgetVisualParameters{});
 
@@ -191,7 +235,14 @@ class GUIWidget : public std::enable_shared_from_this<GUIWidget> {
 
   std::vector<GUIWidgetStylesheet> m_stylesheets;
 
-  std::shared_ptr<GLMaterial> m_renderingMaterial;
+  GUIDrawList m_renderingCache;
+  bool m_needRenderingCacheUpdate = true;
+
+  // The widget or some of its descendants should be rendered again
+  bool m_needSubtreeRenderingUpdate = true;
+
+  // Some widget of the tree has changed its rectangle, visibility or order, the flag is checked on the root only
+  bool m_needHitTestingLayoutUpdate = true;
 
  private:
   friend class GUISystem;
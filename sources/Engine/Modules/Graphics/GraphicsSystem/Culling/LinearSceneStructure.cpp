@@ -11,6 +11,7 @@ void LinearSceneStructure::clear()
 {
   m_staticObjects.clear();
   m_dynamicObjects.clear();
+  m_dynamicObjectsGrid.clear();
 }
 
 void LinearSceneStructure::addObject(GameObject object)
@@ -21,7 +22,7 @@ void LinearSceneStructure::addObject(GameObject object)
     m_staticObjects.push_back(object);
   }
   else {
-    m_dynamicObjects.push_back(object);
+    addDynamicObject(object);
   }
 }
 
@@ -34,6 +35,7 @@ void LinearSceneStructure::removeObject(GameObject object)
   }
   else {
     std::erase(m_dynamicObjects, object);
+    m_dynamicObjectsGrid.removeObject(object);
   }
 }
 
@@ -42,12 +44,39 @@ void LinearSceneStructure::queryNearestDynamicNeighbors(
   float radius,
   std::vector<GameObject>& result)
 {
-  for (GameObject& object : m_dynamicObjects) {
-    glm::vec3 position = object.getComponent<TransformComponent>()->getTransform().getPosition();
+  m_dynamicObjectsGrid.queryObjectsInRadius(origin, radius, result);
+}
 
-    if (glm::length2(position - origin) <= radius * radius) {
-      result.push_back(object);
+void LinearSceneStructure::queryNearestDynamicNeighbors(
+  const glm::vec3& origin,
+  float radius,
+  size_t count,
+  std::vector<GameObject>& result)
+{
+  m_dynamicObjectsGrid.queryNearestObjects(origin, radius, count, result);
+}
+
+void LinearSceneStructure::queryNearestDynamicNeighbors(
+  std::span<const glm::vec3> origins,
+  float radius,
+  std::vector<GameObject>& result,
+  std::vector<size_t>& resultOffsets)
+{
+  m_dynamicObjectsGrid.queryObjectsInRadius(origins, radius, result, resultOffsets);
+}
+
+void LinearSceneStructure::update()
+{
+  // Objects could be moved by the transform directly without the bounds update, so every dynamic
+  // object is re-binned from its current position. The grid buckets are touched only for objects
+  // that have crossed a cell border.
+  for (GameObject& object : m_dynamicObjects) {
+    // The object could be removed from the world before the structure update
+    if (!object.isAlive() || !object.hasComponent<TransformComponent>()) {
+      continue;
     }
+
+    m_dynamicObjectsGrid.updateObject(object, getObjectPosition(object));
   }
 }
 
@@ -62,7 +91,7 @@ void LinearSceneStructure::buildFromObjectsList(std::vector<GameObject>& objects
       m_staticObjects.push_back(object);
     }
     else {
-      m_dynamicObjects.push_back(object);
+      addDynamicObject(object);
     }
   }
 }
@@ -115,3 +144,14 @@ void LinearSceneStructure::queryAllObjects(std::vector<GameObject>& result)
   result.insert(std::end(result), std::begin(m_staticObjects), std::end(m_staticObjects));
   result.insert(std::end(result), std::begin(m_dynamicObjects), std::end(m_dynamicObjects));
 }
+
+void LinearSceneStructure::addDynamicObject(GameObject& object)
+{
+  m_dynamicObjects.push_back(object);
+  m_dynamicObjectsGrid.insertObject(object, getObjectPosition(object));
+}
+
+glm::vec3 LinearSceneStructure::getObjectPosition(GameObject& object)
+{
+  return object.getComponent<TransformComponent>()->getTransform().getPosition();
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "SceneAccelerationStructure.h"
+#include "SpatialHashGrid.h"
 
 class LinearSceneStructure : public SceneAccelerationStructure {
  public:
@@ -17,9 +18,23 @@ class LinearSceneStructure : public SceneAccelerationStructure {
     float radius,
     std::vector<GameObject>& result) override;
 
+  void queryNearestDynamicNeighbors(
+    const glm::vec3& origin,
+    float radius,
+    size_t count,
+    std::vector<GameObject>& result) override;
+
+  void queryNearestDynamicNeighbors(
+    std::span<const glm::vec3> origins,
+    float radius,
+    std::vector<GameObject>& result,
+    std::vector<size_t>& resultOffsets) override;
+
   void queryVisibleObjects(Camera& camera, std::vector<GameObject>& result) override;
   void queryAllObjects(std::vector<GameObject>& result) override;
 
+  void update() override;
+
   void clear() override;
 
   [[nodiscard]] size_t getObjectsCount() const override;
@@ -30,10 +45,15 @@ class LinearSceneStructure : public SceneAccelerationStructure {
     std::vector<GameObject>& objects,
     std::vector<GameObject>& result);
 
+  static glm::vec3 getObjectPosition(GameObject& object);
+
+  void addDynamicObject(GameObject& object);
 
  private:
   GameObject m_levelObject;
 
   std::vector<GameObject> m_staticObjects;
   std::vector<GameObject> m_dynamicObjects;
+
+  SpatialHashGrid m_dynamicObjectsGrid;
 };
@@ -0,0 +1,490 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "OcclusionCuller.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+constexpr float MIN_TRIANGLE_AREA = 1e-6f;
+constexpr float MIN_CLIP_SPACE_W = 1e-6f;
+
+inline float calculateEdgeFunction(const glm::vec3& edgeBegin, const glm::vec3& edgeEnd, float x, float y)
+{
+  return (edgeEnd.x - edgeBegin.x) * (y - edgeBegin.y) - (edgeEnd.y - edgeBegin.y) * (x - edgeBegin.x);
+}
+
+}
+
+OcclusionCuller::OcclusionCuller(const OcclusionCullingOptions& options)
+{
+  setOptions(options);
+}
+
+OcclusionCuller::~OcclusionCuller()
+{
+  stopWorkers();
+}
+
+void OcclusionCuller::setOptions(const OcclusionCullingOptions& options)
+{
+  SW_ASSERT(options.depthBufferWidth > 0 && options.depthBufferHeight > 0);
+
+  // The workers are started again with the new count on the next parallel rasterization
+  if (options.workersCount != m_workers.size()) {
+    stopWorkers();
+  }
+
+  m_options = options;
+
+  m_depthLevels.clear();
+
+  size_t levelWidth = options.depthBufferWidth;
+  size_t levelHeight = options.depthBufferHeight;
+
+  while (true) {
+    m_depthLevels.push_back(DepthLevel{
+      .width = levelWidth,
+      .height = levelHeight,
+      .depth = std::vector<float>(levelWidth * levelHeight, 1.0f),
+    });
+
+    if (levelWidth == 1 && levelHeight == 1) {
+      break;
+    }
+
+    levelWidth = (levelWidth + 1) / 2;
+    levelHeight = (levelHeight + 1) / 2;
+  }
+
+  m_triangles.clear();
+}
+
+const OcclusionCullingOptions& OcclusionCuller::getOptions() const
+{
+  return m_options;
+}
+
+void OcclusionCuller::beginFrame(const glm::mat4& viewProjection)
+{
+  m_viewProjection = viewProjection;
+  m_triangles.clear();
+
+  for (DepthLevel& level : m_depthLevels) {
+    std::fill(level.depth.begin(), level.depth.end(), 1.0f);
+  }
+}
+
+void OcclusionCuller::addOccluder(std::span<const glm::vec3> vertices, std::span<const uint32_t> indices,
+  const glm::mat4& transform)
+{
+  SW_ASSERT(indices.size() % 3 == 0);
+
+  glm::mat4 transformation = m_viewProjection * transform;
+
+  m_clipSpaceVertices.resize(vertices.size());
+
+  for (size_t vertexIndex = 0; vertexIndex < vertices.size(); vertexIndex++) {
+    m_clipSpaceVertices[vertexIndex] = transformation * glm::vec4(vertices[vertexIndex], 1.0f);
+  }
+
+  for (size_t index = 0; index < indices.size(); index += 3) {
+    addClippedTriangle({
+      m_clipSpaceVertices[indices[index]],
+      m_clipSpaceVertices[indices[index + 1]],
+      m_clipSpaceVertices[indices[index + 2]],
+    });
+  }
+}
+
+void OcclusionCuller::addClippedTriangle(const std::array<glm::vec4, 3>& triangle)
+{
+  // The triangle is clipped by the near plane only, the other planes are handled by the rasterization bounds
+  std::array<glm::vec4, 4> polygon;
+  size_t polygonVerticesCount = 0;
+
+  for (size_t vertexIndex = 0; vertexIndex < 3; vertexIndex++) {
+    const glm::vec4& currentVertex = triangle[vertexIndex];
+    const glm::vec4& nextVertex = triangle[(vertexIndex + 1) % 3];
+
+    float currentDistance = currentVertex.z + currentVertex.w;
+    float nextDistance = nextVertex.z + nextVertex.w;
+
+    if (currentDistance >= 0.0f) {
+      polygon[polygonVerticesCount++] = currentVertex;
+    }
+
+    if ((currentDistance >= 0.0f) != (nextDistance >= 0.0f)) {
+      float factor = currentDistance / (currentDistance - nextDistance);
+      polygon[polygonVerticesCount++] = glm::mix(currentVertex, nextVertex, factor);
+    }
+  }
+
+  for (size_t vertexIndex = 1; vertexIndex + 1 < polygonVerticesCount; vertexIndex++) {
+    addScreenTriangle(polygon[0], polygon[vertexIndex], polygon[vertexIndex + 1]);
+  }
+}
+
+void OcclusionCuller::addScreenTriangle(const glm::vec4& first, const glm::vec4& second, const glm::vec4& third)
+{
+  const DepthLevel& depthBuffer = m_depthLevels.front();
+
+  ScreenTriangle triangle;
+  std::array<const glm::vec4*, 3> clipSpaceVertices = {&first, &second, &third};
+
+  for (size_t vertexIndex = 0; vertexIndex < 3; vertexIndex++) {
+    const glm::vec4& clipSpaceVertex = *clipSpaceVertices[vertexIndex];
+
+    if (clipSpaceVertex.w < MIN_CLIP_SPACE_W) {
+      return;
+    }
+
+    glm::vec3 ndcVertex = glm::vec3(clipSpaceVertex) / clipSpaceVertex.w;
+
+    triangle.vertices[vertexIndex] = {
+      (ndcVertex.x * 0.5f + 0.5f) * static_cast<float>(depthBuffer.width),
+      (ndcVertex.y * 0.5f + 0.5f) * static_cast<float>(depthBuffer.height),
+      ndcVertex.z * 0.5f + 0.5f,
+    };
+  }
+
+  auto isOutside = [&triangle](auto&& predicate) {
+    return std::all_of(triangle.vertices.begin(), triangle.vertices.end(), predicate);
+  };
+
+  auto width = static_cast<float>(depthBuffer.width);
+  auto height = static_cast<float>(depthBuffer.height);
+
+  if (isOutside([](const glm::vec3& vertex) { return vertex.x < 0.0f; }) ||
+    isOutside([width](const glm::vec3& vertex) { return vertex.x > width; }) ||
+    isOutside([](const glm::vec3& vertex) { return vertex.y < 0.0f; }) ||
+    isOutside([height](const glm::vec3& vertex) { return vertex.y > height; }) ||
+    isOutside([](const glm::vec3& vertex) { return vertex.z > 1.0f; })) {
+    return;
+  }
+
+  m_triangles.push_back(triangle);
+}
+
+void OcclusionCuller::rasterizeOccluders()
+{
+  if (m_triangles.empty()) {
+    return;
+  }
+
+  const size_t height = m_depthLevels.front().height;
+
+  size_t bandsCount = 1;
+
+  if (m_triangles.size() >= m_options.minParallelTrianglesCount) {
+    bandsCount = std::min(m_options.workersCount + 1, height);
+  }
+
+  if (bandsCount == 1) {
+    rasterizeBand(0, height);
+  }
+  else {
+    rasterizeBandsInParallel((height + bandsCount - 1) / bandsCount);
+  }
+
+  buildHierarchicalDepth();
+}
+
+void OcclusionCuller::rasterizeBand(size_t firstRow, size_t lastRow)
+{
+  for (const ScreenTriangle& triangle : m_triangles) {
+    rasterizeTriangle(triangle, firstRow, lastRow);
+  }
+}
+
+void OcclusionCuller::rasterizeBandsInParallel(size_t bandHeight)
+{
+  if (m_workers.empty()) {
+    startWorkers();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_workersMutex);
+
+    m_bandHeight = bandHeight;
+    m_busyWorkersCount = m_workers.size();
+    m_rasterizationIndex++;
+  }
+
+  m_workersCondition.notify_all();
+
+  // The bands do not share the depth buffer rows, so they are filled without synchronization
+  rasterizeBand(0, bandHeight);
+
+  std::unique_lock<std::mutex> lock(m_workersMutex);
+  m_workersFinishCondition.wait(lock, [this] { return m_busyWorkersCount == 0; });
+}
+
+void OcclusionCuller::startWorkers()
+{
+  SW_ASSERT(m_workers.empty());
+
+  m_isWorkersStopRequested = false;
+  m_workers.reserve(m_options.workersCount);
+
+  for (size_t workerIndex = 0; workerIndex < m_options.workersCount; workerIndex++) {
+    // The current index is passed to the worker, so it does not miss the rasterization requested before its start
+    m_workers.emplace_back(&OcclusionCuller::workerThreadLoop, this, workerIndex, m_rasterizationIndex);
+  }
+}
+
+void OcclusionCuller::stopWorkers()
+{
+  if (m_workers.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_workersMutex);
+    m_isWorkersStopRequested = true;
+  }
+
+  m_workersCondition.notify_all();
+
+  for (std::thread& worker : m_workers) {
+    worker.join();
+  }
+
+  m_workers.clear();
+}
+
+void OcclusionCuller::workerThreadLoop(size_t workerIndex, size_t processedRasterizationIndex)
+{
+  std::unique_lock<std::mutex> lock(m_workersMutex);
+
+  while (true) {
+    m_workersCondition.wait(lock, [this, processedRasterizationIndex] {
+      return m_rasterizationIndex != processedRasterizationIndex || m_isWorkersStopRequested;
+    });
+
+    if (m_isWorkersStopRequested) {
+      return;
+    }
+
+    processedRasterizationIndex = m_rasterizationIndex;
+
+    // The first band is rasterized by the calling thread, the workers without a band just report the finish
+    const size_t height = m_depthLevels.front().height;
+    const size_t firstRow = (workerIndex + 1) * m_bandHeight;
+    const size_t lastRow = std::min(firstRow + m_bandHeight, height);
+
+    lock.unlock();
+
+    if (firstRow < height) {
+      rasterizeBand(firstRow, lastRow);
+    }
+
+    lock.lock();
+
+    m_busyWorkersCount--;
+
+    if (m_busyWorkersCount == 0) {
+      m_workersFinishCondition.notify_one();
+    }
+  }
+}
+
+void OcclusionCuller::rasterizeTriangle(const ScreenTriangle& triangle, size_t firstRow, size_t lastRow)
+{
+  DepthLevel& depthBuffer = m_depthLevels.front();
+
+  glm::vec3 firstVertex = triangle.vertices[0];
+  glm::vec3 secondVertex = triangle.vertices[1];
+  glm::vec3 thirdVertex = triangle.vertices[2];
+
+  float area = calculateEdgeFunction(firstVertex, secondVertex, thirdVertex.x, thirdVertex.y);
+
+  if (std::abs(area) < MIN_TRIANGLE_AREA) {
+    return;
+  }
+
+  // The occluders are two-sided, so the back-facing triangles are turned to the counter-clockwise order
+  if (area < 0.0f) {
+    std::swap(secondVertex, thirdVertex);
+    area = -area;
+  }
+
+  // The bounds are clamped before the conversion as the vertices near the camera are projected far away
+  auto width = static_cast<float>(depthBuffer.width);
+  auto height = static_cast<float>(depthBuffer.height);
+
+  float minX = std::clamp(std::min({firstVertex.x, secondVertex.x, thirdVertex.x}), 0.0f, width);
+  float maxX = std::clamp(std::max({firstVertex.x, secondVertex.x, thirdVertex.x}), 0.0f, width);
+  float minY = std::clamp(std::min({firstVertex.y, secondVertex.y, thirdVertex.y}), 0.0f, height);
+  float maxY = std::clamp(std::max({firstVertex.y, secondVertex.y, thirdVertex.y}), 0.0f, height);
+
+  // The pixels are covered if their centers are inside of the triangle
+  auto firstColumn = static_cast<long>(std::ceil(minX - 0.5f));
+  auto lastColumn = static_cast<long>(std::floor(maxX - 0.5f));
+  auto firstTriangleRow = static_cast<long>(std::ceil(minY - 0.5f));
+  auto lastTriangleRow = static_cast<long>(std::floor(maxY - 0.5f));
+
+  lastColumn = std::min(lastColumn, static_cast<long>(depthBuffer.width) - 1);
+  firstTriangleRow = std::max(firstTriangleRow, static_cast<long>(firstRow));
+  lastTriangleRow = std::min(lastTriangleRow, static_cast<long>(lastRow) - 1);
+
+  if (firstColumn > lastColumn || firstTriangleRow > lastTriangleRow) {
+    return;
+  }
+
+  // The NDC depth is linear in the screen space, so it is interpolated without the perspective correction
+  const float firstWeightStep = -(thirdVertex.y - secondVertex.y);
+  const float secondWeightStep = -(firstVertex.y - thirdVertex.y);
+  const float thirdWeightStep = -(secondVertex.y - firstVertex.y);
+
+  const float depthStep =
+    (firstWeightStep * firstVertex.z + secondWeightStep * secondVertex.z + thirdWeightStep * thirdVertex.z) / area;
+
+  const float firstPixelX = static_cast<float>(firstColumn) + 0.5f;
+
+  for (long row = firstTriangleRow; row <= lastTriangleRow; row++) {
+    const float pixelY = static_cast<float>(row) + 0.5f;
+
+    const float firstRowWeight = calculateEdgeFunction(secondVertex, thirdVertex, firstPixelX, pixelY);
+    const float secondRowWeight = calculateEdgeFunction(thirdVertex, firstVertex, firstPixelX, pixelY);
+    const float thirdRowWeight = calculateEdgeFunction(firstVertex, secondVertex, firstPixelX, pixelY);
+
+    const float rowDepth = (firstRowWeight * firstVertex.z + secondRowWeight * secondVertex.z +
+      thirdRowWeight * thirdVertex.z) / area;
+
+    float* depthRow = depthBuffer.depth.data() + static_cast<size_t>(row) * depthBuffer.width + firstColumn;
+    // The pixels are indexed by int, as its conversion to float is vectorizable unlike the size_t one
+    const auto rowPixelsCount = static_cast<int>(lastColumn - firstColumn + 1);
+
+    for (int pixelIndex = 0; pixelIndex < rowPixelsCount; pixelIndex++) {
+      const auto step = static_cast<float>(pixelIndex);
+
+      const float firstWeight = firstRowWeight + step * firstWeightStep;
+      const float secondWeight = secondRowWeight + step * secondWeightStep;
+      const float thirdWeight = thirdRowWeight + step * thirdWeightStep;
+
+      // The conditions are combined without the short circuit to keep the loop branchless
+      const bool isInside = (firstWeight >= 0.0f) & (secondWeight >= 0.0f) & (thirdWeight >= 0.0f);
+
+      const float storedDepth = depthRow[pixelIndex];
+      const float depth = rowDepth + step * depthStep;
+
+      depthRow[pixelIndex] = (isInside & (depth < storedDepth)) ? depth : storedDepth;
+    }
+  }
+}
+
+void OcclusionCuller::buildHierarchicalDepth()
+{
+  for (size_t levelIndex = 1; levelIndex < m_depthLevels.size(); levelIndex++) {
+    const DepthLevel& sourceLevel = m_depthLevels[levelIndex - 1];
+    DepthLevel& level = m_depthLevels[levelIndex];
+
+    for (size_t row = 0; row < level.height; row++) {
+      const float* firstSourceRow = sourceLevel.depth.data() + (row * 2) * sourceLevel.width;
+      const float* secondSourceRow =
+        sourceLevel.depth.data() + std::min(row * 2 + 1, sourceLevel.height - 1) * sourceLevel.width;
+
+      float* levelRow = level.depth.data() + row * level.width;
+
+      for (size_t column = 0; column < level.width; column++) {
+        const size_t firstColumn = column * 2;
+        const size_t secondColumn = std::min(column * 2 + 1, sourceLevel.width - 1);
+
+        levelRow[column] = std::max(
+          std::max(firstSourceRow[firstColumn], firstSourceRow[secondColumn]),
+          std::max(secondSourceRow[firstColumn], secondSourceRow[secondColumn]));
+      }
+    }
+  }
+}
+
+bool OcclusionCuller::isAABBVisible(const AABB& aabb) const
+{
+  if (m_triangles.empty()) {
+    return true;
+  }
+
+  const DepthLevel& depthBuffer = m_depthLevels.front();
+
+  glm::vec2 screenMin(std::numeric_limits<float>::max());
+  glm::vec2 screenMax(std::numeric_limits<float>::lowest());
+  float minDepth = std::numeric_limits<float>::max();
+
+  for (const glm::vec3& corner : aabb.getCorners()) {
+    glm::vec4 clipSpaceCorner = m_viewProjection * glm::vec4(corner, 1.0f);
+
+    // The boxes crossing the near plane could cover the whole screen
+    if (clipSpaceCorner.z < -clipSpaceCorner.w || clipSpaceCorner.w < MIN_CLIP_SPACE_W) {
+      return true;
+    }
+
+    glm::vec3 ndcCorner = glm::vec3(clipSpaceCorner) / clipSpaceCorner.w;
+
+    glm::vec2 screenCorner = {
+      (ndcCorner.x * 0.5f + 0.5f) * static_cast<float>(depthBuffer.width),
+      (ndcCorner.y * 0.5f + 0.5f) * static_cast<float>(depthBuffer.height),
+    };
+
+    screenMin = glm::min(screenMin, screenCorner);
+    screenMax = glm::max(screenMax, screenCorner);
+    minDepth = std::min(minDepth, ndcCorner.z * 0.5f + 0.5f);
+  }
+
+  if (screenMax.x < 0.0f || screenMax.y < 0.0f ||
+    screenMin.x >= static_cast<float>(depthBuffer.width) || screenMin.y >= static_cast<float>(depthBuffer.height)) {
+    return false;
+  }
+
+  auto clampPixel = [](float coordinate, size_t size) {
+    return static_cast<size_t>(std::clamp(std::floor(coordinate), 0.0f, static_cast<float>(size - 1)));
+  };
+
+  const size_t firstColumn = clampPixel(screenMin.x, depthBuffer.width);
+  const size_t lastColumn = clampPixel(screenMax.x, depthBuffer.width);
+  const size_t firstRow = clampPixel(screenMin.y, depthBuffer.height);
+  const size_t lastRow = clampPixel(screenMax.y, depthBuffer.height);
+
+  // The level is selected to cover the screen rectangle by a few texels only
+  const size_t rectangleSize = std::max(lastColumn - firstColumn, lastRow - firstRow) + 1;
+  size_t levelIndex = 0;
+
+  while (levelIndex + 1 < m_depthLevels.size() && (rectangleSize >> levelIndex) > 2) {
+    levelIndex++;
+  }
+
+  const DepthLevel& level = m_depthLevels[levelIndex];
+
+  for (size_t row = firstRow >> levelIndex; row <= (lastRow >> levelIndex); row++) {
+    for (size_t column = firstColumn >> levelIndex; column <= (lastColumn >> levelIndex); column++) {
+      if (level.depth[row * level.width + column] >= minDepth) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+size_t OcclusionCuller::getOccludersTrianglesCount() const
+{
+  return m_triangles.size();
+}
+
+float OcclusionCuller::getDepth(size_t x, size_t y) const
+{
+  const DepthLevel& depthBuffer = m_depthLevels.front();
+
+  SW_ASSERT(x < depthBuffer.width && y < depthBuffer.height);
+
+  return depthBuffer.depth[y * depthBuffer.width + x];
+}
+
+size_t OcclusionCuller::getHierarchicalDepthLevelsCount() const
+{
+  return m_depthLevels.size();
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <span>
+#include <array>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <glm/vec3.hpp>
+#include <glm/mat4x4.hpp>
+
+#include "Modules/Math/geometry.h"
+
+struct OcclusionCullingOptions {
+  size_t depthBufferWidth = 256;
+  size_t depthBufferHeight = 128;
+
+  // Count of the threads the depth buffer bands are rasterized on, zero means the calling thread only
+  size_t workersCount = 2;
+
+  // Smaller occluders sets are rasterized on the calling thread as the workers wake up costs more
+  size_t minParallelTrianglesCount = 256;
+};
+
+/*!
+ * \brief Software occlusion culling with a low resolution depth buffer
+ *
+ * The occluders triangles are rasterized into the depth buffer on the CPU, then the depth buffer is reduced
+ * into a hierarchical depth pyramid where every texel keeps the farthest depth of the covered pixels. An object
+ * is occluded if its nearest depth is farther than the pyramid depth of all the texels its screen rectangle
+ * covers. The test is conservative: the objects crossing the near plane or not covered by the occluders are
+ * reported as visible.
+ *
+ * The depth buffer rows are split into bands rasterized independently, so the bands could be processed on
+ * the worker threads without synchronization. The workers are started on the first parallel rasterization and
+ * are kept waiting for the next frames. The rows loops are written in the branchless form to let the compiler
+ * vectorize them.
+ */
+class OcclusionCuller {
+ public:
+  explicit OcclusionCuller(const OcclusionCullingOptions& options = {});
+  ~OcclusionCuller();
+
+  OcclusionCuller(const OcclusionCuller&) = delete;
+  OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+
+  void setOptions(const OcclusionCullingOptions& options);
+  [[nodiscard]] const OcclusionCullingOptions& getOptions() const;
+
+  /*!
+   * \brief Clears the occluders and the depth buffer for the new view
+   */
+  void beginFrame(const glm::mat4& viewProjection);
+
+  /*!
+   * \brief Adds the occluder triangles to be rasterized
+   *
+   * The occluders are two-sided, so single planes could be used as the occluders too.
+   */
+  void addOccluder(std::span<const glm::vec3> vertices, std::span<const uint32_t> indices,
+    const glm::mat4& transform);
+
+  /*!
+   * \brief Rasterizes the added occluders and builds the hierarchical depth
+   */
+  void rasterizeOccluders();
+
+  /*!
+   * \brief Checks whether the world space box is not hidden behind the rasterized occluders
+   */
+  [[nodiscard]] bool isAABBVisible(const AABB& aabb) const;
+
+  [[nodiscard]] size_t getOccludersTrianglesCount() const;
+
+  /*!
+   * \brief Returns the depth of the pixel in the [0, 1] range, the bottom row is the first one
+   */
+  [[nodiscard]] float getDepth(size_t x, size_t y) const;
+
+  [[nodiscard]] size_t getHierarchicalDepthLevelsCount() const;
+
+ private:
+  struct ScreenTriangle {
+    // Pixels coordinates and the depth in the [0, 1] range
+    std::array<glm::vec3, 3> vertices;
+  };
+
+  struct DepthLevel {
+    size_t width{};
+    size_t height{};
+
+    std::vector<float> depth;
+  };
+
+ private:
+  void addClippedTriangle(const std::array<glm::vec4, 3>& triangle);
+  void addScreenTriangle(const glm::vec4& first, const glm::vec4& second, const glm::vec4& third);
+
+  void rasterizeBand(size_t firstRow, size_t lastRow);
+
+  /*!
+   * \brief Rasterizes the first band on the calling thread and the others on the workers
+   */
+  void rasterizeBandsInParallel(size_t bandHeight);
+
+  void startWorkers();
+  void stopWorkers();
+  void workerThreadLoop(size_t workerIndex, size_t processedRasterizationIndex);
+  void rasterizeTriangle(const ScreenTriangle& triangle, size_t firstRow, size_t lastRow);
+
+  void buildHierarchicalDepth();
+
+ private:
+  OcclusionCullingOptions m_options;
+
+  glm::mat4 m_viewProjection{};
+
+  std::vector<ScreenTriangle> m_triangles;
+  std::vector<glm::vec4> m_clipSpaceVertices;
+
+  // The first level is the depth buffer
+  std::vector<DepthLevel> m_depthLevels;
+
+  std::vector<std::thread> m_workers;
+  std::mutex m_workersMutex;
+  std::condition_variable m_workersCondition;
+  std::condition_variable m_workersFinishCondition;
+
+  // The index is increased to wake the workers up for the next rasterization
+  size_t m_rasterizationIndex = 0;
+  size_t m_bandHeight = 0;
+  size_t m_busyWorkersCount = 0;
+  bool m_isWorkersStopRequested = false;
+};
@@ -20,9 +20,26 @@ class SceneAccelerationStructure {
     float radius,
     std::vector<GameObject>& result) = 0;
 
+  virtual void queryNearestDynamicNeighbors(
+    const glm::vec3& origin,
+    float radius,
+    size_t count,
+    std::vector<GameObject>& result) = 0;
+
+  virtual void queryNearestDynamicNeighbors(
+    std::span<const glm::vec3> origins,
+    float radius,
+    std::vector<GameObject>& result,
+    std::vector<size_t>& resultOffsets) = 0;
+
   virtual void queryVisibleObjects(Camera& camera, std::vector<GameObject>& result) = 0;
   virtual void queryAllObjects(std::vector<GameObject>& result) = 0;
 
+  /*!
+   * \brief Synchronizes the structure with the current objects transforms
+   */
+  virtual void update() = 0;
+
   virtual void clear() = 0;
 
   [[nodiscard]] virtual size_t getObjectsCount() const = 0;
@@ -0,0 +1,348 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "SpatialHashGrid.h"
+
+namespace {
+
+constexpr int32_t CELL_COORDINATE_BITS = 21;
+constexpr int32_t CELL_COORDINATE_OFFSET = 1 << (CELL_COORDINATE_BITS - 1);
+constexpr uint64_t CELL_COORDINATE_MASK = (uint64_t(1) << CELL_COORDINATE_BITS) - 1;
+
+glm::ivec3 decodeCellKey(uint64_t cellKey)
+{
+  return {
+    int32_t(cellKey & CELL_COORDINATE_MASK) - CELL_COORDINATE_OFFSET,
+    int32_t((cellKey >> CELL_COORDINATE_BITS) & CELL_COORDINATE_MASK) - CELL_COORDINATE_OFFSET,
+    int32_t((cellKey >> (2 * CELL_COORDINATE_BITS)) & CELL_COORDINATE_MASK) - CELL_COORDINATE_OFFSET
+  };
+}
+
+}
+
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+  : m_cellSize(cellSize)
+{
+  SW_ASSERT(cellSize > 0.0f);
+}
+
+void SpatialHashGrid::insertObject(GameObject object, const glm::vec3& position)
+{
+  SW_ASSERT(!hasObject(object));
+
+  size_t entryIndex = m_entries.size();
+
+  m_entries.push_back({.object = object, .position = position, .cellKey = 0, .cellSlotIndex = 0});
+  m_entriesLookup.insert({object.getId(), entryIndex});
+
+  attachToCell(entryIndex, getCellKey(getCellCoordinates(position)));
+}
+
+void SpatialHashGrid::updateObject(GameObject object, const glm::vec3& position)
+{
+  auto entryIt = m_entriesLookup.find(object.getId());
+  SW_ASSERT(entryIt != m_entriesLookup.end());
+
+  size_t entryIndex = entryIt->second;
+  Entry& entry = m_entries[entryIndex];
+
+  entry.position = position;
+
+  CellKey cellKey = getCellKey(getCellCoordinates(position));
+
+  if (cellKey != entry.cellKey) {
+    detachFromCell(entryIndex);
+    attachToCell(entryIndex, cellKey);
+  }
+}
+
+void SpatialHashGrid::removeObject(GameObject object)
+{
+  auto entryIt = m_entriesLookup.find(object.getId());
+  SW_ASSERT(entryIt != m_entriesLookup.end());
+
+  size_t entryIndex = entryIt->second;
+  detachFromCell(entryIndex);
+
+  m_entriesLookup.erase(entryIt);
+
+  size_t lastEntryIndex = m_entries.size() - 1;
+
+  if (entryIndex != lastEntryIndex) {
+    // Move the last entry to the free slot and patch references to it
+    m_entries[entryIndex] = m_entries[lastEntryIndex];
+
+    Entry& movedEntry = m_entries[entryIndex];
+    m_entriesLookup[movedEntry.object.getId()] = entryIndex;
+    m_cells[movedEntry.cellKey][movedEntry.cellSlotIndex] = entryIndex;
+  }
+
+  m_entries.pop_back();
+}
+
+bool SpatialHashGrid::hasObject(GameObject object) const
+{
+  return m_entriesLookup.contains(object.getId());
+}
+
+void SpatialHashGrid::clear()
+{
+  m_entries.clear();
+  m_entriesLookup.clear();
+  m_cells.clear();
+}
+
+void SpatialHashGrid::queryObjectsInRadius(const glm::vec3& origin,
+  float radius,
+  std::vector<GameObject>& result) const
+{
+  float squaredRadius = radius * radius;
+
+  forEachCellInRange(getCellCoordinates(origin - glm::vec3(radius)), getCellCoordinates(origin + glm::vec3(radius)),
+    [this, &origin, squaredRadius, &result](const std::vector<size_t>& cellEntries) {
+      for (size_t entryIndex : cellEntries) {
+        const Entry& entry = m_entries[entryIndex];
+
+        if (glm::length2(entry.position - origin) <= squaredRadius) {
+          result.push_back(entry.object);
+        }
+      }
+    });
+}
+
+void SpatialHashGrid::queryNearestObjects(const glm::vec3& origin,
+  float maxRadius,
+  size_t count,
+  std::vector<GameObject>& result) const
+{
+  if (count == 0 || m_entries.empty()) {
+    return;
+  }
+
+  float squaredMaxRadius = maxRadius * maxRadius;
+
+  glm::ivec3 originCell = getCellCoordinates(origin);
+  int ringsCount = static_cast<int>(std::ceil(maxRadius / m_cellSize));
+
+  std::vector<QueryResult> candidates;
+
+  for (int ring = 0; ring <= ringsCount; ring++) {
+    // Visit only the cells on the border of the current ring
+    for (int x = -ring; x <= ring; x++) {
+      for (int y = -ring; y <= ring; y++) {
+        for (int z = -ring; z <= ring; z++) {
+          if (std::max({std::abs(x), std::abs(y), std::abs(z)}) != ring) {
+            continue;
+          }
+
+          auto cellIt = m_cells.find(getCellKey(originCell + glm::ivec3(x, y, z)));
+
+          if (cellIt == m_cells.end()) {
+            continue;
+          }
+
+          for (size_t entryIndex : cellIt->second) {
+            const Entry& entry = m_entries[entryIndex];
+            float squaredDistance = glm::length2(entry.position - origin);
+
+            if (squaredDistance <= squaredMaxRadius) {
+              candidates.push_back({.object = entry.object, .squaredDistance = squaredDistance});
+            }
+          }
+        }
+      }
+    }
+
+    if (candidates.size() >= count) {
+      std::nth_element(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(count - 1),
+        candidates.end(), [](const QueryResult& lhs, const QueryResult& rhs) {
+          return lhs.squaredDistance < rhs.squaredDistance;
+        });
+
+      // Unvisited cells are at least ring * cellSize away from the origin
+      float safeDistance = static_cast<float>(ring) * m_cellSize;
+
+      if (candidates[count - 1].squaredDistance <= safeDistance * safeDistance) {
+        break;
+      }
+    }
+  }
+
+  size_t resultCount = std::min(count, candidates.size());
+
+  std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(resultCount),
+    candidates.end(), [](const QueryResult& lhs, const QueryResult& rhs) {
+      return lhs.squaredDistance < rhs.squaredDistance;
+    });
+
+  for (size_t candidateIndex = 0; candidateIndex < resultCount; candidateIndex++) {
+    result.push_back(candidates[candidateIndex].object);
+  }
+}
+
+void SpatialHashGrid::queryObjectsInRadius(std::span<const glm::vec3> origins,
+  float radius,
+  std::vector<GameObject>& result,
+  std::vector<size_t>& resultOffsets) const
+{
+  std::vector<std::pair<CellKey, size_t>> originsOrder(origins.size());
+
+  for (size_t originIndex = 0; originIndex < origins.size(); originIndex++) {
+    originsOrder[originIndex] = {getCellKey(getCellCoordinates(origins[originIndex])), originIndex};
+  }
+
+  std::sort(originsOrder.begin(), originsOrder.end());
+
+  float squaredRadius = radius * radius;
+  int cellsReach = static_cast<int>(std::ceil(radius / m_cellSize));
+
+  std::vector<size_t> candidates;
+  std::vector<GameObject> unorderedResult;
+  std::vector<std::pair<size_t, size_t>> originsRanges(origins.size());
+
+  for (size_t groupBegin = 0; groupBegin < originsOrder.size();) {
+    CellKey groupCellKey = originsOrder[groupBegin].first;
+    size_t groupEnd = groupBegin;
+
+    while (groupEnd < originsOrder.size() && originsOrder[groupEnd].first == groupCellKey) {
+      groupEnd++;
+    }
+
+    // All origins of the group are in the same cell, so they share the same candidate cells
+    glm::ivec3 groupCell = decodeCellKey(groupCellKey);
+
+    candidates.clear();
+    forEachCellInRange(groupCell - glm::ivec3(cellsReach), groupCell + glm::ivec3(cellsReach),
+      [&candidates](const std::vector<size_t>& cellEntries) {
+        candidates.insert(candidates.end(), cellEntries.begin(), cellEntries.end());
+      });
+
+    for (size_t orderIndex = groupBegin; orderIndex < groupEnd; orderIndex++) {
+      size_t originIndex = originsOrder[orderIndex].second;
+      const glm::vec3& origin = origins[originIndex];
+
+      size_t rangeBegin = unorderedResult.size();
+
+      for (size_t entryIndex : candidates) {
+        const Entry& entry = m_entries[entryIndex];
+
+        if (glm::length2(entry.position - origin) <= squaredRadius) {
+          unorderedResult.push_back(entry.object);
+        }
+      }
+
+      originsRanges[originIndex] = {rangeBegin, unorderedResult.size()};
+    }
+
+    groupBegin = groupEnd;
+  }
+
+  resultOffsets.resize(origins.size() + 1);
+
+  for (size_t originIndex = 0; originIndex < origins.size(); originIndex++) {
+    resultOffsets[originIndex] = result.size();
+
+    auto [rangeBegin, rangeEnd] = originsRanges[originIndex];
+    result.insert(result.end(),
+      unorderedResult.begin() + static_cast<std::ptrdiff_t>(rangeBegin),
+      unorderedResult.begin() + static_cast<std::ptrdiff_t>(rangeEnd));
+  }
+
+  resultOffsets[origins.size()] = result.size();
+}
+
+size_t SpatialHashGrid::getObjectsCount() const
+{
+  return m_entries.size();
+}
+
+size_t SpatialHashGrid::getCellsCount() const
+{
+  return m_cells.size();
+}
+
+float SpatialHashGrid::getCellSize() const
+{
+  return m_cellSize;
+}
+
+glm::ivec3 SpatialHashGrid::getCellCoordinates(const glm::vec3& position) const
+{
+  return glm::ivec3(glm::floor(position / m_cellSize));
+}
+
+SpatialHashGrid::CellKey SpatialHashGrid::getCellKey(const glm::ivec3& cellCoordinates)
+{
+  return (uint64_t(cellCoordinates.x + CELL_COORDINATE_OFFSET) & CELL_COORDINATE_MASK) |
+    ((uint64_t(cellCoordinates.y + CELL_COORDINATE_OFFSET) & CELL_COORDINATE_MASK) << CELL_COORDINATE_BITS) |
+    ((uint64_t(cellCoordinates.z + CELL_COORDINATE_OFFSET) & CELL_COORDINATE_MASK) << (2 * CELL_COORDINATE_BITS));
+}
+
+void SpatialHashGrid::attachToCell(size_t entryIndex, CellKey cellKey)
+{
+  std::vector<size_t>& cellEntries = m_cells[cellKey];
+
+  Entry& entry = m_entries[entryIndex];
+  entry.cellKey = cellKey;
+  entry.cellSlotIndex = cellEntries.size();
+
+  cellEntries.push_back(entryIndex);
+}
+
+void SpatialHashGrid::detachFromCell(size_t entryIndex)
+{
+  Entry& entry = m_entries[entryIndex];
+
+  auto cellIt = m_cells.find(entry.cellKey);
+  SW_ASSERT(cellIt != m_cells.end());
+
+  std::vector<size_t>& cellEntries = cellIt->second;
+  size_t lastSlotIndex = cellEntries.size() - 1;
+
+  if (entry.cellSlotIndex != lastSlotIndex) {
+    size_t movedEntryIndex = cellEntries[lastSlotIndex];
+
+    cellEntries[entry.cellSlotIndex] = movedEntryIndex;
+    m_entries[movedEntryIndex].cellSlotIndex = entry.cellSlotIndex;
+  }
+
+  cellEntries.pop_back();
+
+  if (cellEntries.empty()) {
+    m_cells.erase(cellIt);
+  }
+}
+
+template<class Function>
+void SpatialHashGrid::forEachCellInRange(const glm::ivec3& minCell, const glm::ivec3& maxCell,
+  Function function) const
+{
+  glm::ivec3 rangeSize = maxCell - minCell + glm::ivec3(1);
+  size_t rangeCellsCount = size_t(rangeSize.x) * size_t(rangeSize.y) * size_t(rangeSize.z);
+
+  if (rangeCellsCount > m_cells.size()) {
+    // Large ranges are cheaper to process by the occupied cells enumeration
+    for (const auto&[cellKey, cellEntries] : m_cells) {
+      glm::ivec3 cell = decodeCellKey(cellKey);
+
+      if (glm::all(glm::greaterThanEqual(cell, minCell)) && glm::all(glm::lessThanEqual(cell, maxCell))) {
+        function(cellEntries);
+      }
+    }
+
+    return;
+  }
+
+  for (int x = minCell.x; x <= maxCell.x; x++) {
+    for (int y = minCell.y; y <= maxCell.y; y++) {
+      for (int z = minCell.z; z <= maxCell.z; z++) {
+        auto cellIt = m_cells.find(getCellKey({x, y, z}));
+
+        if (cellIt != m_cells.end()) {
+          function(cellIt->second);
+        }
+      }
+    }
+  }
+}
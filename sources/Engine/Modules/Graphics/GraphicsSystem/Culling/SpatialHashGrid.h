@@ -0,0 +1,106 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <unordered_map>
+
+#include "Modules/ECS/ECS.h"
+
+/*!
+ * \brief Uniform spatial hash of game objects positions
+ *
+ * Objects are bucketed by the grid cell their position falls into, so radius
+ * and k-nearest queries touch only the cells around the query origin.
+ * Object relocation is incremental: buckets are changed only if the object
+ * has crossed the cell border.
+ */
+class SpatialHashGrid {
+ public:
+  struct QueryResult {
+    GameObject object;
+    float squaredDistance{};
+  };
+
+ public:
+  explicit SpatialHashGrid(float cellSize = DEFAULT_CELL_SIZE);
+
+  void insertObject(GameObject object, const glm::vec3& position);
+  void updateObject(GameObject object, const glm::vec3& position);
+  void removeObject(GameObject object);
+
+  [[nodiscard]] bool hasObject(GameObject object) const;
+
+  void clear();
+
+  /*!
+   * \brief Finds all objects in the specified radius around the origin
+   *
+   * \param origin query origin
+   * \param radius query radius
+   * \param result objects list to append found objects
+   */
+  void queryObjectsInRadius(const glm::vec3& origin, float radius, std::vector<GameObject>& result) const;
+
+  /*!
+   * \brief Finds up to k nearest objects in the specified radius around the origin
+   *
+   * The cells are visited in rings of growing size, so the search stops as soon
+   * as the k-th found object is nearer than any unvisited cell.
+   *
+   * \param origin query origin
+   * \param maxRadius max search radius
+   * \param count max count of objects to find
+   * \param result objects list to append found objects, ordered by the distance to origin
+   */
+  void queryNearestObjects(const glm::vec3& origin, float maxRadius, size_t count,
+    std::vector<GameObject>& result) const;
+
+  /*!
+   * \brief Performs radius queries for multiple origins in one pass
+   *
+   * Origins are processed in cells order to reuse buckets between neighbouring queries.
+   * Objects found for i-th origin are stored in result[resultOffsets[i], resultOffsets[i + 1]) range.
+   *
+   * \param origins query origins
+   * \param radius query radius
+   * \param result flat list of found objects
+   * \param resultOffsets offsets of origins results in the flat list, origins.size() + 1 values
+   */
+  void queryObjectsInRadius(std::span<const glm::vec3> origins, float radius,
+    std::vector<GameObject>& result, std::vector<size_t>& resultOffsets) const;
+
+  [[nodiscard]] size_t getObjectsCount() const;
+  [[nodiscard]] size_t getCellsCount() const;
+
+  [[nodiscard]] float getCellSize() const;
+
+ public:
+  static constexpr float DEFAULT_CELL_SIZE = 4.0f;
+
+ private:
+  using CellKey = uint64_t;
+
+  struct Entry {
+    GameObject object;
+    glm::vec3 position{};
+    CellKey cellKey{};
+    size_t cellSlotIndex{};
+  };
+
+ private:
+  [[nodiscard]] glm::ivec3 getCellCoordinates(const glm::vec3& position) const;
+  [[nodiscard]] static CellKey getCellKey(const glm::ivec3& cellCoordinates);
+
+  void attachToCell(size_t entryIndex, CellKey cellKey);
+  void detachFromCell(size_t entryIndex);
+
+  template<class Function>
+  void forEachCellInRange(const glm::ivec3& minCell, const glm::ivec3& maxCell, Function function) const;
+
+ private:
+  float m_cellSize{};
+
+  std::vector<Entry> m_entries;
+  std::unordered_map<GameObjectId, size_t> m_entriesLookup;
+  std::unordered_map<CellKey, std::vector<size_t>> m_cells;
+};
@@ -227,10 +227,10 @@ void DebugPainter::createRenderingTask(
   mesh.setNormals(std::vector<glm::vec3>(points.size()));
   mesh.setUV(std::vector<glm::vec2>(points.size()));
 
-  std::vector<uint16_t> indices(points.size());
+  std::vector<uint32_t> indices(points.size());
 
   for (size_t pointIndex = 0; pointIndex < points.size(); pointIndex++) {
-    indices[pointIndex] = static_cast<uint16_t>(pointIndex);
+    indices[pointIndex] = static_cast<uint32_t>(pointIndex);
   }
 
   mesh.addSubMesh(indices);
@@ -4,11 +4,19 @@
 
 #include "FrameStats.h"
 
+#include <algorithm>
+#include <numeric>
+
 void FrameStats::reset()
 {
   m_primitivesCount = 0;
   m_subMeshesCount = 0;
   m_culledSubMeshesCount = 0;
+  m_drawCallsCount = 0;
+  m_occludedObjectsCount = 0;
+
+  m_lodsSubMeshesCounts.fill(0);
+  m_lodsSavedPrimitivesCounts.fill(0);
 }
 
 void FrameStats::increasePrimitivesCount(size_t count)
@@ -26,6 +34,24 @@ void FrameStats::increaseCulledSubMeshesCount(size_t count)
   m_culledSubMeshesCount += count;
 }
 
+void FrameStats::increaseDrawCallsCount(size_t count)
+{
+  m_drawCallsCount += count;
+}
+
+void FrameStats::increaseOccludedObjectsCount(size_t count)
+{
+  m_occludedObjectsCount += count;
+}
+
+void FrameStats::increaseLodStatistics(size_t lodIndex, size_t subMeshesCount, size_t savedPrimitivesCount)
+{
+  lodIndex = std::min(lodIndex, MAX_LODS_COUNT - 1);
+
+  m_lodsSubMeshesCounts[lodIndex] += subMeshesCount;
+  m_lodsSavedPrimitivesCounts[lodIndex] += savedPrimitivesCount;
+}
+
 size_t FrameStats::getPrimitivesCount() const
 {
   return m_primitivesCount;
@@ -40,3 +66,32 @@ size_t FrameStats::getCulledSubMeshesCount() const
 {
   return m_culledSubMeshesCount;
 }
+
+size_t FrameStats::getDrawCallsCount() const
+{
+  return m_drawCallsCount;
+}
+
+size_t FrameStats::getOccludedObjectsCount() const
+{
+  return m_occludedObjectsCount;
+}
+
+size_t FrameStats::getLodSubMeshesCount(size_t lodIndex) const
+{
+  SW_ASSERT(lodIndex < MAX_LODS_COUNT);
+
+  return m_lodsSubMeshesCounts[lodIndex];
+}
+
+size_t FrameStats::getLodSavedPrimitivesCount(size_t lodIndex) const
+{
+  SW_ASSERT(lodIndex < MAX_LODS_COUNT);
+
+  return m_lodsSavedPrimitivesCounts[lodIndex];
+}
+
+size_t FrameStats::getSavedPrimitivesCount() const
+{
+  return std::accumulate(m_lodsSavedPrimitivesCounts.begin(), m_lodsSavedPrimitivesCounts.end(), size_t(0));
+}
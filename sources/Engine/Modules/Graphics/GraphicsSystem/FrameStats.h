@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <array>
 
 struct FrameStats {
  public:
@@ -11,15 +12,41 @@ struct FrameStats {
   void increasePrimitivesCount(size_t count);
   void increaseSubMeshesCount(size_t count);
   void increaseCulledSubMeshesCount(size_t count);
+  void increaseDrawCallsCount(size_t count);
+  void increaseOccludedObjectsCount(size_t count);
+
+  /*!
+   * \brief Counts the sub-meshes drawn with the LOD and the primitives saved against the full detail LOD
+   */
+  void increaseLodStatistics(size_t lodIndex, size_t subMeshesCount, size_t savedPrimitivesCount);
 
   [[nodiscard]] size_t getPrimitivesCount() const;
   [[nodiscard]] size_t getSubMeshesCount() const;
   [[nodiscard]] size_t getCulledSubMeshesCount() const;
+  [[nodiscard]] size_t getDrawCallsCount() const;
+  [[nodiscard]] size_t getOccludedObjectsCount() const;
+
+  [[nodiscard]] size_t getLodSubMeshesCount(size_t lodIndex) const;
+  [[nodiscard]] size_t getLodSavedPrimitivesCount(size_t lodIndex) const;
+  [[nodiscard]] size_t getSavedPrimitivesCount() const;
+
+ public:
+  static constexpr size_t MAX_LODS_COUNT = 8;
 
  private:
   size_t m_primitivesCount = 0;
 
   size_t m_subMeshesCount = 0;
   size_t m_culledSubMeshesCount = 0;
+
+  // Multi-draw calls are counted once
+  size_t m_drawCallsCount = 0;
+
+  // The objects passed the frustum test, but hidden behind the occluders
+  size_t m_occludedObjectsCount = 0;
+
+  // The LODs beyond the limit are counted as the last one
+  std::array<size_t, MAX_LODS_COUNT> m_lodsSubMeshesCounts{};
+  std::array<size_t, MAX_LODS_COUNT> m_lodsSavedPrimitivesCounts{};
 };
 
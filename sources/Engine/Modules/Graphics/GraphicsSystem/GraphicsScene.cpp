@@ -4,11 +4,13 @@
 
 #include "GraphicsScene.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "Culling/LinearSceneStructure.h"
 #include "MeshRendererComponent.h"
 #include "MeshRenderingSystem.h"
+#include "OccluderComponent.h"
 #include "TransformComponent.h"
 
 GraphicsScene::GraphicsScene()
@@ -45,6 +47,8 @@ void GraphicsScene::removeObject(GameObject object)
     m_drawableObjectsCount--;
   }
 
+  std::erase(m_occluders, object);
+
   m_accelerationStructure->removeObject(object);
 }
 
@@ -56,9 +60,74 @@ void GraphicsScene::queryNearestDynamicNeighbors(
   m_accelerationStructure->queryNearestDynamicNeighbors(origin, radius, result);
 }
 
+void GraphicsScene::queryNearestDynamicNeighbors(
+  const glm::vec3& origin,
+  float radius,
+  size_t count,
+  std::vector<GameObject>& result)
+{
+  m_accelerationStructure->queryNearestDynamicNeighbors(origin, radius, count, result);
+}
+
+void GraphicsScene::queryNearestDynamicNeighbors(
+  std::span<const glm::vec3> origins,
+  float radius,
+  std::vector<GameObject>& result,
+  std::vector<size_t>& resultOffsets)
+{
+  m_accelerationStructure->queryNearestDynamicNeighbors(origins, radius, result, resultOffsets);
+}
+
+void GraphicsScene::updateObjects()
+{
+  m_accelerationStructure->update();
+}
+
 void GraphicsScene::queryVisibleObjects(Camera& camera, std::vector<GameObject>& result)
 {
+  size_t firstObjectIndex = result.size();
+
   m_accelerationStructure->queryVisibleObjects(camera, result);
+
+  if (m_isOcclusionCullingEnabled && !m_occluders.empty()) {
+    cullOccludedObjects(camera, result, firstObjectIndex);
+  }
+}
+
+void GraphicsScene::cullOccludedObjects(Camera& camera, std::vector<GameObject>& objects, size_t firstObjectIndex)
+{
+  m_occlusionCuller.beginFrame(camera.getProjectionMatrix() * camera.getViewMatrix());
+
+  for (GameObject& occluder : m_occluders) {
+    const Mesh* mesh = occluder.getComponent<OccluderComponent>()->getMeshInstance().get();
+    glm::mat4 transformationMatrix =
+      occluder.getComponent<TransformComponent>()->getTransform().getTransformationMatrix();
+
+    // The occluders are not drawable in general, so they are checked against the frustum here
+    AABB occluderBounds = mesh->getAABB();
+    occluderBounds.applyTransform(transformationMatrix);
+
+    if (!GeometryUtils::isAABBFrustumIntersecting(occluderBounds, camera.getFrustum())) {
+      continue;
+    }
+
+    for (size_t subMeshIndex = 0; subMeshIndex < mesh->getSubMeshesCount(); subMeshIndex++) {
+      m_occlusionCuller.addOccluder(mesh->getVertices(), mesh->getSubMeshIndices(subMeshIndex),
+        transformationMatrix);
+    }
+  }
+
+  m_occlusionCuller.rasterizeOccluders();
+
+  auto occludedObjectsIt = std::remove_if(objects.begin() + static_cast<std::ptrdiff_t>(firstObjectIndex),
+    objects.end(),
+    [this](GameObject& object) {
+      return !m_occlusionCuller.isAABBVisible(object.getComponent<TransformComponent>()->getBoundingBox());
+    });
+
+  m_frameStats.increaseOccludedObjectsCount(static_cast<size_t>(std::distance(occludedObjectsIt, objects.end())));
+
+  objects.erase(occludedObjectsIt, objects.end());
 }
 
 void GraphicsScene::clearObjects()
@@ -112,6 +181,10 @@ void GraphicsScene::addSceneNodeComponent(GameObject& object)
   if (isDrawable) {
     m_drawableObjectsCount++;
   }
+
+  if (object.hasComponent<OccluderComponent>()) {
+    m_occluders.push_back(object);
+  }
 }
 
 bool GraphicsScene::isObjectDrawable(GameObject& object)
@@ -119,6 +192,26 @@ bool GraphicsScene::isObjectDrawable(GameObject& object)
   return object.hasComponent<MeshRendererComponent>();
 }
 
+void GraphicsScene::enableOcclusionCulling(bool isEnabled)
+{
+  m_isOcclusionCullingEnabled = isEnabled;
+}
+
+bool GraphicsScene::isOcclusionCullingEnabled() const
+{
+  return m_isOcclusionCullingEnabled;
+}
+
+void GraphicsScene::setOcclusionCullingOptions(const OcclusionCullingOptions& options)
+{
+  m_occlusionCuller.setOptions(options);
+}
+
+const OcclusionCullingOptions& GraphicsScene::getOcclusionCullingOptions() const
+{
+  return m_occlusionCuller.getOptions();
+}
+
 const FrameStats& GraphicsScene::getFrameStats() const
 {
   return m_frameStats;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Culling/SceneAccelerationStructure.h"
+#include "Culling/OcclusionCuller.h"
 
 #include "FrameStats.h"
 
@@ -82,23 +83,61 @@ class GraphicsScene {
     float radius,
     std::vector<GameObject>& result);
 
+  /*!
+   * \brief Finds up to count nearest dynamic objects, ordered by the distance to origin
+   */
+  void queryNearestDynamicNeighbors(
+    const glm::vec3& origin,
+    float radius,
+    size_t count,
+    std::vector<GameObject>& result);
+
+  /*!
+   * \brief Finds dynamic neighbors for a batch of origins
+   *
+   * Objects found for i-th origin are stored in result[resultOffsets[i], resultOffsets[i + 1]) range.
+   */
+  void queryNearestDynamicNeighbors(
+    std::span<const glm::vec3> origins,
+    float radius,
+    std::vector<GameObject>& result,
+    std::vector<size_t>& resultOffsets);
+
+  /*!
+   * \brief Finds the objects passed the frustum culling and not hidden behind the occluders
+   */
   void queryVisibleObjects(Camera& camera, std::vector<GameObject>& result);
   void queryVisibleObjects(std::vector<GameObject>& result);
 
   void clearObjects();
 
+  void updateObjects();
+
   [[nodiscard]] size_t getObjectsCount() const;
   [[nodiscard]] size_t getDrawableObjectsCount() const;
 
   void setActiveCamera(std::shared_ptr<Camera> camera);
   [[nodiscard]] std::shared_ptr<Camera> getActiveCamera() const;
 
+  /*!
+   * \brief Enables testing of the visible objects against the depth buffer with the rasterized occluders
+   *
+   * Only the objects with the occluder component at the moment of adding to the scene are used as the occluders.
+   */
+  void enableOcclusionCulling(bool isEnabled);
+  [[nodiscard]] bool isOcclusionCullingEnabled() const;
+
+  void setOcclusionCullingOptions(const OcclusionCullingOptions& options);
+  [[nodiscard]] const OcclusionCullingOptions& getOcclusionCullingOptions() const;
+
   [[nodiscard]] const FrameStats& getFrameStats() const;
   FrameStats& getFrameStats();
 
  private:
   void addSceneNodeComponent(GameObject& object);
 
+  void cullOccludedObjects(Camera& camera, std::vector<GameObject>& objects, size_t firstObjectIndex);
+
   [[nodiscard]] static bool isObjectDrawable(GameObject& object);
 
  private:
@@ -107,5 +146,9 @@ class GraphicsScene {
 
   size_t m_drawableObjectsCount{};
 
+  std::vector<GameObject> m_occluders;
+  OcclusionCuller m_occlusionCuller;
+  bool m_isOcclusionCullingEnabled = true;
+
   FrameStats m_frameStats;
 };
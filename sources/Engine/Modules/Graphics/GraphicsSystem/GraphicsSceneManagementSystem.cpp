@@ -45,6 +45,13 @@ void GraphicsSceneManagementSystem::unconfigure()
   gameWorld->unsubscribeEventsListener<GameObjectRemoveEvent>(this);
 }
 
+void GraphicsSceneManagementSystem::update(float delta)
+{
+  ARG_UNUSED(delta);
+
+  m_graphicsScene->updateObjects();
+}
+
 EventProcessStatus GraphicsSceneManagementSystem::receiveEvent(const LoadSceneCommandEvent& event)
 {
   SW_ASSERT(m_graphicsScene->getObjectsCount() == 0);
@@ -39,6 +39,8 @@ class GraphicsSceneManagementSystem : public GameSystem,
   void configure() override;
   void unconfigure() override;
 
+  void update(float delta) override;
+
   EventProcessStatus receiveEvent(const LoadSceneCommandEvent& event) override;
   EventProcessStatus receiveEvent(const UnloadSceneCommandEvent& event) override;
   EventProcessStatus receiveEvent(const AddObjectToSceneCommandEvent& event) override;
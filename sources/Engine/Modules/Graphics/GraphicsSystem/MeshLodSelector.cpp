@@ -0,0 +1,49 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "MeshLodSelector.h"
+
+#include <cmath>
+#include <limits>
+
+float MeshLodSelector::getProjectedScreenSize(const Sphere& boundingSphere,
+  const glm::vec3& cameraPosition,
+  float fovY)
+{
+  float distance = glm::distance(boundingSphere.getOrigin(), cameraPosition);
+
+  if (distance <= boundingSphere.getRadius()) {
+    // The camera is inside the sphere, so the object covers the whole screen
+    return std::numeric_limits<float>::max();
+  }
+
+  return boundingSphere.getRadius() / (distance * std::tan(fovY * 0.5f));
+}
+
+size_t MeshLodSelector::selectLod(const Mesh& mesh, float screenSize, size_t currentLodIndex, float hysteresis)
+{
+  size_t lodsCount = mesh.getLodsCount();
+
+  if (currentLodIndex >= lodsCount) {
+    currentLodIndex = lodsCount - 1;
+  }
+
+  size_t lodIndex = currentLodIndex;
+
+  // Coarser LODs are selected after the size is noticeably smaller than the current LOD threshold
+  while (lodIndex + 1 < lodsCount && screenSize < mesh.getLodMinScreenSize(lodIndex) * (1.0f - hysteresis)) {
+    lodIndex++;
+  }
+
+  if (lodIndex != currentLodIndex) {
+    return lodIndex;
+  }
+
+  // Finer LODs are selected after the size is noticeably bigger than the finer LOD threshold
+  while (lodIndex > 0 && screenSize >= mesh.getLodMinScreenSize(lodIndex - 1) * (1.0f + hysteresis)) {
+    lodIndex--;
+  }
+
+  return lodIndex;
+}
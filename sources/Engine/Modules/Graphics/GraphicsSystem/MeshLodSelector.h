@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+#include <glm/vec3.hpp>
+
+#include "Modules/Math/geometry.h"
+#include "Modules/Graphics/OpenGL/Mesh.h"
+
+/*!
+ * \brief Selection of the mesh LODs by the projected bounding sphere size
+ *
+ * The screen size is the sphere diameter relative to the screen height. The LOD is switched
+ * only after the size crosses the threshold by the hysteresis fraction, so the objects near
+ * the threshold distance do not flicker between the LODs.
+ */
+class MeshLodSelector {
+ public:
+  MeshLodSelector() = delete;
+
+  [[nodiscard]] static float getProjectedScreenSize(const Sphere& boundingSphere,
+    const glm::vec3& cameraPosition,
+    float fovY);
+
+  [[nodiscard]] static size_t selectLod(const Mesh& mesh, float screenSize, size_t currentLodIndex, float hysteresis);
+
+ public:
+  static constexpr float DEFAULT_HYSTERESIS = 0.1f;
+};
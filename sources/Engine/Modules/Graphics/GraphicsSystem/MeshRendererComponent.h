@@ -36,6 +36,8 @@ class MeshRendererComponentBindingParameters {
 };
 
 struct MeshRenderingAttributes {
+  // LOD selected in the previous frame, it is kept to apply the LODs switching hysteresis
+  size_t lodIndex = 0;
 };
 
 class MeshRendererComponent {
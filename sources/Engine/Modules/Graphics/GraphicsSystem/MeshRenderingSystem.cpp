@@ -9,6 +9,7 @@
 
 #include "Modules/ECS/ECS.h"
 #include "Modules/Graphics/GraphicsSystem/Animation/SkeletalAnimationComponent.h"
+#include "Utility/FrameArena.h"
 
 #include "TransformComponent.h"
 #include "MeshRendererComponent.h"
@@ -39,25 +40,18 @@ void MeshRenderingSystem::update(float delta)
 
 void MeshRenderingSystem::render()
 {
-  // TODO: reorganize this logic and get rid of these static cache variables
-  static std::vector<glm::mat4> skinnedMeshesPremultipliedTransforms;
-  SW_ASSERT(skinnedMeshesPremultipliedTransforms.size() < 128);
-  skinnedMeshesPremultipliedTransforms.reserve(128);
-  skinnedMeshesPremultipliedTransforms.clear();
+  m_visibleObjects.clear();
 
-  static std::vector<GameObject> visibleObjects;
-  SW_ASSERT(visibleObjects.size() < 1024);
-  visibleObjects.reserve(1024);
-  visibleObjects.clear();
-
-  m_graphicsScene->queryVisibleObjects(visibleObjects);
+  m_graphicsScene->queryVisibleObjects(m_visibleObjects);
 
   auto& frameStats = m_graphicsScene->getFrameStats();
 
   frameStats.increaseCulledSubMeshesCount(
-    m_graphicsScene->getDrawableObjectsCount() - visibleObjects.size());
+    m_graphicsScene->getDrawableObjectsCount() - m_visibleObjects.size());
+
+  const Camera* camera = m_graphicsScene->getActiveCamera().get();
 
-  for (GameObject obj : visibleObjects) {
+  for (GameObject obj : m_visibleObjects) {
     auto& transformComponent = *obj.getComponent<TransformComponent>().get();
     auto& transform = transformComponent.getTransform();
 
@@ -71,13 +65,18 @@ void MeshRenderingSystem::render()
 
     frameStats.increaseSubMeshesCount(subMeshesCount);
 
+    size_t lodIndex = selectObjectLod(transformComponent, *meshComponent.get(), camera);
+
     bool isMeshAnimated = mesh->isSkinned() && mesh->hasSkeleton() && obj.hasComponent<SkeletalAnimationComponent>();
 
+    // The premultiplied transform is referenced by the render tasks, so it is kept in the frame arena
+    const glm::mat4* skinnedMeshPremultipliedTransform = nullptr;
+
     if (isMeshAnimated) {
       // TODO: investigate and debug getInverseSceneTransform behaviour, check
       //  that this multiplication is correct
-      skinnedMeshesPremultipliedTransforms
-        .push_back(transform.getTransformationMatrix() * mesh->getInverseSceneTransform());
+      skinnedMeshPremultipliedTransform =
+        FrameArena::create<glm::mat4>(transform.getTransformationMatrix() * mesh->getInverseSceneTransform());
     }
 
     for (size_t subMeshIndex = 0; subMeshIndex < subMeshesCount; subMeshIndex++) {
@@ -98,14 +97,20 @@ void MeshRenderingSystem::render()
         }
       }
 
-      frameStats.increasePrimitivesCount(mesh->getSubMeshIndicesCount(subMeshIndex) / 3);
+      size_t lodIndicesCount = mesh->getSubMeshIndicesCount(subMeshIndex, lodIndex);
+
+      frameStats.increasePrimitivesCount(lodIndicesCount / 3);
+      frameStats.increaseLodStatistics(lodIndex, 1,
+        (mesh->getSubMeshIndicesCount(subMeshIndex, 0) - lodIndicesCount) / 3);
 
       m_graphicsContext->scheduleRenderTask(RenderTask{
         .material = meshComponent->getMaterialInstance(subMeshIndex).get(),
         .mesh = mesh,
         .subMeshIndex = static_cast<uint16_t>(subMeshIndex),
-        .transform = ((isMeshAnimated) ? &(*skinnedMeshesPremultipliedTransforms.rbegin()) : &transform.getTransformationMatrix()),
+        .transform = ((isMeshAnimated) ? skinnedMeshPremultipliedTransform : &transform.getTransformationMatrix()),
         .matrixPalette = matrixPalette,
+        .indicesOffset = mesh->getSubMeshIndicesOffset(subMeshIndex, lodIndex),
+        .indicesCount = lodIndicesCount,
       });
 
 //      if (matrixPalette != nullptr) {
@@ -137,3 +142,48 @@ bool MeshRenderingSystem::isBoundsRenderingEnabled() const
 {
   return m_isBoundsRenderingEnabled;
 }
+
+void MeshRenderingSystem::enableLods(bool isEnabled)
+{
+  m_isLodsEnabled = isEnabled;
+}
+
+bool MeshRenderingSystem::isLodsEnabled() const
+{
+  return m_isLodsEnabled;
+}
+
+void MeshRenderingSystem::setLodsHysteresis(float hysteresis)
+{
+  SW_ASSERT(hysteresis >= 0.0f && hysteresis < 1.0f);
+
+  m_lodsHysteresis = hysteresis;
+}
+
+float MeshRenderingSystem::getLodsHysteresis() const
+{
+  return m_lodsHysteresis;
+}
+
+size_t MeshRenderingSystem::selectObjectLod(const TransformComponent& transformComponent,
+  MeshRendererComponent& meshComponent,
+  const Camera* camera) const
+{
+  const Mesh& mesh = *meshComponent.getMeshInstance().get();
+
+  if (!m_isLodsEnabled || camera == nullptr || mesh.getLodsCount() == 1) {
+    return 0;
+  }
+
+  // Bounding spheres are updated for the dynamic objects only
+  Sphere boundingSphere = transformComponent.isStatic() ?
+    transformComponent.getBoundingBox().toSphere() : transformComponent.getBoundingSphere();
+
+  float screenSize = MeshLodSelector::getProjectedScreenSize(boundingSphere,
+    camera->getTransform()->getPosition(), camera->getFOVy());
+
+  size_t& lodIndex = meshComponent.getAttributes().lodIndex;
+  lodIndex = MeshLodSelector::selectLod(mesh, screenSize, lodIndex, m_lodsHysteresis);
+
+  return lodIndex;
+}
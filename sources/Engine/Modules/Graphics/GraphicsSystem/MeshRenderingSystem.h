@@ -4,6 +4,9 @@
 
 #include "Modules/Graphics/OpenGL/GLGraphicsContext.h"
 #include "RenderingSystem.h"
+#include "MeshLodSelector.h"
+#include "MeshRendererComponent.h"
+#include "TransformComponent.h"
 
 class MeshRenderingSystem : public RenderingSystem {
  public:
@@ -22,6 +25,23 @@ class MeshRenderingSystem : public RenderingSystem {
   void enableBoundsRendering(bool isEnabled = true);
   [[nodiscard]] bool isBoundsRenderingEnabled() const;
 
+  void enableLods(bool isEnabled = true);
+  [[nodiscard]] bool isLodsEnabled() const;
+
+  void setLodsHysteresis(float hysteresis);
+  [[nodiscard]] float getLodsHysteresis() const;
+
+ private:
+  [[nodiscard]] size_t selectObjectLod(const TransformComponent& transformComponent,
+    MeshRendererComponent& meshComponent,
+    const Camera* camera) const;
+
  private:
   bool m_isBoundsRenderingEnabled{};
+
+  bool m_isLodsEnabled = true;
+  float m_lodsHysteresis = MeshLodSelector::DEFAULT_HYSTERESIS;
+
+  // The buffer is reused between the frames, so the visible objects query does not allocate
+  std::vector<GameObject> m_visibleObjects;
 };
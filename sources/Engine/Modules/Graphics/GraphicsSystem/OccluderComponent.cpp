@@ -0,0 +1,43 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "OccluderComponent.h"
+
+#include <utility>
+
+#include "Modules/ECS/ECS.h"
+
+OccluderComponent::OccluderComponent() = default;
+
+void OccluderComponent::setMeshInstance(ResourceHandle<Mesh> instance)
+{
+  m_meshInstance = std::move(instance);
+}
+
+ResourceHandle<Mesh> OccluderComponent::getMeshInstance() const
+{
+  return m_meshInstance;
+}
+
+OccluderComponent::BindingParameters OccluderComponent::getBindingParameters() const
+{
+  return OccluderComponent::BindingParameters{
+    .meshResourceName = m_meshInstance.getResourceId(),
+  };
+}
+
+OccluderComponentBinder::OccluderComponentBinder(const ComponentBindingParameters& componentParameters,
+  std::shared_ptr<ResourcesManager> resourcesManager)
+  : m_bindingParameters(componentParameters),
+    m_resourcesManager(std::move(resourcesManager))
+{
+
+}
+
+void OccluderComponentBinder::bindToObject(GameObject& gameObject)
+{
+  auto& occluderComponent = *gameObject.addComponent<OccluderComponent>().get();
+
+  occluderComponent.setMeshInstance(m_resourcesManager->getResource<Mesh>(m_bindingParameters.meshResourceName));
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Modules/Graphics/Resources/MeshResourceManager.h"
+#include "Modules/ECS/GameObjectsFactory.h"
+
+class OccluderComponentBindingParameters {
+ public:
+  std::string meshResourceName;
+
+  template<class Archive>
+  void serialize(Archive& archive)
+  {
+    archive(
+      cereal::make_nvp("mesh_resource", meshResourceName));
+  };
+
+};
+
+/*!
+ * \brief Simplified mesh of the object to be rasterized into the occlusion culling depth buffer
+ *
+ * The occluder mesh should be placed inside of the object visual mesh to keep the culling conservative.
+ */
+class OccluderComponent {
+ public:
+  static constexpr bool s_isSerializable = true;
+  using BindingParameters = OccluderComponentBindingParameters;
+
+ public:
+  OccluderComponent();
+
+  void setMeshInstance(ResourceHandle<Mesh> instance);
+  [[nodiscard]] ResourceHandle<Mesh> getMeshInstance() const;
+
+  [[nodiscard]] BindingParameters getBindingParameters() const;
+
+ private:
+  ResourceHandle<Mesh> m_meshInstance;
+};
+
+class OccluderComponentBinder : public GameObjectsComponentBinder<OccluderComponent> {
+ public:
+  explicit OccluderComponentBinder(const ComponentBindingParameters& componentParameters,
+    std::shared_ptr<ResourcesManager> resourcesManager);
+
+  void bindToObject(GameObject& gameObject) override;
+
+ private:
+  ComponentBindingParameters m_bindingParameters;
+  std::shared_ptr<ResourcesManager> m_resourcesManager;
+};
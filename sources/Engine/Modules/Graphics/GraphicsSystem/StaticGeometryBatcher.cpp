@@ -0,0 +1,228 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "StaticGeometryBatcher.h"
+
+#include <algorithm>
+#include <map>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <glm/gtc/matrix_inverse.hpp>
+
+#include "TransformComponent.h"
+#include "MeshRendererComponent.h"
+
+namespace {
+
+// Spatial cell coordinates and the material of the batch
+using StaticGeometryBatchKey = std::tuple<int, int, int, size_t>;
+
+constexpr uint32_t UNUSED_VERTEX = std::numeric_limits<uint32_t>::max();
+
+StaticGeometryBatchKey getBatchKey(const StaticGeometryBatchSource& source, float cellSize)
+{
+  glm::ivec3 cell(glm::floor(source.origin / cellSize));
+
+  return {cell.x, cell.y, cell.z, source.materialIndex};
+}
+
+}
+
+StaticGeometryBatcher::StaticGeometryBatcher(std::shared_ptr<GameWorld> gameWorld,
+  std::shared_ptr<ResourcesManager> resourcesManager)
+  : m_gameWorld(std::move(gameWorld)),
+    m_resourcesManager(std::move(resourcesManager))
+{
+
+}
+
+std::vector<GameObject> StaticGeometryBatcher::batchObjects(std::vector<GameObject>& objects,
+  const StaticGeometryBatchingOptions& options)
+{
+  std::vector<GameObject> batchedObjects;
+
+  std::vector<StaticGeometryBatchSource> sources;
+  std::vector<ResourceHandle<GLMaterial>> materials;
+
+  for (GameObject& object : objects) {
+    if (!isObjectBatchable(object)) {
+      continue;
+    }
+
+    batchedObjects.push_back(object);
+
+    auto& transformComponent = *object.getComponent<TransformComponent>().get();
+    auto& meshComponent = *object.getComponent<MeshRendererComponent>().get();
+
+    const Mesh* mesh = meshComponent.getMeshInstance().get();
+
+    for (size_t subMeshIndex = 0; subMeshIndex < mesh->getSubMeshesCount(); subMeshIndex++) {
+      ResourceHandle<GLMaterial> material = meshComponent.getMaterialInstance(subMeshIndex);
+
+      auto materialIt = std::find_if(materials.begin(), materials.end(),
+        [&material](const ResourceHandle<GLMaterial>& handle) {
+          return handle.get() == material.get();
+        });
+
+      if (materialIt == materials.end()) {
+        materialIt = materials.insert(materials.end(), material);
+      }
+
+      sources.push_back(StaticGeometryBatchSource{
+        .mesh = mesh,
+        .subMeshIndex = subMeshIndex,
+        .materialIndex = static_cast<size_t>(std::distance(materials.begin(), materialIt)),
+        .transform = transformComponent.getTransform().getTransformationMatrix(),
+        .origin = transformComponent.getBoundingBox().getOrigin(),
+      });
+    }
+  }
+
+  std::vector<StaticGeometryBatch> batches = buildBatches(sources, options);
+  std::vector<GameObject> batchesObjects;
+
+  for (const StaticGeometryBatch& batch : batches) {
+    ResourceHandle<Mesh> batchMesh = m_resourcesManager->createResourceInPlace<Mesh>();
+
+    batchMesh->setVertices(batch.positions);
+    batchMesh->setNormals(batch.normals);
+    batchMesh->setUV(batch.uv);
+    batchMesh->addSubMesh(batch.indices);
+    batchMesh->setAABB(batch.bounds);
+
+    GameObject batchObject = m_gameWorld->createGameObject();
+
+    // The batch geometry is placed in the world space already, so the object transform is the identity one
+    auto& transformComponent = *batchObject.addComponent<TransformComponent>().get();
+    transformComponent.setStaticMode(true);
+    transformComponent.setOnlineMode(true);
+    transformComponent.setBounds(batch.bounds);
+    transformComponent.updateBounds(transformComponent.getTransform().getTransformationMatrix());
+
+    auto& meshComponent = *batchObject.addComponent<MeshRendererComponent>().get();
+    meshComponent.setMeshInstance(batchMesh);
+    meshComponent.setMaterialInstance(0, materials[batch.materialIndex]);
+
+    batchesObjects.push_back(batchObject);
+  }
+
+  // The source meshes are unloaded here if they are not referenced by the other objects
+  for (GameObject& object : batchedObjects) {
+    object.removeComponent<MeshRendererComponent>();
+  }
+
+  spdlog::info("Static geometry batching: {} objects, {} sub-meshes are merged into {} batches",
+    batchedObjects.size(), sources.size(), batches.size());
+
+  return batchesObjects;
+}
+
+bool StaticGeometryBatcher::isObjectBatchable(GameObject& object)
+{
+  if (!object.hasComponent<TransformComponent>() || !object.hasComponent<MeshRendererComponent>()) {
+    return false;
+  }
+
+  if (!object.getComponent<TransformComponent>()->isStatic()) {
+    return false;
+  }
+
+  auto& meshComponent = *object.getComponent<MeshRendererComponent>().get();
+  const Mesh* mesh = meshComponent.getMeshInstance().get();
+
+  // The batches have the position, normal and UV attributes only
+  if (mesh == nullptr || mesh->isSkinned() || !mesh->hasNormals() || !mesh->hasUV() || mesh->getLodsCount() > 1) {
+    return false;
+  }
+
+  for (size_t subMeshIndex = 0; subMeshIndex < mesh->getSubMeshesCount(); subMeshIndex++) {
+    if (meshComponent.getMaterialInstance(subMeshIndex).get() == nullptr) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::vector<StaticGeometryBatch> StaticGeometryBatcher::buildBatches(
+  const std::vector<StaticGeometryBatchSource>& sources,
+  const StaticGeometryBatchingOptions& options)
+{
+  SW_ASSERT(options.cellSize > 0.0f);
+
+  std::vector<StaticGeometryBatch> batches;
+
+  // The last batch of every cell and material, the previous ones are filled up to the vertices limit
+  std::map<StaticGeometryBatchKey, size_t> openBatches;
+
+  std::vector<uint32_t> verticesRemap;
+  std::vector<uint32_t> usedVertices;
+
+  for (size_t sourceIndex = 0; sourceIndex < sources.size(); sourceIndex++) {
+    const StaticGeometryBatchSource& source = sources[sourceIndex];
+    const Mesh& mesh = *source.mesh;
+
+    std::span<const uint32_t> subMeshIndices = mesh.getSubMeshIndices(source.subMeshIndex);
+
+    if (subMeshIndices.empty()) {
+      continue;
+    }
+
+    // The sub-meshes share the mesh vertices, so only the referenced ones are copied
+    verticesRemap.assign(mesh.getVertices().size(), UNUSED_VERTEX);
+    usedVertices.clear();
+
+    for (uint32_t vertexIndex : subMeshIndices) {
+      if (verticesRemap[vertexIndex] == UNUSED_VERTEX) {
+        verticesRemap[vertexIndex] = static_cast<uint32_t>(usedVertices.size());
+        usedVertices.push_back(vertexIndex);
+      }
+    }
+
+    StaticGeometryBatchKey batchKey = getBatchKey(source, options.cellSize);
+    auto batchIt = openBatches.find(batchKey);
+
+    if (batchIt == openBatches.end() || (!batches[batchIt->second].positions.empty() &&
+      batches[batchIt->second].positions.size() + usedVertices.size() > options.maxBatchVerticesCount)) {
+      batches.push_back(StaticGeometryBatch{.materialIndex = source.materialIndex});
+      openBatches[batchKey] = batches.size() - 1;
+    }
+
+    StaticGeometryBatch& batch = batches[openBatches[batchKey]];
+
+    auto baseVertex = static_cast<uint32_t>(batch.positions.size());
+    glm::mat3 normalsTransform = glm::inverseTranspose(glm::mat3(source.transform));
+
+    for (uint32_t vertexIndex : usedVertices) {
+      batch.positions.emplace_back(source.transform * glm::vec4(mesh.getVertices()[vertexIndex], 1.0f));
+      batch.normals.push_back(glm::normalize(normalsTransform * mesh.getNormals()[vertexIndex]));
+      batch.uv.push_back(mesh.getUV()[vertexIndex]);
+    }
+
+    // Mirroring transforms change the triangles winding, so it is restored here
+    bool isMirrored = glm::determinant(glm::mat3(source.transform)) < 0.0f;
+
+    for (size_t index = 0; index < subMeshIndices.size(); index += 3) {
+      uint32_t firstVertex = baseVertex + verticesRemap[subMeshIndices[index]];
+      uint32_t secondVertex = baseVertex + verticesRemap[subMeshIndices[index + 1]];
+      uint32_t thirdVertex = baseVertex + verticesRemap[subMeshIndices[index + 2]];
+
+      if (isMirrored) {
+        std::swap(secondVertex, thirdVertex);
+      }
+
+      batch.indices.insert(batch.indices.end(), {firstVertex, secondVertex, thirdVertex});
+    }
+
+    batch.sourcesIndices.push_back(sourceIndex);
+  }
+
+  for (StaticGeometryBatch& batch : batches) {
+    batch.bounds = GeometryUtils::restoreAABBByVerticesList(batch.positions);
+  }
+
+  return batches;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/mat4x4.hpp>
+
+#include "Modules/ECS/ECS.h"
+#include "Modules/ResourceManagement/ResourcesManagement.h"
+#include "Modules/Graphics/OpenGL/Mesh.h"
+#include "Modules/Math/geometry.h"
+
+struct StaticGeometryBatchingOptions {
+  // Edge length of the cubic spatial cells, the batches do not cross the cells
+  float cellSize = 32.0f;
+
+  // Batches are split to keep them in the shared geometry arenas with 16-bit indices
+  size_t maxBatchVerticesCount = Mesh::MAX_SHORT_INDEXED_VERTICES_COUNT;
+};
+
+/*!
+ * \brief Sub-mesh of a static object to be merged into a batch
+ */
+struct StaticGeometryBatchSource {
+  const Mesh* mesh{};
+  size_t subMeshIndex{};
+
+  // Index of the sub-mesh material in the caller materials list
+  size_t materialIndex{};
+
+  glm::mat4 transform{};
+
+  // The object position that defines the spatial cell of the sub-mesh
+  glm::vec3 origin{};
+};
+
+/*!
+ * \brief World space geometry of the sub-meshes with the same material in a single spatial cell
+ */
+struct StaticGeometryBatch {
+  size_t materialIndex{};
+  std::vector<size_t> sourcesIndices;
+
+  std::vector<glm::vec3> positions;
+  std::vector<glm::vec3> normals;
+  std::vector<glm::vec2> uv;
+  std::vector<uint32_t> indices;
+
+  AABB bounds;
+};
+
+/*!
+ * \brief Load-time batching of the static level geometry
+ *
+ * The static non-animated sub-meshes that share a material within a spatial cell are transformed to the world
+ * space and merged into a single mesh, so a cell is drawn with a draw call per material instead of a draw call
+ * per object sub-mesh. The batches bounds are used for culling as the objects bounds. The source objects keep all
+ * components except the mesh renderer one, so the geometry of the instanced meshes is duplicated per instance.
+ */
+class StaticGeometryBatcher {
+ public:
+  StaticGeometryBatcher(std::shared_ptr<GameWorld> gameWorld, std::shared_ptr<ResourcesManager> resourcesManager);
+
+  /*!
+   * \brief Replaces the batchable objects meshes with the batches objects
+   *
+   * \return the created batches objects
+   */
+  std::vector<GameObject> batchObjects(std::vector<GameObject>& objects, const StaticGeometryBatchingOptions& options);
+
+  /*!
+   * \brief Checks whether the object is static and its mesh could be merged with the other ones
+   *
+   * The meshes with LODs chains are not batched to keep the per-object LODs selection.
+   */
+  [[nodiscard]] static bool isObjectBatchable(GameObject& object);
+
+  [[nodiscard]] static std::vector<StaticGeometryBatch> buildBatches(
+    const std::vector<StaticGeometryBatchSource>& sources,
+    const StaticGeometryBatchingOptions& options);
+
+ private:
+  std::shared_ptr<GameWorld> m_gameWorld;
+  std::shared_ptr<ResourcesManager> m_resourcesManager;
+};
@@ -0,0 +1,312 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "GLGeometryArena.h"
+
+#include <numeric>
+
+#include "GLDebug.h"
+
+namespace {
+
+// The arenas are released with their last allocations, so the registry does not prolong their lifetime
+std::array<std::vector<std::weak_ptr<GLGeometryArena>>, static_cast<size_t>(GLGeometryArenaFormat::Count)> g_arenas;
+
+}
+
+GLGeometryArena::GLGeometryArena(GLGeometryArenaFormat format, size_t verticesCapacity, size_t indicesCapacity)
+  : m_format(format),
+    m_verticesAllocator(verticesCapacity),
+    m_indicesAllocator(indicesCapacity)
+{
+  GL_CALL_BLOCK_BEGIN();
+
+  glCreateVertexArrays(1, &m_vertexArrayObject);
+
+  // The storage is immutable, the data is uploaded by the ranges
+  auto createAttributeBuffer = [this, verticesCapacity](GLuint bindingIndex, size_t vertexSize) {
+    glCreateBuffers(1, &m_vertexBuffers[bindingIndex]);
+    glNamedBufferStorage(m_vertexBuffers[bindingIndex],
+      static_cast<GLsizeiptr>(verticesCapacity * vertexSize),
+      nullptr,
+      GL_DYNAMIC_STORAGE_BIT);
+    glVertexArrayVertexBuffer(m_vertexArrayObject, bindingIndex, m_vertexBuffers[bindingIndex], 0,
+      static_cast<GLsizei>(vertexSize));
+  };
+
+  switch (format) {
+    case GLGeometryArenaFormat::Pos3Norm3UV:
+      createAttributeBuffer(0, sizeof(glm::vec3));
+      createAttributeBuffer(1, sizeof(glm::vec3));
+      createAttributeBuffer(2, sizeof(glm::vec2));
+
+      setupVertexFormat(VerticesPos3Norm3UVSoA::s_vertexFormatAttributes);
+      break;
+
+    case GLGeometryArenaFormat::Pos3Norm3UVSkinned:
+      createAttributeBuffer(0, sizeof(glm::vec3));
+      createAttributeBuffer(1, sizeof(glm::vec3));
+      createAttributeBuffer(2, sizeof(glm::vec2));
+      createAttributeBuffer(4, sizeof(glm::u8vec4));
+      createAttributeBuffer(5, sizeof(glm::u8vec4));
+
+      setupVertexFormat(VertexPos3Norm3UVSkinnedSoA::s_vertexFormatAttributes);
+      break;
+
+    default:
+      SW_ASSERT(false);
+  }
+
+  glCreateBuffers(1, &m_indexBuffer);
+  glNamedBufferStorage(m_indexBuffer,
+    static_cast<GLsizeiptr>(indicesCapacity * sizeof(std::uint16_t)),
+    nullptr,
+    GL_DYNAMIC_STORAGE_BIT);
+  glVertexArrayElementBuffer(m_vertexArrayObject, m_indexBuffer);
+
+  setupDrawIndexAttribute();
+
+  GL_CALL_BLOCK_END();
+}
+
+GLGeometryArena::~GLGeometryArena()
+{
+  for (auto& vertexBuffer : m_vertexBuffers) {
+    if (vertexBuffer != 0) {
+      glDeleteBuffers(1, &vertexBuffer);
+    }
+  }
+
+  glDeleteBuffers(1, &m_indexBuffer);
+  glDeleteBuffers(1, &m_drawIndexBuffer);
+  glDeleteVertexArrays(1, &m_vertexArrayObject);
+}
+
+GLGeometryArenaAllocation GLGeometryArena::allocateShared(GLGeometryArenaFormat format,
+  size_t verticesCount,
+  size_t indicesCount)
+{
+  auto& formatArenas = g_arenas[static_cast<size_t>(format)];
+
+  formatArenas.erase(std::remove_if(formatArenas.begin(), formatArenas.end(),
+    [](const std::weak_ptr<GLGeometryArena>& arena) { return arena.expired(); }), formatArenas.end());
+
+  for (const auto& arenaReference : formatArenas) {
+    std::shared_ptr<GLGeometryArena> arena = arenaReference.lock();
+    std::optional<GLGeometryArenaAllocation> allocation = arena->allocate(verticesCount, indicesCount);
+
+    if (allocation.has_value()) {
+      allocation->arena = std::move(arena);
+      return *allocation;
+    }
+  }
+
+  auto arena = std::make_shared<GLGeometryArena>(format,
+    std::max(verticesCount, DEFAULT_VERTICES_CAPACITY),
+    std::max(indicesCount, DEFAULT_INDICES_CAPACITY));
+
+  formatArenas.push_back(arena);
+
+  std::optional<GLGeometryArenaAllocation> allocation = arena->allocate(verticesCount, indicesCount);
+  SW_ASSERT(allocation.has_value());
+
+  allocation->arena = std::move(arena);
+
+  return *allocation;
+}
+
+std::optional<GLGeometryArenaAllocation> GLGeometryArena::allocate(size_t verticesCount, size_t indicesCount)
+{
+  SW_ASSERT(verticesCount != 0 && indicesCount != 0);
+
+  std::optional<size_t> verticesOffset = m_verticesAllocator.allocate(verticesCount);
+
+  if (!verticesOffset.has_value()) {
+    return std::nullopt;
+  }
+
+  std::optional<size_t> indicesOffset = m_indicesAllocator.allocate(indicesCount);
+
+  if (!indicesOffset.has_value()) {
+    m_verticesAllocator.free(*verticesOffset, verticesCount);
+    return std::nullopt;
+  }
+
+  return GLGeometryArenaAllocation{
+    .verticesOffset = *verticesOffset,
+    .verticesCount = verticesCount,
+    .indicesOffset = *indicesOffset,
+    .indicesCount = indicesCount,
+  };
+}
+
+void GLGeometryArena::free(const GLGeometryArenaAllocation& allocation)
+{
+  SW_ASSERT(allocation.arena.get() == this);
+
+  m_verticesAllocator.free(allocation.verticesOffset, allocation.verticesCount);
+  m_indicesAllocator.free(allocation.indicesOffset, allocation.indicesCount);
+}
+
+void GLGeometryArena::uploadVertices(const GLGeometryArenaAllocation& allocation,
+  const VerticesPos3Norm3UVSoA& vertices)
+{
+  SW_ASSERT(m_format == GLGeometryArenaFormat::Pos3Norm3UV);
+  SW_ASSERT(vertices.positions->size() == allocation.verticesCount &&
+    vertices.normals->size() == allocation.verticesCount && vertices.uv->size() == allocation.verticesCount);
+
+  glNamedBufferSubData(m_vertexBuffers[0],
+    static_cast<GLintptr>(allocation.verticesOffset * sizeof(glm::vec3)),
+    static_cast<GLsizeiptr>(allocation.verticesCount * sizeof(glm::vec3)),
+    vertices.positions->data());
+
+  glNamedBufferSubData(m_vertexBuffers[1],
+    static_cast<GLintptr>(allocation.verticesOffset * sizeof(glm::vec3)),
+    static_cast<GLsizeiptr>(allocation.verticesCount * sizeof(glm::vec3)),
+    vertices.normals->data());
+
+  glNamedBufferSubData(m_vertexBuffers[2],
+    static_cast<GLintptr>(allocation.verticesOffset * sizeof(glm::vec2)),
+    static_cast<GLsizeiptr>(allocation.verticesCount * sizeof(glm::vec2)),
+    vertices.uv->data());
+}
+
+void GLGeometryArena::uploadVertices(const GLGeometryArenaAllocation& allocation,
+  const VertexPos3Norm3UVSkinnedSoA& vertices)
+{
+  SW_ASSERT(m_format == GLGeometryArenaFormat::Pos3Norm3UVSkinned);
+  SW_ASSERT(vertices.positions->size() == allocation.verticesCount &&
+    vertices.normals->size() == allocation.verticesCount && vertices.uv->size() == allocation.verticesCount &&
+    vertices.bonesIds->size() == allocation.verticesCount &&
+    vertices.bonesWeights->size() == allocation.verticesCount);
+
+  glNamedBufferSubData(m_vertexBuffers[0],
+    static_cast<GLintptr>(allocation.verticesOffset * sizeof(glm::vec3)),
+    static_cast<GLsizeiptr>(allocation.verticesCount * sizeof(glm::vec3)),
+    vertices.positions->data());
+
+  glNamedBufferSubData(m_vertexBuffers[1],
+    static_cast<GLintptr>(allocation.verticesOffset * sizeof(glm::vec3)),
+    static_cast<GLsizeiptr>(allocation.verticesCount * sizeof(glm::vec3)),
+    vertices.normals->data());
+
+  glNamedBufferSubData(m_vertexBuffers[2],
+    static_cast<GLintptr>(allocation.verticesOffset * sizeof(glm::vec2)),
+    static_cast<GLsizeiptr>(allocation.verticesCount * sizeof(glm::vec2)),
+    vertices.uv->data());
+
+  glNamedBufferSubData(m_vertexBuffers[4],
+    static_cast<GLintptr>(allocation.verticesOffset * sizeof(glm::u8vec4)),
+    static_cast<GLsizeiptr>(allocation.verticesCount * sizeof(glm::u8vec4)),
+    vertices.bonesIds->data());
+
+  glNamedBufferSubData(m_vertexBuffers[5],
+    static_cast<GLintptr>(allocation.verticesOffset * sizeof(glm::u8vec4)),
+    static_cast<GLsizeiptr>(allocation.verticesCount * sizeof(glm::u8vec4)),
+    vertices.bonesWeights->data());
+}
+
+void GLGeometryArena::uploadIndices(const GLGeometryArenaAllocation& allocation,
+  const std::vector<std::uint16_t>& indices)
+{
+  SW_ASSERT(indices.size() == allocation.indicesCount);
+
+  glNamedBufferSubData(m_indexBuffer,
+    static_cast<GLintptr>(allocation.indicesOffset * sizeof(std::uint16_t)),
+    static_cast<GLsizeiptr>(allocation.indicesCount * sizeof(std::uint16_t)),
+    indices.data());
+}
+
+void GLGeometryArena::bind() const
+{
+  glBindVertexArray(m_vertexArrayObject);
+}
+
+void GLGeometryArena::drawRange(const GLGeometryArenaAllocation& allocation,
+  size_t start,
+  size_t count,
+  GLenum primitivesType) const
+{
+  SW_ASSERT(start + count <= allocation.indicesCount);
+
+  glBindVertexArray(m_vertexArrayObject);
+
+  glDrawElementsBaseVertex(primitivesType,
+    static_cast<GLsizei>(count),
+    GL_UNSIGNED_SHORT,
+    reinterpret_cast<GLvoid*>((allocation.indicesOffset + start) * sizeof(std::uint16_t)),
+    static_cast<GLint>(allocation.verticesOffset));
+}
+
+GLGeometryArenaFormat GLGeometryArena::getFormat() const
+{
+  return m_format;
+}
+
+size_t GLGeometryArena::getVerticesCapacity() const
+{
+  return m_verticesAllocator.getCapacity();
+}
+
+size_t GLGeometryArena::getIndicesCapacity() const
+{
+  return m_indicesAllocator.getCapacity();
+}
+
+size_t GLGeometryArena::getFreeVerticesCount() const
+{
+  return m_verticesAllocator.getFreeSize();
+}
+
+size_t GLGeometryArena::getFreeIndicesCount() const
+{
+  return m_indicesAllocator.getFreeSize();
+}
+
+void GLGeometryArena::setupVertexFormat(const std::vector<VertexFormatAttributeSpec>& attributes)
+{
+  for (const VertexFormatAttributeSpec& attribData : attributes) {
+    switch (attribData.type) {
+      case GL_FLOAT:
+        glVertexArrayAttribFormat(m_vertexArrayObject,
+          attribData.attribIndex, attribData.size,
+          attribData.type, attribData.normalized, attribData.relativeOffset);
+        break;
+
+      case GL_UNSIGNED_BYTE:
+        glVertexArrayAttribIFormat(m_vertexArrayObject, attribData.attribIndex, attribData.size,
+          attribData.type,
+          attribData.relativeOffset);
+        break;
+
+      default:
+        SW_ASSERT(false);
+    }
+
+    glVertexArrayAttribBinding(m_vertexArrayObject, attribData.attribIndex, attribData.bindingIndex);
+    glEnableVertexArrayAttrib(m_vertexArrayObject, attribData.attribIndex);
+  }
+}
+
+void GLGeometryArena::setupDrawIndexAttribute()
+{
+  std::vector<GLuint> drawIndices(MAX_DRAWS_PER_CALL);
+  std::iota(drawIndices.begin(), drawIndices.end(), 0);
+
+  glCreateBuffers(1, &m_drawIndexBuffer);
+  glNamedBufferStorage(m_drawIndexBuffer,
+    static_cast<GLsizeiptr>(drawIndices.size() * sizeof(GLuint)),
+    drawIndices.data(),
+    GL_NONE);
+
+  // The binding follows the vertex attributes bindings, the draws are not instanced otherwise
+  const GLuint drawIndexBindingIndex = static_cast<GLuint>(m_vertexBuffers.size());
+
+  glVertexArrayVertexBuffer(m_vertexArrayObject, drawIndexBindingIndex, m_drawIndexBuffer, 0, sizeof(GLuint));
+  glVertexArrayBindingDivisor(m_vertexArrayObject, drawIndexBindingIndex, 1);
+
+  glVertexArrayAttribIFormat(m_vertexArrayObject, DRAW_INDEX_ATTRIBUTE_INDEX, 1, GL_UNSIGNED_INT, 0);
+  glVertexArrayAttribBinding(m_vertexArrayObject, DRAW_INDEX_ATTRIBUTE_INDEX, drawIndexBindingIndex);
+  glEnableVertexArrayAttrib(m_vertexArrayObject, DRAW_INDEX_ATTRIBUTE_INDEX);
+}
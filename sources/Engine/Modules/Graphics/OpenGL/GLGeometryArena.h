@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "GL.h"
+#include "GLGeometryStore.h"
+#include "Utility/RangeAllocator.h"
+
+enum class GLGeometryArenaFormat {
+  Pos3Norm3UV,
+  Pos3Norm3UVSkinned,
+  Count
+};
+
+class GLGeometryArena;
+
+/*!
+ * \brief Vertices and indices ranges of a mesh in the shared geometry arena
+ *
+ * The indices are relative to the first vertex of the range, so they are drawn with the base vertex.
+ */
+struct GLGeometryArenaAllocation {
+  std::shared_ptr<GLGeometryArena> arena;
+
+  size_t verticesOffset{};
+  size_t verticesCount{};
+
+  size_t indicesOffset{};
+  size_t indicesCount{};
+};
+
+/*!
+ * \brief Indirect draw command layout of glMultiDrawElementsIndirect
+ */
+struct GLDrawElementsIndirectCommand {
+  GLuint count{};
+  GLuint instanceCount{};
+  GLuint firstIndex{};
+  GLint baseVertex{};
+  GLuint baseInstance{};
+};
+
+/*!
+ * \brief Shared immutable vertex and index buffers of all static meshes of the same vertex format
+ *
+ * All meshes of an arena are drawn with the single VAO, so the runs of the meshes with the same material
+ * could be drawn with a single multi-draw call. The arena also binds the per-draw index attribute,
+ * its value is the base instance of the indirect command, so the shaders could fetch per-draw data.
+ */
+class GLGeometryArena {
+ public:
+  GLGeometryArena(GLGeometryArenaFormat format, size_t verticesCapacity, size_t indicesCapacity);
+  ~GLGeometryArena();
+
+  GLGeometryArena(const GLGeometryArena&) = delete;
+  GLGeometryArena& operator=(const GLGeometryArena&) = delete;
+
+  /*!
+   * \brief Allocates the ranges in one of the shared arenas of the format, a new arena is created if all are full
+   */
+  [[nodiscard]] static GLGeometryArenaAllocation allocateShared(GLGeometryArenaFormat format,
+    size_t verticesCount,
+    size_t indicesCount);
+
+  void free(const GLGeometryArenaAllocation& allocation);
+
+  void uploadVertices(const GLGeometryArenaAllocation& allocation, const VerticesPos3Norm3UVSoA& vertices);
+  void uploadVertices(const GLGeometryArenaAllocation& allocation, const VertexPos3Norm3UVSkinnedSoA& vertices);
+  void uploadIndices(const GLGeometryArenaAllocation& allocation, const std::vector<std::uint16_t>& indices);
+
+  void bind() const;
+
+  /*!
+   * \brief Draws the indices range of the allocation, the start is relative to the allocation indices
+   */
+  void drawRange(const GLGeometryArenaAllocation& allocation,
+    size_t start,
+    size_t count,
+    GLenum primitivesType = GL_TRIANGLES) const;
+
+  [[nodiscard]] GLGeometryArenaFormat getFormat() const;
+
+  [[nodiscard]] size_t getVerticesCapacity() const;
+  [[nodiscard]] size_t getIndicesCapacity() const;
+
+  [[nodiscard]] size_t getFreeVerticesCount() const;
+  [[nodiscard]] size_t getFreeIndicesCount() const;
+
+ public:
+  static constexpr size_t DEFAULT_VERTICES_CAPACITY = 512 * 1024;
+  static constexpr size_t DEFAULT_INDICES_CAPACITY = 2 * 1024 * 1024;
+
+  // Per-draw index attribute, it is sourced with the divisor, so its value is the base instance of the draw
+  static constexpr GLuint DRAW_INDEX_ATTRIBUTE_INDEX = 7;
+  static constexpr size_t MAX_DRAWS_PER_CALL = 4096;
+
+ private:
+  [[nodiscard]] std::optional<GLGeometryArenaAllocation> allocate(size_t verticesCount, size_t indicesCount);
+
+  void setupVertexFormat(const std::vector<VertexFormatAttributeSpec>& attributes);
+  void setupDrawIndexAttribute();
+
+ private:
+  GLGeometryArenaFormat m_format;
+
+  RangeAllocator m_verticesAllocator;
+  RangeAllocator m_indicesAllocator;
+
+  // Buffers are indexed by the attributes bindings, as in the geometry store
+  std::array<GLuint, 6> m_vertexBuffers = {0, 0, 0, 0, 0, 0};
+  GLuint m_indexBuffer = 0;
+  GLuint m_drawIndexBuffer = 0;
+  GLuint m_vertexArrayObject = 0;
+};
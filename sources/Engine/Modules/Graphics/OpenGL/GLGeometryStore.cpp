@@ -172,6 +172,19 @@ GLGeometryStore::GLGeometryStore(const VertexPos3Norm3UVSkinnedSoA& vertices,
     minStorageCapacity);
 }
 
+GLGeometryStore::GLGeometryStore(const VertexPos3Norm3UVSkinnedSoA& vertices,
+  const std::vector<uint32_t>& indices, GLenum storageFlags, size_t minStorageCapacity)
+{
+  SW_ASSERT(!vertices.positions->empty() && vertices.positions->size() == vertices.normals->size() &&
+    vertices.positions->size() == vertices.uv->size() && vertices.positions->size() == vertices.bonesIds->size() &&
+    vertices.positions->size() == vertices.bonesWeights->size() && !indices.empty());
+
+  setupVAO<VertexPos3Norm3UVSkinnedSoA, VertexPos3Norm3UVSkinnedSoA>(vertices,
+    indices,
+    storageFlags,
+    minStorageCapacity);
+}
+
 GLGeometryStore::GLGeometryStore(const VerticesPos3Norm3UVSoA& vertices, GLenum storageFlags,
   size_t minStorageCapacity)
 {
@@ -191,6 +204,15 @@ GLGeometryStore::GLGeometryStore(const VerticesPos3Norm3UVSoA& vertices,
   setupVAO<VerticesPos3Norm3UVSoA, VerticesPos3Norm3UVSoA>(vertices, indices, storageFlags, minStorageCapacity);
 }
 
+GLGeometryStore::GLGeometryStore(const VerticesPos3Norm3UVSoA& vertices,
+  const std::vector<std::uint32_t>& indices, GLenum storageFlags, size_t minStorageCapacity)
+{
+  SW_ASSERT(!vertices.positions->empty() && vertices.positions->size() == vertices.normals->size() &&
+    vertices.positions->size() == vertices.uv->size());
+
+  setupVAO<VerticesPos3Norm3UVSoA, VerticesPos3Norm3UVSoA>(vertices, indices, storageFlags, minStorageCapacity);
+}
+
 GLGeometryStore::GLGeometryStore(const std::vector<VertexPos3Norm3UV>& vertices,
   GLenum storageFlags,
   size_t minStorageCapacity)
@@ -243,12 +265,22 @@ bool GLGeometryStore::isIndexed() const
   return m_indicesCount > 0;
 }
 
+GLenum GLGeometryStore::getIndexType() const
+{
+  return m_indexType;
+}
+
+size_t GLGeometryStore::getIndexSize() const
+{
+  return (m_indexType == GL_UNSIGNED_INT) ? sizeof(std::uint32_t) : sizeof(std::uint16_t);
+}
+
 void GLGeometryStore::draw(GLenum primitivesType) const
 {
   glBindVertexArray(m_vertexArrayObject);
 
   if (isIndexed()) {
-    glDrawElements(primitivesType, static_cast<GLsizei>(m_indicesCount), GL_UNSIGNED_SHORT, nullptr);
+    glDrawElements(primitivesType, static_cast<GLsizei>(m_indicesCount), m_indexType, nullptr);
   }
   else {
     glDrawArrays(primitivesType, 0, static_cast<GLsizei>(m_verticesCount));
@@ -262,8 +294,8 @@ void GLGeometryStore::drawRange(size_t start, size_t count, GLenum primitivesTyp
   if (isIndexed()) {
     glDrawElements(primitivesType,
       static_cast<GLsizei>(count),
-      GL_UNSIGNED_SHORT,
-      reinterpret_cast<GLvoid*>(start * sizeof(uint16_t)));
+      m_indexType,
+      reinterpret_cast<GLvoid*>(start * getIndexSize()));
   }
   else {
     glDrawArrays(primitivesType, static_cast<GLint>(start), static_cast<GLsizei>(count));
@@ -408,10 +440,12 @@ void GLGeometryStore::updateVertices(const VertexPos3Norm3UVSkinnedSoA& vertices
 
 void GLGeometryStore::updateIndices(const std::vector<std::uint16_t>& indices)
 {
-  SW_ASSERT(indices.size() <= m_indicesStorageCapacity && "Storage reallocation is forbidden");
+  uploadIndices(indices);
+}
 
-  glNamedBufferSubData(m_indexBuffer, 0, indices.size() * sizeof(std::uint16_t), indices.data());
-  m_indicesCount = indices.size();
+void GLGeometryStore::updateIndices(const std::vector<std::uint32_t>& indices)
+{
+  uploadIndices(indices);
 }
 
 size_t GLGeometryStore::getVerticesCapacity() const
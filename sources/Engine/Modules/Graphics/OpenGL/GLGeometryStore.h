@@ -70,6 +70,10 @@ class GLGeometryStore {
     const std::vector<std::uint16_t>& indices,
     GLenum storageFlags = GL_NONE,
     size_t minStorageCapacity = 0);
+  GLGeometryStore(const VerticesPos3Norm3UVSoA& vertices,
+    const std::vector<std::uint32_t>& indices,
+    GLenum storageFlags = GL_NONE,
+    size_t minStorageCapacity = 0);
 
   explicit GLGeometryStore(const VertexPos3Color4SoA& vertices,
     GLenum storageFlags = GL_NONE,
@@ -86,6 +90,10 @@ class GLGeometryStore {
     const std::vector<std::uint16_t>& indices,
     GLenum storageFlags = GL_NONE,
     size_t minStorageCapacity = 0);
+  GLGeometryStore(const VertexPos3Norm3UVSkinnedSoA& vertices,
+    const std::vector<std::uint32_t>& indices,
+    GLenum storageFlags = GL_NONE,
+    size_t minStorageCapacity = 0);
 
   ~GLGeometryStore();
 
@@ -94,6 +102,11 @@ class GLGeometryStore {
 
   [[nodiscard]] bool isIndexed() const;
 
+  /*!
+   * \brief Returns GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, the indices type is fixed at the store creation
+   */
+  [[nodiscard]] GLenum getIndexType() const;
+
   void draw(GLenum primitivesType = GL_TRIANGLES) const;
   void drawRange(size_t start, size_t count, GLenum primitivesType = GL_TRIANGLES) const;
 
@@ -102,25 +115,33 @@ class GLGeometryStore {
   void updateVertices(const VertexPos3Color4SoA& vertices);
   void updateVertices(const VertexPos3Norm3UVSkinnedSoA& vertices);
   void updateIndices(const std::vector<std::uint16_t>& indices);
+  void updateIndices(const std::vector<std::uint32_t>& indices);
 
   [[nodiscard]] size_t getVerticesCapacity() const;
   [[nodiscard]] size_t getIndicesCapacity() const;
 
  private:
-  template<class T, class DescriptionType>
+  template<class T, class DescriptionType, class IndexType>
   void setupVAO(const T& vertices,
-    const std::vector<std::uint16_t>& indices,
+    const std::vector<IndexType>& indices,
     GLenum storageFlags,
     size_t minStorageCapacity = 0);
 
   template<class T>
   void setupVertexBuffers(const T& vertices, GLenum storageFlags, size_t minStorageCapacity = 0);
 
+  template<class IndexType>
+  void uploadIndices(const std::vector<IndexType>& indices);
+
+  [[nodiscard]] size_t getIndexSize() const;
+
  private:
   std::array<GLuint, 6> m_vertexBuffers = {0, 0, 0, 0, 0, 0};
   GLuint m_indexBuffer = 0;
   GLuint m_vertexArrayObject = 0;
 
+  GLenum m_indexType = GL_UNSIGNED_SHORT;
+
   size_t m_verticesCount = 0;
   size_t m_indicesCount = 0;
 
@@ -12,9 +12,9 @@ void GLGeometryStore::setupVertexBuffers(const T& vertices, GLenum storageFlags,
   SW_ASSERT(false);
 }
 
-template<class T, class DescriptionType>
+template<class T, class DescriptionType, class IndexType>
 void GLGeometryStore::setupVAO(const T& vertices,
-  const std::vector<std::uint16_t>& indices,
+  const std::vector<IndexType>& indices,
   GLenum storageFlags,
   size_t minStorageCapacity)
 {
@@ -49,6 +49,10 @@ void GLGeometryStore::setupVAO(const T& vertices,
 
   GL_CALL_BLOCK_END();
 
+  static_assert(std::is_same_v<IndexType, std::uint16_t> || std::is_same_v<IndexType, std::uint32_t>);
+
+  m_indexType = std::is_same_v<IndexType, std::uint32_t> ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+
   // Create and fill index buffer if is is needed
   if (!indices.empty()) {
     GL_CALL_BLOCK_BEGIN();
@@ -76,6 +80,16 @@ void GLGeometryStore::setupVAO(const T& vertices,
 
 }
 
+template<class IndexType>
+void GLGeometryStore::uploadIndices(const std::vector<IndexType>& indices)
+{
+  SW_ASSERT(sizeof(IndexType) == getIndexSize() && "The indices type could not be changed after the store creation");
+  SW_ASSERT(indices.size() <= m_indicesStorageCapacity && "Storage reallocation is forbidden");
+
+  glNamedBufferSubData(m_indexBuffer, 0, indices.size() * sizeof(IndexType), indices.data());
+  m_indicesCount = indices.size();
+}
+
 template<>
 void GLGeometryStore::setupVertexBuffers<>(const VerticesPos3Norm3UVSoA& vertices,
   GLenum storageFlags,
@@ -8,6 +8,7 @@
 
 #include "Modules/Graphics/GraphicsSystem/FrameStats.h"
 #include "Exceptions/exceptions.h"
+#include "Modules/Profiling/CPUProfiler.h"
 #include "options.h"
 
 GLGraphicsContext::GLGraphicsContext(SDL_Window* window)
@@ -88,6 +89,16 @@ GLGraphicsContext::GLGraphicsContext(SDL_Window* window)
   m_guiTransformationBuffer = std::make_unique<GLUniformBuffer<GUITransformation>>();
   m_guiTransformationBuffer->attachToBindingEntry(1);
 
+  glCreateBuffers(1, &m_drawCommandsBuffer);
+  glNamedBufferStorage(m_drawCommandsBuffer,
+    static_cast<GLsizeiptr>(GLGeometryArena::MAX_DRAWS_PER_CALL * sizeof(GLDrawElementsIndirectCommand)),
+    nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+  glCreateBuffers(1, &m_drawTransformsBuffer);
+  glNamedBufferStorage(m_drawTransformsBuffer,
+    static_cast<GLsizeiptr>(GLGeometryArena::MAX_DRAWS_PER_CALL * sizeof(glm::mat4)),
+    nullptr, GL_DYNAMIC_STORAGE_BIT);
+
   spdlog::info("OpenGL context is created");
 }
 
@@ -332,11 +343,27 @@ void GLGraphicsContext::setupGraphicsScene(std::shared_ptr<GraphicsScene> graphi
 
 void GLGraphicsContext::scheduleRenderTask(const RenderTask& task)
 {
+  if (m_renderingQueuesFrameIndex != FrameArena::getFrameIndex()) {
+    resetRenderingQueues();
+  }
+
   m_renderingQueues[static_cast<size_t>(task.material->getRenderingStage())].push_back(task);
 }
 
+void GLGraphicsContext::resetRenderingQueues()
+{
+  for (size_t stageIndex = 0; stageIndex < m_renderingQueues.size(); stageIndex++) {
+    m_renderingQueues[stageIndex] = FrameVector<RenderTask>();
+    m_renderingQueues[stageIndex].reserve(m_renderingQueuesCapacities[stageIndex]);
+  }
+
+  m_renderingQueuesFrameIndex = FrameArena::getFrameIndex();
+}
+
 void GLGraphicsContext::executeRenderTasks()
 {
+  SW_PROFILE_SCOPE("GLGraphicsContext::executeRenderTasks");
+
   // TODO: get rid of buffers clearing and copying as possible
   //  For example, use depth swap trick to avoid depth buffer clearing
 
@@ -443,9 +470,37 @@ void GLGraphicsContext::executeRenderingStageQueue(RenderingStage stage)
     return;
   }
 
+  static const std::array<ProfilerScopeId, static_cast<size_t>(RenderingStage::Count)> stagesProfilerScopes = {
+    CPUProfiler::registerScope("Rendering stage Deferred"),
+    CPUProfiler::registerScope("Rendering stage Forward"),
+    CPUProfiler::registerScope("Rendering stage ForwardDebug"),
+    CPUProfiler::registerScope("Rendering stage ForwardEnvironment"),
+    CPUProfiler::registerScope("Rendering stage PostProcess"),
+    CPUProfiler::registerScope("Rendering stage GUI"),
+  };
+
+  SW_PROFILE_SCOPE_ID(stagesProfilerScopes[static_cast<size_t>(stage)]);
+
+  // Deferred tasks do not depend on the order, so they are grouped to form the multi-draw runs
+  if (stage == RenderingStage::Deferred) {
+    auto getTaskSortingKey = [](const RenderTask& task) {
+      const GLGeometryArenaAllocation* allocation = task.mesh->getGeometryArenaAllocation();
+
+      return std::make_pair(reinterpret_cast<uintptr_t>(task.material),
+        reinterpret_cast<uintptr_t>((allocation != nullptr) ? allocation->arena.get() : nullptr));
+    };
+
+    std::stable_sort(queue.begin(), queue.end(),
+      [&getTaskSortingKey](const RenderTask& first, const RenderTask& second) {
+        return getTaskSortingKey(first) < getTaskSortingKey(second);
+      });
+  }
+
   applyGpuState(queue.begin()->material->getGpuStateParameters());
 
-  for (const auto& renderingTask : queue) {
+  for (size_t taskIndex = 0; taskIndex < queue.size();) {
+    const RenderTask& renderingTask = queue[taskIndex];
+
     GLShadersPipeline& shadersPipeline = renderingTask.material->getShadersPipeline();
     glBindProgramPipeline(shadersPipeline.m_programPipeline);
 
@@ -475,13 +530,125 @@ void GLGraphicsContext::executeRenderingStageQueue(RenderingStage stage)
         renderingTask.scissorsRect.getWidth(), renderingTask.scissorsRect.getHeight());
     }
 
-    renderingTask.mesh->getGeometryStore()->drawRange(
-      renderingTask.mesh->getSubMeshIndicesOffset(renderingTask.subMeshIndex),
-      renderingTask.mesh->getSubMeshIndicesCount(renderingTask.subMeshIndex),
-      renderingTask.primitivesType);
+    bool isDrawTransformsSupported = vertexShader->hasStorageBlock(DRAW_TRANSFORMS_STORAGE_BLOCK);
+    size_t multiDrawRunLength = getMultiDrawRunLength(std::span<const RenderTask>(queue).subspan(taskIndex),
+      isDrawTransformsSupported);
+
+    if (multiDrawRunLength > 1) {
+      executeMultiDraw(std::span<const RenderTask>(queue).subspan(taskIndex, multiDrawRunLength),
+        isDrawTransformsSupported);
+    }
+    else if (renderingTask.indicesCount != 0) {
+      renderingTask.mesh->drawRange(renderingTask.indicesOffset,
+        renderingTask.indicesCount,
+        renderingTask.primitivesType);
+    }
+    else {
+      renderingTask.mesh->drawRange(
+        renderingTask.mesh->getSubMeshIndicesOffset(renderingTask.subMeshIndex),
+        renderingTask.mesh->getSubMeshIndicesCount(renderingTask.subMeshIndex),
+        renderingTask.primitivesType);
+    }
+
+    if (m_graphicsScene != nullptr) {
+      m_graphicsScene->getFrameStats().increaseDrawCallsCount(1);
+    }
+
+    taskIndex += multiDrawRunLength;
+  }
+
+  // The next tasks of the stage are scheduled into the new queue, the old one is released with the frame arena
+  m_renderingQueuesCapacities[static_cast<size_t>(stage)] = queue.size();
+  queue = FrameVector<RenderTask>();
+}
+
+size_t GLGraphicsContext::getMultiDrawRunLength(std::span<const RenderTask> tasks, bool isDrawTransformsSupported)
+{
+  const RenderTask& firstTask = tasks.front();
+  const GLGeometryArenaAllocation* firstAllocation = firstTask.mesh->getGeometryArenaAllocation();
+
+  // Skinned meshes have own palettes and scissors rectangles could differ, so such tasks are drawn one by one
+  if (firstAllocation == nullptr || firstTask.matrixPalette != nullptr ||
+    firstTask.material->getGpuStateParameters().getScissorsTestMode() == ScissorsTestMode::Enabled) {
+    return 1;
+  }
+
+  size_t runLength = 1;
+
+  while (runLength < tasks.size() && runLength < GLGeometryArena::MAX_DRAWS_PER_CALL) {
+    const RenderTask& task = tasks[runLength];
+    const GLGeometryArenaAllocation* allocation = task.mesh->getGeometryArenaAllocation();
+
+    bool isCompatible = task.material == firstTask.material &&
+      allocation != nullptr && allocation->arena == firstAllocation->arena &&
+      task.matrixPalette == nullptr &&
+      task.primitivesType == firstTask.primitivesType &&
+      (isDrawTransformsSupported || task.transform == firstTask.transform);
+
+    if (!isCompatible) {
+      break;
+    }
+
+    runLength++;
+  }
+
+  return runLength;
+}
+
+void GLGraphicsContext::executeMultiDraw(std::span<const RenderTask> tasks, bool isDrawTransformsSupported)
+{
+  SW_ASSERT(tasks.size() <= GLGeometryArena::MAX_DRAWS_PER_CALL);
+
+  FrameVector<GLDrawElementsIndirectCommand> drawCommands;
+  drawCommands.reserve(tasks.size());
+
+  FrameVector<glm::mat4> drawTransforms;
+
+  if (isDrawTransformsSupported) {
+    drawTransforms.reserve(tasks.size());
+  }
+
+  for (const RenderTask& task : tasks) {
+    const GLGeometryArenaAllocation* allocation = task.mesh->getGeometryArenaAllocation();
+
+    size_t indicesOffset = (task.indicesCount != 0) ?
+      task.indicesOffset : task.mesh->getSubMeshIndicesOffset(task.subMeshIndex);
+    size_t indicesCount = (task.indicesCount != 0) ?
+      task.indicesCount : task.mesh->getSubMeshIndicesCount(task.subMeshIndex);
+
+    // The base instance is the draw index, it is fetched by the shaders through the draw index attribute
+    drawCommands.push_back(GLDrawElementsIndirectCommand{
+      .count = static_cast<GLuint>(indicesCount),
+      .instanceCount = 1,
+      .firstIndex = static_cast<GLuint>(allocation->indicesOffset + indicesOffset),
+      .baseVertex = static_cast<GLint>(allocation->verticesOffset),
+      .baseInstance = static_cast<GLuint>(drawCommands.size()),
+    });
+
+    if (isDrawTransformsSupported) {
+      drawTransforms.push_back(*task.transform);
+    }
+  }
+
+  glNamedBufferSubData(m_drawCommandsBuffer, 0,
+    static_cast<GLsizeiptr>(drawCommands.size() * sizeof(GLDrawElementsIndirectCommand)),
+    drawCommands.data());
+
+  if (isDrawTransformsSupported) {
+    glNamedBufferSubData(m_drawTransformsBuffer, 0,
+      static_cast<GLsizeiptr>(drawTransforms.size() * sizeof(glm::mat4)),
+      drawTransforms.data());
+
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, DRAW_TRANSFORMS_STORAGE_BINDING, m_drawTransformsBuffer, 0,
+      static_cast<GLsizeiptr>(drawTransforms.size() * sizeof(glm::mat4)));
   }
 
-  m_renderingQueues[static_cast<size_t>(stage)].clear();
+  tasks.front().mesh->getGeometryArenaAllocation()->arena->bind();
+
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_drawCommandsBuffer);
+  glMultiDrawElementsIndirect(tasks.front().primitivesType, GL_UNSIGNED_SHORT, nullptr,
+    static_cast<GLsizei>(drawCommands.size()), 0);
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
 }
 
 int GLGraphicsContext::getViewportWidth() const
@@ -514,6 +681,12 @@ void GLGraphicsContext::unloadResources()
   m_deferredAccumulationMaterial.reset();
   m_sceneTransformationBuffer.reset();
   m_guiTransformationBuffer.reset();
+
+  glDeleteBuffers(1, &m_drawCommandsBuffer);
+  glDeleteBuffers(1, &m_drawTransformsBuffer);
+
+  m_drawCommandsBuffer = 0;
+  m_drawTransformsBuffer = 0;
 }
 
 SDLGLContext::~SDLGLContext()
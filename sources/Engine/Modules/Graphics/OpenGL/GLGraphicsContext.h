@@ -7,6 +7,7 @@
 #include "Modules/Math/Rect.h"
 
 #include "GLGeometryStore.h"
+#include "GLGeometryArena.h"
 #include "GLShadersPipeline.h"
 #include "GLMaterial.h"
 #include "GLFramebuffer.h"
@@ -16,6 +17,7 @@
 #include "Modules/Graphics/GraphicsSystem/Transform.h"
 
 #include "GLUniformBuffer.h"
+#include "Utility/FrameArena.h"
 
 class SharedGraphicsState;
 
@@ -40,6 +42,10 @@ struct RenderTask {
 
   GLenum primitivesType = GL_TRIANGLES;
   RectI scissorsRect{};
+
+  // Indices range of the mesh to draw instead of the sub-mesh, it is used if the count is not zero
+  size_t indicesOffset = 0;
+  size_t indicesCount = 0;
 };
 
 class GLGraphicsContext;
@@ -94,6 +100,21 @@ class GLGraphicsContext {
   void applyContextChange();
   void resetMaterial();
 
+  /*!
+   * \brief Replaces the queues that are left from the previous frames, their memory is released by the frame arena
+   */
+  void resetRenderingQueues();
+
+  /*!
+   * \brief Returns the count of the first queue tasks that could be drawn with a single multi-draw
+   *
+   * The tasks should share the material and the geometry arena. If the vertex shader does not fetch the
+   * transforms by the draw index, the tasks should share the transform too.
+   */
+  [[nodiscard]] static size_t getMultiDrawRunLength(std::span<const RenderTask> tasks, bool isDrawTransformsSupported);
+
+  void executeMultiDraw(std::span<const RenderTask> tasks, bool isDrawTransformsSupported);
+
  private:
   SDLGLContext m_sdlGLContext;
 
@@ -112,7 +133,10 @@ class GLGraphicsContext {
   std::unique_ptr<GLFramebuffer> m_deferredFramebuffer;
   std::unique_ptr<GLFramebuffer> m_forwardFramebuffer;
 
-  std::array<std::vector<RenderTask>, 6> m_renderingQueues;
+  // The queues are allocated in the frame arena and are recreated every frame with the last frame capacities
+  std::array<FrameVector<RenderTask>, 6> m_renderingQueues;
+  std::array<size_t, 6> m_renderingQueuesCapacities{};
+  uint64_t m_renderingQueuesFrameIndex = 0;
 
   std::unique_ptr<GLMaterial> m_deferredAccumulationMaterial;
 
@@ -121,6 +145,14 @@ class GLGraphicsContext {
   std::unique_ptr<GLUniformBuffer<SceneTransformation>> m_sceneTransformationBuffer;
   std::unique_ptr<GLUniformBuffer<GUITransformation>> m_guiTransformationBuffer;
 
+  GLuint m_drawCommandsBuffer = 0;
+  GLuint m_drawTransformsBuffer = 0;
+
+ private:
+  // The vertex shaders could declare the storage block with the transforms array indexed by the draw index attribute
+  static constexpr const char* DRAW_TRANSFORMS_STORAGE_BLOCK = "DrawTransforms";
+  static constexpr GLuint DRAW_TRANSFORMS_STORAGE_BINDING = 2;
+
  private:
   static void APIENTRY debugOutputCallback(GLenum source,
     GLenum type,
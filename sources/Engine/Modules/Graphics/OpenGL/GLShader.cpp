@@ -80,6 +80,7 @@ GLShader::GLShader(ShaderType type, const std::string& source)
   glDeleteShader(shader);
 
   cacheUniformsLocations();
+  cacheStorageBlocks();
 }
 
 GLShader::~GLShader()
@@ -157,6 +158,37 @@ bool GLShader::hasParameter(const std::string& name) const
   return m_uniformsCache.find(name) != m_uniformsCache.end();
 }
 
+bool GLShader::hasStorageBlock(const std::string& name) const
+{
+  return m_storageBlocksCache.contains(name);
+}
+
+void GLShader::cacheStorageBlocks()
+{
+  GL_CALL_BLOCK_BEGIN();
+
+  GLint blocksCount = 0;
+  glGetProgramInterfaceiv(m_shaderProgram, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &blocksCount);
+
+  if (blocksCount != 0) {
+    GLint maxNameLength = 0;
+    glGetProgramInterfaceiv(m_shaderProgram, GL_SHADER_STORAGE_BLOCK, GL_MAX_NAME_LENGTH, &maxNameLength);
+
+    std::vector<GLchar> blockName(static_cast<size_t>(maxNameLength));
+
+    for (GLint blockIndex = 0; blockIndex < blocksCount; blockIndex++) {
+      GLsizei length = 0;
+
+      glGetProgramResourceName(m_shaderProgram, GL_SHADER_STORAGE_BLOCK, static_cast<GLuint>(blockIndex),
+        maxNameLength, &length, blockName.data());
+
+      m_storageBlocksCache.insert(std::string(blockName.data(), static_cast<std::string::size_type>(length)));
+    }
+  }
+
+  GL_CALL_BLOCK_END();
+}
+
 void GLShader::cacheUniformsLocations()
 {
   GL_CALL_BLOCK_BEGIN();
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <span>
 
 #include <glm/vec2.hpp>
@@ -41,6 +42,8 @@ class GLShader : public Resource {
   void setArrayParameter(const std::string& name, size_t valueIndex, const glm::mat4x4& value);
 
   [[nodiscard]] bool hasParameter(const std::string& name) const;
+  [[nodiscard]] bool hasStorageBlock(const std::string& name) const;
+
  private:
   struct UniformInfo {
     GLint location;
@@ -49,12 +52,14 @@ class GLShader : public Resource {
 
  private:
   void cacheUniformsLocations();
+  void cacheStorageBlocks();
 
  private:
   GLuint m_shaderProgram;
   ShaderType m_type;
 
   std::unordered_map<std::string, UniformInfo> m_uniformsCache;
+  std::unordered_set<std::string> m_storageBlocksCache;
 
  private:
   friend class GLShadersPipeline;
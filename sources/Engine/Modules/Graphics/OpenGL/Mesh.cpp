@@ -5,6 +5,23 @@
 #include "Mesh.h"
 #include "Exceptions/exceptions.h"
 
+namespace {
+
+std::vector<uint16_t> toShortIndices(const std::vector<uint32_t>& indices)
+{
+  std::vector<uint16_t> shortIndices(indices.size());
+
+  for (size_t indexNumber = 0; indexNumber < indices.size(); indexNumber++) {
+    SW_ASSERT(indices[indexNumber] <= std::numeric_limits<uint16_t>::max());
+
+    shortIndices[indexNumber] = static_cast<uint16_t>(indices[indexNumber]);
+  }
+
+  return shortIndices;
+}
+
+}
+
 Mesh::Mesh(bool isDynamic, size_t minStorageCapacity)
   : m_isDynamic(isDynamic),
     m_minStorageCapacity(minStorageCapacity)
@@ -12,21 +29,27 @@ Mesh::Mesh(bool isDynamic, size_t minStorageCapacity)
 
 }
 
-Mesh::~Mesh() = default;
+Mesh::~Mesh()
+{
+  if (m_geometryArenaAllocation.has_value()) {
+    m_geometryArenaAllocation->arena->free(*m_geometryArenaAllocation);
+  }
+}
 
 void Mesh::setVertices(const std::vector<glm::vec3>& vertices)
 {
-  SW_ASSERT(m_geometryStore == nullptr || m_isDynamic &&
+  SW_ASSERT(!hasGeometryBuffer() || m_isDynamic &&
     !m_vertices.empty());
 
   m_vertices = vertices;
   setAttributeOutdated(MeshAttributes::Positions);
 }
 
-void Mesh::addSubMesh(const std::vector<uint16_t>& indices)
+void Mesh::addSubMesh(const std::vector<uint32_t>& indices)
 {
-  SW_ASSERT(m_geometryStore == nullptr && "Sub-mesh adding after geometry buffer formation is forbidden");
+  SW_ASSERT(!hasGeometryBuffer() && "Sub-mesh adding after geometry buffer formation is forbidden");
   SW_ASSERT(!m_vertices.empty());
+  SW_ASSERT(m_lods.empty() && "Sub-mesh adding after LODs setup is forbidden");
 
   m_needGeometryBufferUpdate = true;
 
@@ -34,10 +57,11 @@ void Mesh::addSubMesh(const std::vector<uint16_t>& indices)
   calculateSubMeshesOffsets();
 }
 
-void Mesh::setIndices(const std::vector<uint16_t>& indices, size_t subMeshIndex)
+void Mesh::setIndices(const std::vector<uint32_t>& indices, size_t subMeshIndex)
 {
   SW_ASSERT(subMeshIndex < m_indices.size());
-  SW_ASSERT(m_geometryStore == nullptr || !m_indices.empty());
+  SW_ASSERT(!hasGeometryBuffer() || !m_indices.empty());
+  SW_ASSERT(m_lods.empty() && "Indices of the mesh with LODs could not be changed");
 
   m_needGeometryBufferUpdate = true;
   m_needUpdateIndices = true;
@@ -49,7 +73,7 @@ void Mesh::setIndices(const std::vector<uint16_t>& indices, size_t subMeshIndex)
 
 void Mesh::setNormals(const std::vector<glm::vec3>& normals)
 {
-  SW_ASSERT(m_geometryStore == nullptr || m_isDynamic &&
+  SW_ASSERT(!hasGeometryBuffer() || m_isDynamic &&
     !m_normals.empty());
 
   m_normals = normals;
@@ -58,7 +82,7 @@ void Mesh::setNormals(const std::vector<glm::vec3>& normals)
 
 void Mesh::setTangents(const std::vector<glm::vec3>& tangents)
 {
-  SW_ASSERT(m_geometryStore == nullptr || m_isDynamic &&
+  SW_ASSERT(!hasGeometryBuffer() || m_isDynamic &&
     !m_tangents.empty() &&
     tangents.size() <= m_geometryStore->getVerticesCapacity());
 
@@ -68,7 +92,7 @@ void Mesh::setTangents(const std::vector<glm::vec3>& tangents)
 
 void Mesh::setUV(const std::vector<glm::vec2>& uv)
 {
-  SW_ASSERT(m_geometryStore == nullptr || m_isDynamic &&
+  SW_ASSERT(!hasGeometryBuffer() || m_isDynamic &&
     !m_uv.empty());
 
   m_uv = uv;
@@ -77,16 +101,31 @@ void Mesh::setUV(const std::vector<glm::vec2>& uv)
 
 void Mesh::setSkinData(const std::vector<glm::u8vec4>& bonesIDs, const std::vector<glm::u8vec4>& bonesWeights)
 {
-  SW_ASSERT(m_geometryStore == nullptr || m_isDynamic &&
+  SW_ASSERT(!hasGeometryBuffer() || m_isDynamic &&
     !m_bonesIDs.empty());
 
-  SW_ASSERT(m_geometryStore == nullptr || m_isDynamic &&
+  SW_ASSERT(!hasGeometryBuffer() || m_isDynamic &&
     !m_bonesWeights.empty());
 
   m_bonesIDs = bonesIDs;
   m_bonesWeights = bonesWeights;
 }
 
+const std::vector<glm::vec3>& Mesh::getVertices() const
+{
+  return m_vertices;
+}
+
+const std::vector<glm::vec3>& Mesh::getNormals() const
+{
+  return m_normals;
+}
+
+const std::vector<glm::vec2>& Mesh::getUV() const
+{
+  return m_uv;
+}
+
 bool Mesh::hasVertices() const
 {
   return !m_vertices.empty();
@@ -117,30 +156,125 @@ bool Mesh::hasSkeleton() const
   return m_skeleton.has_value();
 }
 
+bool Mesh::hasWideIndices() const
+{
+  // The storage capacity is taken into account, as the dynamic meshes vertices count could grow up to it
+  return std::max(m_vertices.size(), m_minStorageCapacity) > MAX_SHORT_INDEXED_VERTICES_COUNT;
+}
+
 size_t Mesh::getSubMeshesCount() const
 {
   return m_indices.size();
 }
 
-size_t Mesh::getSubMeshIndicesOffset(size_t subMeshIndex) const
+size_t Mesh::getSubMeshIndicesOffset(size_t subMeshIndex, size_t lodIndex) const
+{
+  SW_ASSERT(subMeshIndex < m_indices.size());
+
+  if (m_lods.empty()) {
+    SW_ASSERT(lodIndex == 0);
+
+    return m_subMeshesIndicesOffsets[subMeshIndex];
+  }
+
+  SW_ASSERT(lodIndex < m_lods.size());
+
+  return m_subMeshesIndicesOffsets[subMeshIndex] + m_lods[lodIndex].subMeshesRanges[subMeshIndex].indicesOffset;
+}
+
+size_t Mesh::getSubMeshIndicesCount(size_t subMeshIndex, size_t lodIndex) const
 {
   SW_ASSERT(subMeshIndex < m_indices.size());
 
-  return m_subMeshesIndicesOffsets[subMeshIndex];
+  if (m_lods.empty()) {
+    SW_ASSERT(lodIndex == 0);
+
+    return m_indices[subMeshIndex].size();
+  }
+
+  SW_ASSERT(lodIndex < m_lods.size());
+
+  return m_lods[lodIndex].subMeshesRanges[subMeshIndex].indicesCount;
 }
 
-size_t Mesh::getSubMeshIndicesCount(size_t subMeshIndex) const
+std::span<const uint32_t> Mesh::getSubMeshIndices(size_t subMeshIndex, size_t lodIndex) const
 {
   SW_ASSERT(subMeshIndex < m_indices.size());
 
-  return m_indices[subMeshIndex].size();
+  std::span<const uint32_t> subMeshIndices(m_indices[subMeshIndex]);
+
+  if (m_lods.empty()) {
+    SW_ASSERT(lodIndex == 0);
+
+    return subMeshIndices;
+  }
+
+  SW_ASSERT(lodIndex < m_lods.size());
+
+  const MeshIndicesRange& range = m_lods[lodIndex].subMeshesRanges[subMeshIndex];
+
+  return subMeshIndices.subspan(range.indicesOffset, range.indicesCount);
 }
 
-GLGeometryStore* Mesh::getGeometryStore()
+void Mesh::setLods(const std::vector<MeshLodDescription>& lods)
+{
+  SW_ASSERT(lods.size() <= MAX_LODS_COUNT);
+
+  for (const MeshLodDescription& lod : lods) {
+    SW_ASSERT(lod.subMeshesRanges.size() == m_indices.size());
+
+    for (size_t subMeshIndex = 0; subMeshIndex < m_indices.size(); subMeshIndex++) {
+      const MeshIndicesRange& range = lod.subMeshesRanges[subMeshIndex];
+
+      if (range.indicesOffset + range.indicesCount > m_indices[subMeshIndex].size()) {
+        THROW_EXCEPTION(EngineRuntimeException, "Mesh LOD indices range is out of the sub-mesh indices");
+      }
+    }
+  }
+
+  m_lods = lods;
+}
+
+size_t Mesh::getLodsCount() const
+{
+  return std::max(m_lods.size(), size_t(1));
+}
+
+float Mesh::getLodMinScreenSize(size_t lodIndex) const
+{
+  if (m_lods.empty()) {
+    SW_ASSERT(lodIndex == 0);
+
+    return 0.0f;
+  }
+
+  SW_ASSERT(lodIndex < m_lods.size());
+
+  return m_lods[lodIndex].minScreenSize;
+}
+
+void Mesh::drawRange(size_t start, size_t count, GLenum primitivesType)
 {
   updateGeometryBuffer();
 
-  return m_geometryStore.get();
+  if (m_geometryArenaAllocation.has_value()) {
+    m_geometryArenaAllocation->arena->drawRange(*m_geometryArenaAllocation, start, count, primitivesType);
+  }
+  else {
+    m_geometryStore->drawRange(start, count, primitivesType);
+  }
+}
+
+const GLGeometryArenaAllocation* Mesh::getGeometryArenaAllocation()
+{
+  updateGeometryBuffer();
+
+  return m_geometryArenaAllocation.has_value() ? &m_geometryArenaAllocation.value() : nullptr;
+}
+
+bool Mesh::hasGeometryBuffer() const
+{
+  return m_geometryStore != nullptr || m_geometryArenaAllocation.has_value();
 }
 
 void Mesh::setAABB(const AABB& aabb)
@@ -205,44 +339,28 @@ void Mesh::updateGeometryBuffer()
     meshAttributesMask = meshAttributesMask | MeshAttributes::BonesIDs | MeshAttributes::BonesWeights;
   }
 
-  std::vector<uint16_t> indices;
+  std::vector<uint32_t> indices;
 
-  if (m_geometryStore == nullptr || m_needUpdateIndices) {
+  if (!hasGeometryBuffer() || m_needUpdateIndices) {
     for (const auto& subMeshIndices : m_indices) {
       indices.insert(indices.end(), subMeshIndices.begin(), subMeshIndices.end());
     }
   }
 
-  if (m_geometryStore == nullptr) {
-    GLenum storageFlags = GL_NONE;
-
-    if (m_isDynamic) {
-      storageFlags |= GL_DYNAMIC_STORAGE_BIT;
-    }
+  // Only static indexed meshes are placed into the arena, as the arena ranges could not grow.
+  // The arena index buffers are 16-bit, so the meshes with wide indices have own geometry stores.
+  bool isArenaFormat = meshAttributesMask == MESH_FORMAT_POS_NORM_UV ||
+    meshAttributesMask == MESH_FORMAT_POS_NORM_TAN_UV || meshAttributesMask == MESH_FORMAT_POS_NORM_UV_SKINNED;
 
-    if (meshAttributesMask == MESH_FORMAT_POS_NORM_UV || meshAttributesMask == MESH_FORMAT_POS_NORM_TAN_UV) {
-      if (meshAttributesMask == MESH_FORMAT_POS_NORM_TAN_UV) {
-        spdlog::warn("Tangents attributes for a mesh will be ignored");
-      }
-
-      //geometryStore = new GLGeometryStore(constructVerticesList<VertexPos3Norm3UV>(), indices);
-      m_geometryStore = std::make_unique<GLGeometryStore>(VerticesPos3Norm3UVSoA{
-        .positions = &m_vertices,
-        .normals = &m_normals,
-        .uv = &m_uv
-      }, indices, storageFlags, m_minStorageCapacity);
-    }
-    else if (meshAttributesMask == MESH_FORMAT_POS_NORM_UV_SKINNED) {
-      m_geometryStore = std::make_unique<GLGeometryStore>(VertexPos3Norm3UVSkinnedSoA{
-        .positions = &m_vertices,
-        .normals = &m_normals,
-        .uv = &m_uv,
-        .bonesIds = &m_bonesIDs,
-        .bonesWeights = &m_bonesWeights
-      }, indices, storageFlags, m_minStorageCapacity);
+  if (!m_isDynamic && m_minStorageCapacity == 0 && isArenaFormat && !m_indices.empty() && !hasWideIndices()) {
+    updateGeometryArenaAllocation(meshAttributesMask, toShortIndices(indices));
+  }
+  else if (m_geometryStore == nullptr) {
+    if (hasWideIndices()) {
+      createGeometryStore(meshAttributesMask, indices);
     }
     else {
-      THROW_EXCEPTION(EngineRuntimeException, "Unsupported vertex buffer layout");
+      createGeometryStore(meshAttributesMask, toShortIndices(indices));
     }
   }
   else {
@@ -276,7 +394,13 @@ void Mesh::updateGeometryBuffer()
     }
 
     if (m_needUpdateIndices) {
-      m_geometryStore->updateIndices(indices);
+      if (m_geometryStore->getIndexType() == GL_UNSIGNED_INT) {
+        m_geometryStore->updateIndices(indices);
+      }
+      else {
+        m_geometryStore->updateIndices(toShortIndices(indices));
+      }
+
       m_needUpdateIndices = false;
     }
   }
@@ -284,6 +408,93 @@ void Mesh::updateGeometryBuffer()
   m_needGeometryBufferUpdate = false;
 }
 
+template<class IndexType>
+void Mesh::createGeometryStore(MeshAttributesSet meshAttributesMask, const std::vector<IndexType>& indices)
+{
+  GLenum storageFlags = GL_NONE;
+
+  if (m_isDynamic) {
+    storageFlags |= GL_DYNAMIC_STORAGE_BIT;
+  }
+
+  if (meshAttributesMask == MESH_FORMAT_POS_NORM_UV || meshAttributesMask == MESH_FORMAT_POS_NORM_TAN_UV) {
+    if (meshAttributesMask == MESH_FORMAT_POS_NORM_TAN_UV) {
+      spdlog::warn("Tangents attributes for a mesh will be ignored");
+    }
+
+    m_geometryStore = std::make_unique<GLGeometryStore>(VerticesPos3Norm3UVSoA{
+      .positions = &m_vertices,
+      .normals = &m_normals,
+      .uv = &m_uv
+    }, indices, storageFlags, m_minStorageCapacity);
+  }
+  else if (meshAttributesMask == MESH_FORMAT_POS_NORM_UV_SKINNED) {
+    m_geometryStore = std::make_unique<GLGeometryStore>(VertexPos3Norm3UVSkinnedSoA{
+      .positions = &m_vertices,
+      .normals = &m_normals,
+      .uv = &m_uv,
+      .bonesIds = &m_bonesIDs,
+      .bonesWeights = &m_bonesWeights
+    }, indices, storageFlags, m_minStorageCapacity);
+  }
+  else {
+    THROW_EXCEPTION(EngineRuntimeException, "Unsupported vertex buffer layout");
+  }
+}
+
+void Mesh::updateGeometryArenaAllocation(MeshAttributesSet meshAttributesMask, const std::vector<uint16_t>& indices)
+{
+  if (m_geometryArenaAllocation.has_value()) {
+    if (!m_needUpdateIndices) {
+      return;
+    }
+
+    m_needUpdateIndices = false;
+
+    if (indices.size() == m_geometryArenaAllocation->indicesCount) {
+      m_geometryArenaAllocation->arena->uploadIndices(*m_geometryArenaAllocation, indices);
+      return;
+    }
+
+    // The indices count is changed, so the mesh is moved to the new ranges
+    m_geometryArenaAllocation->arena->free(*m_geometryArenaAllocation);
+    m_geometryArenaAllocation.reset();
+  }
+
+  if (meshAttributesMask == MESH_FORMAT_POS_NORM_TAN_UV) {
+    spdlog::warn("Tangents attributes for a mesh will be ignored");
+  }
+
+  bool isSkinnedFormat = meshAttributesMask == MESH_FORMAT_POS_NORM_UV_SKINNED;
+
+  GLGeometryArenaAllocation allocation = GLGeometryArena::allocateShared(
+    isSkinnedFormat ? GLGeometryArenaFormat::Pos3Norm3UVSkinned : GLGeometryArenaFormat::Pos3Norm3UV,
+    m_vertices.size(), indices.size());
+
+  if (isSkinnedFormat) {
+    allocation.arena->uploadVertices(allocation, VertexPos3Norm3UVSkinnedSoA{
+      .positions = &m_vertices,
+      .normals = &m_normals,
+      .uv = &m_uv,
+      .bonesIds = &m_bonesIDs,
+      .bonesWeights = &m_bonesWeights
+    });
+  }
+  else {
+    allocation.arena->uploadVertices(allocation, VerticesPos3Norm3UVSoA{
+      .positions = &m_vertices,
+      .normals = &m_normals,
+      .uv = &m_uv
+    });
+  }
+
+  allocation.arena->uploadIndices(allocation, indices);
+
+  m_geometryArenaAllocation = std::move(allocation);
+  m_needUpdateAttributes.reset();
+  m_needUpdateIndices = false;
+}
+
 void Mesh::setAttributeOutdated(MeshAttributes attribute, bool isOutdated)
 {
   m_needUpdateAttributes[size_t(attribute)] = isOutdated;
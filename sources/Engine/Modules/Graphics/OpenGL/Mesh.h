@@ -5,12 +5,15 @@
 #include <memory>
 #include <optional>
 #include <bitset>
+#include <limits>
+#include <span>
 
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
 #include "Modules/ResourceManagement/ResourcesManagement.h"
 #include "Modules/Graphics/OpenGL/GLGeometryStore.h"
+#include "Modules/Graphics/OpenGL/GLGeometryArena.h"
 #include "Modules/Graphics/GraphicsSystem/Animation/Skeleton.h"
 #include "Modules/Math/geometry.h"
 
@@ -41,13 +44,28 @@ inline constexpr MeshAttributes operator~(MeshAttributes a)
 
 using MeshAttributesSet = MeshAttributes;
 
+struct MeshIndicesRange {
+  uint32_t indicesOffset{};
+  uint32_t indicesCount{};
+};
+
+/*!
+ * \brief Level of detail of the mesh, the indices ranges are relative to the sub-meshes indices
+ */
+struct MeshLodDescription {
+  // Minimal projected bounding sphere diameter relative to the screen height
+  float minScreenSize{};
+
+  std::vector<MeshIndicesRange> subMeshesRanges;
+};
+
 class Mesh : public Resource {
  public:
   explicit Mesh(bool isDynamic = false, size_t minStorageCapacity = 0);
   ~Mesh() override;
 
-  void addSubMesh(const std::vector<uint16_t>& indices);
-  void setIndices(const std::vector<uint16_t>& indices, size_t subMeshIndex);
+  void addSubMesh(const std::vector<uint32_t>& indices);
+  void setIndices(const std::vector<uint32_t>& indices, size_t subMeshIndex);
 
   void setVertices(const std::vector<glm::vec3>& vertices);
   void setNormals(const std::vector<glm::vec3>& normals);
@@ -56,6 +74,10 @@ class Mesh : public Resource {
 
   void setSkinData(const std::vector<glm::u8vec4>& bonesIDs, const std::vector<glm::u8vec4>& bonesWeights);
 
+  [[nodiscard]] const std::vector<glm::vec3>& getVertices() const;
+  [[nodiscard]] const std::vector<glm::vec3>& getNormals() const;
+  [[nodiscard]] const std::vector<glm::vec2>& getUV() const;
+
   [[nodiscard]] bool hasVertices() const;
   [[nodiscard]] bool hasNormals() const;
   [[nodiscard]] bool hasTangents() const;
@@ -63,11 +85,39 @@ class Mesh : public Resource {
   [[nodiscard]] bool isSkinned() const;
   [[nodiscard]] bool hasSkeleton() const;
 
+  /*!
+   * \brief Checks whether the mesh vertices could not be addressed with 16-bit indices
+   *
+   * Such meshes are drawn with 32-bit indices from the own geometry store, as the shared arenas use 16-bit indices.
+   */
+  [[nodiscard]] bool hasWideIndices() const;
+
   [[nodiscard]] size_t getSubMeshesCount() const;
-  [[nodiscard]] size_t getSubMeshIndicesOffset(size_t subMeshIndex) const;
-  [[nodiscard]] size_t getSubMeshIndicesCount(size_t subMeshIndex) const;
+  [[nodiscard]] size_t getSubMeshIndicesOffset(size_t subMeshIndex, size_t lodIndex = 0) const;
+  [[nodiscard]] size_t getSubMeshIndicesCount(size_t subMeshIndex, size_t lodIndex = 0) const;
+
+  /*!
+   * \brief Returns the sub-mesh indices of the LOD, they reference the whole mesh vertices
+   */
+  [[nodiscard]] std::span<const uint32_t> getSubMeshIndices(size_t subMeshIndex, size_t lodIndex = 0) const;
+
+  /*!
+   * \brief Sets the LODs chain from the full detail one, the whole sub-meshes are the single LOD by default
+   */
+  void setLods(const std::vector<MeshLodDescription>& lods);
 
-  GLGeometryStore* getGeometryStore();
+  [[nodiscard]] size_t getLodsCount() const;
+  [[nodiscard]] float getLodMinScreenSize(size_t lodIndex) const;
+
+  /*!
+   * \brief Draws the indices range of the mesh from the shared geometry arena or the own geometry store
+   */
+  void drawRange(size_t start, size_t count, GLenum primitivesType = GL_TRIANGLES);
+
+  /*!
+   * \brief Returns the mesh ranges in the shared geometry arena, or null if the mesh has an own geometry store
+   */
+  [[nodiscard]] const GLGeometryArenaAllocation* getGeometryArenaAllocation();
 
   void setAABB(const AABB& aabb);
   [[nodiscard]] const AABB& getAABB() const;
@@ -82,17 +132,27 @@ class Mesh : public Resource {
   void calculateSubMeshesOffsets();
 
   void updateGeometryBuffer();
+  void updateGeometryArenaAllocation(MeshAttributesSet meshAttributesMask, const std::vector<uint16_t>& indices);
+
+  template<class IndexType>
+  void createGeometryStore(MeshAttributesSet meshAttributesMask, const std::vector<IndexType>& indices);
+
+  [[nodiscard]] bool hasGeometryBuffer() const;
 
   void setAttributeOutdated(MeshAttributes attribute, bool isOutdated = true);
 
  private:
+  // Static meshes are placed into the shared geometry arena, dynamic ones have own geometry stores
   std::unique_ptr<GLGeometryStore> m_geometryStore;
+  std::optional<GLGeometryArenaAllocation> m_geometryArenaAllocation;
 
   std::vector<glm::vec3> m_vertices;
 
-  std::vector<std::vector<uint16_t>> m_indices;
+  std::vector<std::vector<uint32_t>> m_indices;
   std::vector<uint32_t> m_subMeshesIndicesOffsets;
 
+  std::vector<MeshLodDescription> m_lods;
+
   std::vector<glm::vec3> m_normals;
   std::vector<glm::vec3> m_tangents;
   std::vector<glm::vec2> m_uv;
@@ -122,4 +182,10 @@ class Mesh : public Resource {
   static constexpr MeshAttributesSet MESH_FORMAT_POS_NORM_UV_SKINNED =
     MeshAttributes::Positions | MeshAttributes::Normals | MeshAttributes::UV |
       MeshAttributes::BonesIDs | MeshAttributes::BonesWeights;
+
+ public:
+  static constexpr size_t MAX_LODS_COUNT = 8;
+
+  // Maximal vertices count of the meshes with 16-bit indices
+  static constexpr size_t MAX_SHORT_INDEXED_VERTICES_COUNT = size_t(std::numeric_limits<uint16_t>::max()) + 1;
 };
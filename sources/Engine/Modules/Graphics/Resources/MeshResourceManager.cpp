@@ -80,6 +80,22 @@ void MeshResourceManager::load(size_t resourceIndex)
     mesh->addSubMesh(rawSubMeshDescription.indices);
   }
 
+  if (rawMesh.lods.size() > Mesh::MAX_LODS_COUNT) {
+    THROW_EXCEPTION(EngineRuntimeException, fmt::format("Mesh {} has too many LODs", config->resourcePath));
+  }
+
+  std::vector<MeshLodDescription> lods;
+
+  for (const RawMeshLodDescription& rawLodDescription : rawMesh.lods) {
+    lods.push_back(MeshLodDescription{
+      .minScreenSize = rawLodDescription.minScreenSize,
+      .subMeshesRanges = MemoryUtils::createBinaryCompatibleVector<RawMeshIndicesRange, MeshIndicesRange>(
+        rawLodDescription.subMeshesRanges),
+    });
+  }
+
+  mesh->setLods(lods);
+
   mesh->setAABB(AABB(rawVector3ToGLMVector3(rawMesh.aabb.min), rawVector3ToGLMVector3(rawMesh.aabb.max)));
   mesh->setInverseSceneTransform(rawMatrix4ToGLMMatrix4(rawMesh.inverseSceneTransform));
 
@@ -6,6 +6,129 @@
 #include "Exceptions/exceptions.h"
 
 #include "Utility/files.h"
+#include "Modules/Math/VertexQuantization.h"
+
+namespace {
+
+// Header of the meshes with 16-bit vertices count and indices
+struct RawMeshHeaderWithoutQuantization {
+  uint16_t formatVersion;
+  uint16_t verticesCount;
+
+  bitmask64 storedAttributesMask;
+  uint16_t subMeshesCount;
+};
+
+bool isQuantized(const RawMeshHeader& header, RawMeshQuantization quantization)
+{
+  return (static_cast<RawMeshQuantization>(header.quantizedAttributesMask) & quantization) !=
+    RawMeshQuantization::None;
+}
+
+template<class T>
+void readAttribute(std::ifstream& meshFile, std::vector<T>& attribute, size_t verticesCount)
+{
+  attribute.resize(verticesCount);
+  meshFile.read(reinterpret_cast<char*>(attribute.data()), sizeof(*attribute.begin()) * verticesCount);
+}
+
+template<class StoredType, class T, class Decoder>
+void readQuantizedAttribute(std::ifstream& meshFile, std::vector<T>& attribute, size_t verticesCount,
+  Decoder decoder)
+{
+  std::vector<StoredType> storedAttribute;
+  readAttribute(meshFile, storedAttribute, verticesCount);
+
+  attribute.resize(verticesCount);
+  std::transform(storedAttribute.begin(), storedAttribute.end(), attribute.begin(), decoder);
+}
+
+template<class T>
+void writeAttribute(std::ofstream& meshFile, const std::vector<T>& attribute)
+{
+  meshFile.write(reinterpret_cast<const char*>(attribute.data()), sizeof(*attribute.begin()) * attribute.size());
+}
+
+template<class StoredType, class T, class Encoder>
+void writeQuantizedAttribute(std::ofstream& meshFile, const std::vector<T>& attribute, Encoder encoder)
+{
+  std::vector<StoredType> storedAttribute(attribute.size());
+  std::transform(attribute.begin(), attribute.end(), storedAttribute.begin(), encoder);
+
+  writeAttribute(meshFile, storedAttribute);
+}
+
+template<class StoredType>
+void readIndices(std::ifstream& meshFile, std::vector<uint32_t>& indices, size_t indicesCount)
+{
+  std::vector<StoredType> storedIndices(indicesCount);
+  meshFile.read(reinterpret_cast<char*>(storedIndices.data()), sizeof(*storedIndices.begin()) * indicesCount);
+
+  indices.assign(storedIndices.begin(), storedIndices.end());
+}
+
+template<class StoredType>
+void writeIndices(std::ofstream& meshFile, const std::vector<uint32_t>& indices)
+{
+  std::vector<StoredType> storedIndices(indices.size());
+  std::transform(indices.begin(), indices.end(), storedIndices.begin(), [](uint32_t index) {
+    return static_cast<StoredType>(index);
+  });
+
+  meshFile.write(reinterpret_cast<const char*>(storedIndices.data()),
+    sizeof(*storedIndices.begin()) * storedIndices.size());
+}
+
+RawAABB getPositionsBounds(const std::vector<RawVector3>& positions)
+{
+  glm::vec3 boundsMin(std::numeric_limits<float>::max());
+  glm::vec3 boundsMax(std::numeric_limits<float>::lowest());
+
+  for (const RawVector3& position : positions) {
+    boundsMin = glm::min(boundsMin, rawVector3ToGLMVector3(position));
+    boundsMax = glm::max(boundsMax, rawVector3ToGLMVector3(position));
+  }
+
+  return RawAABB{.min = glmVector3ToRawVector3(boundsMin), .max = glmVector3ToRawVector3(boundsMax)};
+}
+
+void readDirections(std::ifstream& meshFile, std::vector<RawVector3>& directions, size_t verticesCount,
+  bool isQuantized8, bool isQuantized16)
+{
+  if (isQuantized8) {
+    readQuantizedAttribute<glm::i8vec2>(meshFile, directions, verticesCount, [](const glm::i8vec2& direction) {
+      return glmVector3ToRawVector3(VertexQuantization::dequantizeDirection8(direction));
+    });
+  }
+  else if (isQuantized16) {
+    readQuantizedAttribute<glm::i16vec2>(meshFile, directions, verticesCount, [](const glm::i16vec2& direction) {
+      return glmVector3ToRawVector3(VertexQuantization::dequantizeDirection16(direction));
+    });
+  }
+  else {
+    readAttribute(meshFile, directions, verticesCount);
+  }
+}
+
+void writeDirections(std::ofstream& meshFile, const std::vector<RawVector3>& directions,
+  bool isQuantized8, bool isQuantized16)
+{
+  if (isQuantized8) {
+    writeQuantizedAttribute<glm::i8vec2>(meshFile, directions, [](const RawVector3& direction) {
+      return VertexQuantization::quantizeDirection8(rawVector3ToGLMVector3(direction));
+    });
+  }
+  else if (isQuantized16) {
+    writeQuantizedAttribute<glm::i16vec2>(meshFile, directions, [](const RawVector3& direction) {
+      return VertexQuantization::quantizeDirection16(rawVector3ToGLMVector3(direction));
+    });
+  }
+  else {
+    writeAttribute(meshFile, directions);
+  }
+}
+
+}
 
 RawMesh RawMesh::readFromFile(const std::string& path)
 {
@@ -16,9 +139,28 @@ RawMesh RawMesh::readFromFile(const std::string& path)
   RawMesh rawMesh;
 
   std::ifstream meshFile(path, std::ios::binary);
-  meshFile.read(reinterpret_cast<char*>(&rawMesh.header), sizeof(rawMesh.header));
 
-  if (rawMesh.header.formatVersion != MESH_FORMAT_VERSION) {
+  uint16_t formatVersion = 0;
+  meshFile.read(reinterpret_cast<char*>(&formatVersion), sizeof(formatVersion));
+  meshFile.seekg(0);
+
+  if (formatVersion == MESH_FORMAT_VERSION) {
+    meshFile.read(reinterpret_cast<char*>(&rawMesh.header), sizeof(rawMesh.header));
+  }
+  else if (formatVersion == MESH_FORMAT_VERSION_WITHOUT_QUANTIZATION ||
+    formatVersion == MESH_FORMAT_VERSION_WITHOUT_LODS) {
+    RawMeshHeaderWithoutQuantization header{};
+    meshFile.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    rawMesh.header = RawMeshHeader{
+      .formatVersion = header.formatVersion,
+      .verticesCount = header.verticesCount,
+      .storedAttributesMask = header.storedAttributesMask,
+      .subMeshesCount = header.subMeshesCount,
+      .quantizedAttributesMask = static_cast<bitmask64>(RawMeshQuantization::None),
+    };
+  }
+  else {
     THROW_EXCEPTION(EngineRuntimeException, "Trying to load mesh with incompatible format version: " +
       path);
   }
@@ -28,54 +170,72 @@ RawMesh RawMesh::readFromFile(const std::string& path)
       path);
   }
 
-  const uint16_t verticesCount = rawMesh.header.verticesCount;
+  const size_t verticesCount = rawMesh.header.verticesCount;
   auto storedAttributesMask = static_cast<RawMeshAttributes>(rawMesh.header.storedAttributesMask);
 
   if ((storedAttributesMask & RawMeshAttributes::Positions) != RawMeshAttributes::Empty) {
-    rawMesh.positions.resize(rawMesh.header.verticesCount);
-    meshFile.read(reinterpret_cast<char*>(rawMesh.positions.data()),
-      sizeof(*rawMesh.positions.begin()) * verticesCount);
+    if (isQuantized(rawMesh.header, RawMeshQuantization::Positions16)) {
+      RawAABB bounds{};
+      meshFile.read(reinterpret_cast<char*>(&bounds), sizeof(bounds));
+
+      glm::vec3 boundsMin = rawVector3ToGLMVector3(bounds.min);
+      glm::vec3 boundsMax = rawVector3ToGLMVector3(bounds.max);
+
+      readQuantizedAttribute<glm::u16vec3>(meshFile, rawMesh.positions, verticesCount,
+        [boundsMin, boundsMax](const glm::u16vec3& position) {
+          return glmVector3ToRawVector3(VertexQuantization::dequantizePosition(position, boundsMin, boundsMax));
+        });
+    }
+    else {
+      readAttribute(meshFile, rawMesh.positions, verticesCount);
+    }
   }
 
   if ((storedAttributesMask & RawMeshAttributes::Normals) != RawMeshAttributes::Empty) {
-    rawMesh.normals.resize(rawMesh.header.verticesCount);
-    meshFile.read(reinterpret_cast<char*>(rawMesh.normals.data()),
-      sizeof(*rawMesh.normals.begin()) * verticesCount);
+    readDirections(meshFile, rawMesh.normals, verticesCount,
+      isQuantized(rawMesh.header, RawMeshQuantization::Normals8),
+      isQuantized(rawMesh.header, RawMeshQuantization::Normals16));
   }
 
   if ((storedAttributesMask & RawMeshAttributes::Tangents) != RawMeshAttributes::Empty) {
-    rawMesh.tangents.resize(rawMesh.header.verticesCount);
-    meshFile.read(reinterpret_cast<char*>(rawMesh.tangents.data()),
-      sizeof(*rawMesh.tangents.begin()) * verticesCount);
+    readDirections(meshFile, rawMesh.tangents, verticesCount,
+      isQuantized(rawMesh.header, RawMeshQuantization::Tangents8),
+      isQuantized(rawMesh.header, RawMeshQuantization::Tangents16));
   }
 
   if ((storedAttributesMask & RawMeshAttributes::UV) != RawMeshAttributes::Empty) {
-    rawMesh.uv.resize(rawMesh.header.verticesCount);
-    meshFile.read(reinterpret_cast<char*>(rawMesh.uv.data()),
-      sizeof(*rawMesh.uv.begin()) * verticesCount);
+    if (isQuantized(rawMesh.header, RawMeshQuantization::UVHalf)) {
+      readQuantizedAttribute<glm::u16vec2>(meshFile, rawMesh.uv, verticesCount, [](const glm::u16vec2& uv) {
+        return glmVector2ToRawVector2(VertexQuantization::dequantizeHalf(uv));
+      });
+    }
+    else {
+      readAttribute(meshFile, rawMesh.uv, verticesCount);
+    }
   }
 
   if ((storedAttributesMask & RawMeshAttributes::BonesIDs) != RawMeshAttributes::Empty) {
-    rawMesh.bonesIds.resize(rawMesh.header.verticesCount);
-    meshFile.read(reinterpret_cast<char*>(rawMesh.bonesIds.data()),
-      sizeof(*rawMesh.bonesIds.begin()) * verticesCount);
+    readAttribute(meshFile, rawMesh.bonesIds, verticesCount);
   }
 
   if ((storedAttributesMask & RawMeshAttributes::BonesWeights) != RawMeshAttributes::Empty) {
-    rawMesh.bonesWeights.resize(rawMesh.header.verticesCount);
-    meshFile.read(reinterpret_cast<char*>(rawMesh.bonesWeights.data()),
-      sizeof(*rawMesh.bonesWeights.begin()) * verticesCount);
+    readAttribute(meshFile, rawMesh.bonesWeights, verticesCount);
   }
 
+  const size_t indexSize = getStoredIndexSize(verticesCount);
+
   for (size_t subMeshIndex = 0; subMeshIndex < rawMesh.header.subMeshesCount; subMeshIndex++) {
     RawSubMeshDescription subMeshDescription;
 
     meshFile.read(reinterpret_cast<char*>(&subMeshDescription.indicesCount),
       sizeof(subMeshDescription.indicesCount));
 
-    subMeshDescription.indices.resize(subMeshDescription.indicesCount);
-    meshFile.read(reinterpret_cast<char*>(subMeshDescription.indices.data()),
-      sizeof(*subMeshDescription.indices.begin()) * subMeshDescription.indicesCount);
+    if (indexSize == sizeof(uint16_t)) {
+      readIndices<uint16_t>(meshFile, subMeshDescription.indices, subMeshDescription.indicesCount);
+    }
+    else {
+      readIndices<uint32_t>(meshFile, subMeshDescription.indices, subMeshDescription.indicesCount);
+    }
 
     rawMesh.subMeshesDescriptions.push_back(subMeshDescription);
   }
@@ -84,6 +244,31 @@ RawMesh RawMesh::readFromFile(const std::string& path)
   meshFile.read(reinterpret_cast<char*>(&rawMesh.inverseSceneTransform.data),
     sizeof(rawMesh.inverseSceneTransform.data));
 
+  if (rawMesh.header.formatVersion == MESH_FORMAT_VERSION_WITHOUT_LODS) {
+    rawMesh.lods.push_back(getFullDetailLod(rawMesh));
+  }
+  else {
+    uint16_t lodsCount = 0;
+    meshFile.read(reinterpret_cast<char*>(&lodsCount), sizeof(lodsCount));
+
+    if (lodsCount > MESH_MAX_LODS_COUNT) {
+      THROW_EXCEPTION(EngineRuntimeException, "Mesh file has too many LODs");
+    }
+
+    for (size_t lodIndex = 0; lodIndex < lodsCount; lodIndex++) {
+      RawMeshLodDescription lodDescription{};
+      meshFile.read(reinterpret_cast<char*>(&lodDescription.minScreenSize), sizeof(lodDescription.minScreenSize));
+
+      lodDescription.subMeshesRanges.resize(rawMesh.header.subMeshesCount);
+      meshFile.read(reinterpret_cast<char*>(lodDescription.subMeshesRanges.data()),
+        sizeof(*lodDescription.subMeshesRanges.begin()) * rawMesh.header.subMeshesCount);
+
+      rawMesh.lods.push_back(std::move(lodDescription));
+    }
+  }
+
+  rawMesh.header.formatVersion = MESH_FORMAT_VERSION;
+
   meshFile.close();
 
   return rawMesh;
@@ -96,8 +281,6 @@ void RawMesh::writeToFile(const std::string& path, const RawMesh& rawMesh)
 
   std::ofstream meshFile(path, std::ios::binary);
 
-  const uint16_t verticesCount = rawMesh.header.verticesCount;
-
   meshFile.write(reinterpret_cast<const char*>(&rawMesh.header), sizeof(rawMesh.header));
 
   auto storedAttributesMask = static_cast<RawMeshAttributes>(rawMesh.header.storedAttributesMask);
@@ -105,58 +288,119 @@ void RawMesh::writeToFile(const std::string& path, const RawMesh& rawMesh)
   if ((storedAttributesMask & RawMeshAttributes::Positions) != RawMeshAttributes::Empty) {
     SW_ASSERT(rawMesh.positions.size() == rawMesh.header.verticesCount);
 
-    meshFile.write(reinterpret_cast<const char*>(rawMesh.positions.data()),
-      sizeof(*rawMesh.positions.begin()) * verticesCount);
+    if (isQuantized(rawMesh.header, RawMeshQuantization::Positions16)) {
+      RawAABB bounds = getPositionsBounds(rawMesh.positions);
+      meshFile.write(reinterpret_cast<const char*>(&bounds), sizeof(bounds));
+
+      glm::vec3 boundsMin = rawVector3ToGLMVector3(bounds.min);
+      glm::vec3 boundsMax = rawVector3ToGLMVector3(bounds.max);
+
+      writeQuantizedAttribute<glm::u16vec3>(meshFile, rawMesh.positions,
+        [boundsMin, boundsMax](const RawVector3& position) {
+          return VertexQuantization::quantizePosition(rawVector3ToGLMVector3(position), boundsMin, boundsMax);
+        });
+    }
+    else {
+      writeAttribute(meshFile, rawMesh.positions);
+    }
   }
 
   if ((storedAttributesMask & RawMeshAttributes::Normals) != RawMeshAttributes::Empty) {
     SW_ASSERT(rawMesh.normals.size() == rawMesh.header.verticesCount);
 
-    meshFile.write(reinterpret_cast<const char*>(rawMesh.normals.data()),
-      sizeof(*rawMesh.normals.begin()) * verticesCount);
+    writeDirections(meshFile, rawMesh.normals,
+      isQuantized(rawMesh.header, RawMeshQuantization::Normals8),
+      isQuantized(rawMesh.header, RawMeshQuantization::Normals16));
   }
 
   if ((storedAttributesMask & RawMeshAttributes::Tangents) != RawMeshAttributes::Empty) {
     SW_ASSERT(rawMesh.tangents.size() == rawMesh.header.verticesCount);
 
-    meshFile.write(reinterpret_cast<const char*>(rawMesh.tangents.data()),
-      sizeof(*rawMesh.tangents.begin()) * verticesCount);
+    writeDirections(meshFile, rawMesh.tangents,
+      isQuantized(rawMesh.header, RawMeshQuantization::Tangents8),
+      isQuantized(rawMesh.header, RawMeshQuantization::Tangents16));
   }
 
   if ((storedAttributesMask & RawMeshAttributes::UV) != RawMeshAttributes::Empty) {
     SW_ASSERT(rawMesh.uv.size() == rawMesh.header.verticesCount);
 
-    meshFile.write(reinterpret_cast<const char*>(rawMesh.uv.data()),
-      sizeof(*rawMesh.uv.begin()) * verticesCount);
+    if (isQuantized(rawMesh.header, RawMeshQuantization::UVHalf)) {
+      writeQuantizedAttribute<glm::u16vec2>(meshFile, rawMesh.uv, [](const RawVector2& uv) {
+        return VertexQuantization::quantizeHalf(rawVector2ToGLMVector2(uv));
+      });
+    }
+    else {
+      writeAttribute(meshFile, rawMesh.uv);
+    }
   }
 
   if ((storedAttributesMask & RawMeshAttributes::BonesIDs) != RawMeshAttributes::Empty) {
     SW_ASSERT(rawMesh.bonesIds.size() == rawMesh.header.verticesCount);
 
-    meshFile.write(reinterpret_cast<const char*>(rawMesh.bonesIds.data()),
-      sizeof(*rawMesh.bonesIds.begin()) * verticesCount);
+    writeAttribute(meshFile, rawMesh.bonesIds);
   }
 
   if ((storedAttributesMask & RawMeshAttributes::BonesWeights) != RawMeshAttributes::Empty) {
     SW_ASSERT(rawMesh.bonesWeights.size() == rawMesh.header.verticesCount);
 
-    meshFile.write(reinterpret_cast<const char*>(rawMesh.bonesWeights.data()),
-      sizeof(*rawMesh.bonesWeights.begin()) * verticesCount);
+    writeAttribute(meshFile, rawMesh.bonesWeights);
   }
 
+  const size_t indexSize = getStoredIndexSize(rawMesh.header.verticesCount);
+
   for (const RawSubMeshDescription& rawSubMeshDescription : rawMesh.subMeshesDescriptions) {
     SW_ASSERT(rawSubMeshDescription.indicesCount == rawSubMeshDescription.indices.size());
 
     meshFile.write(reinterpret_cast<const char*>(&rawSubMeshDescription.indicesCount),
       sizeof(rawSubMeshDescription.indicesCount));
 
-    meshFile.write(reinterpret_cast<const char*>(rawSubMeshDescription.indices.data()),
-      sizeof(*rawSubMeshDescription.indices.begin()) * rawSubMeshDescription.indicesCount);
+    if (indexSize == sizeof(uint16_t)) {
+      writeIndices<uint16_t>(meshFile, rawSubMeshDescription.indices);
+    }
+    else {
+      writeIndices<uint32_t>(meshFile, rawSubMeshDescription.indices);
+    }
   }
 
   meshFile.write(reinterpret_cast<const char*>(&rawMesh.aabb), sizeof(rawMesh.aabb));
   meshFile.write(reinterpret_cast<const char*>(&rawMesh.inverseSceneTransform.data),
     sizeof(rawMesh.inverseSceneTransform.data));
 
+  std::vector<RawMeshLodDescription> lods = rawMesh.lods;
+
+  if (lods.empty()) {
+    lods.push_back(getFullDetailLod(rawMesh));
+  }
+
+  auto lodsCount = static_cast<uint16_t>(lods.size());
+  meshFile.write(reinterpret_cast<const char*>(&lodsCount), sizeof(lodsCount));
+
+  for (const RawMeshLodDescription& lodDescription : lods) {
+    SW_ASSERT(lodDescription.subMeshesRanges.size() == rawMesh.header.subMeshesCount);
+
+    meshFile.write(reinterpret_cast<const char*>(&lodDescription.minScreenSize), sizeof(lodDescription.minScreenSize));
+    meshFile.write(reinterpret_cast<const char*>(lodDescription.subMeshesRanges.data()),
+      sizeof(*lodDescription.subMeshesRanges.begin()) * lodDescription.subMeshesRanges.size());
+  }
+
   meshFile.close();
 }
+
+RawMeshLodDescription RawMesh::getFullDetailLod(const RawMesh& rawMesh)
+{
+  RawMeshLodDescription lodDescription{.minScreenSize = 0.0f};
+
+  for (const RawSubMeshDescription& subMeshDescription : rawMesh.subMeshesDescriptions) {
+    lodDescription.subMeshesRanges.push_back(RawMeshIndicesRange{
+      .indicesOffset = 0,
+      .indicesCount = subMeshDescription.indicesCount
+    });
+  }
+
+  return lodDescription;
+}
+
+size_t RawMesh::getStoredIndexSize(size_t verticesCount)
+{
+  return (verticesCount > size_t(std::numeric_limits<uint16_t>::max()) + 1) ? sizeof(uint32_t) : sizeof(uint16_t);
+}
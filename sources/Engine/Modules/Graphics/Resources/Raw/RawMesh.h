@@ -10,7 +10,15 @@
 
 // TODO: assume that there could be migrations from previous meshes formats,
 //  try to avoid manual meshes reimporting.
-constexpr uint16_t MESH_FORMAT_VERSION = 116;
+constexpr uint16_t MESH_FORMAT_VERSION = 118;
+
+// Meshes of the previous version have 16-bit vertices count and indices and no quantized attributes
+constexpr uint16_t MESH_FORMAT_VERSION_WITHOUT_QUANTIZATION = 117;
+
+// Meshes of the version have no LODs chain, they are read as the single LOD meshes
+constexpr uint16_t MESH_FORMAT_VERSION_WITHOUT_LODS = 116;
+
+constexpr uint16_t MESH_MAX_LODS_COUNT = 8;
 
 enum class RawMeshAttributes {
   Empty = 0,
@@ -37,6 +45,32 @@ inline RawMeshAttributes operator^(RawMeshAttributes a, RawMeshAttributes b)
   return static_cast<RawMeshAttributes>(static_cast<unsigned int>(a) ^ static_cast<unsigned int>(b));
 }
 
+/**
+ * @brief Compact encodings of the vertex attributes in the mesh file, the attributes are decoded on reading.
+ *
+ * Positions are stored as 16-bit unsigned normalized values relative to the positions bounds, normals
+ * and tangents are octahedral-mapped to two 8-bit or 16-bit signed normalized values, UV are half floats.
+ */
+enum class RawMeshQuantization {
+  None = 0,
+  Positions16 = 1,
+  Normals8 = 2,
+  Normals16 = 4,
+  Tangents8 = 8,
+  Tangents16 = 16,
+  UVHalf = 32,
+};
+
+inline RawMeshQuantization operator|(RawMeshQuantization a, RawMeshQuantization b)
+{
+  return static_cast<RawMeshQuantization>(static_cast<unsigned int>(a) | static_cast<unsigned int>(b));
+}
+
+inline RawMeshQuantization operator&(RawMeshQuantization a, RawMeshQuantization b)
+{
+  return static_cast<RawMeshQuantization>(static_cast<unsigned int>(a) & static_cast<unsigned int>(b));
+}
+
 /**
  * @brief Mesh format is intended to store meshes geometry in single vertex buffer, so
  * all submeshes should have the same vertex format.
@@ -44,20 +78,49 @@ inline RawMeshAttributes operator^(RawMeshAttributes a, RawMeshAttributes b)
  * Raw mesh could contain one or more submeshes, each submesh is represented by
  * indices count and indices values.
  *
- * Indices are intended to be 2-bytes integers, so mesh should contain not more than
- * 65535 vertices, but indices count can be bigger.
+ * Indices are stored as 2-bytes integers if the mesh contains not more than 65536 vertices
+ * and as 4-bytes integers otherwise, they are always 4-bytes integers in memory.
+ *
+ * The quantized attributes are stored in the compact encodings, the positions bounds are
+ * stored before the quantized positions.
+ *
+ * The LODs chain is stored after the mesh data as the LODs count and the sub-meshes
+ * indices ranges of every LOD.
  */
 struct RawMeshHeader {
   uint16_t formatVersion;
-  uint16_t verticesCount;
+  uint32_t verticesCount;
 
   bitmask64 storedAttributesMask;
   uint16_t subMeshesCount;
+
+  bitmask64 quantizedAttributesMask;
 };
 
 struct RawSubMeshDescription {
   uint32_t indicesCount;
-  std::vector<uint16_t> indices;
+  std::vector<uint32_t> indices;
+};
+
+struct RawMeshIndicesRange {
+  uint32_t indicesOffset;
+  uint32_t indicesCount;
+};
+
+/**
+ * @brief Level of detail of the mesh, all LODs share the mesh vertices.
+ *
+ * The indices of the LODs are stored in the sub-meshes indices one after another, so
+ * the LOD is described by the indices ranges of the sub-meshes.
+ */
+struct RawMeshLodDescription {
+  /**
+   * @brief Minimal projected bounding sphere diameter relative to the screen height,
+   * the LOD is used while the mesh is not smaller.
+   */
+  float minScreenSize;
+
+  std::vector<RawMeshIndicesRange> subMeshesRanges;
 };
 
 struct RawAABB {
@@ -77,6 +140,11 @@ struct RawMesh {
 
   std::vector<RawSubMeshDescription> subMeshesDescriptions;
 
+  /**
+   * @brief LODs chain from the full detail one, the whole sub-meshes are treated as the single LOD if it is empty
+   */
+  std::vector<RawMeshLodDescription> lods;
+
   /**
    * @brief Axis-aligned bounding box for the whole mesh
    */
@@ -91,4 +159,14 @@ struct RawMesh {
 
   static RawMesh readFromFile(const std::string& path);
   static void writeToFile(const std::string& path, const RawMesh& rawMesh);
+
+  /**
+   * @brief Returns the LOD that covers the whole sub-meshes indices
+   */
+  static RawMeshLodDescription getFullDetailLod(const RawMesh& rawMesh);
+
+  /**
+   * @brief Returns the size of the stored indices of the mesh with the vertices count, 2 or 4 bytes
+   */
+  static size_t getStoredIndexSize(size_t verticesCount);
 };
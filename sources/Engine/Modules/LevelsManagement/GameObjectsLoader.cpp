@@ -32,6 +32,7 @@ GameObjectsLoader::GameObjectsLoader(std::shared_ptr<GameWorld> gameWorld,
   registerComponentName<CameraComponent>("camera");
   registerComponentName<SkeletalAnimationComponent>("animation");
   registerComponentName<KinematicCharacterComponent>("kinematic_character");
+  registerComponentName<OccluderComponent>("occluder");
 
   registerGenericComponentLoader<TransformComponent>(
     [this](const pugi::xml_node& objectNode) {
@@ -72,6 +73,11 @@ GameObjectsLoader::GameObjectsLoader(std::shared_ptr<GameWorld> gameWorld,
     [this](const pugi::xml_node& objectNode) {
       return loadKinematicCharacterData(objectNode);
     });
+
+  registerGenericComponentLoader<OccluderComponent>(
+    [this](const pugi::xml_node& objectNode) {
+      return loadOccluderData(objectNode);
+    });
 }
 
 GameObjectsLoader::~GameObjectsLoader() = default;
@@ -342,6 +348,14 @@ std::unique_ptr<BaseGameObjectsComponentBinder> GameObjectsLoader::loadKinematic
   return std::make_unique<KinematicCharacterComponentBinder>(bindingParameters, m_resourceManager);
 }
 
+std::unique_ptr<BaseGameObjectsComponentBinder> GameObjectsLoader::loadOccluderData(const pugi::xml_node& data)
+{
+  OccluderComponentBindingParameters bindingParameters;
+  bindingParameters.meshResourceName = data.attribute("mesh").as_string();
+
+  return std::make_unique<OccluderComponentBinder>(bindingParameters, m_resourceManager);
+}
+
 GameObject GameObjectsLoader::buildGameObject(const std::string& spawnName,
   const std::optional<std::string>& objectName)
 {
@@ -13,6 +13,7 @@
 #include "Modules/Graphics/GraphicsSystem/TransformComponent.h"
 #include "Modules/Graphics/GraphicsSystem/MeshRendererComponent.h"
 #include "Modules/Graphics/GraphicsSystem/CameraComponent.h"
+#include "Modules/Graphics/GraphicsSystem/OccluderComponent.h"
 #include "Modules/Graphics/GraphicsSystem/EnvironmentRenderingSystem.h"
 #include "Modules/Graphics/GraphicsSystem/Animation/AnimationStatesMachine.h"
 #include "Modules/Graphics/GraphicsSystem/Animation/SkeletalAnimationComponent.h"
@@ -173,6 +174,7 @@ class GameObjectsLoader {
   std::unique_ptr<BaseGameObjectsComponentBinder> loadCameraData(const pugi::xml_node& data);
   std::unique_ptr<BaseGameObjectsComponentBinder> loadAnimationData(const pugi::xml_node& data);
   std::unique_ptr<BaseGameObjectsComponentBinder> loadKinematicCharacterData(const pugi::xml_node& data);
+  std::unique_ptr<BaseGameObjectsComponentBinder> loadOccluderData(const pugi::xml_node& data);
 
  private:
   std::shared_ptr<GameWorld> m_gameWorld;
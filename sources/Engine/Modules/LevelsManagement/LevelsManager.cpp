@@ -14,7 +14,8 @@ LevelsManager::LevelsManager(const std::shared_ptr<GameWorld>& gameWorld,
   const std::shared_ptr<ResourcesManager>& resourceManager)
   : m_gameWorld(gameWorld),
     m_resourceManager(resourceManager),
-    m_gameObjectsLoader(gameWorld, resourceManager)
+    m_gameObjectsLoader(gameWorld, resourceManager),
+    m_staticGeometryBatcher(gameWorld, resourceManager)
 {
 
 }
@@ -99,6 +100,14 @@ void LevelsManager::loadLevel(const std::string& name)
     }
   }
 
+  if (m_isStaticGeometryBatchingEnabled) {
+    for (GameObject batchObject : m_staticGeometryBatcher.batchObjects(sceneObjects, m_staticGeometryBatchingOptions)) {
+      batchObject.getComponent<TransformComponent>()->setLevelId(name);
+
+      sceneObjects.push_back(batchObject);
+    }
+  }
+
   m_gameWorld->emitEvent<LoadSceneCommandEvent>(LoadSceneCommandEvent{.sceneObjects=sceneObjects});
 
   m_isLevelLoaded = true;
@@ -140,6 +149,28 @@ void LevelsManager::loadSpawnObjectsList(const std::string& spawnListName)
   loadSpawnList(FileUtils::getSpawnListPath(spawnListName));
 }
 
+void LevelsManager::enableStaticGeometryBatching(bool isEnabled)
+{
+  m_isStaticGeometryBatchingEnabled = isEnabled;
+}
+
+bool LevelsManager::isStaticGeometryBatchingEnabled() const
+{
+  return m_isStaticGeometryBatchingEnabled;
+}
+
+void LevelsManager::setStaticGeometryBatchingOptions(const StaticGeometryBatchingOptions& options)
+{
+  SW_ASSERT(options.cellSize > 0.0f);
+
+  m_staticGeometryBatchingOptions = options;
+}
+
+const StaticGeometryBatchingOptions& LevelsManager::getStaticGeometryBatchingOptions() const
+{
+  return m_staticGeometryBatchingOptions;
+}
+
 bool LevelsManager::isLevelLoaded() const
 {
   return m_isLevelLoaded;
@@ -8,6 +8,8 @@
 
 #include "Utility/xml.h"
 
+#include "Modules/Graphics/GraphicsSystem/StaticGeometryBatcher.h"
+
 #include "GameObjectsLoader.h"
 
 class LevelsManager : public std::enable_shared_from_this<LevelsManager> {
@@ -35,6 +37,15 @@ class LevelsManager : public std::enable_shared_from_this<LevelsManager> {
 
   std::shared_ptr<GameWorld> getGameWorld() const;
 
+  /*!
+   * \brief Enables merging of the level static meshes into the batches by materials and spatial cells on loading
+   */
+  void enableStaticGeometryBatching(bool isEnabled);
+  [[nodiscard]] bool isStaticGeometryBatchingEnabled() const;
+
+  void setStaticGeometryBatchingOptions(const StaticGeometryBatchingOptions& options);
+  [[nodiscard]] const StaticGeometryBatchingOptions& getStaticGeometryBatchingOptions() const;
+
   [[nodiscard]] bool isLevelLoaded() const;
   [[nodiscard]] const std::string& getLoadedLevelName() const;
 
@@ -52,6 +63,10 @@ class LevelsManager : public std::enable_shared_from_this<LevelsManager> {
 
   GameObjectsLoader m_gameObjectsLoader;
 
+  StaticGeometryBatcher m_staticGeometryBatcher;
+  StaticGeometryBatchingOptions m_staticGeometryBatchingOptions;
+  bool m_isStaticGeometryBatchingEnabled = true;
+
   bool m_isLevelLoaded = false;
   std::string m_loadedLevelName;
 };
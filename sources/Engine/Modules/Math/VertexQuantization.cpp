@@ -0,0 +1,132 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "VertexQuantization.h"
+
+#include <limits>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <glm/gtc/packing.hpp>
+
+namespace {
+
+glm::vec2 signNotZero(const glm::vec2& value)
+{
+  return {(value.x >= 0.0f) ? 1.0f : -1.0f, (value.y >= 0.0f) ? 1.0f : -1.0f};
+}
+
+template<class T>
+T quantizeSnorm(float value)
+{
+  constexpr auto maxValue = static_cast<float>(std::numeric_limits<T>::max());
+
+  return static_cast<T>(std::round(glm::clamp(value, -1.0f, 1.0f) * maxValue));
+}
+
+template<class T>
+float dequantizeSnorm(T value)
+{
+  constexpr auto maxValue = static_cast<float>(std::numeric_limits<T>::max());
+
+  return glm::max(static_cast<float>(value) / maxValue, -1.0f);
+}
+
+}
+
+glm::u16vec3 VertexQuantization::quantizePosition(const glm::vec3& position,
+  const glm::vec3& boundsMin,
+  const glm::vec3& boundsMax)
+{
+  constexpr auto maxValue = static_cast<float>(std::numeric_limits<uint16_t>::max());
+
+  glm::u16vec3 quantizedPosition{};
+
+  for (glm::length_t axis = 0; axis < 3; axis++) {
+    float extent = boundsMax[axis] - boundsMin[axis];
+    float relativePosition = (extent > 0.0f) ? (position[axis] - boundsMin[axis]) / extent : 0.0f;
+
+    quantizedPosition[axis] = static_cast<uint16_t>(std::round(glm::clamp(relativePosition, 0.0f, 1.0f) * maxValue));
+  }
+
+  return quantizedPosition;
+}
+
+glm::vec3 VertexQuantization::dequantizePosition(const glm::u16vec3& position,
+  const glm::vec3& boundsMin,
+  const glm::vec3& boundsMax)
+{
+  constexpr auto maxValue = static_cast<float>(std::numeric_limits<uint16_t>::max());
+
+  return boundsMin + glm::vec3(position) / maxValue * (boundsMax - boundsMin);
+}
+
+glm::vec2 VertexQuantization::encodeOctahedral(const glm::vec3& direction)
+{
+  float manhattanLength = glm::abs(direction.x) + glm::abs(direction.y) + glm::abs(direction.z);
+
+  if (manhattanLength == 0.0f) {
+    return {0.0f, 0.0f};
+  }
+
+  glm::vec3 octahedronPoint = direction / manhattanLength;
+  glm::vec2 encodedDirection(octahedronPoint.x, octahedronPoint.y);
+
+  // The lower hemisphere is folded over the diagonals
+  if (octahedronPoint.z < 0.0f) {
+    encodedDirection = (1.0f - glm::abs(glm::vec2(encodedDirection.y, encodedDirection.x))) *
+      signNotZero(encodedDirection);
+  }
+
+  return encodedDirection;
+}
+
+glm::vec3 VertexQuantization::decodeOctahedral(const glm::vec2& encodedDirection)
+{
+  glm::vec3 direction(encodedDirection.x, encodedDirection.y,
+    1.0f - glm::abs(encodedDirection.x) - glm::abs(encodedDirection.y));
+
+  if (direction.z < 0.0f) {
+    glm::vec2 unfoldedDirection = (1.0f - glm::abs(glm::vec2(direction.y, direction.x))) *
+      signNotZero(glm::vec2(direction.x, direction.y));
+
+    direction.x = unfoldedDirection.x;
+    direction.y = unfoldedDirection.y;
+  }
+
+  return glm::normalize(direction);
+}
+
+glm::i8vec2 VertexQuantization::quantizeDirection8(const glm::vec3& direction)
+{
+  glm::vec2 encodedDirection = encodeOctahedral(direction);
+
+  return {quantizeSnorm<int8_t>(encodedDirection.x), quantizeSnorm<int8_t>(encodedDirection.y)};
+}
+
+glm::vec3 VertexQuantization::dequantizeDirection8(const glm::i8vec2& direction)
+{
+  return decodeOctahedral({dequantizeSnorm(direction.x), dequantizeSnorm(direction.y)});
+}
+
+glm::i16vec2 VertexQuantization::quantizeDirection16(const glm::vec3& direction)
+{
+  glm::vec2 encodedDirection = encodeOctahedral(direction);
+
+  return {quantizeSnorm<int16_t>(encodedDirection.x), quantizeSnorm<int16_t>(encodedDirection.y)};
+}
+
+glm::vec3 VertexQuantization::dequantizeDirection16(const glm::i16vec2& direction)
+{
+  return decodeOctahedral({dequantizeSnorm(direction.x), dequantizeSnorm(direction.y)});
+}
+
+glm::u16vec2 VertexQuantization::quantizeHalf(const glm::vec2& value)
+{
+  return {glm::packHalf1x16(value.x), glm::packHalf1x16(value.y)};
+}
+
+glm::vec2 VertexQuantization::dequantizeHalf(const glm::u16vec2& value)
+{
+  return {glm::unpackHalf1x16(value.x), glm::unpackHalf1x16(value.y)};
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/gtc/type_precision.hpp>
+
+/*!
+ * \brief Compact encodings of the vertex attributes
+ *
+ * Positions are stored as 16-bit unsigned normalized values relative to the bounds, directions are
+ * octahedral-mapped to two signed normalized values, texture coordinates are stored as half floats.
+ */
+class VertexQuantization {
+ public:
+  VertexQuantization() = delete;
+
+  [[nodiscard]] static glm::u16vec3 quantizePosition(const glm::vec3& position,
+    const glm::vec3& boundsMin,
+    const glm::vec3& boundsMax);
+  [[nodiscard]] static glm::vec3 dequantizePosition(const glm::u16vec3& position,
+    const glm::vec3& boundsMin,
+    const glm::vec3& boundsMax);
+
+  /*!
+   * \brief Maps the direction to the octahedron unfolded to the [-1, 1] square
+   */
+  [[nodiscard]] static glm::vec2 encodeOctahedral(const glm::vec3& direction);
+  [[nodiscard]] static glm::vec3 decodeOctahedral(const glm::vec2& encodedDirection);
+
+  [[nodiscard]] static glm::i8vec2 quantizeDirection8(const glm::vec3& direction);
+  [[nodiscard]] static glm::vec3 dequantizeDirection8(const glm::i8vec2& direction);
+
+  [[nodiscard]] static glm::i16vec2 quantizeDirection16(const glm::vec3& direction);
+  [[nodiscard]] static glm::vec3 dequantizeDirection16(const glm::i16vec2& direction);
+
+  [[nodiscard]] static glm::u16vec2 quantizeHalf(const glm::vec2& value);
+  [[nodiscard]] static glm::vec2 dequantizeHalf(const glm::u16vec2& value);
+};
@@ -21,4 +21,7 @@ class KinematicCharacterComponentBackend {
 
   virtual void enableSimulation(bool enable) = 0;
   [[nodiscard]] virtual bool isSimulationEnabled() const = 0;
+
+  virtual void enableCollisionEvents(bool enable) = 0;
+  [[nodiscard]] virtual bool isCollisionEventsEnabled() const = 0;
 };
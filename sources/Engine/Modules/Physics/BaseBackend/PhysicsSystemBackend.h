@@ -2,6 +2,8 @@
 
 #include "Modules/ECS/ECS.h"
 #include "Modules/Math/geometry.h"
+#include "Modules/Physics/PhysicsQueries.h"
+#include "Modules/Physics/PhysicsSimulationSettings.h"
 
 class PhysicsSystemBackend {
  public:
@@ -20,5 +22,27 @@ class PhysicsSystemBackend {
   virtual void render() = 0;
   virtual void update(float delta) = 0;
 
+  virtual void beforeRender() = 0;
+  virtual void afterRender() = 0;
+
+  /*!
+   * \brief Waits for the simulation running on the dedicated thread, its results are applied on the next update
+   */
+  virtual void synchronizeSimulation() = 0;
+
   virtual void setUpdateStepCallback(std::function<void(float)> callback) = 0;
+
+  virtual void setSimulationLodOrigins(const std::vector<glm::vec3>& origins) = 0;
+  [[nodiscard]] virtual PhysicsSimulationLodStatistics getSimulationLodStatistics() const = 0;
+
+  [[nodiscard]] virtual PhysicsQueryHit raycast(const PhysicsRaycastQuery& query) = 0;
+  virtual void raycast(std::span<const PhysicsRaycastQuery> queries, std::vector<PhysicsQueryHit>& hits) = 0;
+
+  [[nodiscard]] virtual PhysicsQueryHit sweep(const PhysicsSweepQuery& query) = 0;
+  virtual void sweep(std::span<const PhysicsSweepQuery> queries, std::vector<PhysicsQueryHit>& hits) = 0;
+
+  virtual void overlap(const PhysicsOverlapQuery& query, std::vector<GameObject>& result) = 0;
+  virtual void overlap(std::span<const PhysicsOverlapQuery> queries,
+    std::vector<GameObject>& result,
+    std::vector<size_t>& resultOffsets) = 0;
 };
@@ -25,4 +25,7 @@ class RigidBodyComponentBackend {
 
   virtual void enableSimulation(bool enable) = 0;
   [[nodiscard]] virtual bool isSimulationEnabled() const = 0;
+
+  virtual void enableCollisionEvents(bool enable) = 0;
+  [[nodiscard]] virtual bool isCollisionEventsEnabled() const = 0;
 };
@@ -4,17 +4,29 @@
 
 #include "BulletCollisionDispatcher.h"
 
-#include <utility>
-
 BulletCollisionDispatcher::BulletCollisionDispatcher(btCollisionConfiguration* collisionConfiguration,
-  std::weak_ptr<BulletPhysicsSystemBackend> physicsSystemBackend)
-    : btCollisionDispatcher(collisionConfiguration),
-    m_physicsSystemBackend(std::move(physicsSystemBackend))
+  BulletPhysicsSystemBackend* physicsSystemBackend,
+  bool isParallelDispatchEnabled)
+    : btCollisionDispatcherMt(collisionConfiguration),
+    m_physicsSystemBackend(physicsSystemBackend),
+    m_isParallelDispatchEnabled(isParallelDispatchEnabled)
 {
 
 }
 
+void BulletCollisionDispatcher::dispatchAllCollisionPairs(btOverlappingPairCache* pairCache,
+  const btDispatcherInfo& dispatchInfo,
+  btDispatcher* dispatcher)
+{
+  if (m_isParallelDispatchEnabled) {
+    btCollisionDispatcherMt::dispatchAllCollisionPairs(pairCache, dispatchInfo, dispatcher);
+  }
+  else {
+    btCollisionDispatcher::dispatchAllCollisionPairs(pairCache, dispatchInfo, dispatcher);
+  }
+}
+
 BulletPhysicsSystemBackend& BulletCollisionDispatcher::getPhysicsSystemBackend() const
 {
-  return *m_physicsSystemBackend.lock();
+  return *m_physicsSystemBackend;
 }
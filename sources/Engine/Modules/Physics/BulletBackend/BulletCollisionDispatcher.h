@@ -1,19 +1,32 @@
 #pragma once
 
-#include <memory>
 #include <btBulletCollisionCommon.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
 
 class BulletPhysicsSystemBackend;
 
-class BulletCollisionDispatcher : public btCollisionDispatcher {
+/*!
+ * \brief Collision dispatcher that processes the narrowphase pairs on the task scheduler threads
+ *
+ * The sequential dispatching is used for single-threaded worlds, as the global task scheduler
+ * could be changed by other worlds.
+ */
+class BulletCollisionDispatcher : public btCollisionDispatcherMt {
  public:
   BulletCollisionDispatcher(btCollisionConfiguration* collisionConfiguration,
-    std::weak_ptr<BulletPhysicsSystemBackend> physicsSystemBackend);
+    BulletPhysicsSystemBackend* physicsSystemBackend,
+    bool isParallelDispatchEnabled);
 
   ~BulletCollisionDispatcher() override = default;
 
+  void dispatchAllCollisionPairs(btOverlappingPairCache* pairCache,
+    const btDispatcherInfo& dispatchInfo,
+    btDispatcher* dispatcher) override;
+
   [[nodiscard]] BulletPhysicsSystemBackend& getPhysicsSystemBackend() const;
 
  private:
-  std::weak_ptr<BulletPhysicsSystemBackend> m_physicsSystemBackend;
-};
\ No newline at end of file
+  // The backend owns the dispatcher, the pointer is not locked as the near callback is called for every pair
+  BulletPhysicsSystemBackend* m_physicsSystemBackend;
+  bool m_isParallelDispatchEnabled = false;
+};
@@ -0,0 +1,292 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "BulletCollisionShapesCache.h"
+
+#include <mutex>
+#include <cstring>
+#include <BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h>
+
+#include "BulletCollisionShapes.h"
+#include "BulletUtils.h"
+
+struct BulletTriangleMeshData {
+  ~BulletTriangleMeshData()
+  {
+    shape.reset();
+
+    if (optimizedBvhBuffer != nullptr) {
+      btAlignedFree(optimizedBvhBuffer);
+    }
+  }
+
+  std::unique_ptr<btTriangleIndexVertexArray> meshInterface;
+  std::unique_ptr<BulletBVHTriangleMeshShape> shape;
+
+  // Deserialized BVH is located in the buffer, so it should live as long as the shape
+  void* optimizedBvhBuffer = nullptr;
+
+  size_t memorySize = 0;
+};
+
+namespace {
+
+struct SharedShapeKey {
+  const CollisionShape* shape;
+  glm::vec3 scale;
+
+  bool operator==(const SharedShapeKey& other) const
+  {
+    return shape == other.shape && scale == other.scale;
+  }
+};
+
+struct SharedShapeKeyHash {
+  size_t operator()(const SharedShapeKey& key) const
+  {
+    size_t hash = std::hash<const CollisionShape*>()(key.shape);
+
+    for (glm::length_t component = 0; component < 3; component++) {
+      hash ^= std::hash<float>()(key.scale[component]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+
+    return hash;
+  }
+};
+
+std::mutex g_cacheMutex;
+
+std::unordered_map<SharedShapeKey, std::weak_ptr<BulletSharedCollisionShape>, SharedShapeKeyHash> g_sharedShapes;
+std::unordered_map<const CollisionShapeTriangleMesh*, std::weak_ptr<BulletTriangleMeshData>> g_triangleMeshes;
+
+template<class Map, class Key, class Value>
+void storeCacheEntry(Map& map, const Key& key, const std::shared_ptr<Value>& value)
+{
+  constexpr size_t MIN_EXPIRED_ENTRIES_SWEEP_SIZE = 64;
+
+  // Expired entries are removed once the cache is grown twice, so the removal cost is amortized
+  static size_t sweepSize = MIN_EXPIRED_ENTRIES_SWEEP_SIZE;
+
+  map[key] = value;
+
+  if (map.size() >= sweepSize) {
+    std::erase_if(map, [](const auto& entry) {
+      return entry.second.expired();
+    });
+
+    sweepSize = std::max(MIN_EXPIRED_ENTRIES_SWEEP_SIZE, 2 * map.size());
+  }
+}
+
+std::unique_ptr<btTriangleIndexVertexArray> createMeshInterface(const CollisionShapeTriangleMesh& triangleMesh)
+{
+  // The arrays refer to the resource geometry without copying
+  const std::vector<glm::vec3>& vertices = triangleMesh.getVertices();
+  const std::vector<uint32_t>& indices = triangleMesh.getIndices();
+
+  static_assert(sizeof(btScalar) == sizeof(float) && sizeof(int) == sizeof(uint32_t));
+
+  return std::make_unique<btTriangleIndexVertexArray>(static_cast<int>(indices.size() / 3),
+    reinterpret_cast<int*>(const_cast<uint32_t*>(indices.data())),
+    static_cast<int>(3 * sizeof(uint32_t)),
+    static_cast<int>(vertices.size()),
+    reinterpret_cast<btScalar*>(const_cast<glm::vec3*>(vertices.data())),
+    static_cast<int>(sizeof(glm::vec3)));
+}
+
+}
+
+BulletSharedCollisionShape::~BulletSharedCollisionShape()
+{
+  // Scaled meshes wrappers should be destroyed before the shared meshes
+  m_ownedShapes.clear();
+  m_triangleMeshes.clear();
+}
+
+btCollisionShape* BulletSharedCollisionShape::getShape() const
+{
+  return m_shape;
+}
+
+const glm::vec3& BulletSharedCollisionShape::getScale() const
+{
+  return m_scale;
+}
+
+std::shared_ptr<BulletSharedCollisionShape> BulletCollisionShapesCache::acquireShape(const CollisionShape& shape,
+  const glm::vec3& scale)
+{
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+
+  SharedShapeKey key{.shape = &shape, .scale = scale};
+
+  auto shapeIt = g_sharedShapes.find(key);
+
+  if (shapeIt != g_sharedShapes.end()) {
+    if (auto sharedShape = shapeIt->second.lock()) {
+      return sharedShape;
+    }
+  }
+
+  auto sharedShape = std::make_shared<BulletSharedCollisionShape>();
+  sharedShape->m_scale = scale;
+  sharedShape->m_shape = createShape(shape.getShapeData(), *sharedShape);
+  sharedShape->m_shape->setLocalScaling(BulletUtils::glmVec3ToBt(scale));
+
+  storeCacheEntry(g_sharedShapes, key, sharedShape);
+
+  return sharedShape;
+}
+
+btCollisionShape* BulletCollisionShapesCache::createShape(const CollisionShapeData& shapeData,
+  BulletSharedCollisionShape& sharedShape)
+{
+  std::unique_ptr<btCollisionShape> shape;
+
+  if (const auto* sphereShape = std::get_if<CollisionShapeSphere>(&shapeData)) {
+    shape = std::make_unique<BulletSphereShape>(sphereShape->getRadius());
+  }
+  else if (const auto* boxShape = std::get_if<CollisionShapeBox>(&shapeData)) {
+    shape = std::make_unique<BulletBoxShape>(BulletUtils::glmVec3ToBt(boxShape->getHalfExtents()));
+  }
+  else if (const auto* capsuleShape = std::get_if<CollisionShapeCapsule>(&shapeData)) {
+    shape = std::make_unique<BulletCapsuleShape>(capsuleShape->getRadius(), capsuleShape->getHeight());
+  }
+  else if (const auto* triangleMeshShape = std::get_if<CollisionShapeTriangleMesh>(&shapeData)) {
+    std::shared_ptr<BulletTriangleMeshData> triangleMesh = acquireTriangleMesh(*triangleMeshShape);
+
+    // The mesh shape is always wrapped, so the scaling of the shared mesh is never changed
+    shape = std::make_unique<btScaledBvhTriangleMeshShape>(triangleMesh->shape.get(), btVector3(1.0f, 1.0f, 1.0f));
+    sharedShape.m_triangleMeshes.push_back(std::move(triangleMesh));
+  }
+  else if (const auto* compoundShape = std::get_if<CollisionShapeCompound>(&shapeData)) {
+    auto compound = std::make_unique<BulletCompoundShape>();
+
+    for (const auto& childShape : compoundShape->getChildren()) {
+      btTransform transform;
+      transform.setIdentity();
+
+      transform.setOrigin(BulletUtils::glmVec3ToBt(childShape.origin));
+
+      compound->addChildShape(transform, createShape(childShape.shape, sharedShape));
+    }
+
+    shape = std::move(compound);
+  }
+  else {
+    SW_ASSERT(false);
+  }
+
+  btCollisionShape* shapePtr = shape.get();
+  sharedShape.m_ownedShapes.push_back(std::move(shape));
+
+  return shapePtr;
+}
+
+std::shared_ptr<BulletTriangleMeshData> BulletCollisionShapesCache::acquireTriangleMesh(
+  const CollisionShapeTriangleMesh& triangleMesh)
+{
+  auto triangleMeshIt = g_triangleMeshes.find(&triangleMesh);
+
+  if (triangleMeshIt != g_triangleMeshes.end()) {
+    if (auto triangleMeshData = triangleMeshIt->second.lock()) {
+      return triangleMeshData;
+    }
+  }
+
+  auto triangleMeshData = std::make_shared<BulletTriangleMeshData>();
+  triangleMeshData->meshInterface = createMeshInterface(triangleMesh);
+
+  const std::vector<std::byte>& optimizedBvhData = triangleMesh.getOptimizedBvhData();
+  btOptimizedBvh* optimizedBvh = nullptr;
+
+  if (!optimizedBvhData.empty()) {
+    // The BVH is deserialized in place, so it requires an aligned writable copy of the data
+    triangleMeshData->optimizedBvhBuffer = btAlignedAlloc(optimizedBvhData.size(), 16);
+    std::memcpy(triangleMeshData->optimizedBvhBuffer, optimizedBvhData.data(), optimizedBvhData.size());
+
+    optimizedBvh = btOptimizedBvh::deSerializeInPlace(triangleMeshData->optimizedBvhBuffer,
+      static_cast<unsigned int>(optimizedBvhData.size()), false);
+
+    if (optimizedBvh == nullptr || !optimizedBvh->isQuantized()) {
+      spdlog::warn("Baked collision mesh BVH is incompatible with the physics backend, it will be rebuilt");
+
+      btAlignedFree(triangleMeshData->optimizedBvhBuffer);
+      triangleMeshData->optimizedBvhBuffer = nullptr;
+      optimizedBvh = nullptr;
+    }
+  }
+
+  if (optimizedBvh != nullptr) {
+    triangleMeshData->shape = std::make_unique<BulletBVHTriangleMeshShape>(triangleMeshData->meshInterface.get(),
+      true, false);
+    triangleMeshData->shape->setOptimizedBvh(optimizedBvh);
+    triangleMeshData->memorySize = optimizedBvhData.size();
+  }
+  else {
+    triangleMeshData->shape = std::make_unique<BulletBVHTriangleMeshShape>(triangleMeshData->meshInterface.get(),
+      true, true);
+    triangleMeshData->memorySize = triangleMeshData->shape->getOptimizedBvh()->calculateSerializeBufferSize();
+  }
+
+  triangleMeshData->memorySize += triangleMesh.getVertices().size() * sizeof(glm::vec3) +
+    triangleMesh.getIndices().size() * sizeof(uint32_t);
+
+  storeCacheEntry(g_triangleMeshes, &triangleMesh, triangleMeshData);
+
+  return triangleMeshData;
+}
+
+std::vector<std::byte> BulletCollisionShapesCache::bakeOptimizedBvh(const CollisionShapeTriangleMesh& triangleMesh)
+{
+  std::unique_ptr<btTriangleIndexVertexArray> meshInterface = createMeshInterface(triangleMesh);
+  BulletBVHTriangleMeshShape shape(meshInterface.get(), true, true);
+
+  btOptimizedBvh* optimizedBvh = shape.getOptimizedBvh();
+  unsigned int bufferSize = optimizedBvh->calculateSerializeBufferSize();
+
+  void* buffer = btAlignedAlloc(bufferSize, 16);
+  bool isSerialized = optimizedBvh->serializeInPlace(buffer, bufferSize, false);
+  SW_ASSERT(isSerialized);
+
+  std::vector<std::byte> data(bufferSize);
+  std::memcpy(data.data(), buffer, bufferSize);
+
+  btAlignedFree(buffer);
+
+  return data;
+}
+
+size_t BulletCollisionShapesCache::getSharedShapesCount()
+{
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+
+  return std::count_if(g_sharedShapes.begin(), g_sharedShapes.end(), [](const auto& entry) {
+    return !entry.second.expired();
+  });
+}
+
+size_t BulletCollisionShapesCache::getTriangleMeshesCount()
+{
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+
+  return std::count_if(g_triangleMeshes.begin(), g_triangleMeshes.end(), [](const auto& entry) {
+    return !entry.second.expired();
+  });
+}
+
+size_t BulletCollisionShapesCache::getTriangleMeshesMemorySize()
+{
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+
+  size_t memorySize = 0;
+
+  for (const auto& [triangleMeshPtr, triangleMeshData] : g_triangleMeshes) {
+    if (auto triangleMesh = triangleMeshData.lock()) {
+      memorySize += triangleMesh->memorySize;
+    }
+  }
+
+  return memorySize;
+}
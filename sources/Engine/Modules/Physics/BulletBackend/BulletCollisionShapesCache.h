@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <glm/vec3.hpp>
+#include <btBulletCollisionCommon.h>
+
+#include "Modules/Physics/CollisionShapes.h"
+
+struct BulletTriangleMeshData;
+
+/*!
+ * \brief Bullet shapes tree created for a collision shape resource, the tree is shared between physics objects
+ */
+class BulletSharedCollisionShape {
+ public:
+  BulletSharedCollisionShape() = default;
+  ~BulletSharedCollisionShape();
+
+  BulletSharedCollisionShape(const BulletSharedCollisionShape&) = delete;
+  BulletSharedCollisionShape& operator=(const BulletSharedCollisionShape&) = delete;
+
+  [[nodiscard]] btCollisionShape* getShape() const;
+  [[nodiscard]] const glm::vec3& getScale() const;
+
+ private:
+  btCollisionShape* m_shape = nullptr;
+  glm::vec3 m_scale = glm::vec3(1.0f);
+
+  // Root shape and compound children, triangle meshes shapes are owned by the meshes data
+  std::vector<std::unique_ptr<btCollisionShape>> m_ownedShapes;
+  std::vector<std::shared_ptr<BulletTriangleMeshData>> m_triangleMeshes;
+
+ private:
+  friend class BulletCollisionShapesCache;
+};
+
+/*!
+ * \brief Cache of Bullet shapes for collision shape resources
+ *
+ * Every resource is converted only once per scale, triangle meshes data and BVH are shared between
+ * all scales. The triangle meshes refer to the resource geometry, so the resource should not be
+ * changed while its shapes are used.
+ */
+class BulletCollisionShapesCache {
+ public:
+  BulletCollisionShapesCache() = delete;
+
+  [[nodiscard]] static std::shared_ptr<BulletSharedCollisionShape> acquireShape(const CollisionShape& shape,
+    const glm::vec3& scale = glm::vec3(1.0f));
+
+  /*!
+   * \brief Builds the quantized BVH of the mesh and serializes it to be stored with the mesh
+   */
+  [[nodiscard]] static std::vector<std::byte> bakeOptimizedBvh(const CollisionShapeTriangleMesh& triangleMesh);
+
+  [[nodiscard]] static size_t getSharedShapesCount();
+  [[nodiscard]] static size_t getTriangleMeshesCount();
+
+  /*!
+   * \brief Returns the size of the geometry and BVH of the alive triangle meshes in bytes
+   */
+  [[nodiscard]] static size_t getTriangleMeshesMemorySize();
+
+ private:
+  static btCollisionShape* createShape(const CollisionShapeData& shapeData, BulletSharedCollisionShape& sharedShape);
+  static std::shared_ptr<BulletTriangleMeshData> acquireTriangleMesh(const CollisionShapeTriangleMesh& triangleMesh);
+};
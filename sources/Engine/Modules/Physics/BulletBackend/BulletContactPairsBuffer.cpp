@@ -0,0 +1,49 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "BulletContactPairsBuffer.h"
+
+#include <algorithm>
+
+BulletContactPairsBuffer::BulletContactPairsBuffer(size_t capacity)
+  : m_pairs(capacity)
+{
+
+}
+
+void BulletContactPairsBuffer::push(GameObjectId firstObjectId, GameObjectId secondObjectId)
+{
+  BulletContactPair pair{
+    .firstObjectId = std::min(firstObjectId, secondObjectId),
+    .secondObjectId = std::max(firstObjectId, secondObjectId)
+  };
+
+  size_t pairIndex = m_pairsCount.fetch_add(1, std::memory_order_relaxed);
+
+  if (pairIndex < m_pairs.size()) {
+    m_pairs[pairIndex] = pair;
+  }
+  else {
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    m_overflowPairs.push_back(pair);
+  }
+}
+
+void BulletContactPairsBuffer::collect(std::vector<BulletContactPair>& pairs)
+{
+  size_t pairsCount = m_pairsCount.exchange(0, std::memory_order_acquire);
+
+  pairs.assign(m_pairs.begin(), m_pairs.begin() + static_cast<std::ptrdiff_t>(std::min(pairsCount, m_pairs.size())));
+
+  if (!m_overflowPairs.empty()) {
+    pairs.insert(pairs.end(), m_overflowPairs.begin(), m_overflowPairs.end());
+    m_overflowPairs.clear();
+
+    m_pairs.resize(2 * pairsCount);
+  }
+
+  // The same pair could be dispatched several times per step, e.g. by the characters controllers
+  std::sort(pairs.begin(), pairs.end());
+  pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+}
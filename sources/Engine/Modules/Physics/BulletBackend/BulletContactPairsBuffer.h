@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "Modules/ECS/ECS.h"
+
+struct BulletContactPair {
+  GameObjectId firstObjectId{};
+  GameObjectId secondObjectId{};
+
+  bool operator==(const BulletContactPair& other) const = default;
+
+  bool operator<(const BulletContactPair& other) const
+  {
+    return (firstObjectId < other.firstObjectId) ||
+      (firstObjectId == other.firstObjectId && secondObjectId < other.secondObjectId);
+  }
+};
+
+/*!
+ * \brief Buffer of touching objects pairs filled by the narrowphase
+ *
+ * Pairs are pushed from the collision dispatcher worker threads without locks into the preallocated
+ * storage. The pairs that do not fit are stored under the lock, and the storage is grown for the next step.
+ */
+class BulletContactPairsBuffer {
+ public:
+  explicit BulletContactPairsBuffer(size_t capacity = 256);
+
+  void push(GameObjectId firstObjectId, GameObjectId secondObjectId);
+
+  /*!
+   * \brief Moves the sorted unique pairs into the list and resets the buffer
+   *
+   * It should not be called concurrently with push.
+   */
+  void collect(std::vector<BulletContactPair>& pairs);
+
+ private:
+  std::vector<BulletContactPair> m_pairs;
+  std::atomic<size_t> m_pairsCount = 0;
+
+  std::mutex m_overflowMutex;
+  std::vector<BulletContactPair> m_overflowPairs;
+};
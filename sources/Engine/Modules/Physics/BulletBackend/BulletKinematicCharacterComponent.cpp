@@ -9,17 +9,19 @@
 
 #include "Modules/Math/MathUtils.h"
 #include "BulletUtils.h"
+#include "BulletCollisionShapesCache.h"
 
 BulletKinematicCharacterComponent::BulletKinematicCharacterComponent(ResourceHandle<CollisionShape> collisionShape)
-  : m_collisionShape(dynamic_cast<btConvexShape*>(BulletUtils::convertCollisionShapeToBulletShape(*collisionShape)))
+  : m_collisionShape(BulletCollisionShapesCache::acquireShape(*collisionShape))
 {
-  SW_ASSERT(m_collisionShape != nullptr && "Bullet kinematic character should have convex collision shape");
+  auto* convexShape = dynamic_cast<btConvexShape*>(m_collisionShape->getShape());
+  SW_ASSERT(convexShape != nullptr && "Bullet kinematic character should have convex collision shape");
 
   m_ghostObject = new btPairCachingGhostObject();
-  m_ghostObject->setCollisionShape(m_collisionShape);
+  m_ghostObject->setCollisionShape(convexShape);
   m_ghostObject->setCollisionFlags(btCollisionObject::CF_CHARACTER_OBJECT);
 
-  m_kinematicController = new BulletKinematicCharacterController(m_ghostObject, m_collisionShape);
+  m_kinematicController = new BulletKinematicCharacterController(m_ghostObject, convexShape);
 }
 
 BulletKinematicCharacterComponent::~BulletKinematicCharacterComponent()
@@ -51,14 +53,12 @@ bool BulletKinematicCharacterComponent::isOnGround() const
   return m_kinematicController->onGround();
 }
 
-void BulletKinematicCharacterComponent::setUpdateCallback(std::function<void(const btTransform&)> updateCallback)
+btTransform BulletKinematicCharacterComponent::getSimulatedTransform() const
 {
-  m_kinematicController->setUpdateCallback([updateCallback, this](const btTransform& transform) {
-    btTransform shiftedTransform = transform;
-    shiftedTransform.setOrigin(shiftedTransform.getOrigin() - this->m_originOffset);
+  btTransform transform = m_ghostObject->getWorldTransform();
+  transform.setOrigin(transform.getOrigin() - m_originOffset);
 
-    updateCallback(shiftedTransform);
-  });
+  return transform;
 }
 
 void BulletKinematicCharacterComponent::setOriginOffset(const glm::vec3& offset)
@@ -81,3 +81,13 @@ bool BulletKinematicCharacterComponent::isSimulationEnabled() const
   return m_ghostObject->getActivationState() != DISABLE_SIMULATION;
 }
 
+void BulletKinematicCharacterComponent::enableCollisionEvents(bool enable)
+{
+  BulletUtils::setCollisionObjectFlag(*m_ghostObject, BulletUtils::COLLISION_EVENTS_FLAG, enable);
+}
+
+bool BulletKinematicCharacterComponent::isCollisionEventsEnabled() const
+{
+  return BulletUtils::hasCollisionObjectFlag(*m_ghostObject, BulletUtils::COLLISION_EVENTS_FLAG);
+}
+
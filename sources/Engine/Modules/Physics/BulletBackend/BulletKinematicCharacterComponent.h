@@ -11,6 +11,7 @@
 #include "Modules/Physics/CollisionShapes.h"
 
 #include "BulletKinematicCharacterController.h"
+#include "BulletCollisionShapesCache.h"
 
 class BulletPhysicsSystemBackend;
 
@@ -26,7 +27,10 @@ class BulletKinematicCharacterComponent : public KinematicCharacterComponentBack
   void jump(const glm::vec3& jumpVector) override;
   [[nodiscard]] bool isOnGround() const override;
 
-  void setUpdateCallback(std::function<void(const btTransform&)> updateCallback);
+  /*!
+   * \brief Returns the character transform without the origin offset
+   */
+  [[nodiscard]] btTransform getSimulatedTransform() const;
 
   void setOriginOffset(const glm::vec3& offset) override;
   [[nodiscard]] glm::vec3 getOriginOffset() const override;
@@ -34,8 +38,11 @@ class BulletKinematicCharacterComponent : public KinematicCharacterComponentBack
   void enableSimulation(bool enable) override;
   [[nodiscard]] bool isSimulationEnabled() const override;
 
+  void enableCollisionEvents(bool enable) override;
+  [[nodiscard]] bool isCollisionEventsEnabled() const override;
+
  private:
-  btConvexShape* m_collisionShape = nullptr;
+  std::shared_ptr<BulletSharedCollisionShape> m_collisionShape;
   BulletKinematicCharacterController* m_kinematicController = nullptr;
   btPairCachingGhostObject* m_ghostObject = nullptr;
 
@@ -4,8 +4,6 @@
 
 #include "BulletKinematicCharacterController.h"
 
-#include <utility>
-
 BulletKinematicCharacterController::BulletKinematicCharacterController(btPairCachingGhostObject* ghostObject,
   btConvexShape* convexShape,
   btScalar stepHeight,
@@ -13,17 +11,3 @@ BulletKinematicCharacterController::BulletKinematicCharacterController(btPairCac
 {
 
 }
-
-void BulletKinematicCharacterController::updateAction(btCollisionWorld* collisionWorld, btScalar deltaTime)
-{
-  btKinematicCharacterController::updateAction(collisionWorld, deltaTime);
-
-  if (m_updateCallback != nullptr) {
-    m_updateCallback(m_ghostObject->getWorldTransform());
-  }
-}
-
-void BulletKinematicCharacterController::setUpdateCallback(std::function<void(const btTransform&)> updateCallback)
-{
-  m_updateCallback = std::move(updateCallback);
-}
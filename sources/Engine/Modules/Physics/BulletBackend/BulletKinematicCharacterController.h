@@ -1,6 +1,5 @@
 #pragma once
 
-#include <functional>
 #include <BulletDynamics/Character/btKinematicCharacterController.h>
 #include <BulletCollision/CollisionDispatch/btGhostObject.h>
 
@@ -12,11 +11,4 @@ class BulletKinematicCharacterController : public btKinematicCharacterController
     const btVector3& up = btVector3(0.0f, 1.0f, 0.0f));
 
   ~BulletKinematicCharacterController() override = default;
-
-  void updateAction(btCollisionWorld * collisionWorld, btScalar deltaTime) override;
-
-  void setUpdateCallback(std::function<void(const btTransform&)> updateCallback);
-
- private:
-  std::function<void(const btTransform&)> m_updateCallback;
 };
\ No newline at end of file
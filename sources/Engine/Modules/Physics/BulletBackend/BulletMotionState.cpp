@@ -4,7 +4,6 @@
 
 #include "BulletMotionState.h"
 
-#include <utility>
 #include "Modules/Graphics/GraphicsSystem/TransformComponent.h"
 
 BulletMotionState::BulletMotionState(const btTransform& transform)
@@ -22,14 +21,5 @@ void BulletMotionState::getWorldTransform(btTransform& worldTrans) const
 
 void BulletMotionState::setWorldTransform(const btTransform& worldTrans)
 {
-  if (m_updateCallback != nullptr) {
-    m_updateCallback(worldTrans);
-  }
-
   m_btTransform = worldTrans;
 }
-
-void BulletMotionState::setUpdateCallback(std::function<void(const btTransform&)> updateCallback)
-{
-  m_updateCallback = std::move(updateCallback);
-}
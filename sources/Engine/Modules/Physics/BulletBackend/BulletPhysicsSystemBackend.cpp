@@ -5,23 +5,223 @@
 #include "BulletPhysicsSystemBackend.h"
 
 #include <utility>
+#include <unordered_set>
+#include <limits>
+#include <cstdlib>
 #include <BulletCollision/CollisionDispatch/btGhostObject.h>
+#include <LinearMath/btThreads.h>
 
 #include "Modules/Graphics/GraphicsSystem/TransformComponent.h"
 #include "Modules/Graphics/GraphicsSystem/MeshRendererComponent.h"
+#include "Modules/Profiling/MemoryTracker.h"
 
 #include "BulletRigidBodyComponent.h"
 #include "BulletUtils.h"
 
-BulletPhysicsSystemBackend::BulletPhysicsSystemBackend(GameWorld* gameWorld)
-  : m_gameWorld(gameWorld)
+namespace {
+
+constexpr int QUERIES_BATCH_GRAIN_SIZE = 16;
+
+/*!
+ * \brief Extends Bullet query callbacks with the ignored object and offline objects filtering
+ */
+template<class BaseCallback>
+class BulletFilteredQueryCallback : public BaseCallback {
+ public:
+  template<class ...Args>
+  explicit BulletFilteredQueryCallback(const PhysicsQueryFilter& filter, Args&& ...args)
+    : BaseCallback(std::forward<Args>(args)...)
+  {
+    this->m_collisionFilterGroup = btBroadphaseProxy::AllFilter;
+    this->m_collisionFilterMask = static_cast<int>(filter.collisionMask);
+
+    if (filter.ignoredObject.isFormed()) {
+      m_ignoredUserPointer = reinterpret_cast<void*>(static_cast<uintptr_t>(filter.ignoredObject.getId()));
+      m_hasIgnoredObject = true;
+    }
+  }
+
+  [[nodiscard]] bool needsCollision(btBroadphaseProxy* proxy) const override
+  {
+    if (!BaseCallback::needsCollision(proxy)) {
+      return false;
+    }
+
+    const auto* collisionObject = static_cast<const btCollisionObject*>(proxy->m_clientObject);
+
+    if (collisionObject->getActivationState() == DISABLE_SIMULATION) {
+      return false;
+    }
+
+    return !(m_hasIgnoredObject && collisionObject->getUserPointer() == m_ignoredUserPointer);
+  }
+
+ private:
+  void* m_ignoredUserPointer = nullptr;
+  bool m_hasIgnoredObject = false;
+};
+
+class BulletOverlapQueryCallback : public btCollisionWorld::ContactResultCallback {
+ public:
+  BulletOverlapQueryCallback(const btCollisionObject* queryObject, std::vector<const btCollisionObject*>& result)
+    : m_queryObject(queryObject),
+      m_result(result)
+  {
+
+  }
+
+  btScalar addSingleResult(btManifoldPoint& contactPoint,
+    const btCollisionObjectWrapper* collisionObjectWrapper0, int partId0, int index0,
+    const btCollisionObjectWrapper* collisionObjectWrapper1, int partId1, int index1) override
+  {
+    ARG_UNUSED(partId0);
+    ARG_UNUSED(index0);
+    ARG_UNUSED(partId1);
+    ARG_UNUSED(index1);
+
+    if (contactPoint.getDistance() > 0.0f) {
+      return 0.0f;
+    }
+
+    const btCollisionObject* collisionObject = collisionObjectWrapper0->getCollisionObject();
+
+    if (collisionObject == m_queryObject) {
+      collisionObject = collisionObjectWrapper1->getCollisionObject();
+    }
+
+    // Compound and mesh shapes report multiple contacts per object
+    if (std::find(m_result.begin(), m_result.end(), collisionObject) == m_result.end()) {
+      m_result.push_back(collisionObject);
+    }
+
+    return 0.0f;
+  }
+
+ private:
+  const btCollisionObject* m_queryObject;
+  std::vector<const btCollisionObject*>& m_result;
+};
+
+template<class Function>
+class BulletParallelForBody : public btIParallelForBody {
+ public:
+  explicit BulletParallelForBody(Function function)
+    : m_function(std::move(function))
+  {
+
+  }
+
+  void forLoop(int beginIndex, int endIndex) const override
+  {
+    for (int index = beginIndex; index < endIndex; index++) {
+      m_function(static_cast<size_t>(index));
+    }
+  }
+
+ private:
+  Function m_function;
+};
+
+/*!
+ * \brief Runs the function for the indices range with Bullet task scheduler
+ *
+ * The iterations are actually parallel only if Bullet is built with BT_THREADSAFE
+ * and a multithreaded task scheduler is active, otherwise they are executed sequentially.
+ */
+template<class Function>
+void parallelFor(size_t count, Function function)
 {
+  if (count == 0) {
+    return;
+  }
+
+  BulletParallelForBody<Function> body(std::move(function));
+  btParallelFor(0, static_cast<int>(count), QUERIES_BATCH_GRAIN_SIZE, body);
+}
+
+/*!
+ * \brief Creates temporary Bullet shape for the query shape on the stack and passes it to the function
+ */
+template<class Function>
+void visitQueryShape(const PhysicsQueryShape& shape, Function function)
+{
+  if (const auto* sphereShape = std::get_if<CollisionShapeSphere>(&shape)) {
+    btSphereShape bulletShape(sphereShape->getRadius());
+    function(bulletShape);
+  }
+  else if (const auto* capsuleShape = std::get_if<CollisionShapeCapsule>(&shape)) {
+    btCapsuleShape bulletShape(capsuleShape->getRadius(), capsuleShape->getHeight());
+    function(bulletShape);
+  }
+  else if (const auto* boxShape = std::get_if<CollisionShapeBox>(&shape)) {
+    btBoxShape bulletShape(BulletUtils::glmVec3ToBt(boxShape->getHalfExtents()));
+    function(bulletShape);
+  }
+  else {
+    SW_ASSERT(false);
+  }
+}
+
+btTransform makeBulletTransform(const glm::vec3& origin, const glm::quat& orientation)
+{
+  btTransform transform;
+  transform.setIdentity();
+
+  transform.setOrigin(BulletUtils::glmVec3ToBt(origin));
+  transform.setRotation(BulletUtils::glmQuatToBt(orientation));
+
+  return transform;
+}
+
+// The size of the block is stored before the block, the header keeps the malloc alignment
+constexpr size_t BULLET_ALLOCATION_HEADER_SIZE = alignof(std::max_align_t);
+
+void* allocateBulletMemory(size_t size)
+{
+  auto* block = static_cast<std::byte*>(std::malloc(size + BULLET_ALLOCATION_HEADER_SIZE));
+
+  if (block == nullptr) {
+    return nullptr;
+  }
+
+  *reinterpret_cast<size_t*>(block) = size;
+  MemoryTracker::registerAllocation(MemoryCounters::Physics, size);
+
+  return block + BULLET_ALLOCATION_HEADER_SIZE;
+}
+
+void freeBulletMemory(void* pointer)
+{
+  if (pointer == nullptr) {
+    return;
+  }
+
+  std::byte* block = static_cast<std::byte*>(pointer) - BULLET_ALLOCATION_HEADER_SIZE;
+  MemoryTracker::registerDeallocation(MemoryCounters::Physics, *reinterpret_cast<size_t*>(block));
+
+  std::free(block);
+}
+
+}
+
+BulletPhysicsSystemBackend::BulletPhysicsSystemBackend(GameWorld* gameWorld,
+  const PhysicsSimulationSettings& simulationSettings)
+  : m_gameWorld(gameWorld),
+    m_simulationSettings(simulationSettings)
+{
+
+}
+
+void BulletPhysicsSystemBackend::installMemoryAllocator()
+{
+  btAlignedAllocSetCustom(&allocateBulletMemory, &freeBulletMemory);
 }
 
 BulletPhysicsSystemBackend::~BulletPhysicsSystemBackend()
 {
   SW_ASSERT(m_dynamicsWorld == nullptr &&
     m_constraintSolver == nullptr &&
+    m_constraintSolversPool == nullptr &&
     m_broadphaseInterface == nullptr &&
     m_collisionDispatcher == nullptr &&
     m_collisionConfiguration == nullptr);
@@ -41,22 +241,161 @@ void BulletPhysicsSystemBackend::setGravity(const glm::vec3& gravity)
 
 void BulletPhysicsSystemBackend::update(float delta)
 {
-  m_dynamicsWorld->stepSimulation(delta, 60);
+  if (m_simulationSettings.isDedicatedThreadEnabled) {
+    // The steps requested before the previous rendering are finished here, so the game sees their
+    // results with one update latency. They are interpolated with the time left after that update
+    synchronizeSimulation();
+
+    m_interpolationFactor = getAccumulatedStepFraction();
+    applySimulatedTransforms(m_interpolationFactor);
+
+    // Events are delivered after the transforms update, so the listeners see the simulated state
+    deliverCollisionEvents(m_collisionEvents);
+    m_collisionEvents.clear();
+
+    updateSimulationLod();
+
+    m_pendingStepsCount = std::min(m_pendingStepsCount + consumeSimulationTime(delta),
+      m_simulationSettings.maxStepsPerUpdate);
+  }
+  else {
+    updateSimulationLod();
+
+    size_t stepsCount = consumeSimulationTime(delta);
+
+    if (stepsCount > 0 && m_updateStepCallback) {
+      // Fixed updates should see the state of the last step rather than the interpolated one
+      applySimulatedTransforms(1.0f);
+    }
+
+    for (size_t stepIndex = 0; stepIndex < stepsCount; stepIndex++) {
+      if (m_updateStepCallback) {
+        SW_PROFILE_SCOPE("Physics fixed update");
+        m_updateStepCallback(m_simulationSettings.fixedTimeStep);
+      }
+
+      // The fixed update could move the objects, the bodies should be moved before the step
+      pushExternalTransformChanges();
+      performSimulationSteps(1);
+
+      // Fixed update of the next step and the collision listeners should see the updated transforms
+      applySimulatedTransforms(1.0f);
+
+      deliverCollisionEvents(m_collisionEvents);
+      m_collisionEvents.clear();
+    }
+
+    // Rendered transforms are interpolated between the two last steps by the time left in the accumulator
+    m_interpolationFactor = getAccumulatedStepFraction();
+    applySimulatedTransforms(m_interpolationFactor);
+  }
+}
+
+void BulletPhysicsSystemBackend::beforeRender()
+{
+  if (!m_simulationSettings.isDedicatedThreadEnabled || m_pendingStepsCount == 0) {
+    return;
+  }
+
+  // Fixed update callbacks touch the game state, so they are called on the main thread before
+  // the steps are simulated on the dedicated thread. All callbacks of the update are called in
+  // a row and see the state of the last finished step
+  if (m_updateStepCallback) {
+    applySimulatedTransforms(1.0f);
+
+    for (size_t stepIndex = 0; stepIndex < m_pendingStepsCount; stepIndex++) {
+      SW_PROFILE_SCOPE("Physics fixed update");
+      m_updateStepCallback(m_simulationSettings.fixedTimeStep);
+    }
+
+    applySimulatedTransforms(m_interpolationFactor);
+  }
+
+  requestSimulationSteps(m_pendingStepsCount);
+  m_pendingStepsCount = 0;
+}
+
+void BulletPhysicsSystemBackend::afterRender()
+{
+  synchronizeSimulation();
+}
+
+void BulletPhysicsSystemBackend::synchronizeSimulation()
+{
+  if (!m_simulationSettings.isDedicatedThreadEnabled) {
+    return;
+  }
+
+  SW_PROFILE_SCOPE("Physics wait for simulation");
+  waitForSimulation();
+}
+
+size_t BulletPhysicsSystemBackend::consumeSimulationTime(float delta)
+{
+  float fixedTimeStep = m_simulationSettings.fixedTimeStep;
+
+  m_simulationTimeAccumulator += delta;
+
+  // The small bias prevents losing a step because of rounding errors when delta is a multiple of the step
+  auto stepsCount = static_cast<size_t>(m_simulationTimeAccumulator / fixedTimeStep + 1e-3f);
+
+  if (stepsCount > m_simulationSettings.maxStepsPerUpdate) {
+    // The simulation can not catch up with the elapsed time, so the rest of it is dropped
+    stepsCount = m_simulationSettings.maxStepsPerUpdate;
+    m_simulationTimeAccumulator = 0.0f;
+  }
+  else {
+    m_simulationTimeAccumulator = std::max(0.0f,
+      m_simulationTimeAccumulator - static_cast<float>(stepsCount) * fixedTimeStep);
+  }
+
+  return stepsCount;
+}
+
+float BulletPhysicsSystemBackend::getAccumulatedStepFraction() const
+{
+  return std::min(m_simulationTimeAccumulator / m_simulationSettings.fixedTimeStep, 1.0f);
+}
+
+void BulletPhysicsSystemBackend::performSimulationSteps(size_t stepsCount)
+{
+  m_settledTransforms.clear();
+
+  for (size_t stepIndex = 0; stepIndex < stepsCount; stepIndex++) {
+    SW_PROFILE_SCOPE("Physics simulation step");
+
+    beginSimulationLodStep();
+
+    {
+      SW_PROFILE_SCOPE("Physics world step");
+
+      // Zero substeps count means a single step of exactly the specified duration
+      m_dynamicsWorld->stepSimulation(m_simulationSettings.fixedTimeStep, 0);
+    }
+
+    endSimulationLodStep();
+
+    {
+      SW_PROFILE_SCOPE("Physics contact pairs processing");
+      processContactPairs();
+    }
+
+    storeStepTransforms();
+
+    m_simulationStepIndex++;
+  }
 }
 
 void BulletPhysicsSystemBackend::configure()
 {
   m_collisionConfiguration = new btDefaultCollisionConfiguration();
-  m_collisionDispatcher = new BulletCollisionDispatcher(m_collisionConfiguration, shared_from_this());
   m_broadphaseInterface = new btDbvtBroadphase();
-  m_constraintSolver = new btSequentialImpulseConstraintSolver();
+
+  createDynamicsWorld();
 
   m_collisionDispatcher
     ->setNearCallback(reinterpret_cast<btNearCallback>(BulletPhysicsSystemBackend::physicsNearCallback));
 
-  m_dynamicsWorld = new btDiscreteDynamicsWorld(m_collisionDispatcher,
-    m_broadphaseInterface, m_constraintSolver, m_collisionConfiguration);
-
   m_broadphaseInterface->getOverlappingPairCache()->setInternalGhostPairCallback(new btGhostPairCallback());
 
   m_physicsDebugPainter = new BulletDebugPainter();
@@ -68,10 +407,618 @@ void BulletPhysicsSystemBackend::configure()
   m_gameWorld->subscribeEventsListener<GameObjectRemoveComponentEvent<KinematicCharacterComponent>>(this);
 
   m_gameWorld->subscribeEventsListener<GameObjectOnlineStatusChangeEvent>(this);
+
+  if (m_simulationSettings.isDedicatedThreadEnabled) {
+    startSimulationThread();
+  }
+}
+
+void BulletPhysicsSystemBackend::createDynamicsWorld()
+{
+  if (m_simulationSettings.isMultithreadingEnabled) {
+#if BT_THREADSAFE
+    setupTaskScheduler();
+
+    // The parallel dispatcher allocates per-thread manifolds lists, so it is created after the scheduler setup
+    m_collisionDispatcher = new BulletCollisionDispatcher(m_collisionConfiguration, this, true);
+
+    m_constraintSolversPool = new btConstraintSolverPoolMt(btGetTaskScheduler()->getNumThreads());
+    m_dynamicsWorld = new btDiscreteDynamicsWorldMt(m_collisionDispatcher,
+      m_broadphaseInterface, m_constraintSolversPool, nullptr, m_collisionConfiguration);
+
+    spdlog::info("Physics world is created with {} worker threads", btGetTaskScheduler()->getNumThreads());
+
+    return;
+#else
+    spdlog::warn("Physics multithreading is requested, but the physics backend is not built as thread-safe");
+#endif
+  }
+
+  m_collisionDispatcher = new BulletCollisionDispatcher(m_collisionConfiguration, this, false);
+
+  m_constraintSolver = new btSequentialImpulseConstraintSolver();
+  m_dynamicsWorld = new btDiscreteDynamicsWorld(m_collisionDispatcher,
+    m_broadphaseInterface, m_constraintSolver, m_collisionConfiguration);
+}
+
+void BulletPhysicsSystemBackend::setupTaskScheduler()
+{
+  // Bullet task scheduler is global, so the default one is created once and shared between physics worlds
+  static std::unique_ptr<btITaskScheduler> defaultTaskScheduler(btCreateDefaultTaskScheduler());
+
+  btITaskScheduler* taskScheduler = nullptr;
+
+  switch (m_simulationSettings.taskSchedulerType) {
+    case PhysicsTaskSchedulerType::Sequential:
+      taskScheduler = btGetSequentialTaskScheduler();
+      break;
+
+    case PhysicsTaskSchedulerType::Default:
+      taskScheduler = defaultTaskScheduler.get();
+      break;
+
+    case PhysicsTaskSchedulerType::OpenMP:
+      taskScheduler = btGetOpenMPTaskScheduler();
+      break;
+
+    case PhysicsTaskSchedulerType::TBB:
+      taskScheduler = btGetTBBTaskScheduler();
+      break;
+
+    case PhysicsTaskSchedulerType::PPL:
+      taskScheduler = btGetPPLTaskScheduler();
+      break;
+
+    default:
+      SW_ASSERT(false);
+  }
+
+  if (taskScheduler == nullptr) {
+    spdlog::warn("Requested physics task scheduler is not available, the default one is used");
+    taskScheduler = (defaultTaskScheduler != nullptr) ? defaultTaskScheduler.get() : btGetSequentialTaskScheduler();
+  }
+
+  size_t threadsCount = m_simulationSettings.workerThreadsCount;
+
+  if (threadsCount == 0) {
+    threadsCount = std::max(1U, std::thread::hardware_concurrency());
+  }
+
+  taskScheduler->setNumThreads(std::min(static_cast<int>(threadsCount), taskScheduler->getMaxNumThreads()));
+  btSetTaskScheduler(taskScheduler);
+}
+
+void BulletPhysicsSystemBackend::updateSimulationLod()
+{
+  const PhysicsSimulationLodSettings& lodSettings = m_simulationSettings.lod;
+
+  if (!lodSettings.isEnabled) {
+    return;
+  }
+
+  SW_ASSERT(lodSettings.reducedRateStepsInterval > 0 && lodSettings.reducedRateRadius <= lodSettings.farRadius);
+  SW_ASSERT(lodSettings.farLod == PhysicsSimulationLod::Sleeping ||
+    lodSettings.farLod == PhysicsSimulationLod::KinematicProxy);
+
+  m_simulationLodStatistics = PhysicsSimulationLodStatistics();
+
+  std::vector<glm::vec3> origins;
+  collectSimulationLodOrigins(origins);
+
+  wakeInteractingKinematicProxies();
+
+  // Sleeping and kinematic proxy LODs are alternatives of the same detail level
+  auto getDetailLevel = [](PhysicsSimulationLod lod) {
+    return std::min(static_cast<size_t>(lod), static_cast<size_t>(PhysicsSimulationLod::Sleeping));
+  };
+
+  auto classifyDistance = [&lodSettings, &origins](float distance) {
+    if (origins.empty() || distance < lodSettings.reducedRateRadius) {
+      return PhysicsSimulationLod::Full;
+    }
+
+    return (distance < lodSettings.farRadius) ? PhysicsSimulationLod::ReducedRate : lodSettings.farLod;
+  };
+
+  for (SimulationLodBody& body : m_simulationLodBodies) {
+    btRigidBody* rigidBody = body.rigidBody;
+
+    if (rigidBody->getActivationState() == DISABLE_SIMULATION) {
+      continue;
+    }
+
+    glm::vec3 position = BulletUtils::btVec3ToGlm(rigidBody->getWorldTransform().getOrigin());
+    float squaredDistance = std::numeric_limits<float>::max();
+
+    for (const glm::vec3& origin : origins) {
+      squaredDistance = std::min(squaredDistance, glm::distance2(position, origin));
+    }
+
+    float distance = std::sqrt(squaredDistance);
+
+    PhysicsSimulationLod targetLod = body.lod;
+    PhysicsSimulationLod coarserLod = classifyDistance(distance - lodSettings.hysteresisDistance);
+    PhysicsSimulationLod finerLod = classifyDistance(distance);
+
+    if (getDetailLevel(coarserLod) > getDetailLevel(body.lod)) {
+      targetLod = coarserLod;
+    }
+    else if (getDetailLevel(finerLod) < getDetailLevel(body.lod)) {
+      targetLod = finerLod;
+    }
+
+    if (body.lod == PhysicsSimulationLod::Sleeping && rigidBody->isActive()) {
+      // Bullet wakes sleeping bodies touched by active ones
+      body.isWokenByInteraction = true;
+    }
+
+    if (getDetailLevel(targetLod) < getDetailLevel(lodSettings.farLod)) {
+      body.isWokenByInteraction = false;
+    }
+    else if (body.isWokenByInteraction) {
+      if (rigidBody->isActive()) {
+        targetLod = PhysicsSimulationLod::ReducedRate;
+      }
+      else {
+        body.isWokenByInteraction = false;
+      }
+    }
+
+    if (targetLod != body.lod) {
+      setBodySimulationLod(body, targetLod);
+    }
+
+    auto lodIndex = static_cast<size_t>(body.lod);
+    m_simulationLodStatistics.bodiesCount[lodIndex]++;
+
+    if (rigidBody->isActive()) {
+      m_simulationLodStatistics.activeBodiesCount[lodIndex]++;
+    }
+  }
+}
+
+void BulletPhysicsSystemBackend::setBodySimulationLod(SimulationLodBody& body, PhysicsSimulationLod lod)
+{
+  constexpr float REDUCED_RATE_PHASE_CELL_SIZE = 10.0f;
+
+  if (body.lod == lod) {
+    return;
+  }
+
+  btRigidBody* rigidBody = body.rigidBody;
+
+  if (body.lod == PhysicsSimulationLod::KinematicProxy) {
+    // The body should be re-added to the world to restore its broadphase group and simulation islands
+    m_dynamicsWorld->removeRigidBody(rigidBody);
+
+    rigidBody->setCollisionFlags(rigidBody->getCollisionFlags() & ~btCollisionObject::CF_KINEMATIC_OBJECT);
+    rigidBody->setMassProps(body.mass, body.localInertia);
+    rigidBody->updateInertiaTensor();
+
+    m_dynamicsWorld->addRigidBody(rigidBody);
+  }
+
+  switch (lod) {
+    case PhysicsSimulationLod::Full:
+    case PhysicsSimulationLod::ReducedRate:
+      rigidBody->activate(true);
+      break;
+
+    case PhysicsSimulationLod::Sleeping:
+      rigidBody->setLinearVelocity(btVector3(0.0f, 0.0f, 0.0f));
+      rigidBody->setAngularVelocity(btVector3(0.0f, 0.0f, 0.0f));
+      rigidBody->setActivationState(ISLAND_SLEEPING);
+      break;
+
+    case PhysicsSimulationLod::KinematicProxy:
+      body.mass = rigidBody->getMass();
+      body.localInertia = rigidBody->getLocalInertia();
+
+      m_dynamicsWorld->removeRigidBody(rigidBody);
+
+      rigidBody->setLinearVelocity(btVector3(0.0f, 0.0f, 0.0f));
+      rigidBody->setAngularVelocity(btVector3(0.0f, 0.0f, 0.0f));
+      rigidBody->setMassProps(0.0f, btVector3(0.0f, 0.0f, 0.0f));
+      rigidBody->setCollisionFlags(rigidBody->getCollisionFlags() | btCollisionObject::CF_KINEMATIC_OBJECT);
+
+      m_dynamicsWorld->addRigidBody(rigidBody);
+      rigidBody->setActivationState(ISLAND_SLEEPING);
+      break;
+
+    default:
+      SW_ASSERT(false);
+      break;
+  }
+
+  if (lod == PhysicsSimulationLod::ReducedRate) {
+    // Neighbour bodies likely share the phase, so they are frozen and simulated at the same steps
+    glm::ivec3 cell(glm::floor(BulletUtils::btVec3ToGlm(rigidBody->getWorldTransform().getOrigin()) /
+      REDUCED_RATE_PHASE_CELL_SIZE));
+
+    uint32_t cellHash = (static_cast<uint32_t>(cell.x) * 73856093U) ^
+      (static_cast<uint32_t>(cell.y) * 19349663U) ^ (static_cast<uint32_t>(cell.z) * 83492791U);
+
+    body.reducedRatePhase = cellHash % m_simulationSettings.lod.reducedRateStepsInterval;
+  }
+
+  body.lod = lod;
+}
+
+void BulletPhysicsSystemBackend::wakeInteractingKinematicProxies()
+{
+  bool hasKinematicProxies = std::any_of(m_simulationLodBodies.begin(), m_simulationLodBodies.end(),
+    [](const SimulationLodBody& body) {
+      return body.lod == PhysicsSimulationLod::KinematicProxy;
+    });
+
+  if (!hasKinematicProxies) {
+    return;
+  }
+
+  // Proxies are static for Bullet, so the contacts with active bodies are checked manually
+  std::unordered_set<const btCollisionObject*> touchedProxies;
+
+  for (int manifoldIndex = 0; manifoldIndex < m_collisionDispatcher->getNumManifolds(); manifoldIndex++) {
+    const btPersistentManifold* manifold = m_collisionDispatcher->getManifoldByIndexInternal(manifoldIndex);
+
+    if (manifold->getNumContacts() == 0) {
+      continue;
+    }
+
+    const btCollisionObject* firstObject = manifold->getBody0();
+    const btCollisionObject* secondObject = manifold->getBody1();
+
+    if (firstObject->isKinematicObject() && secondObject->isActive() && !secondObject->isStaticOrKinematicObject()) {
+      touchedProxies.insert(firstObject);
+    }
+    else if (secondObject->isKinematicObject() && firstObject->isActive() &&
+      !firstObject->isStaticOrKinematicObject()) {
+      touchedProxies.insert(secondObject);
+    }
+  }
+
+  for (SimulationLodBody& body : m_simulationLodBodies) {
+    if (body.lod == PhysicsSimulationLod::KinematicProxy && touchedProxies.contains(body.rigidBody)) {
+      setBodySimulationLod(body, PhysicsSimulationLod::ReducedRate);
+      body.isWokenByInteraction = true;
+    }
+  }
+}
+
+void BulletPhysicsSystemBackend::collectSimulationLodOrigins(std::vector<glm::vec3>& origins) const
+{
+  origins = m_simulationLodOrigins;
+
+  for (const auto&[gameObjectId, kinematicCharacter] : m_kinematicCharacters) {
+    if (kinematicCharacter->isSimulationEnabled()) {
+      origins.push_back(BulletUtils::btVec3ToGlm(kinematicCharacter->getSimulatedTransform().getOrigin()));
+    }
+  }
+}
+
+void BulletPhysicsSystemBackend::beginSimulationLodStep()
+{
+  m_reducedRateStepStates.clear();
+
+  if (!m_simulationSettings.lod.isEnabled) {
+    return;
+  }
+
+  size_t stepsInterval = m_simulationSettings.lod.reducedRateStepsInterval;
+  auto timeScale = static_cast<btScalar>(stepsInterval);
+
+  for (const SimulationLodBody& body : m_simulationLodBodies) {
+    btRigidBody* rigidBody = body.rigidBody;
+
+    // Sleeping bodies are not simulated anyway
+    if (body.lod != PhysicsSimulationLod::ReducedRate || !rigidBody->isActive()) {
+      continue;
+    }
+
+    ReducedRateBodyStepState stepState{
+      .rigidBody = rigidBody,
+      .isSimulatedStep = (m_simulationStepIndex + body.reducedRatePhase) % stepsInterval == 0,
+      .linearVelocity = rigidBody->getLinearVelocity(),
+      .angularVelocity = rigidBody->getAngularVelocity(),
+      .gravity = rigidBody->getGravity(),
+      .activationState = rigidBody->getActivationState(),
+      .deactivationTime = rigidBody->getDeactivationTime()
+    };
+
+    if (stepState.isSimulatedStep) {
+      // The single step should cover the whole interval, so velocities are scaled by the interval
+      // length and the gravity acceleration is scaled twice to get the same velocity change
+      rigidBody->setLinearVelocity(stepState.linearVelocity * timeScale);
+      rigidBody->setAngularVelocity(stepState.angularVelocity * timeScale);
+      rigidBody->setGravity(stepState.gravity * timeScale * timeScale);
+    }
+    else {
+      // The frozen body is still woken by Bullet if an active body touches it
+      rigidBody->setActivationState(ISLAND_SLEEPING);
+    }
+
+    m_reducedRateStepStates.push_back(stepState);
+  }
+}
+
+void BulletPhysicsSystemBackend::endSimulationLodStep()
+{
+  auto timeScale = static_cast<btScalar>(m_simulationSettings.lod.reducedRateStepsInterval);
+
+  for (const ReducedRateBodyStepState& stepState : m_reducedRateStepStates) {
+    btRigidBody* rigidBody = stepState.rigidBody;
+
+    if (stepState.isSimulatedStep) {
+      rigidBody->setLinearVelocity(rigidBody->getLinearVelocity() / timeScale);
+      rigidBody->setAngularVelocity(rigidBody->getAngularVelocity() / timeScale);
+      rigidBody->setGravity(stepState.gravity);
+    }
+    else if (rigidBody->getActivationState() == ISLAND_SLEEPING) {
+      // Bullet resets velocities of sleeping bodies, so the state before the step is restored
+      rigidBody->setLinearVelocity(stepState.linearVelocity);
+      rigidBody->setAngularVelocity(stepState.angularVelocity);
+      rigidBody->forceActivationState(stepState.activationState);
+      rigidBody->setDeactivationTime(stepState.deactivationTime);
+    }
+  }
+
+  m_reducedRateStepStates.clear();
+}
+
+void BulletPhysicsSystemBackend::startSimulationThread()
+{
+  SW_ASSERT(!m_simulationThread.joinable());
+
+  m_isSimulationThreadStopRequested = false;
+  m_requestedStepsCount = 0;
+
+  m_simulationThread = std::thread(&BulletPhysicsSystemBackend::simulationThreadLoop, this);
+}
+
+void BulletPhysicsSystemBackend::stopSimulationThread()
+{
+  if (!m_simulationThread.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_simulationMutex);
+    m_isSimulationThreadStopRequested = true;
+  }
+
+  m_simulationCondition.notify_all();
+  m_simulationThread.join();
+}
+
+void BulletPhysicsSystemBackend::simulationThreadLoop()
+{
+  std::unique_lock<std::mutex> lock(m_simulationMutex);
+
+  while (true) {
+    m_simulationCondition.wait(lock, [this] {
+      return m_requestedStepsCount > 0 || m_isSimulationThreadStopRequested;
+    });
+
+    if (m_isSimulationThreadStopRequested) {
+      return;
+    }
+
+    size_t stepsCount = m_requestedStepsCount;
+
+    lock.unlock();
+
+    performSimulationSteps(stepsCount);
+
+    lock.lock();
+
+    m_requestedStepsCount = 0;
+    m_simulationCondition.notify_all();
+  }
+}
+
+void BulletPhysicsSystemBackend::requestSimulationSteps(size_t stepsCount)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_simulationMutex);
+
+    SW_ASSERT(m_requestedStepsCount == 0);
+    m_requestedStepsCount = stepsCount;
+  }
+
+  m_simulationCondition.notify_all();
+}
+
+void BulletPhysicsSystemBackend::waitForSimulation()
+{
+  std::unique_lock<std::mutex> lock(m_simulationMutex);
+
+  m_simulationCondition.wait(lock, [this] {
+    return m_requestedStepsCount == 0;
+  });
+}
+
+void BulletPhysicsSystemBackend::storeStepTransforms()
+{
+  std::swap(m_previousStepTransforms, m_lastStepTransforms);
+  m_lastStepTransforms.clear();
+
+  auto getRigidBodyTransform = [](const btRigidBody* rigidBody) {
+    const btTransform& transform = rigidBody->getWorldTransform();
+
+    return SimulatedObjectTransform{
+      .gameObjectId = static_cast<GameObjectId>(reinterpret_cast<uintptr_t>(rigidBody->getUserPointer())),
+      .rigidBody = rigidBody,
+      .position = BulletUtils::btVec3ToGlm(transform.getOrigin()),
+      .orientation = BulletUtils::btQuatToGlm(transform.getRotation())
+    };
+  };
+
+  const auto& rigidBodies = m_dynamicsWorld->getNonStaticRigidBodies();
+
+  for (int rigidBodyIndex = 0; rigidBodyIndex < rigidBodies.size(); rigidBodyIndex++) {
+    const btRigidBody* rigidBody = rigidBodies[rigidBodyIndex];
+
+    // Sleeping and disabled bodies are not moved by the simulation
+    if (rigidBody->isActive()) {
+      m_lastStepTransforms.push_back(getRigidBodyTransform(rigidBody));
+    }
+  }
+
+  // The bodies that stopped moving at the step are not interpolated further, their final transforms
+  // are kept separately, so they are not lost if several steps are simulated in a row
+  for (const SimulatedObjectTransform& previousTransform : m_previousStepTransforms) {
+    if (previousTransform.rigidBody == nullptr || !previousTransform.isActive ||
+      previousTransform.rigidBody->isActive()) {
+      continue;
+    }
+
+    SimulatedObjectTransform settledTransform = getRigidBodyTransform(previousTransform.rigidBody);
+    settledTransform.isActive = false;
+
+    m_lastStepTransforms.push_back(settledTransform);
+    m_settledTransforms.push_back(settledTransform);
+  }
+
+  for (const auto&[gameObjectId, kinematicCharacter] : m_kinematicCharacters) {
+    if (!kinematicCharacter->isSimulationEnabled()) {
+      continue;
+    }
+
+    btTransform transform = kinematicCharacter->getSimulatedTransform();
+
+    m_lastStepTransforms.push_back(SimulatedObjectTransform{
+      .gameObjectId = gameObjectId,
+      .position = BulletUtils::btVec3ToGlm(transform.getOrigin()),
+      .orientation = BulletUtils::btQuatToGlm(transform.getRotation())
+    });
+  }
+
+  // Game objects storage is indexed by IDs, so the ordered writes are more cache friendly.
+  // The order also allows to match transforms of the two steps in one pass
+  std::sort(m_lastStepTransforms.begin(), m_lastStepTransforms.end(),
+    [](const SimulatedObjectTransform& lhs, const SimulatedObjectTransform& rhs) {
+      return lhs.gameObjectId < rhs.gameObjectId;
+    });
+}
+
+void BulletPhysicsSystemBackend::applySimulatedTransforms(float interpolationFactor)
+{
+  pushExternalTransformChanges();
+
+  m_writtenTransformComponents.clear();
+
+  for (const SimulatedObjectTransform& settledTransform : m_settledTransforms) {
+    writeSimulatedTransform(settledTransform.gameObjectId, settledTransform.position, settledTransform.orientation);
+  }
+
+  auto previousTransformIt = m_previousStepTransforms.begin();
+
+  for (const SimulatedObjectTransform& lastTransform : m_lastStepTransforms) {
+    while (previousTransformIt != m_previousStepTransforms.end() &&
+      previousTransformIt->gameObjectId < lastTransform.gameObjectId) {
+      writeSimulatedTransform(previousTransformIt->gameObjectId,
+        previousTransformIt->position, previousTransformIt->orientation);
+
+      ++previousTransformIt;
+    }
+
+    if (previousTransformIt != m_previousStepTransforms.end() &&
+      previousTransformIt->gameObjectId == lastTransform.gameObjectId) {
+      writeSimulatedTransform(lastTransform.gameObjectId,
+        glm::mix(previousTransformIt->position, lastTransform.position, interpolationFactor),
+        glm::slerp(previousTransformIt->orientation, lastTransform.orientation, interpolationFactor));
+
+      ++previousTransformIt;
+    }
+    else {
+      // The body has just started moving, so there is nothing to interpolate from
+      writeSimulatedTransform(lastTransform.gameObjectId, lastTransform.position, lastTransform.orientation);
+    }
+  }
+
+  for (; previousTransformIt != m_previousStepTransforms.end(); ++previousTransformIt) {
+    writeSimulatedTransform(previousTransformIt->gameObjectId,
+      previousTransformIt->position, previousTransformIt->orientation);
+  }
+
+  // Bounds of the moved objects are updated in one pass after all transforms are written
+  for (TransformComponent* transformComponent : m_writtenTransformComponents) {
+    const Transform& transform = transformComponent->getTransform();
+    transformComponent->updateBounds(transform.getPosition(), transform.getOrientation());
+  }
+}
+
+void BulletPhysicsSystemBackend::pushExternalTransformChanges()
+{
+  for (auto writtenTransformIt = m_writtenTransforms.begin(); writtenTransformIt != m_writtenTransforms.end();) {
+    GameObjectId gameObjectId = writtenTransformIt->first;
+    const WrittenObjectTransform& writtenTransform = writtenTransformIt->second;
+    auto* transformComponent = m_gameWorld->findComponent<TransformComponent>(gameObjectId);
+
+    if (transformComponent == nullptr) {
+      writtenTransformIt = m_writtenTransforms.erase(writtenTransformIt);
+      continue;
+    }
+
+    const Transform& transform = transformComponent->getTransform();
+
+    if (transform.getPosition() == writtenTransform.position &&
+      transform.getOrientation() == writtenTransform.orientation) {
+      ++writtenTransformIt;
+      continue;
+    }
+
+    if (auto* rigidBodyComponent = m_gameWorld->findComponent<RigidBodyComponent>(gameObjectId)) {
+      rigidBodyComponent->setTransform(transform);
+    }
+    else if (auto* kinematicCharacterComponent =
+      m_gameWorld->findComponent<KinematicCharacterComponent>(gameObjectId)) {
+      kinematicCharacterComponent->setTransform(transform);
+    }
+
+    // The interpolated transforms of the old location are not valid anymore
+    writtenTransformIt = m_writtenTransforms.erase(writtenTransformIt);
+    eraseSimulatedTransforms(gameObjectId);
+  }
+}
+
+void BulletPhysicsSystemBackend::eraseSimulatedTransforms(GameObjectId gameObjectId)
+{
+  auto isObjectTransform = [gameObjectId](const SimulatedObjectTransform& transform) {
+    return transform.gameObjectId == gameObjectId;
+  };
+
+  std::erase_if(m_previousStepTransforms, isObjectTransform);
+  std::erase_if(m_lastStepTransforms, isObjectTransform);
+  std::erase_if(m_settledTransforms, isObjectTransform);
+
+  m_writtenTransforms.erase(gameObjectId);
+}
+
+void BulletPhysicsSystemBackend::writeSimulatedTransform(GameObjectId gameObjectId,
+  const glm::vec3& position,
+  const glm::quat& orientation)
+{
+  auto* transformComponent = m_gameWorld->findComponent<TransformComponent>(gameObjectId);
+
+  // The object could be removed after the simulation step
+  if (transformComponent == nullptr) {
+    return;
+  }
+
+  Transform& transform = transformComponent->getTransform();
+
+  transform.setOrientation(orientation);
+  transform.setPosition(position);
+
+  m_writtenTransforms[gameObjectId] = WrittenObjectTransform{.position = position, .orientation = orientation};
+  m_writtenTransformComponents.push_back(transformComponent);
 }
 
 void BulletPhysicsSystemBackend::unconfigure()
 {
+  stopSimulationThread();
+
   m_gameWorld->unsubscribeEventsListener<GameObjectRemoveComponentEvent<KinematicCharacterComponent>>(this);
   m_gameWorld->unsubscribeEventsListener<GameObjectAddComponentEvent<KinematicCharacterComponent>>(this);
 
@@ -89,6 +1036,9 @@ void BulletPhysicsSystemBackend::unconfigure()
   delete m_constraintSolver;
   m_constraintSolver = nullptr;
 
+  delete m_constraintSolversPool;
+  m_constraintSolversPool = nullptr;
+
   delete m_broadphaseInterface;
   m_broadphaseInterface = nullptr;
 
@@ -97,6 +1047,19 @@ void BulletPhysicsSystemBackend::unconfigure()
 
   delete m_collisionConfiguration;
   m_collisionConfiguration = nullptr;
+
+  m_kinematicCharacters.clear();
+  m_simulationLodBodies.clear();
+  m_reducedRateStepStates.clear();
+
+  m_touchingContactPairs.clear();
+  m_collisionEvents.clear();
+
+  m_previousStepTransforms.clear();
+  m_lastStepTransforms.clear();
+  m_settledTransforms.clear();
+  m_writtenTransformComponents.clear();
+  m_writtenTransforms.clear();
 }
 
 EventProcessStatus BulletPhysicsSystemBackend::receiveEvent(
@@ -110,6 +1073,13 @@ EventProcessStatus BulletPhysicsSystemBackend::receiveEvent(
     dynamic_cast<const BulletRigidBodyComponent*>(&event.component->getBackend());
 
   m_dynamicsWorld->removeRigidBody(bulletRigidBodyComponent->m_rigidBodyInstance);
+
+  std::erase_if(m_simulationLodBodies, [bulletRigidBodyComponent](const SimulationLodBody& body) {
+    return body.rigidBody == bulletRigidBodyComponent->m_rigidBodyInstance;
+  });
+
+  eraseSimulatedTransforms(event.gameObject.getId());
+
   event.component->resetBackend();
 
   return EventProcessStatus::Processed;
@@ -134,17 +1104,12 @@ EventProcessStatus BulletPhysicsSystemBackend::receiveEvent(
   btRigidBody* rigidBodyInstance = bulletRigidBodyComponent->m_rigidBodyInstance;
   rigidBodyInstance->setUserPointer(reinterpret_cast<void*>(static_cast<uintptr_t>(gameObjectId)));
 
-  auto* motionState = dynamic_cast<BulletMotionState*>(rigidBodyInstance->getMotionState());
-
-  motionState->setUpdateCallback([gameObjectId, this](const btTransform& transform) {
-    auto obj = this->m_gameWorld->findGameObject(gameObjectId);
-    SW_ASSERT(obj.isAlive());
-
-    BulletPhysicsSystemBackend::synchronizeTransforms(obj, transform);
-  });
-
   m_dynamicsWorld->addRigidBody(bulletRigidBodyComponent->m_rigidBodyInstance);
 
+  if (!rigidBodyInstance->isStaticOrKinematicObject()) {
+    m_simulationLodBodies.push_back({.gameObjectId = gameObjectId, .rigidBody = rigidBodyInstance});
+  }
+
   // Only online objects should be affected by physics simulation
   if (!event.gameObject.getComponent<TransformComponent>()->isOnline()) {
     rigidBodyComponent->enableSimulation(false);
@@ -166,6 +1131,12 @@ EventProcessStatus BulletPhysicsSystemBackend::receiveEvent(
   m_dynamicsWorld->removeCollisionObject(bulletKinematicComponent->m_ghostObject);
   m_dynamicsWorld->removeAction(bulletKinematicComponent->m_kinematicController);
 
+  std::erase_if(m_kinematicCharacters, [bulletKinematicComponent](const auto& kinematicCharacter) {
+    return kinematicCharacter.second == bulletKinematicComponent;
+  });
+
+  eraseSimulatedTransforms(event.gameObject.getId());
+
   kinematicCharacterComponent->resetBackend();
 
   return EventProcessStatus::Processed;
@@ -194,10 +1165,7 @@ EventProcessStatus BulletPhysicsSystemBackend::receiveEvent(
 
   kinematicController->setGravity(m_dynamicsWorld->getGravity());
 
-  bulletKinematicComponent->setUpdateCallback([gameObjectId, this](const btTransform& transform) {
-    GameObject object = this->m_gameWorld->findGameObject(gameObjectId);
-    BulletPhysicsSystemBackend::synchronizeTransforms(object, transform);
-  });
+  m_kinematicCharacters.emplace_back(gameObjectId, bulletKinematicComponent);
 
   m_dynamicsWorld->addCollisionObject(ghostObject, btBroadphaseProxy::CharacterFilter, btBroadphaseProxy::AllFilter);
   m_dynamicsWorld->addAction(kinematicController);
@@ -217,6 +1185,16 @@ EventProcessStatus BulletPhysicsSystemBackend::receiveEvent(const GameObjectOnli
   GameObject affectedObject = event.gameObject;
 
   if (affectedObject.hasComponent<RigidBodyComponent>()) {
+    auto lodBodyIt = std::find_if(m_simulationLodBodies.begin(), m_simulationLodBodies.end(),
+      [&affectedObject](const SimulationLodBody& body) {
+        return body.gameObjectId == affectedObject.getId();
+      });
+
+    // Offline bodies are not affected by the simulation LOD, the LOD is chosen again after going online
+    if (lodBodyIt != m_simulationLodBodies.end()) {
+      setBodySimulationLod(*lodBodyIt, PhysicsSimulationLod::Full);
+    }
+
     affectedObject.getComponent<RigidBodyComponent>()->enableSimulation(event.makeOnline);
   }
 
@@ -236,42 +1214,114 @@ void BulletPhysicsSystemBackend::physicsNearCallback(btBroadphasePair& collision
   btCollisionDispatcher& dispatcher,
   btDispatcherInfo& dispatchInfo)
 {
-  dynamic_cast<const BulletCollisionDispatcher&>(dispatcher).getPhysicsSystemBackend().nearCallback(collisionPair,
+  static_cast<const BulletCollisionDispatcher&>(dispatcher).getPhysicsSystemBackend().nearCallback(collisionPair,
     dispatcher, dispatchInfo);
 }
 
 void BulletPhysicsSystemBackend::nearCallback(btBroadphasePair& collisionPair,
   btCollisionDispatcher& dispatcher, btDispatcherInfo& dispatchInfo)
 {
+  // The callback could be called from the dispatcher worker threads, so it only records touching pairs
+  btCollisionDispatcher::defaultNearCallback(collisionPair, dispatcher, dispatchInfo);
+
   auto* client1 = static_cast<btCollisionObject*>(collisionPair.m_pProxy0->m_clientObject);
   auto* client2 = static_cast<btCollisionObject*>(collisionPair.m_pProxy1->m_clientObject);
 
-  RigidBodyCollisionProcessingStatus processingStatus = RigidBodyCollisionProcessingStatus::Skipped;
+  if (collisionPair.m_algorithm == nullptr ||
+    client1->getUserPointer() == nullptr || client2->getUserPointer() == nullptr) {
+    return;
+  }
 
-  if (client1->getUserPointer() != nullptr && client2->getUserPointer() != nullptr) {
-    auto clientId1 = static_cast<GameObjectId>(reinterpret_cast<uintptr_t>(client1->getUserPointer()));
-    auto clientId2 = static_cast<GameObjectId>(reinterpret_cast<uintptr_t>(client2->getUserPointer()));
+  if (!BulletUtils::hasCollisionObjectFlag(*client1, BulletUtils::COLLISION_EVENTS_FLAG) &&
+    !BulletUtils::hasCollisionObjectFlag(*client2, BulletUtils::COLLISION_EVENTS_FLAG)) {
+    return;
+  }
 
-    auto gameObject1 = m_gameWorld->findGameObject(clientId1);
-    auto collisionCallback1 = getCollisionsCallback(gameObject1);
+  static thread_local btManifoldArray manifolds;
 
-    auto gameObject2 = m_gameWorld->findGameObject(clientId2);
-    auto collisionCallback2 = getCollisionsCallback(gameObject2);
+  manifolds.resize(0);
+  collisionPair.m_algorithm->getAllContactManifolds(manifolds);
 
-    CollisionInfo collisionInfo = {.selfGameObject = gameObject1, .gameObject = gameObject2};
+  bool isTouching = false;
 
-    if (collisionCallback1 != nullptr) {
-      processingStatus = collisionCallback1(collisionInfo);
-    }
+  for (int manifoldIndex = 0; manifoldIndex < manifolds.size() && !isTouching; manifoldIndex++) {
+    isTouching = manifolds[manifoldIndex]->getNumContacts() > 0;
+  }
 
-    if (collisionCallback2 != nullptr && processingStatus != RigidBodyCollisionProcessingStatus::Processed) {
-      std::swap(collisionInfo.gameObject, collisionInfo.selfGameObject);
-      processingStatus = collisionCallback2(collisionInfo);
+  if (isTouching) {
+    m_contactPairsBuffer.push(static_cast<GameObjectId>(reinterpret_cast<uintptr_t>(client1->getUserPointer())),
+      static_cast<GameObjectId>(reinterpret_cast<uintptr_t>(client2->getUserPointer())));
+  }
+}
+
+void BulletPhysicsSystemBackend::processContactPairs()
+{
+  m_contactPairsBuffer.collect(m_currentContactPairs);
+
+  // Both lists are sorted, so the contacts state changes are found in one pass
+  auto currentPairIt = m_currentContactPairs.begin();
+  auto previousPairIt = m_touchingContactPairs.begin();
+
+  auto pushEvent = [this](CollisionEventType type, const BulletContactPair& pair) {
+    m_collisionEvents.push_back(BufferedCollisionEvent{
+      .type = type,
+      .firstObjectId = pair.firstObjectId,
+      .secondObjectId = pair.secondObjectId
+    });
+  };
+
+  while (currentPairIt != m_currentContactPairs.end() || previousPairIt != m_touchingContactPairs.end()) {
+    if (previousPairIt == m_touchingContactPairs.end() ||
+      (currentPairIt != m_currentContactPairs.end() && *currentPairIt < *previousPairIt)) {
+      pushEvent(CollisionEventType::Begin, *currentPairIt);
+      currentPairIt++;
+    }
+    else if (currentPairIt == m_currentContactPairs.end() || *previousPairIt < *currentPairIt) {
+      pushEvent(CollisionEventType::End, *previousPairIt);
+      previousPairIt++;
+    }
+    else {
+      pushEvent(CollisionEventType::Persist, *currentPairIt);
+      currentPairIt++;
+      previousPairIt++;
     }
   }
 
-  if (processingStatus != RigidBodyCollisionProcessingStatus::Processed) {
-    btCollisionDispatcher::defaultNearCallback(collisionPair, dispatcher, dispatchInfo);
+  std::swap(m_currentContactPairs, m_touchingContactPairs);
+}
+
+void BulletPhysicsSystemBackend::deliverCollisionEvents(const std::vector<BufferedCollisionEvent>& events)
+{
+  for (const BufferedCollisionEvent& bufferedEvent : events) {
+    GameObject firstGameObject = m_gameWorld->findGameObject(bufferedEvent.firstObjectId);
+    GameObject secondGameObject = m_gameWorld->findGameObject(bufferedEvent.secondObjectId);
+
+    // The objects could be removed after the simulation step or by the previous events listeners
+    if (!firstGameObject.isAlive() || !secondGameObject.isAlive()) {
+      continue;
+    }
+
+    if (bufferedEvent.type != CollisionEventType::End) {
+      auto processingStatus = RigidBodyCollisionProcessingStatus::Skipped;
+      CollisionInfo collisionInfo = {.selfGameObject = firstGameObject, .gameObject = secondGameObject};
+
+      if (auto collisionCallback = getCollisionsCallback(firstGameObject)) {
+        processingStatus = collisionCallback(collisionInfo);
+      }
+
+      if (processingStatus != RigidBodyCollisionProcessingStatus::Processed && secondGameObject.isAlive()) {
+        if (auto collisionCallback = getCollisionsCallback(secondGameObject)) {
+          std::swap(collisionInfo.gameObject, collisionInfo.selfGameObject);
+          collisionCallback(collisionInfo);
+        }
+      }
+    }
+
+    m_gameWorld->emitEvent(CollisionEvent{
+      .type = bufferedEvent.type,
+      .firstGameObject = firstGameObject,
+      .secondGameObject = secondGameObject
+    });
   }
 }
 
@@ -308,43 +1358,187 @@ bool BulletPhysicsSystemBackend::isDebugDrawingEnabled()
 void BulletPhysicsSystemBackend::render()
 {
   if (isDebugDrawingEnabled()) {
+    // Debug drawing reads the world state, so the overlapped simulation should be finished first
+    synchronizeSimulation();
+
     m_dynamicsWorld->debugDrawWorld();
   }
 }
 
-void BulletPhysicsSystemBackend::physicsTickCallback(btDynamicsWorld* world, btScalar timeStep)
+void BulletPhysicsSystemBackend::setUpdateStepCallback(std::function<void(float)> callback)
 {
-  auto* physicsBackend = reinterpret_cast<BulletPhysicsSystemBackend*>(world->getWorldUserInfo());
+  // The callback is called before each fixed simulation step on the main thread
+  m_updateStepCallback = std::move(callback);
+}
 
-  physicsBackend->m_updateStepCallback(static_cast<float>(timeStep));
+void BulletPhysicsSystemBackend::setSimulationLodOrigins(const std::vector<glm::vec3>& origins)
+{
+  m_simulationLodOrigins = origins;
 }
 
-void BulletPhysicsSystemBackend::setUpdateStepCallback(std::function<void(float)> callback)
+PhysicsSimulationLodStatistics BulletPhysicsSystemBackend::getSimulationLodStatistics() const
 {
-  m_updateStepCallback = callback;
+  return m_simulationLodStatistics;
+}
 
-  if (m_updateStepCallback) {
-    m_dynamicsWorld->setInternalTickCallback(BulletPhysicsSystemBackend::physicsTickCallback,
-      reinterpret_cast<void*>(this), true);
+PhysicsQueryHit BulletPhysicsSystemBackend::raycast(const PhysicsRaycastQuery& query)
+{
+  const btCollisionObject* hitObject = nullptr;
+  PhysicsQueryHit hit = performRaycast(query, hitObject);
+
+  hit.gameObject = getCollisionObjectGameObject(hitObject);
+
+  return hit;
+}
+
+void BulletPhysicsSystemBackend::raycast(std::span<const PhysicsRaycastQuery> queries,
+  std::vector<PhysicsQueryHit>& hits)
+{
+  hits.resize(queries.size());
+  std::vector<const btCollisionObject*> hitObjects(queries.size());
+
+  parallelFor(queries.size(), [this, queries, &hits, &hitObjects](size_t queryIndex) {
+    hits[queryIndex] = performRaycast(queries[queryIndex], hitObjects[queryIndex]);
+  });
+
+  // Game objects lookup is not thread-safe, so it is performed after the queries
+  for (size_t queryIndex = 0; queryIndex < queries.size(); queryIndex++) {
+    hits[queryIndex].gameObject = getCollisionObjectGameObject(hitObjects[queryIndex]);
   }
-  else {
-    m_dynamicsWorld->setInternalTickCallback(nullptr,
-      reinterpret_cast<void*>(this), true);
+}
+
+PhysicsQueryHit BulletPhysicsSystemBackend::sweep(const PhysicsSweepQuery& query)
+{
+  const btCollisionObject* hitObject = nullptr;
+  PhysicsQueryHit hit = performSweep(query, hitObject);
+
+  hit.gameObject = getCollisionObjectGameObject(hitObject);
+
+  return hit;
+}
+
+void BulletPhysicsSystemBackend::sweep(std::span<const PhysicsSweepQuery> queries,
+  std::vector<PhysicsQueryHit>& hits)
+{
+  hits.resize(queries.size());
+  std::vector<const btCollisionObject*> hitObjects(queries.size());
+
+  parallelFor(queries.size(), [this, queries, &hits, &hitObjects](size_t queryIndex) {
+    hits[queryIndex] = performSweep(queries[queryIndex], hitObjects[queryIndex]);
+  });
+
+  for (size_t queryIndex = 0; queryIndex < queries.size(); queryIndex++) {
+    hits[queryIndex].gameObject = getCollisionObjectGameObject(hitObjects[queryIndex]);
+  }
+}
+
+void BulletPhysicsSystemBackend::overlap(const PhysicsOverlapQuery& query, std::vector<GameObject>& result)
+{
+  std::vector<const btCollisionObject*> overlappingObjects;
+  performOverlap(query, overlappingObjects);
+
+  for (const btCollisionObject* collisionObject : overlappingObjects) {
+    result.push_back(getCollisionObjectGameObject(collisionObject));
+  }
+}
+
+void BulletPhysicsSystemBackend::overlap(std::span<const PhysicsOverlapQuery> queries,
+  std::vector<GameObject>& result,
+  std::vector<size_t>& resultOffsets)
+{
+  std::vector<std::vector<const btCollisionObject*>> overlappingObjects(queries.size());
+
+  parallelFor(queries.size(), [this, queries, &overlappingObjects](size_t queryIndex) {
+    performOverlap(queries[queryIndex], overlappingObjects[queryIndex]);
+  });
+
+  resultOffsets.resize(queries.size() + 1);
+
+  for (size_t queryIndex = 0; queryIndex < queries.size(); queryIndex++) {
+    resultOffsets[queryIndex] = result.size();
+
+    for (const btCollisionObject* collisionObject : overlappingObjects[queryIndex]) {
+      result.push_back(getCollisionObjectGameObject(collisionObject));
+    }
   }
+
+  resultOffsets[queries.size()] = result.size();
+}
+
+PhysicsQueryHit BulletPhysicsSystemBackend::performRaycast(const PhysicsRaycastQuery& query,
+  const btCollisionObject*& hitObject) const
+{
+  btVector3 from = BulletUtils::glmVec3ToBt(query.from);
+  btVector3 to = BulletUtils::glmVec3ToBt(query.to);
+
+  BulletFilteredQueryCallback<btCollisionWorld::ClosestRayResultCallback> callback(query.filter, from, to);
+  m_dynamicsWorld->rayTest(from, to, callback);
+
+  hitObject = nullptr;
+
+  if (!callback.hasHit()) {
+    return PhysicsQueryHit{};
+  }
+
+  hitObject = callback.m_collisionObject;
+
+  return PhysicsQueryHit{
+    .isHit = true,
+    .position = BulletUtils::btVec3ToGlm(callback.m_hitPointWorld),
+    .normal = BulletUtils::btVec3ToGlm(callback.m_hitNormalWorld),
+    .fraction = callback.m_closestHitFraction
+  };
 }
 
-void BulletPhysicsSystemBackend::synchronizeTransforms(GameObject& object, const btTransform& transform)
+PhysicsQueryHit BulletPhysicsSystemBackend::performSweep(const PhysicsSweepQuery& query,
+  const btCollisionObject*& hitObject) const
 {
-  glm::quat orientation = BulletUtils::btQuatToGlm(transform.getRotation());
-  glm::vec3 origin = BulletUtils::btVec3ToGlm(transform.getOrigin());
+  btTransform from = makeBulletTransform(query.from, query.orientation);
+  btTransform to = makeBulletTransform(query.to, query.orientation);
 
-  if (object.hasComponent<TransformComponent>()) {
-    auto& objectTransformComponent = *object.getComponent<TransformComponent>().get();
-    auto& objectTransform = objectTransformComponent.getTransform();
+  BulletFilteredQueryCallback<btCollisionWorld::ClosestConvexResultCallback> callback(query.filter,
+    from.getOrigin(), to.getOrigin());
 
-    objectTransform.setOrientation(orientation);
-    objectTransform.setPosition(origin);
+  visitQueryShape(query.shape, [this, &from, &to, &callback](const btConvexShape& shape) {
+    m_dynamicsWorld->convexSweepTest(&shape, from, to, callback);
+  });
+
+  hitObject = nullptr;
 
-    objectTransformComponent.updateBounds(origin, orientation);
+  if (!callback.hasHit()) {
+    return PhysicsQueryHit{};
   }
+
+  hitObject = callback.m_hitCollisionObject;
+
+  return PhysicsQueryHit{
+    .isHit = true,
+    .position = BulletUtils::btVec3ToGlm(callback.m_hitPointWorld),
+    .normal = BulletUtils::btVec3ToGlm(callback.m_hitNormalWorld),
+    .fraction = callback.m_closestHitFraction
+  };
+}
+
+void BulletPhysicsSystemBackend::performOverlap(const PhysicsOverlapQuery& query,
+  std::vector<const btCollisionObject*>& result) const
+{
+  visitQueryShape(query.shape, [this, &query, &result](btConvexShape& shape) {
+    btCollisionObject queryObject;
+    queryObject.setCollisionShape(&shape);
+    queryObject.setWorldTransform(makeBulletTransform(query.position, query.orientation));
+
+    BulletFilteredQueryCallback<BulletOverlapQueryCallback> callback(query.filter, &queryObject, result);
+    m_dynamicsWorld->contactTest(&queryObject, callback);
+  });
+}
+
+GameObject BulletPhysicsSystemBackend::getCollisionObjectGameObject(const btCollisionObject* collisionObject) const
+{
+  if (collisionObject == nullptr || collisionObject->getUserPointer() == nullptr) {
+    return GameObject();
+  }
+
+  auto gameObjectId = static_cast<GameObjectId>(reinterpret_cast<uintptr_t>(collisionObject->getUserPointer()));
+
+  return m_gameWorld->findGameObject(gameObjectId);
 }
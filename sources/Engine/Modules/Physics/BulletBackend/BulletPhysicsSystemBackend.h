@@ -1,7 +1,14 @@
 #pragma once
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+
 #include <glm/vec3.hpp>
 #include <btBulletDynamicsCommon.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <LinearMath/btThreads.h>
 
 #include "Modules/ECS/ECS.h"
 #include "Modules/ECS/OnlineManagementSystem.h"
@@ -12,9 +19,12 @@
 #include "Modules/Physics/PhysicsCollisions.h"
 
 #include "BulletCollisionDispatcher.h"
+#include "BulletContactPairsBuffer.h"
 #include "BulletDebugPainter.h"
 #include "BulletKinematicCharacterComponent.h"
 
+class TransformComponent;
+
 // TODO: fix possible circular dependency here, replace shared_ptr to GameWorld with weak_ptr
 
 class BulletPhysicsSystemBackend :
@@ -26,9 +36,17 @@ class BulletPhysicsSystemBackend :
   public EventsListener<GameObjectRemoveComponentEvent<KinematicCharacterComponent>>,
   public EventsListener<GameObjectOnlineStatusChangeEvent> {
  public:
-  explicit BulletPhysicsSystemBackend(GameWorld* gameWorld);
+  BulletPhysicsSystemBackend(GameWorld* gameWorld, const PhysicsSimulationSettings& simulationSettings);
   ~BulletPhysicsSystemBackend() override;
 
+  /*!
+   * \brief Routes Bullet allocations through the physics memory counter
+   *
+   * It should be called once at the engine startup before any Bullet object is created,
+   * the memory allocated with one allocator could not be freed with another one.
+   */
+  static void installMemoryAllocator();
+
   void configure() override;
   void unconfigure() override;
 
@@ -38,6 +56,11 @@ class BulletPhysicsSystemBackend :
   void update(float delta) override;
   void render() override;
 
+  void beforeRender() override;
+  void afterRender() override;
+
+  void synchronizeSimulation() override;
+
   EventProcessStatus receiveEvent(
     const GameObjectAddComponentEvent<RigidBodyComponent>& event) override;
 
@@ -57,32 +80,221 @@ class BulletPhysicsSystemBackend :
 
   void setUpdateStepCallback(std::function<void(float)> callback) override;
 
+  void setSimulationLodOrigins(const std::vector<glm::vec3>& origins) override;
+  [[nodiscard]] PhysicsSimulationLodStatistics getSimulationLodStatistics() const override;
+
+  [[nodiscard]] PhysicsQueryHit raycast(const PhysicsRaycastQuery& query) override;
+  void raycast(std::span<const PhysicsRaycastQuery> queries, std::vector<PhysicsQueryHit>& hits) override;
+
+  [[nodiscard]] PhysicsQueryHit sweep(const PhysicsSweepQuery& query) override;
+  void sweep(std::span<const PhysicsSweepQuery> queries, std::vector<PhysicsQueryHit>& hits) override;
+
+  void overlap(const PhysicsOverlapQuery& query, std::vector<GameObject>& result) override;
+  void overlap(std::span<const PhysicsOverlapQuery> queries,
+    std::vector<GameObject>& result,
+    std::vector<size_t>& resultOffsets) override;
+
+ private:
+  struct SimulatedObjectTransform {
+    GameObjectId gameObjectId{};
+
+    // It is null for kinematic characters
+    const btRigidBody* rigidBody = nullptr;
+
+    glm::vec3 position{};
+    glm::quat orientation{};
+
+    // Inactive transforms are the final ones of the bodies that stopped moving at the step
+    bool isActive = true;
+  };
+
+  struct WrittenObjectTransform {
+    glm::vec3 position{};
+    glm::quat orientation{};
+  };
+
+  struct SimulationLodBody {
+    GameObjectId gameObjectId{};
+    btRigidBody* rigidBody = nullptr;
+    PhysicsSimulationLod lod = PhysicsSimulationLod::Full;
+
+    // Reduced rate bodies are simulated at the steps with the matching phase
+    size_t reducedRatePhase = 0;
+
+    // Mass properties are stored while the body is replaced by the kinematic proxy
+    btScalar mass = 0.0f;
+    btVector3 localInertia = btVector3(0.0f, 0.0f, 0.0f);
+
+    // The far body is woken by an interaction, it is simulated until it falls asleep
+    bool isWokenByInteraction = false;
+  };
+
+  struct BufferedCollisionEvent {
+    CollisionEventType type{};
+    GameObjectId firstObjectId{};
+    GameObjectId secondObjectId{};
+  };
+
+  struct ReducedRateBodyStepState {
+    btRigidBody* rigidBody = nullptr;
+    bool isSimulatedStep = false;
+
+    btVector3 linearVelocity;
+    btVector3 angularVelocity;
+    btVector3 gravity;
+    int activationState = ACTIVE_TAG;
+    btScalar deactivationTime = 0.0f;
+  };
+
  private:
   bool isConfigured() const;
 
+  void createDynamicsWorld();
+  void setupTaskScheduler();
+
+  /*!
+   * \brief Converts the elapsed time to the count of fixed simulation steps
+   *
+   * The rest of the time is accumulated for the next updates.
+   */
+  [[nodiscard]] size_t consumeSimulationTime(float delta);
+
+  /*!
+   * \brief Returns the accumulated time that is not simulated yet as a fraction of the fixed step
+   */
+  [[nodiscard]] float getAccumulatedStepFraction() const;
+
+  void performSimulationSteps(size_t stepsCount);
+
+  /*!
+   * \brief Assigns the simulation LOD to dynamic bodies by the distance to the LOD origins
+   *
+   * It is called on the main thread before the simulation steps, the bodies are processed in
+   * the registration order, so the LOD transitions are deterministic.
+   */
+  void updateSimulationLod();
+  void setBodySimulationLod(SimulationLodBody& body, PhysicsSimulationLod lod);
+  void wakeInteractingKinematicProxies();
+  void collectSimulationLodOrigins(std::vector<glm::vec3>& origins) const;
+
+  /*!
+   * \brief Prepares reduced rate bodies for the step, they are either frozen or simulated with the longer step
+   */
+  void beginSimulationLodStep();
+  void endSimulationLodStep();
+
+  void startSimulationThread();
+  void stopSimulationThread();
+  void simulationThreadLoop();
+
+  void requestSimulationSteps(size_t stepsCount);
+  void waitForSimulation();
+
+  /*!
+   * \brief Stores transforms of the moved bodies after the step, the transforms of the previous step are kept
+   */
+  void storeStepTransforms();
+
+  /*!
+   * \brief Writes the simulated transforms interpolated between the two last steps into transform components
+   *
+   * The transforms are written directly to the components storage, then the bounds of the
+   * written components are updated in one pass. The factor is the fraction of the fixed step,
+   * the factor 1 gives the exact state of the last step.
+   */
+  void applySimulatedTransforms(float interpolationFactor);
+
+  /*!
+   * \brief Moves the bodies to the transforms changed by the game code since the last simulated transforms write
+   *
+   * The changed transforms are detected by the comparison with the written ones, the simulated
+   * transforms of such objects are dropped, so the teleports and kinematic moves are not overwritten.
+   */
+  void pushExternalTransformChanges();
+  void writeSimulatedTransform(GameObjectId gameObjectId, const glm::vec3& position, const glm::quat& orientation);
+  void eraseSimulatedTransforms(GameObjectId gameObjectId);
+
+  // The queries methods do not touch the game world, so they could be called from worker threads
+  [[nodiscard]] PhysicsQueryHit performRaycast(const PhysicsRaycastQuery& query,
+    const btCollisionObject*& hitObject) const;
+  [[nodiscard]] PhysicsQueryHit performSweep(const PhysicsSweepQuery& query,
+    const btCollisionObject*& hitObject) const;
+  void performOverlap(const PhysicsOverlapQuery& query, std::vector<const btCollisionObject*>& result) const;
+
+  [[nodiscard]] GameObject getCollisionObjectGameObject(const btCollisionObject* collisionObject) const;
+
   void nearCallback(btBroadphasePair& collisionPair,
     btCollisionDispatcher& dispatcher, btDispatcherInfo& dispatchInfo);
   static CollisionCallback getCollisionsCallback(GameObject& object);
 
-  static void synchronizeTransforms(GameObject& object, const btTransform& transform);
+  /*!
+   * \brief Compares touching pairs of the step with the previous step ones and buffers the contacts events
+   */
+  void processContactPairs();
+
+  /*!
+   * \brief Calls collision callbacks and emits collision events on the main thread
+   */
+  void deliverCollisionEvents(const std::vector<BufferedCollisionEvent>& events);
 
  private:
   static void physicsNearCallback(btBroadphasePair& collisionPair,
     btCollisionDispatcher& dispatcher, btDispatcherInfo& dispatchInfo);
 
-  static void physicsTickCallback(btDynamicsWorld* world, btScalar timeStep);
-
  private:
   GameWorld* m_gameWorld;
+  PhysicsSimulationSettings m_simulationSettings;
 
   btDefaultCollisionConfiguration* m_collisionConfiguration = nullptr;
   BulletCollisionDispatcher* m_collisionDispatcher = nullptr;
   btBroadphaseInterface* m_broadphaseInterface = nullptr;
-  btSequentialImpulseConstraintSolver* m_constraintSolver = nullptr;
+  btConstraintSolver* m_constraintSolver = nullptr;
+  btConstraintSolverPoolMt* m_constraintSolversPool = nullptr;
   btDiscreteDynamicsWorld* m_dynamicsWorld = nullptr;
   BulletDebugPainter* m_physicsDebugPainter = nullptr;
 
   bool m_isDebugDrawingEnabled = false;
 
   std::function<void(float)> m_updateStepCallback;
+
+  float m_simulationTimeAccumulator = 0.0f;
+  size_t m_pendingStepsCount = 0;
+
+  std::thread m_simulationThread;
+  std::mutex m_simulationMutex;
+  std::condition_variable m_simulationCondition;
+  size_t m_requestedStepsCount = 0;
+  bool m_isSimulationThreadStopRequested = false;
+
+  std::vector<std::pair<GameObjectId, BulletKinematicCharacterComponent*>> m_kinematicCharacters;
+
+  std::vector<SimulationLodBody> m_simulationLodBodies;
+  std::vector<glm::vec3> m_simulationLodOrigins;
+  PhysicsSimulationLodStatistics m_simulationLodStatistics;
+  std::vector<ReducedRateBodyStepState> m_reducedRateStepStates;
+  size_t m_simulationStepIndex = 0;
+
+  // Transforms of the moved bodies at the two last steps, ordered by game objects IDs. They are written by
+  // the simulation thread and read by the main thread only when the requested steps are finished
+  std::vector<SimulatedObjectTransform> m_previousStepTransforms;
+  std::vector<SimulatedObjectTransform> m_lastStepTransforms;
+
+  // Final transforms of the bodies that stopped moving during the requested steps
+  std::vector<SimulatedObjectTransform> m_settledTransforms;
+
+  float m_interpolationFactor = 1.0f;
+
+  // Transform components written by the current transforms application
+  std::vector<TransformComponent*> m_writtenTransformComponents;
+
+  // The last simulated transforms written into the transform components
+  std::unordered_map<GameObjectId, WrittenObjectTransform> m_writtenTransforms;
+
+  // Sorted touching pairs of the current and the previous steps
+  BulletContactPairsBuffer m_contactPairsBuffer;
+  std::vector<BulletContactPair> m_currentContactPairs;
+  std::vector<BulletContactPair> m_touchingContactPairs;
+
+  // Collision events are buffered by the simulation thread in the same way as the transforms
+  std::vector<BufferedCollisionEvent> m_collisionEvents;
 };
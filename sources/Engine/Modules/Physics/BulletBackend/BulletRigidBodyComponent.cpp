@@ -7,9 +7,11 @@
 
 #include <utility>
 #include "BulletUtils.h"
+#include "BulletCollisionShapesCache.h"
 
 BulletRigidBodyComponent::BulletRigidBodyComponent(float mass, ResourceHandle<CollisionShape> collisionShape)
-  : m_collisionShape(BulletUtils::convertCollisionShapeToBulletShape(*collisionShape))
+  : m_collisionShapeResource(collisionShape),
+    m_collisionShape(BulletCollisionShapesCache::acquireShape(*collisionShape))
 {
   btTransform defaultTransform;
   defaultTransform.setIdentity();
@@ -35,7 +37,7 @@ BulletRigidBodyComponent::~BulletRigidBodyComponent()
 
 btCollisionShape* BulletRigidBodyComponent::getBtCollisionShape() const
 {
-  return m_collisionShape;
+  return m_collisionShape->getShape();
 }
 
 void BulletRigidBodyComponent::setMass(float mass)
@@ -61,7 +63,15 @@ void BulletRigidBodyComponent::setTransform(const Transform& transform)
   m_motionState->setWorldTransform(internalTransform);
   m_rigidBodyInstance->setWorldTransform(internalTransform);
 
-  m_rigidBodyInstance->getCollisionShape()->setLocalScaling(BulletUtils::glmVec3ToBt(transform.getScale()));
+  if (transform.getScale() != m_collisionShape->getScale()) {
+    // The shape is shared with other bodies, so the scaled shape is requested instead of the scaling change
+    auto scaledShape = BulletCollisionShapesCache::acquireShape(*m_collisionShapeResource, transform.getScale());
+
+    m_rigidBodyInstance->setCollisionShape(scaledShape->getShape());
+    m_collisionShape = std::move(scaledShape);
+
+    setMass(getMass());
+  }
 }
 
 void BulletRigidBodyComponent::setLinearVelocity(const glm::vec3& velocity)
@@ -96,12 +106,6 @@ glm::vec3 BulletRigidBodyComponent::getLinearFactor() const
   return BulletUtils::btVec3ToGlm(m_rigidBodyInstance->getLinearFactor());
 }
 
-void BulletRigidBodyComponent::setUpdateCallback(std::function<void(const btTransform&)> updateCallback)
-{
-  auto* motionState = dynamic_cast<BulletMotionState*>(m_rigidBodyInstance->getMotionState());
-  motionState->setUpdateCallback(std::move(updateCallback));
-}
-
 void BulletRigidBodyComponent::enableSimulation(bool enable)
 {
   m_rigidBodyInstance->setActivationState(((enable) ? ACTIVE_TAG : DISABLE_SIMULATION));
@@ -111,3 +115,13 @@ bool BulletRigidBodyComponent::isSimulationEnabled() const
 {
   return m_rigidBodyInstance->getActivationState() != DISABLE_SIMULATION;
 }
+
+void BulletRigidBodyComponent::enableCollisionEvents(bool enable)
+{
+  BulletUtils::setCollisionObjectFlag(*m_rigidBodyInstance, BulletUtils::COLLISION_EVENTS_FLAG, enable);
+}
+
+bool BulletRigidBodyComponent::isCollisionEventsEnabled() const
+{
+  return BulletUtils::hasCollisionObjectFlag(*m_rigidBodyInstance, BulletUtils::COLLISION_EVENTS_FLAG);
+}
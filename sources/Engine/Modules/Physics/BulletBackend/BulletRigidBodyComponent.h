@@ -11,6 +11,7 @@
 #include "Modules/Physics/CollisionShapes.h"
 
 #include "BulletMotionState.h"
+#include "BulletCollisionShapesCache.h"
 
 class BulletPhysicsSystemBackend;
 
@@ -35,13 +36,15 @@ class BulletRigidBodyComponent : public RigidBodyComponentBackend {
   void setLinearFactor(const glm::vec3& factor) override;
   [[nodiscard]] glm::vec3 getLinearFactor() const override;
 
-  void setUpdateCallback(std::function<void(const btTransform&)> updateCallback);
-
   void enableSimulation(bool enable) override;
   [[nodiscard]] bool isSimulationEnabled() const override;
 
+  void enableCollisionEvents(bool enable) override;
+  [[nodiscard]] bool isCollisionEventsEnabled() const override;
+
  private:
-  btCollisionShape* m_collisionShape = nullptr;
+  ResourceHandle<CollisionShape> m_collisionShapeResource;
+  std::shared_ptr<BulletSharedCollisionShape> m_collisionShape;
 
   BulletMotionState* m_motionState = nullptr;
   btRigidBody* m_rigidBodyInstance = nullptr;
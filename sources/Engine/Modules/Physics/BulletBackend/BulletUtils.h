@@ -1,15 +1,18 @@
 #pragma once
 
+#include <algorithm>
 #include <glm/vec3.hpp>
 #include <glm/gtc/quaternion.hpp>
 
 #include <btBulletDynamicsCommon.h>
 
 #include "Modules/Graphics/GraphicsSystem/Transform.h"
-#include "Modules/Physics/CollisionShapes.h"
 
 class BulletUtils {
  public:
+  // Flags of collision objects are stored in the user index, so the narrowphase does not touch the game world
+  static constexpr int COLLISION_EVENTS_FLAG = 1;
+
   static inline btVector3 glmVec3ToBt(const glm::vec3& v)
   {
     return btVector3(v.x, v.y, v.z);
@@ -48,7 +51,19 @@ class BulletUtils {
     return transform;
   }
 
-  static btCollisionShape* convertCollisionShapeToBulletShape(const CollisionShape& shape);
-  static btCollisionShape* convertCollisionShapeToBulletShape(const CollisionShapeData& shape);
+  static inline void setCollisionObjectFlag(btCollisionObject& collisionObject, int flag, bool value)
+  {
+    // The user index is -1 by default
+    int flags = std::max(collisionObject.getUserIndex(), 0);
+
+    collisionObject.setUserIndex((value) ? (flags | flag) : (flags & ~flag));
+  }
+
+  static inline bool hasCollisionObjectFlag(const btCollisionObject& collisionObject, int flag)
+  {
+    int flags = collisionObject.getUserIndex();
+
+    return flags > 0 && (flags & flag) != 0;
+  }
 };
 
@@ -5,6 +5,7 @@
 #include "CollisionShapes.h"
 
 #include <utility>
+#include <numeric>
 
 void CollisionShapeSphere::setRadius(float radius)
 {
@@ -82,16 +83,25 @@ const std::vector<CollisionShapeCompoundChild>& CollisionShapeCompound::getChild
 }
 
 CollisionShapeTriangleMesh::CollisionShapeTriangleMesh(std::vector<glm::vec3> vertices)
-  : m_vertices(std::move(vertices))
 {
-  SW_ASSERT(!m_vertices.empty() && m_vertices.size() % 3 == 0);
+  setVertices(vertices);
+}
+
+CollisionShapeTriangleMesh::CollisionShapeTriangleMesh(std::vector<glm::vec3> vertices, std::vector<uint32_t> indices)
+  : m_vertices(std::move(vertices)),
+    m_indices(std::move(indices))
+{
+  SW_ASSERT(!m_vertices.empty() && !m_indices.empty() && m_indices.size() % 3 == 0);
 }
 
 void CollisionShapeTriangleMesh::setVertices(const std::vector<glm::vec3>& vertices)
 {
   SW_ASSERT(!vertices.empty() && vertices.size() % 3 == 0);
 
-  m_vertices = vertices;
+  std::vector<uint32_t> indices(vertices.size());
+  std::iota(indices.begin(), indices.end(), 0);
+
+  setGeometry(vertices, indices);
 }
 
 const std::vector<glm::vec3>& CollisionShapeTriangleMesh::getVertices() const
@@ -99,6 +109,31 @@ const std::vector<glm::vec3>& CollisionShapeTriangleMesh::getVertices() const
   return m_vertices;
 }
 
+void CollisionShapeTriangleMesh::setGeometry(const std::vector<glm::vec3>& vertices,
+  const std::vector<uint32_t>& indices)
+{
+  SW_ASSERT(!vertices.empty() && !indices.empty() && indices.size() % 3 == 0);
+
+  m_vertices = vertices;
+  m_indices = indices;
+  m_optimizedBvhData.clear();
+}
+
+const std::vector<uint32_t>& CollisionShapeTriangleMesh::getIndices() const
+{
+  return m_indices;
+}
+
+void CollisionShapeTriangleMesh::setOptimizedBvhData(const std::vector<std::byte>& data)
+{
+  m_optimizedBvhData = data;
+}
+
+const std::vector<std::byte>& CollisionShapeTriangleMesh::getOptimizedBvhData() const
+{
+  return m_optimizedBvhData;
+}
+
 CollisionShape::CollisionShape(CollisionShapeData  shapeData)
   : m_shapeData(std::move(shapeData))
 {
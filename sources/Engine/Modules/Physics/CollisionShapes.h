@@ -1,6 +1,8 @@
 #pragma once
 
 #include <variant>
+#include <vector>
+#include <cstddef>
 #include <glm/vec3.hpp>
 
 #include "Modules/ResourceManagement/ResourcesManagement.h"
@@ -51,14 +53,34 @@ struct CollisionShapeCapsule {
 struct CollisionShapeTriangleMesh {
  public:
   CollisionShapeTriangleMesh() = default;
+
+  /*!
+   * \brief Creates the mesh from the triangles list, each three vertices form a triangle
+   */
   explicit CollisionShapeTriangleMesh(std::vector<glm::vec3> vertices);
+  CollisionShapeTriangleMesh(std::vector<glm::vec3> vertices, std::vector<uint32_t> indices);
   ~CollisionShapeTriangleMesh() = default;
 
   void setVertices(const std::vector<glm::vec3>& vertices);
   [[nodiscard]] const std::vector<glm::vec3>& getVertices() const;
 
+  void setGeometry(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices);
+  [[nodiscard]] const std::vector<uint32_t>& getIndices() const;
+
+  /*!
+   * \brief Sets the serialized acceleration structure of the mesh prepared by the physics backend
+   *
+   * The data is used to avoid the acceleration structure building on the shape creation,
+   * it is reset on the geometry change
+   */
+  void setOptimizedBvhData(const std::vector<std::byte>& data);
+  [[nodiscard]] const std::vector<std::byte>& getOptimizedBvhData() const;
+
  private:
   std::vector<glm::vec3> m_vertices;
+  std::vector<uint32_t> m_indices;
+
+  std::vector<std::byte> m_optimizedBvhData;
 };
 
 struct CollisionShapeCompound;
@@ -39,6 +39,7 @@ bool KinematicCharacterComponent::isOnGround() const
 void KinematicCharacterComponent::setCollisionCallback(CollisionCallback callback)
 {
   m_collisionCallback = std::move(callback);
+  m_backend->enableCollisionEvents(m_isCollisionEventsEnabled || m_collisionCallback != nullptr);
 }
 
 CollisionCallback KinematicCharacterComponent::getCollisionCallback() const
@@ -86,6 +87,17 @@ bool KinematicCharacterComponent::isSimulationEnabled() const
   return m_backend->isSimulationEnabled();
 }
 
+void KinematicCharacterComponent::enableCollisionEvents(bool enable)
+{
+  m_isCollisionEventsEnabled = enable;
+  m_backend->enableCollisionEvents(m_isCollisionEventsEnabled || m_collisionCallback != nullptr);
+}
+
+bool KinematicCharacterComponent::isCollisionEventsEnabled() const
+{
+  return m_isCollisionEventsEnabled;
+}
+
 KinematicCharacterComponent::BindingParameters KinematicCharacterComponent::getBindingParameters() const
 {
   return KinematicCharacterComponent::BindingParameters{
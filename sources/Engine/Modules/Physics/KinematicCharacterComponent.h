@@ -49,6 +49,12 @@ struct KinematicCharacterComponent {
 
   void enableSimulation(bool enable);
   [[nodiscard]] bool isSimulationEnabled() const;
+
+  /*!
+   * \brief Enables collision events of the character, they are always enabled for characters with collision callbacks
+   */
+  void enableCollisionEvents(bool enable);
+  [[nodiscard]] bool isCollisionEventsEnabled() const;
   
   [[nodiscard]] const KinematicCharacterComponentBackend& getBackend() const;
   [[nodiscard]] KinematicCharacterComponentBackend& getBackend();
@@ -63,6 +69,7 @@ struct KinematicCharacterComponent {
   ResourceHandle<CollisionShape> m_collisionShape;
   std::shared_ptr<KinematicCharacterComponentBackend> m_backend;
   CollisionCallback m_collisionCallback;
+  bool m_isCollisionEventsEnabled = false;
 };
 
 class KinematicCharacterComponentBinder : public GameObjectsComponentBinder<KinematicCharacterComponent> {
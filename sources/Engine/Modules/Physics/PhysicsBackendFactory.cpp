@@ -8,9 +8,15 @@
 #include "BulletBackend/BulletRigidBodyComponent.h"
 #include "BulletBackend/BulletKinematicCharacterComponent.h"
 
-std::shared_ptr<PhysicsSystemBackend> PhysicsBackendFactory::createPhysicsSystem(GameWorld* gameWorld)
+void PhysicsBackendFactory::initializeBackend()
 {
-  return std::make_shared<BulletPhysicsSystemBackend>(gameWorld);
+  BulletPhysicsSystemBackend::installMemoryAllocator();
+}
+
+std::shared_ptr<PhysicsSystemBackend> PhysicsBackendFactory::createPhysicsSystem(GameWorld* gameWorld,
+  const PhysicsSimulationSettings& settings)
+{
+  return std::make_shared<BulletPhysicsSystemBackend>(gameWorld, settings);
 }
 
 std::shared_ptr<RigidBodyComponentBackend> PhysicsBackendFactory::createRigidBodyComponent(float mass,
@@ -13,7 +13,13 @@ class PhysicsBackendFactory {
   PhysicsBackendFactory() = delete;
 
  public:
-  static std::shared_ptr<PhysicsSystemBackend> createPhysicsSystem(GameWorld* gameWorld);
+  /*!
+   * \brief Prepares the physics backend, it should be called before any physics object is created
+   */
+  static void initializeBackend();
+
+  static std::shared_ptr<PhysicsSystemBackend> createPhysicsSystem(GameWorld* gameWorld,
+    const PhysicsSimulationSettings& settings);
 
   static std::shared_ptr<RigidBodyComponentBackend> createRigidBodyComponent(float mass,
     ResourceHandle<CollisionShape> collisionShape);
@@ -7,6 +7,9 @@ struct CollisionInfo {
   GameObject gameObject;
 };
 
+/*!
+ * \brief Status of the collision callback, Processed status prevents calling the callback of the other object
+ */
 enum class RigidBodyCollisionProcessingStatus {
   Processed,
   ObservedOnly,
@@ -14,3 +17,26 @@ enum class RigidBodyCollisionProcessingStatus {
 };
 
 using CollisionCallback = std::function<RigidBodyCollisionProcessingStatus(CollisionInfo&)>;
+
+enum class CollisionEventType {
+  // The objects have got the first contact point during the step
+  Begin,
+
+  // The objects are still in contact after the step
+  Persist,
+
+  // The objects have lost the last contact point during the step
+  End
+};
+
+/*!
+ * \brief Contact state change of two physics objects
+ *
+ * The events are buffered during the simulation step and emitted in bulk after the step, only objects
+ * with enabled collision events or collision callbacks produce them.
+ */
+struct CollisionEvent {
+  CollisionEventType type;
+  GameObject firstGameObject;
+  GameObject secondGameObject;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <variant>
+#include <glm/vec3.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "Modules/ECS/ECS.h"
+#include "CollisionShapes.h"
+
+/*!
+ * \brief Collision groups of physics objects, the values match the backend broadphase groups
+ */
+struct PhysicsCollisionGroups {
+  static constexpr uint32_t Default = 1;
+  static constexpr uint32_t Static = 2;
+  static constexpr uint32_t Kinematic = 4;
+  static constexpr uint32_t Debris = 8;
+  static constexpr uint32_t Sensor = 16;
+  static constexpr uint32_t Character = 32;
+  static constexpr uint32_t All = 0xFFFFFFFF;
+};
+
+struct PhysicsQueryFilter {
+  uint32_t collisionMask = PhysicsCollisionGroups::All;
+
+  // The object is skipped by the query, e.g. the query initiator itself
+  GameObject ignoredObject;
+};
+
+/*!
+ * \brief Convex shape used for sweep and overlap queries
+ */
+using PhysicsQueryShape = std::variant<CollisionShapeSphere, CollisionShapeCapsule, CollisionShapeBox>;
+
+struct PhysicsRaycastQuery {
+  glm::vec3 from{};
+  glm::vec3 to{};
+  PhysicsQueryFilter filter;
+};
+
+struct PhysicsSweepQuery {
+  PhysicsQueryShape shape;
+  glm::vec3 from{};
+  glm::vec3 to{};
+  glm::quat orientation = glm::identity<glm::quat>();
+  PhysicsQueryFilter filter;
+};
+
+struct PhysicsOverlapQuery {
+  PhysicsQueryShape shape;
+  glm::vec3 position{};
+  glm::quat orientation = glm::identity<glm::quat>();
+  PhysicsQueryFilter filter;
+};
+
+struct PhysicsQueryHit {
+  bool isHit{};
+
+  // The object is not formed if the hit collision object does not belong to any game object
+  GameObject gameObject;
+
+  glm::vec3 position{};
+  glm::vec3 normal{};
+
+  // Relative distance of the hit along the query segment, in [0, 1] range
+  float fraction = 1.0f;
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+enum class PhysicsTaskSchedulerType {
+  Sequential,
+  Default,
+  OpenMP,
+  TBB,
+  PPL
+};
+
+enum class PhysicsSimulationLod : uint8_t {
+  // Simulated every fixed step
+  Full,
+
+  // Simulated once per several fixed steps with the proportionally longer step
+  ReducedRate,
+
+  // Forced to sleep until an interaction with an active body or the LOD origin proximity
+  Sleeping,
+
+  // Replaced by the static kinematic object that still blocks other bodies, the mass is restored on the LOD change
+  KinematicProxy,
+
+  Count
+};
+
+/*!
+ * \brief Distance-based simulation level of detail of dynamic rigid bodies
+ *
+ * The distance is measured from the nearest LOD origin, kinematic characters are always treated as origins.
+ */
+struct PhysicsSimulationLodSettings {
+  bool isEnabled = false;
+
+  float reducedRateRadius = 40.0f;
+  size_t reducedRateStepsInterval = 4;
+
+  // Bodies beyond the radius are switched to the far LOD, it should be Sleeping or KinematicProxy
+  float farRadius = 80.0f;
+  PhysicsSimulationLod farLod = PhysicsSimulationLod::Sleeping;
+
+  // Bodies leave a LOD only after moving this distance away from its border, so they do not switch LOD every update
+  float hysteresisDistance = 2.0f;
+};
+
+struct PhysicsSimulationLodStatistics {
+  std::array<size_t, static_cast<size_t>(PhysicsSimulationLod::Count)> bodiesCount{};
+
+  // Bodies that are awake and really simulated, it is the actual physics cost of the LOD
+  std::array<size_t, static_cast<size_t>(PhysicsSimulationLod::Count)> activeBodiesCount{};
+};
+
+struct PhysicsSimulationSettings {
+  // Use multithreaded world with constraint solvers pool, requires thread-safe physics backend build
+  bool isMultithreadingEnabled = false;
+
+  PhysicsTaskSchedulerType taskSchedulerType = PhysicsTaskSchedulerType::Default;
+
+  // Zero means the hardware concurrency
+  size_t workerThreadsCount = 0;
+
+  // Step the world on a dedicated thread while the frame is rendered. Simulated transforms
+  // and collision events are delivered on the main thread at the next update, so the game sees
+  // the simulation with one update latency. Fixed update callbacks of the update are called in
+  // a row before rendering. The rendering code should not access the physics world while the
+  // steps are in progress
+  bool isDedicatedThreadEnabled = false;
+
+  // Transforms of moved objects are interpolated between the two last steps by the time left after the update
+  float fixedTimeStep = 1.0f / 60.0f;
+  size_t maxStepsPerUpdate = 60;
+
+  PhysicsSimulationLodSettings lod;
+};
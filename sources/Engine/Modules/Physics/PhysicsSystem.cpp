@@ -7,7 +7,11 @@
 #include <utility>
 #include "PhysicsBackendFactory.h"
 
-PhysicsSystem::PhysicsSystem() = default;
+PhysicsSystem::PhysicsSystem(const PhysicsSimulationSettings& simulationSettings)
+  : m_simulationSettings(simulationSettings)
+{
+
+}
 
 PhysicsSystem::~PhysicsSystem()
 {
@@ -16,7 +20,7 @@ PhysicsSystem::~PhysicsSystem()
 
 void PhysicsSystem::configure()
 {
-  m_physicsBackend = PhysicsBackendFactory::createPhysicsSystem(getGameWorld());
+  m_physicsBackend = PhysicsBackendFactory::createPhysicsSystem(getGameWorld(), m_simulationSettings);
   m_physicsBackend->configure();
 }
 
@@ -26,11 +30,38 @@ void PhysicsSystem::unconfigure()
   m_physicsBackend = nullptr;
 }
 
+void PhysicsSystem::deactivate()
+{
+  // The simulation should not be left in progress while the system is inactive
+  if (m_physicsBackend != nullptr) {
+    m_physicsBackend->synchronizeSimulation();
+  }
+}
+
 void PhysicsSystem::update(float delta)
 {
   m_physicsBackend->update(delta);
 }
 
+void PhysicsSystem::beforeRender()
+{
+  if (!isActive()) {
+    return;
+  }
+
+  m_physicsBackend->beforeRender();
+}
+
+void PhysicsSystem::afterRender()
+{
+  m_physicsBackend->afterRender();
+}
+
+const PhysicsSimulationSettings& PhysicsSystem::getSimulationSettings() const
+{
+  return m_simulationSettings;
+}
+
 void PhysicsSystem::setGravity(const glm::vec3& gravity)
 {
   m_physicsBackend->setGravity(gravity);
@@ -60,3 +91,45 @@ void PhysicsSystem::setUpdateStepCallback(std::function<void(float)> callback)
 {
   m_physicsBackend->setUpdateStepCallback(std::move(callback));
 }
+
+void PhysicsSystem::setSimulationLodOrigins(const std::vector<glm::vec3>& origins)
+{
+  m_physicsBackend->setSimulationLodOrigins(origins);
+}
+
+PhysicsSimulationLodStatistics PhysicsSystem::getSimulationLodStatistics() const
+{
+  return m_physicsBackend->getSimulationLodStatistics();
+}
+
+PhysicsQueryHit PhysicsSystem::raycast(const PhysicsRaycastQuery& query)
+{
+  return m_physicsBackend->raycast(query);
+}
+
+void PhysicsSystem::raycast(std::span<const PhysicsRaycastQuery> queries, std::vector<PhysicsQueryHit>& hits)
+{
+  m_physicsBackend->raycast(queries, hits);
+}
+
+PhysicsQueryHit PhysicsSystem::sweep(const PhysicsSweepQuery& query)
+{
+  return m_physicsBackend->sweep(query);
+}
+
+void PhysicsSystem::sweep(std::span<const PhysicsSweepQuery> queries, std::vector<PhysicsQueryHit>& hits)
+{
+  m_physicsBackend->sweep(queries, hits);
+}
+
+void PhysicsSystem::overlap(const PhysicsOverlapQuery& query, std::vector<GameObject>& result)
+{
+  m_physicsBackend->overlap(query, result);
+}
+
+void PhysicsSystem::overlap(std::span<const PhysicsOverlapQuery> queries,
+  std::vector<GameObject>& result,
+  std::vector<size_t>& resultOffsets)
+{
+  m_physicsBackend->overlap(queries, result, resultOffsets);
+}
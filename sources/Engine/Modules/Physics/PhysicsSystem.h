@@ -8,19 +8,35 @@
 #include "KinematicCharacterComponent.h"
 
 #include "CollisionShapesFactory.h"
+#include "PhysicsQueries.h"
+#include "PhysicsSimulationSettings.h"
 
 
 class PhysicsSystem : public GameSystem {
  public:
-  PhysicsSystem();
+  explicit PhysicsSystem(const PhysicsSimulationSettings& simulationSettings = PhysicsSimulationSettings());
   ~PhysicsSystem() override;
 
   void configure() override;
   void unconfigure() override;
 
+  void deactivate() override;
+
   void render() override;
   void update(float delta) override;
 
+  /*!
+   * \brief Starts the simulation on the dedicated thread, if it is enabled, so it overlaps rendering
+   */
+  void beforeRender() override;
+
+  /*!
+   * \brief Waits for the dedicated thread simulation, the simulated transforms are applied on the next update
+   */
+  void afterRender() override;
+
+  [[nodiscard]] const PhysicsSimulationSettings& getSimulationSettings() const;
+
   void enableDebugDrawing(bool enable);
   bool isDebugDrawingEnabled();
 
@@ -29,6 +45,61 @@ class PhysicsSystem : public GameSystem {
 
   void setUpdateStepCallback(std::function<void(float)> callback);
 
+  /*!
+   * \brief Sets additional points of interest for the simulation LOD, e.g. the camera position
+   *
+   * Kinematic characters are LOD origins by default, the bodies LOD is chosen by the distance to the nearest origin.
+   */
+  void setSimulationLodOrigins(const std::vector<glm::vec3>& origins);
+
+  /*!
+   * \brief Returns the bodies counts per simulation LOD gathered during the last LOD update
+   */
+  [[nodiscard]] PhysicsSimulationLodStatistics getSimulationLodStatistics() const;
+
+  /*!
+   * \brief Finds the closest object intersected by the segment
+   *
+   * \param query raycast query
+   * \return the closest hit, isHit is false if nothing is found
+   */
+  [[nodiscard]] PhysicsQueryHit raycast(const PhysicsRaycastQuery& query);
+
+  /*!
+   * \brief Performs a batch of raycasts, the queries could be processed in parallel
+   *
+   * \param queries raycast queries
+   * \param hits the closest hits, one per query
+   */
+  void raycast(std::span<const PhysicsRaycastQuery> queries, std::vector<PhysicsQueryHit>& hits);
+
+  /*!
+   * \brief Finds the first object hit by the convex shape moved along the segment
+   *
+   * \param query sweep query
+   * \return the closest hit, isHit is false if nothing is found
+   */
+  [[nodiscard]] PhysicsQueryHit sweep(const PhysicsSweepQuery& query);
+  void sweep(std::span<const PhysicsSweepQuery> queries, std::vector<PhysicsQueryHit>& hits);
+
+  /*!
+   * \brief Finds all objects intersecting with the convex shape
+   *
+   * \param query overlap query
+   * \param result objects list to append found objects
+   */
+  void overlap(const PhysicsOverlapQuery& query, std::vector<GameObject>& result);
+
+  /*!
+   * \brief Performs a batch of overlap tests
+   *
+   * Objects found for i-th query are stored in result[resultOffsets[i], resultOffsets[i + 1]) range.
+   */
+  void overlap(std::span<const PhysicsOverlapQuery> queries,
+    std::vector<GameObject>& result,
+    std::vector<size_t>& resultOffsets);
+
  private:
+  PhysicsSimulationSettings m_simulationSettings;
   std::shared_ptr<PhysicsSystemBackend> m_physicsBackend;
 };
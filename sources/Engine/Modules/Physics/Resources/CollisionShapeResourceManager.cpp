@@ -52,7 +52,12 @@ void CollisionShapeResourceManager::load(size_t resourceIndex)
         std::vector<glm::vec3> vertices =
           MemoryUtils::createBinaryCompatibleVector<RawVector3, glm::vec3>(rawShape.triangleMesh.vertices);
 
-        collisionShapes.push_back({CollisionShapeTriangleMesh(vertices), {0.0f, 0.0f, 0.0f}});
+        CollisionShapeTriangleMesh triangleMesh(std::move(vertices), rawShape.triangleMesh.indices);
+
+        // The baked BVH allows to share the shape between physics objects without rebuilding it on the level loading
+        triangleMesh.setOptimizedBvhData(rawShape.triangleMesh.optimizedBvh);
+
+        collisionShapes.push_back({std::move(triangleMesh), {0.0f, 0.0f, 0.0f}});
 
         break;
       }
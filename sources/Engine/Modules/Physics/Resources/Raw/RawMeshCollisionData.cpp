@@ -48,6 +48,16 @@ RawMeshCollisionData RawMeshCollisionData::readFromFile(const std::string& path)
 
         collisionDataFile.read(reinterpret_cast<char*>(shape.triangleMesh.vertices.data()),
           sizeof(*shape.triangleMesh.vertices.begin()) * shape.triangleMesh.header.verticesCount);
+
+        shape.triangleMesh.indices.resize(shape.triangleMesh.header.indicesCount);
+
+        collisionDataFile.read(reinterpret_cast<char*>(shape.triangleMesh.indices.data()),
+          sizeof(*shape.triangleMesh.indices.begin()) * shape.triangleMesh.header.indicesCount);
+
+        shape.triangleMesh.optimizedBvh.resize(shape.triangleMesh.header.optimizedBvhSize);
+
+        collisionDataFile.read(reinterpret_cast<char*>(shape.triangleMesh.optimizedBvh.data()),
+          shape.triangleMesh.header.optimizedBvhSize);
         break;
       default:
         SW_ASSERT(0);
@@ -68,8 +78,6 @@ void RawMeshCollisionData::writeToFile(const std::string& path, const RawMeshCol
 
   std::ofstream collisionDataFile(path, std::ios::binary);
 
-  const uint16_t collisionShapesCount = rawCollisionData.header.collisionShapesCount;
-
   collisionDataFile.write(reinterpret_cast<const char*>(&rawCollisionData.header), sizeof(rawCollisionData.header));
 
   for (auto& shape : rawCollisionData.collisionShapes) {
@@ -85,8 +93,18 @@ void RawMeshCollisionData::writeToFile(const std::string& path, const RawMeshCol
       case RawMeshCollisionShapeType::TriangleMesh:
         collisionDataFile.write(reinterpret_cast<const char*>(&shape.triangleMesh.header),sizeof(shape.triangleMesh.header));
 
+        SW_ASSERT(shape.triangleMesh.header.verticesCount == shape.triangleMesh.vertices.size() &&
+          shape.triangleMesh.header.indicesCount == shape.triangleMesh.indices.size() &&
+          shape.triangleMesh.header.optimizedBvhSize == shape.triangleMesh.optimizedBvh.size());
+
         collisionDataFile.write(reinterpret_cast<const char*>(shape.triangleMesh.vertices.data()),
           sizeof(*shape.triangleMesh.vertices.begin()) * shape.triangleMesh.header.verticesCount);
+
+        collisionDataFile.write(reinterpret_cast<const char*>(shape.triangleMesh.indices.data()),
+          sizeof(*shape.triangleMesh.indices.begin()) * shape.triangleMesh.header.indicesCount);
+
+        collisionDataFile.write(reinterpret_cast<const char*>(shape.triangleMesh.optimizedBvh.data()),
+          shape.triangleMesh.header.optimizedBvhSize);
         break;
       default:
         SW_ASSERT(0);
@@ -94,8 +112,5 @@ void RawMeshCollisionData::writeToFile(const std::string& path, const RawMeshCol
     }
   }
 
-  collisionDataFile.write(reinterpret_cast<const char*>(rawCollisionData.collisionShapes.data()),
-    sizeof(*rawCollisionData.collisionShapes.begin()) * collisionShapesCount);
-
   collisionDataFile.close();
 }
@@ -4,11 +4,12 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <cstddef>
 
 #include "Modules/ResourceManagement/RawDataStructures.h"
 #include "Modules/Math/geometry.h"
 
-constexpr uint16_t MESH_COLLISION_DATA_FORMAT_VERSION = 112;
+constexpr uint16_t MESH_COLLISION_DATA_FORMAT_VERSION = 113;
 
 enum class RawMeshCollisionShapeType {
   Sphere,
@@ -27,12 +28,18 @@ struct RawMeshCollisionShapeAABB {
 };
 
 struct RawMeshCollisionShapeTriangleMeshHeader {
-  uint16_t verticesCount = 0;
+  uint32_t verticesCount = 0;
+  uint32_t indicesCount = 0;
+
+  // Size of the serialized backend-specific BVH, zero if the BVH is not baked
+  uint32_t optimizedBvhSize = 0;
 };
 
 struct RawMeshCollisionShapeTriangleMesh {
   RawMeshCollisionShapeTriangleMeshHeader header;
   std::vector<RawVector3> vertices;
+  std::vector<uint32_t> indices;
+  std::vector<std::byte> optimizedBvh;
 };
 
 struct RawMeshCollisionShape {
@@ -44,6 +44,7 @@ glm::vec3 RigidBodyComponent::getLinearVelocity() const
 void RigidBodyComponent::setCollisionCallback(CollisionCallback callback)
 {
   m_collisionCallback = std::move(callback);
+  m_backend->enableCollisionEvents(m_isCollisionEventsEnabled || m_collisionCallback != nullptr);
 }
 
 CollisionCallback RigidBodyComponent::getCollisionCallback() const
@@ -104,6 +105,17 @@ bool RigidBodyComponent::isSimulationEnabled() const
   return m_backend->isSimulationEnabled();
 }
 
+void RigidBodyComponent::enableCollisionEvents(bool enable)
+{
+  m_isCollisionEventsEnabled = enable;
+  m_backend->enableCollisionEvents(m_isCollisionEventsEnabled || m_collisionCallback != nullptr);
+}
+
+bool RigidBodyComponent::isCollisionEventsEnabled() const
+{
+  return m_isCollisionEventsEnabled;
+}
+
 RigidBodyComponentBinder::RigidBodyComponentBinder(const ComponentBindingParameters& componentParameters,
   std::shared_ptr<ResourcesManager> resourcesManager)
   : m_bindingParameters(componentParameters),
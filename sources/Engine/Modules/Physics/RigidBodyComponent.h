@@ -52,6 +52,12 @@ struct RigidBodyComponent {
   void enableSimulation(bool enable);
   [[nodiscard]] bool isSimulationEnabled() const;
 
+  /*!
+   * \brief Enables collision events of the body, they are always enabled for bodies with collision callbacks
+   */
+  void enableCollisionEvents(bool enable);
+  [[nodiscard]] bool isCollisionEventsEnabled() const;
+
   [[nodiscard]] const RigidBodyComponentBackend& getBackend() const;
   [[nodiscard]] RigidBodyComponentBackend& getBackend();
 
@@ -63,6 +69,7 @@ struct RigidBodyComponent {
   ResourceHandle<CollisionShape> m_collisionShape;
   std::shared_ptr<RigidBodyComponentBackend> m_backend;
   CollisionCallback m_collisionCallback;
+  bool m_isCollisionEventsEnabled = false;
 };
 
 class RigidBodyComponentBinder : public GameObjectsComponentBinder<RigidBodyComponent> {
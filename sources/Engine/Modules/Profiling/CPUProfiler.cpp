@@ -0,0 +1,423 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "CPUProfiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <limits>
+#include <fstream>
+#include <spdlog/spdlog.h>
+
+namespace {
+
+// The scope is opened while the profiler was disabled, so its event is not written
+constexpr uint64_t NOT_RECORDED_SCOPE_TIME = std::numeric_limits<uint64_t>::max();
+
+/*!
+ * \brief Ring buffer slot guarded by the sequence counter
+ *
+ * The slot is written by the owning thread while other threads could read it, so the event fields are
+ * atomic and the reader validates the copied event by the sequence counter before and after the copying.
+ */
+struct ThreadEventSlot {
+  // Index of the stored event plus one, zero while the event is written
+  std::atomic<uint64_t> sequence = 0;
+
+  std::atomic<ProfilerScopeId> scopeId = 0;
+  std::atomic<uint32_t> depth = 0;
+  std::atomic<uint64_t> beginTime = 0;
+  std::atomic<uint64_t> endTime = 0;
+};
+
+struct ThreadEventsBuffer {
+  std::vector<ThreadEventSlot> events = std::vector<ThreadEventSlot>(CPUProfiler::THREAD_EVENTS_BUFFER_CAPACITY);
+
+  // Count of the events written by the thread, i-th event is stored in the (i % capacity) slot
+  std::atomic<uint64_t> writtenEventsCount = 0;
+
+  // Unfinished scopes, they are accessed only by the owning thread
+  std::vector<ProfilerEvent> openedScopes;
+
+  uint32_t threadIndex{};
+
+  // Counts of the events that are already processed, they are accessed only under the profiler mutex
+  uint64_t aggregatedEventsCount = 0;
+  uint64_t collectedEventsCount = 0;
+};
+
+struct TraceEvent {
+  ProfilerEvent event;
+  uint32_t threadIndex{};
+};
+
+struct FrameStatisticsNode {
+  ProfilerScopeStatistics statistics;
+
+  size_t firstChild = std::numeric_limits<size_t>::max();
+  size_t lastChild = std::numeric_limits<size_t>::max();
+  size_t nextSibling = std::numeric_limits<size_t>::max();
+};
+
+constexpr size_t NO_FRAME_STATISTICS_NODE = std::numeric_limits<size_t>::max();
+
+std::mutex g_profilerMutex;
+
+std::vector<std::string> g_scopesNames;
+std::unordered_map<std::string, ProfilerScopeId> g_scopesLookup;
+
+// Buffers are shared with the threads, so the events of finished threads are still collected
+std::vector<std::shared_ptr<ThreadEventsBuffer>> g_threadsBuffers;
+
+std::atomic<bool> g_isEnabled = true;
+std::atomic<bool> g_isTraceCaptured = false;
+
+std::vector<TraceEvent> g_traceEvents;
+
+std::vector<ProfilerEvent> g_frameEvents;
+std::vector<FrameStatisticsNode> g_frameStatisticsNodes;
+std::vector<size_t> g_frameStatisticsStack;
+std::vector<ProfilerScopeStatistics> g_frameStatistics;
+
+uint64_t g_frameBeginTime = 0;
+uint64_t g_frameTime = 0;
+
+const std::chrono::steady_clock::time_point g_profilerStartTime = std::chrono::steady_clock::now();
+
+uint64_t getCurrentTime()
+{
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - g_profilerStartTime).count());
+}
+
+ThreadEventsBuffer& getThreadEventsBuffer()
+{
+  thread_local std::shared_ptr<ThreadEventsBuffer> threadEventsBuffer = [] {
+    auto eventsBuffer = std::make_shared<ThreadEventsBuffer>();
+    eventsBuffer->openedScopes.reserve(64);
+
+    std::lock_guard<std::mutex> lock(g_profilerMutex);
+
+    eventsBuffer->threadIndex = static_cast<uint32_t>(g_threadsBuffers.size());
+    g_threadsBuffers.push_back(eventsBuffer);
+
+    return eventsBuffer;
+  }();
+
+  return *threadEventsBuffer;
+}
+
+/*!
+ * \brief Copies the events written after the specified count and returns the new count of the read events
+ *
+ * The buffer could be written by its thread during the copying, so the events that are overwritten
+ * or being written in the meantime are dropped.
+ */
+uint64_t readThreadEvents(const ThreadEventsBuffer& eventsBuffer, uint64_t readEventsCount,
+  std::vector<ProfilerEvent>& events)
+{
+  constexpr uint64_t capacity = CPUProfiler::THREAD_EVENTS_BUFFER_CAPACITY;
+
+  uint64_t writtenEventsCount = eventsBuffer.writtenEventsCount.load(std::memory_order_acquire);
+  uint64_t firstEventIndex = std::max(readEventsCount,
+    (writtenEventsCount > capacity) ? writtenEventsCount - capacity : 0);
+
+  for (uint64_t eventIndex = firstEventIndex; eventIndex < writtenEventsCount; eventIndex++) {
+    const ThreadEventSlot& slot = eventsBuffer.events[eventIndex % capacity];
+
+    if (slot.sequence.load(std::memory_order_acquire) != eventIndex + 1) {
+      continue;
+    }
+
+    ProfilerEvent event{
+      .scopeId = slot.scopeId.load(std::memory_order_relaxed),
+      .depth = slot.depth.load(std::memory_order_relaxed),
+      .beginTime = slot.beginTime.load(std::memory_order_relaxed),
+      .endTime = slot.endTime.load(std::memory_order_relaxed),
+    };
+
+    // The fields loads should not be reordered after the sequence check
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (slot.sequence.load(std::memory_order_relaxed) == eventIndex + 1) {
+      events.push_back(event);
+    }
+  }
+
+  return writtenEventsCount;
+}
+
+void collectFrameStatistics(size_t nodeIndex, uint32_t depth)
+{
+  for (size_t childIndex = g_frameStatisticsNodes[nodeIndex].firstChild; childIndex != NO_FRAME_STATISTICS_NODE;
+       childIndex = g_frameStatisticsNodes[childIndex].nextSibling) {
+    ProfilerScopeStatistics statistics = g_frameStatisticsNodes[childIndex].statistics;
+    statistics.depth = depth;
+
+    g_frameStatistics.push_back(statistics);
+
+    collectFrameStatistics(childIndex, depth + 1);
+  }
+}
+
+/*!
+ * \brief Merges the calls of the same scopes with the same parents into the calls hierarchy
+ */
+void aggregateFrameEvents(std::vector<ProfilerEvent>& events)
+{
+  // Parents are started before their children, the depth resolves the parents started at the same time
+  std::sort(events.begin(), events.end(), [](const ProfilerEvent& event1, const ProfilerEvent& event2) {
+    return std::tie(event1.beginTime, event1.depth) < std::tie(event2.beginTime, event2.depth);
+  });
+
+  g_frameStatisticsNodes.clear();
+  g_frameStatisticsNodes.emplace_back();
+
+  g_frameStatisticsStack.clear();
+
+  for (const ProfilerEvent& event : events) {
+    while (!g_frameStatisticsStack.empty() &&
+      g_frameStatisticsNodes[g_frameStatisticsStack.back()].statistics.depth >= event.depth) {
+      g_frameStatisticsStack.pop_back();
+    }
+
+    size_t parentIndex = g_frameStatisticsStack.empty() ? 0 : g_frameStatisticsStack.back();
+    size_t nodeIndex = g_frameStatisticsNodes[parentIndex].firstChild;
+
+    while (nodeIndex != NO_FRAME_STATISTICS_NODE &&
+      g_frameStatisticsNodes[nodeIndex].statistics.scopeId != event.scopeId) {
+      nodeIndex = g_frameStatisticsNodes[nodeIndex].nextSibling;
+    }
+
+    if (nodeIndex == NO_FRAME_STATISTICS_NODE) {
+      nodeIndex = g_frameStatisticsNodes.size();
+
+      FrameStatisticsNode& node = g_frameStatisticsNodes.emplace_back();
+      node.statistics.scopeId = event.scopeId;
+      node.statistics.depth = event.depth;
+
+      FrameStatisticsNode& parentNode = g_frameStatisticsNodes[parentIndex];
+
+      if (parentNode.lastChild == NO_FRAME_STATISTICS_NODE) {
+        parentNode.firstChild = nodeIndex;
+      }
+      else {
+        g_frameStatisticsNodes[parentNode.lastChild].nextSibling = nodeIndex;
+      }
+
+      parentNode.lastChild = nodeIndex;
+    }
+
+    ProfilerScopeStatistics& statistics = g_frameStatisticsNodes[nodeIndex].statistics;
+    statistics.totalTime += event.endTime - event.beginTime;
+    statistics.callsCount++;
+
+    g_frameStatisticsStack.push_back(nodeIndex);
+  }
+
+  g_frameStatistics.clear();
+  collectFrameStatistics(0, 0);
+}
+
+std::string escapeJsonString(const std::string& string)
+{
+  std::string escapedString;
+  escapedString.reserve(string.size());
+
+  for (char character : string) {
+    if (character == '"' || character == '\\') {
+      escapedString.push_back('\\');
+    }
+
+    escapedString.push_back(character);
+  }
+
+  return escapedString;
+}
+
+}
+
+ProfilerScopeId CPUProfiler::registerScope(std::string_view name)
+{
+  std::lock_guard<std::mutex> lock(g_profilerMutex);
+
+  auto [scopeIt, isInserted] = g_scopesLookup.emplace(std::string(name),
+    static_cast<ProfilerScopeId>(g_scopesNames.size()));
+
+  if (isInserted) {
+    g_scopesNames.emplace_back(name);
+  }
+
+  return scopeIt->second;
+}
+
+std::string CPUProfiler::getScopeName(ProfilerScopeId scopeId)
+{
+  std::lock_guard<std::mutex> lock(g_profilerMutex);
+
+  SW_ASSERT(scopeId < g_scopesNames.size());
+
+  return g_scopesNames[scopeId];
+}
+
+void CPUProfiler::setEnabled(bool isEnabled)
+{
+  g_isEnabled.store(isEnabled, std::memory_order_relaxed);
+}
+
+bool CPUProfiler::isEnabled()
+{
+  return g_isEnabled.load(std::memory_order_relaxed);
+}
+
+void CPUProfiler::beginScope(ProfilerScopeId scopeId)
+{
+  ThreadEventsBuffer& eventsBuffer = getThreadEventsBuffer();
+
+  // The scope is pushed even if the profiler is disabled, so the scopes stack stays balanced on the state change
+  eventsBuffer.openedScopes.push_back(ProfilerEvent{
+    .scopeId = scopeId,
+    .depth = static_cast<uint32_t>(eventsBuffer.openedScopes.size()),
+    .beginTime = isEnabled() ? getCurrentTime() : NOT_RECORDED_SCOPE_TIME,
+  });
+}
+
+void CPUProfiler::endScope()
+{
+  ThreadEventsBuffer& eventsBuffer = getThreadEventsBuffer();
+  SW_ASSERT(!eventsBuffer.openedScopes.empty());
+
+  ProfilerEvent event = eventsBuffer.openedScopes.back();
+  eventsBuffer.openedScopes.pop_back();
+
+  if (event.beginTime == NOT_RECORDED_SCOPE_TIME) {
+    return;
+  }
+
+  event.endTime = getCurrentTime();
+
+  uint64_t eventIndex = eventsBuffer.writtenEventsCount.load(std::memory_order_relaxed);
+  ThreadEventSlot& slot = eventsBuffer.events[eventIndex % THREAD_EVENTS_BUFFER_CAPACITY];
+
+  // The fields stores should not be reordered before the slot is marked as being written
+  slot.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot.scopeId.store(event.scopeId, std::memory_order_relaxed);
+  slot.depth.store(event.depth, std::memory_order_relaxed);
+  slot.beginTime.store(event.beginTime, std::memory_order_relaxed);
+  slot.endTime.store(event.endTime, std::memory_order_relaxed);
+
+  slot.sequence.store(eventIndex + 1, std::memory_order_release);
+  eventsBuffer.writtenEventsCount.store(eventIndex + 1, std::memory_order_release);
+}
+
+void CPUProfiler::finishFrame()
+{
+  ThreadEventsBuffer& frameEventsBuffer = getThreadEventsBuffer();
+  uint64_t currentTime = getCurrentTime();
+
+  std::lock_guard<std::mutex> lock(g_profilerMutex);
+
+  g_frameEvents.clear();
+  frameEventsBuffer.aggregatedEventsCount = readThreadEvents(frameEventsBuffer,
+    frameEventsBuffer.aggregatedEventsCount, g_frameEvents);
+
+  aggregateFrameEvents(g_frameEvents);
+
+  g_frameTime = currentTime - g_frameBeginTime;
+  g_frameBeginTime = currentTime;
+
+  if (!g_isTraceCaptured.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  for (const auto& eventsBuffer : g_threadsBuffers) {
+    g_frameEvents.clear();
+    eventsBuffer->collectedEventsCount = readThreadEvents(*eventsBuffer, eventsBuffer->collectedEventsCount,
+      g_frameEvents);
+
+    for (const ProfilerEvent& event : g_frameEvents) {
+      if (g_traceEvents.size() >= MAX_TRACE_EVENTS_COUNT) {
+        break;
+      }
+
+      g_traceEvents.push_back(TraceEvent{.event = event, .threadIndex = eventsBuffer->threadIndex});
+    }
+  }
+}
+
+const std::vector<ProfilerScopeStatistics>& CPUProfiler::getFrameStatistics()
+{
+  return g_frameStatistics;
+}
+
+uint64_t CPUProfiler::getFrameTime()
+{
+  return g_frameTime;
+}
+
+void CPUProfiler::startTraceCapture()
+{
+  std::lock_guard<std::mutex> lock(g_profilerMutex);
+
+  // Only the events written after the capture start are collected
+  for (const auto& eventsBuffer : g_threadsBuffers) {
+    eventsBuffer->collectedEventsCount = eventsBuffer->writtenEventsCount.load(std::memory_order_acquire);
+  }
+
+  g_traceEvents.clear();
+  g_isTraceCaptured.store(true, std::memory_order_relaxed);
+}
+
+void CPUProfiler::stopTraceCapture()
+{
+  g_isTraceCaptured.store(false, std::memory_order_relaxed);
+}
+
+bool CPUProfiler::isTraceCaptured()
+{
+  return g_isTraceCaptured.load(std::memory_order_relaxed);
+}
+
+bool CPUProfiler::exportChromeTrace(const std::string& path)
+{
+  std::lock_guard<std::mutex> lock(g_profilerMutex);
+
+  std::ofstream traceFile(path, std::ios::trunc);
+
+  if (!traceFile.is_open()) {
+    spdlog::error("Profiler trace can not be written to {}", path);
+    return false;
+  }
+
+  std::vector<std::string> escapedScopesNames;
+  escapedScopesNames.reserve(g_scopesNames.size());
+
+  for (const std::string& scopeName : g_scopesNames) {
+    escapedScopesNames.push_back(escapeJsonString(scopeName));
+  }
+
+  traceFile << "{\"traceEvents\":[";
+
+  for (size_t eventIndex = 0; eventIndex < g_traceEvents.size(); eventIndex++) {
+    const TraceEvent& traceEvent = g_traceEvents[eventIndex];
+
+    // The trace event format timestamps are in microseconds
+    traceFile << fmt::format("{}\n{{\"name\":\"{}\",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+                             "\"pid\":0,\"tid\":{}}}",
+      (eventIndex == 0) ? "" : ",",
+      escapedScopesNames[traceEvent.event.scopeId],
+      static_cast<double>(traceEvent.event.beginTime) / 1000.0,
+      static_cast<double>(traceEvent.event.endTime - traceEvent.event.beginTime) / 1000.0,
+      traceEvent.threadIndex);
+  }
+
+  traceFile << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  spdlog::info("Profiler trace with {} events is written to {}", g_traceEvents.size(), path);
+
+  return true;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using ProfilerScopeId = uint32_t;
+
+/*!
+ * \brief Timing of a finished profiler scope, the times are in nanoseconds since the profiler start
+ */
+struct ProfilerEvent {
+  ProfilerScopeId scopeId{};
+  uint32_t depth{};
+
+  uint64_t beginTime{};
+  uint64_t endTime{};
+};
+
+/*!
+ * \brief Aggregated timing of a scope in the calls hierarchy of a frame
+ */
+struct ProfilerScopeStatistics {
+  ProfilerScopeId scopeId{};
+  uint32_t depth{};
+
+  uint64_t totalTime{};
+  size_t callsCount{};
+};
+
+/*!
+ * \brief Hierarchical CPU profiler with thread-local events ring buffers
+ *
+ * Scopes only write their timings to the buffer of the current thread, the events are aggregated
+ * and collected for the trace on the main thread once per frame. The oldest events are overwritten
+ * if the buffer is not collected in time.
+ */
+class CPUProfiler {
+ public:
+  CPUProfiler() = delete;
+
+  /*!
+   * \brief Registers the scope name, the same identifier is returned for the same names
+   */
+  [[nodiscard]] static ProfilerScopeId registerScope(std::string_view name);
+  [[nodiscard]] static std::string getScopeName(ProfilerScopeId scopeId);
+
+  static void setEnabled(bool isEnabled);
+  [[nodiscard]] static bool isEnabled();
+
+  static void beginScope(ProfilerScopeId scopeId);
+  static void endScope();
+
+  /*!
+   * \brief Finishes the current frame of the calling thread, it should be called on the main thread
+   *
+   * The frame events are aggregated into the frame statistics and collected to the trace if it is captured.
+   */
+  static void finishFrame();
+
+  /*!
+   * \brief Returns the calls hierarchy of the last finished frame in the depth-first order
+   */
+  [[nodiscard]] static const std::vector<ProfilerScopeStatistics>& getFrameStatistics();
+  [[nodiscard]] static uint64_t getFrameTime();
+
+  static void startTraceCapture();
+  static void stopTraceCapture();
+  [[nodiscard]] static bool isTraceCaptured();
+
+  /*!
+   * \brief Writes the captured events of all threads in the Chrome trace event format
+   *
+   * \param path output file path
+   * \return true if the file is written
+   */
+  static bool exportChromeTrace(const std::string& path);
+
+ public:
+  static constexpr size_t THREAD_EVENTS_BUFFER_CAPACITY = 16384;
+  static constexpr size_t MAX_TRACE_EVENTS_COUNT = 4 * 1024 * 1024;
+};
+
+/*!
+ * \brief Measures the time of the enclosing code block
+ */
+class CPUProfilerScope {
+ public:
+  explicit CPUProfilerScope(ProfilerScopeId scopeId)
+  {
+    CPUProfiler::beginScope(scopeId);
+  }
+
+  ~CPUProfilerScope()
+  {
+    CPUProfiler::endScope();
+  }
+
+  CPUProfilerScope(const CPUProfilerScope&) = delete;
+  CPUProfilerScope& operator=(const CPUProfilerScope&) = delete;
+};
+
+#define SW_PROFILER_CONCAT_IMPL(a, b) a##b
+#define SW_PROFILER_CONCAT(a, b) SW_PROFILER_CONCAT_IMPL(a, b)
+
+#ifdef SW_PROFILER_ENABLED
+#define SW_PROFILE_SCOPE(name) \
+  static const ProfilerScopeId SW_PROFILER_CONCAT(profilerScopeId, __LINE__) = CPUProfiler::registerScope(name); \
+  CPUProfilerScope SW_PROFILER_CONCAT(profilerScope, __LINE__)(SW_PROFILER_CONCAT(profilerScopeId, __LINE__))
+
+#define SW_PROFILE_SCOPE_ID(scopeId) \
+  CPUProfilerScope SW_PROFILER_CONCAT(profilerScope, __LINE__)(scopeId)
+#else
+#define SW_PROFILE_SCOPE(name) ((void)0)
+#define SW_PROFILE_SCOPE_ID(scopeId) ((void)(scopeId))
+#endif
@@ -0,0 +1,337 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "MemoryTracker.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "Exceptions/exceptions.h"
+
+namespace {
+
+struct MemoryCounterData {
+  // The counters only grow, so the live values are consistent enough without the locks
+  std::atomic<size_t> allocationsCount = 0;
+  std::atomic<size_t> deallocationsCount = 0;
+
+  std::atomic<size_t> allocatedBytes = 0;
+  std::atomic<size_t> deallocatedBytes = 0;
+
+  // Frame values are accessed only by the main thread
+  size_t frameBeginAllocationsCount = 0;
+  size_t frameAllocationsCount = 0;
+};
+
+std::array<MemoryCounterData, MemoryTracker::MAX_COUNTERS_COUNT> g_counters;
+
+std::mutex g_countersNamesMutex;
+
+// The order should match the predefined counters identifiers
+std::vector<std::string> g_countersNames = {"ecs", "gui", "physics", "scripting"};
+
+std::atomic<size_t> g_heapAllocationsCount = 0;
+
+size_t g_frameBeginHeapAllocationsCount = 0;
+size_t g_frameHeapAllocationsCount = 0;
+
+size_t getDifference(size_t minuend, size_t subtrahend)
+{
+  // The values could be read in the middle of the allocation, so they are clamped instead of wrapping
+  return (minuend > subtrahend) ? minuend - subtrahend : 0;
+}
+
+}
+
+MemoryCounterId MemoryTracker::registerCounter(std::string_view name)
+{
+  std::lock_guard<std::mutex> lock(g_countersNamesMutex);
+
+  auto counterIt = std::find(g_countersNames.begin(), g_countersNames.end(), name);
+
+  if (counterIt != g_countersNames.end()) {
+    return static_cast<MemoryCounterId>(std::distance(g_countersNames.begin(), counterIt));
+  }
+
+  if (g_countersNames.size() >= MAX_COUNTERS_COUNT) {
+    THROW_EXCEPTION(EngineRuntimeException, "Memory counters limit is exceeded, counter " + std::string(name));
+  }
+
+  g_countersNames.emplace_back(name);
+
+  return static_cast<MemoryCounterId>(g_countersNames.size() - 1);
+}
+
+std::string MemoryTracker::getCounterName(MemoryCounterId counterId)
+{
+  std::lock_guard<std::mutex> lock(g_countersNamesMutex);
+
+  return g_countersNames[counterId];
+}
+
+size_t MemoryTracker::getCountersCount()
+{
+  std::lock_guard<std::mutex> lock(g_countersNamesMutex);
+
+  return g_countersNames.size();
+}
+
+void MemoryTracker::registerAllocation(MemoryCounterId counterId, size_t size)
+{
+  SW_ASSERT(counterId < MAX_COUNTERS_COUNT);
+
+  MemoryCounterData& counter = g_counters[counterId];
+  counter.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  counter.allocationsCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::registerDeallocation(MemoryCounterId counterId, size_t size)
+{
+  SW_ASSERT(counterId < MAX_COUNTERS_COUNT);
+
+  MemoryCounterData& counter = g_counters[counterId];
+  counter.deallocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  counter.deallocationsCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::finishFrame()
+{
+  for (MemoryCounterData& counter : g_counters) {
+    size_t allocationsCount = counter.allocationsCount.load(std::memory_order_relaxed);
+
+    counter.frameAllocationsCount = allocationsCount - counter.frameBeginAllocationsCount;
+    counter.frameBeginAllocationsCount = allocationsCount;
+  }
+
+  size_t heapAllocationsCount = g_heapAllocationsCount.load(std::memory_order_relaxed);
+
+  g_frameHeapAllocationsCount = heapAllocationsCount - g_frameBeginHeapAllocationsCount;
+  g_frameBeginHeapAllocationsCount = heapAllocationsCount;
+}
+
+MemoryCounterStatistics MemoryTracker::getCounterStatistics(MemoryCounterId counterId)
+{
+  SW_ASSERT(counterId < MAX_COUNTERS_COUNT);
+
+  const MemoryCounterData& counter = g_counters[counterId];
+
+  size_t allocationsCount = counter.allocationsCount.load(std::memory_order_relaxed);
+
+  return MemoryCounterStatistics{
+    .counterId = counterId,
+    .liveBytes = getDifference(counter.allocatedBytes.load(std::memory_order_relaxed),
+      counter.deallocatedBytes.load(std::memory_order_relaxed)),
+    .liveAllocationsCount = getDifference(allocationsCount, counter.deallocationsCount.load(std::memory_order_relaxed)),
+    .allocationsCount = allocationsCount,
+    .frameAllocationsCount = counter.frameAllocationsCount,
+  };
+}
+
+size_t MemoryTracker::getFrameHeapAllocationsCount()
+{
+  return g_frameHeapAllocationsCount;
+}
+
+size_t MemoryTracker::getHeapAllocationsCount()
+{
+  return g_heapAllocationsCount.load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::registerHeapAllocation()
+{
+  g_heapAllocationsCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool MemoryTracker::isHeapAllocationsTrackingEnabled()
+{
+#ifdef SW_HEAP_ALLOCATIONS_TRACKING_ENABLED
+  return true;
+#else
+  return false;
+#endif
+}
+
+#ifdef SW_HEAP_ALLOCATIONS_TRACKING_ENABLED
+
+// All replaceable forms are defined, as the standard libraries do not forward the aligned forms to the default
+// ones, and the forwarding of the array and nothrow forms is not guaranteed
+
+namespace {
+
+bool isOverAligned(std::size_t alignment)
+{
+  return alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+}
+
+void* allocateHeapMemory(std::size_t size, std::size_t alignment)
+{
+  MemoryTracker::registerHeapAllocation();
+
+  if (size == 0) {
+    size = 1;
+  }
+
+  while (true) {
+    void* pointer = nullptr;
+
+    if (!isOverAligned(alignment)) {
+      pointer = std::malloc(size);
+    }
+    else {
+#ifdef _WIN32
+      pointer = _aligned_malloc(size, alignment);
+#else
+      // The size of the aligned allocation should be a multiple of the alignment
+      pointer = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+    }
+
+    if (pointer != nullptr) {
+      return pointer;
+    }
+
+    std::new_handler handler = std::get_new_handler();
+
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+
+    handler();
+  }
+}
+
+void* allocateHeapMemoryNoThrow(std::size_t size, std::size_t alignment) noexcept
+{
+  try {
+    return allocateHeapMemory(size, alignment);
+  }
+  catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void freeHeapMemory(void* pointer, std::size_t alignment) noexcept
+{
+#ifdef _WIN32
+  if (isOverAligned(alignment)) {
+    _aligned_free(pointer);
+    return;
+  }
+#else
+  ARG_UNUSED(alignment);
+#endif
+
+  std::free(pointer);
+}
+
+}
+
+void* operator new(std::size_t size)
+{
+  return allocateHeapMemory(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size)
+{
+  return allocateHeapMemory(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  return allocateHeapMemory(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+  return allocateHeapMemory(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocateHeapMemoryNoThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocateHeapMemoryNoThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  return allocateHeapMemoryNoThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  return allocateHeapMemoryNoThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept
+{
+  freeHeapMemory(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+  freeHeapMemory(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+  freeHeapMemory(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+  freeHeapMemory(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept
+{
+  freeHeapMemory(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept
+{
+  freeHeapMemory(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+  freeHeapMemory(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+  freeHeapMemory(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+  freeHeapMemory(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+  freeHeapMemory(pointer, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  freeHeapMemory(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  freeHeapMemory(pointer, static_cast<std::size_t>(alignment));
+}
+
+#endif
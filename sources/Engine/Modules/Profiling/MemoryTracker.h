@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "swdebug.h"
+
+using MemoryCounterId = uint32_t;
+
+/*!
+ * \brief Predefined memory counters of the engine subsystems
+ *
+ * The resources are counted per resource type, the types counters are registered by the resources managers.
+ */
+struct MemoryCounters {
+  static constexpr MemoryCounterId ECS = 0;
+  static constexpr MemoryCounterId GUI = 1;
+  static constexpr MemoryCounterId Physics = 2;
+  static constexpr MemoryCounterId Scripting = 3;
+};
+
+struct MemoryCounterStatistics {
+  MemoryCounterId counterId{};
+
+  size_t liveBytes{};
+  size_t liveAllocationsCount{};
+
+  size_t allocationsCount{};
+
+  // Allocations of the last finished frame
+  size_t frameAllocationsCount{};
+};
+
+/*!
+ * \brief Live memory and allocations counters of the engine subsystems
+ *
+ * The counters are updated by the tagged allocators of the subsystems and are lock-free, so they could be
+ * updated from any thread. The global heap allocations are counted separately, without the sizes, to
+ * report the allocations count of every frame.
+ */
+class MemoryTracker {
+ public:
+  MemoryTracker() = delete;
+
+  /*!
+   * \brief Registers the counter name, the same identifier is returned for the same names
+   */
+  [[nodiscard]] static MemoryCounterId registerCounter(std::string_view name);
+  [[nodiscard]] static std::string getCounterName(MemoryCounterId counterId);
+  [[nodiscard]] static size_t getCountersCount();
+
+  static void registerAllocation(MemoryCounterId counterId, size_t size);
+  static void registerDeallocation(MemoryCounterId counterId, size_t size);
+
+  /*!
+   * \brief Finishes the current frame, it should be called on the main thread
+   */
+  static void finishFrame();
+
+  [[nodiscard]] static MemoryCounterStatistics getCounterStatistics(MemoryCounterId counterId);
+
+  /*!
+   * \brief Returns the count of all heap allocations of the last finished frame, on all threads
+   *
+   * The allocations are counted only if the engine is built with the heap allocations tracking.
+   */
+  [[nodiscard]] static size_t getFrameHeapAllocationsCount();
+  [[nodiscard]] static size_t getHeapAllocationsCount();
+
+  /*!
+   * \brief Checks whether the global allocation functions are replaced to count the heap allocations
+   */
+  [[nodiscard]] static bool isHeapAllocationsTrackingEnabled();
+
+  static void registerHeapAllocation();
+
+ public:
+  static constexpr size_t MAX_COUNTERS_COUNT = 128;
+};
+
+/*!
+ * \brief Standard allocator that reports the allocated memory to the memory counter
+ */
+template<class T, MemoryCounterId CounterId>
+class TrackedAllocator {
+ public:
+  using value_type = T;
+
+  template<class U>
+  struct rebind {
+    using other = TrackedAllocator<U, CounterId>;
+  };
+
+ public:
+  TrackedAllocator() noexcept = default;
+
+  // Containers rebind the allocator to their nodes types
+  template<class U>
+  TrackedAllocator(const TrackedAllocator<U, CounterId>& allocator) noexcept
+  {
+    ARG_UNUSED(allocator);
+  }
+
+  [[nodiscard]] T* allocate(size_t count)
+  {
+    T* pointer = std::allocator<T>().allocate(count);
+    MemoryTracker::registerAllocation(CounterId, count * sizeof(T));
+
+    return pointer;
+  }
+
+  void deallocate(T* pointer, size_t count) noexcept
+  {
+    MemoryTracker::registerDeallocation(CounterId, count * sizeof(T));
+    std::allocator<T>().deallocate(pointer, count);
+  }
+
+  template<class U>
+  bool operator==(const TrackedAllocator<U, CounterId>& allocator) const noexcept
+  {
+    ARG_UNUSED(allocator);
+
+    return true;
+  }
+};
+
+template<class T, MemoryCounterId CounterId>
+using TrackedVector = std::vector<T, TrackedAllocator<T, CounterId>>;
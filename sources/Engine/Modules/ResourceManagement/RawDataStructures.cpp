@@ -31,6 +31,16 @@ glm::mat4 rawMatrix4ToGLMMatrix4(const RawMatrix4& matrix)
   return glmMatrix;
 }
 
+RawVector2 glmVector2ToRawVector2(const glm::vec2& vector)
+{
+  return RawVector2{.x = vector.x, .y = vector.y};
+}
+
+glm::vec2 rawVector2ToGLMVector2(const RawVector2& vector)
+{
+  return glm::vec2(vector.x, vector.y);
+}
+
 RawVector3 glmVector3ToRawVector3(const glm::vec3& vector)
 {
   return RawVector3{.x = vector.x, .y = vector.y, .z = vector.z};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <glm/vec2.hpp>
 #include <glm/mat4x4.hpp>
 #include <glm/gtc/quaternion.hpp>
 
@@ -78,6 +79,9 @@ struct RawQuaternion {
 RawMatrix4 glmMatrix4ToRawMatrix4(const glm::mat4& matrix);
 glm::mat4 rawMatrix4ToGLMMatrix4(const RawMatrix4& matrix);
 
+RawVector2 glmVector2ToRawVector2(const glm::vec2& vector);
+glm::vec2 rawVector2ToGLMVector2(const RawVector2& vector);
+
 RawVector3 glmVector3ToRawVector3(const glm::vec3& vector);
 glm::vec3 rawVector3ToGLMVector3(const RawVector3& vector);
 
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <spdlog/spdlog.h>
+#include <boost/core/demangle.hpp>
 
 #include "Utility/DynamicObjectsPool.h"
 #include "Utility/xml.h"
@@ -94,12 +95,23 @@ class SpecificResourceManager : public BaseResourceManager {
     :
     BaseResourceManager(resourceManager,
       ResourceTypeIdentifier::getTypeId<ResourceType>(),
-      std::make_unique<ResourcesStorage<ResourceType>>(),
+      std::make_unique<ResourcesStorage<ResourceType>>(getMemoryCounterId()),
       std::move(configurationPool))
   {
 
   }
 
+  /*!
+   * \brief Returns the memory counter of the resources of the type and their configurations
+   */
+  [[nodiscard]] static MemoryCounterId getMemoryCounterId()
+  {
+    static MemoryCounterId memoryCounterId = MemoryTracker::registerCounter(
+      "resources/" + boost::core::demangle(typeid(ResourceType).name()));
+
+    return memoryCounterId;
+  }
+
   template<class ResourceInheritor, class... Args>
   inline ResourceType* allocateResource(size_t resourceIndex, Args&& ... args)
   {
@@ -142,7 +154,8 @@ class ResourceManager : public SpecificResourceManager<ResourceType> {
  public:
   explicit ResourceManager(ResourcesManager* resourcesManager)
     : SpecificResourceManager<ResourceType>(resourcesManager,
-    std::make_unique<DynamicObjectsPool<ResourceConfigurationType>>(2048))
+    std::make_unique<DynamicObjectsPool<ResourceConfigurationType>>(2048,
+      SpecificResourceManager<ResourceType>::getMemoryCounterId()))
   {
 
   }
@@ -19,6 +19,7 @@
 #include "ResourcesStorage.h"
 #include "ResourceManager.h"
 
+#include "Modules/Profiling/CPUProfiler.h"
 #include "options.h"
 
 class ResourcesManager {
@@ -130,7 +131,11 @@ class ResourcesManager {
           resourceState.getResourceName());
       }
 
-      resourceManager->load(resourceHandle->getResourceIndex());
+      {
+        SW_PROFILE_SCOPE("ResourcesManager::load");
+        resourceManager->load(resourceHandle->getResourceIndex());
+      }
+
       resourceState.setLoadingState(ResourceLoadingState::Loaded);
 
       resourceHandle->m_resourcePtr = resourceManager->getResourcePtr(resourceHandle->getResourceIndex());
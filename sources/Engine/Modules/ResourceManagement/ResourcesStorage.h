@@ -2,6 +2,8 @@
 
 #include <vector>
 
+#include "Modules/Profiling/MemoryTracker.h"
+
 class BaseResourcesStorage {
  public:
   BaseResourcesStorage() = default;
@@ -27,12 +29,18 @@ class BaseResourcesStorage {
 template<class ResourceType>
 class ResourcesStorage : public BaseResourcesStorage {
  public:
-  ResourcesStorage() = default;
+  explicit ResourcesStorage(MemoryCounterId memoryCounterId)
+    : m_memoryCounterId(memoryCounterId)
+  {
+
+  }
+
   ~ResourcesStorage() override = default;
 
   [[nodiscard]] size_t increaseStorageSize() override
   {
     m_resources.push_back(nullptr);
+    m_resourcesSizes.push_back(0);
 
     return m_resources.size() - 1;
   }
@@ -44,11 +52,19 @@ class ResourcesStorage : public BaseResourcesStorage {
 
     m_resources[resourceIndex] = resourcePointer;
 
+    // Only the resource object itself is counted, the resource could own other allocations
+    m_resourcesSizes[resourceIndex] = sizeof(ResourceInheritor);
+    MemoryTracker::registerAllocation(m_memoryCounterId, sizeof(ResourceInheritor));
+
     return resourcePointer;
   }
 
   void freeResource(size_t resourceIndex) override
   {
+    if (m_resources[resourceIndex] != nullptr) {
+      MemoryTracker::registerDeallocation(m_memoryCounterId, m_resourcesSizes[resourceIndex]);
+    }
+
     delete m_resources[resourceIndex];
     m_resources[resourceIndex] = nullptr;
   }
@@ -67,4 +83,7 @@ class ResourcesStorage : public BaseResourcesStorage {
   // TODO: dynamic memory allocations lead to memory fragmentation
   //  so it will be better to use continuous memory storage
   std::vector<ResourceType*> m_resources;
+  std::vector<size_t> m_resourcesSizes;
+
+  MemoryCounterId m_memoryCounterId;
 };
\ No newline at end of file
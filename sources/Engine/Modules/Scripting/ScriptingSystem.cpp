@@ -34,7 +34,7 @@ void ScriptingSystem::unconfigure()
 
 EventProcessStatus ScriptingSystem::receiveEvent(const ExecuteScriptDirectedActionCommand& event)
 {
-  auto actionHandler = findActionHandler(event.actionName);
+  const auto& actionHandler = findActionHandler(event.actionName);
   validateActionCallResult(actionHandler(event.initiator.getName(), event.target.getName()));
 
   return EventProcessStatus::Processed;
@@ -42,7 +42,7 @@ EventProcessStatus ScriptingSystem::receiveEvent(const ExecuteScriptDirectedActi
 
 EventProcessStatus ScriptingSystem::receiveEvent(const ExecuteScriptSimpleActionCommand& event)
 {
-  auto actionHandler = findActionHandler(event.actionName);
+  const auto& actionHandler = findActionHandler(event.actionName);
   validateActionCallResult(actionHandler());
 
   return EventProcessStatus::Processed;
@@ -50,23 +50,37 @@ EventProcessStatus ScriptingSystem::receiveEvent(const ExecuteScriptSimpleAction
 
 EventProcessStatus ScriptingSystem::receiveEvent(const ExecuteScriptUndirectedActionCommand& event)
 {
-  auto actionHandler = findActionHandler(event.actionName);
+  const auto& actionHandler = findActionHandler(event.actionName);
   validateActionCallResult(actionHandler(event.initiator.getName()));
 
   return EventProcessStatus::Processed;
 }
 
-sol::protected_function ScriptingSystem::findActionHandler(const std::string& handlerName)
+const sol::protected_function& ScriptingSystem::findActionHandler(const std::string& handlerName)
 {
+  if (m_actionHandlersScriptsRevision != m_scriptsExecutor->getScriptsRevision()) {
+    m_actionHandlers.clear();
+    m_actionHandlersScriptsRevision = m_scriptsExecutor->getScriptsRevision();
+  }
+
+  auto actionHandlerIt = m_actionHandlers.find(handlerName);
+
+  if (actionHandlerIt != m_actionHandlers.end()) {
+    return actionHandlerIt->second;
+  }
+
+  // The expression is evaluated to support the handlers that are stored in tables, e.g. "quests.on_talk"
   auto actionHandlerFindExpression = m_scriptsExecutor->getLuaState().load("return " + handlerName);
   auto actionFindingResult = actionHandlerFindExpression();
 
-  return static_cast<sol::protected_function>(actionFindingResult);
+  // Missing handlers are cached as well, calling them reports the error the same way
+  return m_actionHandlers.emplace(handlerName,
+    static_cast<sol::protected_function>(actionFindingResult)).first->second;
 }
 
 EventProcessStatus ScriptingSystem::receiveEvent(const ExecuteScriptParametricActionCommand& event)
 {
-  auto actionHandler = findActionHandler(event.getActionName());
+  const auto& actionHandler = findActionHandler(event.getActionName());
   validateActionCallResult(event.apply(actionHandler));
 
   return EventProcessStatus::Processed;
@@ -87,3 +101,8 @@ std::shared_ptr<ScriptsExecutor> ScriptingSystem::getScriptsExecutor() const
 {
   return m_scriptsExecutor;
 }
+
+void ScriptingSystem::reloadScripts()
+{
+  m_scriptsExecutor->reloadScripts();
+}
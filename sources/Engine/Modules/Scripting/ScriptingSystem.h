@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <utility>
+#include <unordered_map>
 
 #include "Modules/ECS/ECS.h"
 #include "ScriptsExecutor.h"
@@ -23,8 +24,8 @@ struct ExecuteScriptDirectedActionCommand {
 
 struct ExecuteScriptParametricActionCommand {
  public:
-  [[nodiscard]] sol::protected_function_result apply(sol::protected_function actionHandler) const {
-    return m_actionApplier(std::move(actionHandler));
+  [[nodiscard]] sol::protected_function_result apply(const sol::protected_function& actionHandler) const {
+    return m_actionApplier(actionHandler);
   }
 
   template<class TupleType>
@@ -33,7 +34,7 @@ struct ExecuteScriptParametricActionCommand {
 
     actionCommand.m_actionName = actionName;
 
-    actionCommand.m_actionApplier = [parameters] (sol::protected_function actionHandler) {
+    actionCommand.m_actionApplier = [parameters] (const sol::protected_function& actionHandler) {
       return std::apply(actionHandler, parameters);
     };
 
@@ -49,7 +50,7 @@ struct ExecuteScriptParametricActionCommand {
 
  private:
   std::string m_actionName;
-  std::function<sol::protected_function_result(sol::protected_function actionHandler)> m_actionApplier;
+  std::function<sol::protected_function_result(const sol::protected_function& actionHandler)> m_actionApplier;
 };
 
 class ScriptingSystem : public GameSystem,
@@ -71,11 +72,22 @@ class ScriptingSystem : public GameSystem,
 
   [[nodiscard]] std::shared_ptr<ScriptsExecutor> getScriptsExecutor() const;
 
+  /*!
+   * \brief Reloads the game scripts, the cached action handlers are resolved again on the next actions
+   */
+  void reloadScripts();
+
  private:
-  [[nodiscard]] sol::protected_function findActionHandler(const std::string& handlerName);
+  /*!
+   * \brief Returns the cached action handler, the handler is resolved by its name only on the first call
+   */
+  [[nodiscard]] const sol::protected_function& findActionHandler(const std::string& handlerName);
   void validateActionCallResult(const sol::protected_function_result& result);
 
  private:
   std::shared_ptr<ScriptsExecutor> m_scriptsExecutor;
+
+  std::unordered_map<std::string, sol::protected_function> m_actionHandlers;
+  size_t m_actionHandlersScriptsRevision = 0;
 };
 
@@ -4,12 +4,15 @@
 
 #include "ScriptsExecutor.h"
 
+#include <fstream>
+#include <filesystem>
 #include <spdlog/spdlog.h>
 #include <glm/gtx/string_cast.hpp>
 
 #include "Exceptions/exceptions.h"
 
 #include "Utility/files.h"
+#include "Modules/Profiling/MemoryTracker.h"
 
 inline void luaStatePanic(sol::optional<std::string> errorMessage)
 {
@@ -25,40 +28,191 @@ ScriptsExecutor::ScriptsExecutor(std::shared_ptr<GameWorld> gameWorld)
     m_luaState(sol::c_call<decltype(&luaStatePanic), &luaStatePanic>),
     m_scriptsGameWorld(std::make_shared<ScriptsGameWorld>(gameWorld))
 {
+  installTrackedAllocator();
+
   m_luaState.open_libraries(sol::lib::base, sol::lib::string);
 
   registerCommonTypes();
   registerGameWorld();
 
+  loadScripts();
+}
+
+ScriptsExecutor::~ScriptsExecutor()
+{
+
+}
+
+void ScriptsExecutor::installTrackedAllocator()
+{
+  lua_State* luaState = m_luaState.lua_state();
+
+  // LuaJIT does not allow to create 64-bit states with a custom allocator, so the
+  // default allocator of the created state is wrapped instead
+  m_luaAllocator = lua_getallocf(luaState, &m_luaAllocatorUserData);
+
+  // The initial state memory is allocated before the wrapping, so it is reported as a single block
+  auto initialMemorySize = static_cast<size_t>(lua_gc(luaState, LUA_GCCOUNT, 0)) * 1024 +
+    static_cast<size_t>(lua_gc(luaState, LUA_GCCOUNTB, 0));
+  MemoryTracker::registerAllocation(MemoryCounters::Scripting, initialMemorySize);
+
+  lua_setallocf(luaState, &ScriptsExecutor::allocateTrackedMemory, this);
+}
+
+void* ScriptsExecutor::allocateTrackedMemory(void* userData, void* pointer, size_t oldSize, size_t newSize)
+{
+  auto* executor = static_cast<ScriptsExecutor*>(userData);
+  void* newPointer = executor->m_luaAllocator(executor->m_luaAllocatorUserData, pointer, oldSize, newSize);
+
+  // The old block is kept if the reallocation is failed
+  if (pointer != nullptr && (newSize == 0 || newPointer != nullptr)) {
+    MemoryTracker::registerDeallocation(MemoryCounters::Scripting, oldSize);
+  }
+
+  if (newSize != 0 && newPointer != nullptr) {
+    MemoryTracker::registerAllocation(MemoryCounters::Scripting, newSize);
+  }
+
+  return newPointer;
+}
+
+const sol::state& ScriptsExecutor::getLuaState() const
+{
+  return m_luaState;
+}
+
+sol::state& ScriptsExecutor::getLuaState()
+{
+  return m_luaState;
+}
+
+void ScriptsExecutor::reloadScripts()
+{
+  loadScripts();
+
+  m_scriptsRevision++;
+}
+
+size_t ScriptsExecutor::getScriptsRevision() const
+{
+  return m_scriptsRevision;
+}
+
+void ScriptsExecutor::loadScripts()
+{
   std::vector<std::string> scriptsList = FileUtils::getScriptsList();
 
   for (const std::string& scriptName : scriptsList) {
-    try {
-      if (scriptName != "annotations") {
-        spdlog::info("Load script {}", scriptName);
-        m_luaState.script_file(FileUtils::getScriptPath(scriptName));
-      }
+    if (scriptName == "annotations") {
+      continue;
     }
-    catch (const sol::error& error) {
+
+    spdlog::info("Load script {}", scriptName);
+
+    sol::protected_function_result result = loadScriptChunk(scriptName)();
+
+    if (!result.valid()) {
+      sol::error error = result;
+
       THROW_EXCEPTION(EngineRuntimeException,
         fmt::format("Script can not be loaded, name {}, error {}", scriptName, error.what()));
     }
   }
 }
 
-ScriptsExecutor::~ScriptsExecutor()
+sol::protected_function ScriptsExecutor::loadScriptChunk(const std::string& scriptName)
 {
+  std::string scriptPath = FileUtils::getScriptPath(scriptName);
+  std::string cachePath = FileUtils::getScriptBytecodeCachePath(scriptName);
+
+  // The chunk name is the same for the source and the bytecode, so the error messages refer to the script file
+  std::string chunkName = "@" + scriptPath;
+
+  std::string source = FileUtils::readFile(scriptPath);
+  uint64_t sourceHash = getSourceHash(source);
+
+  if (std::optional<std::string> bytecode = readBytecodeCache(cachePath, sourceHash)) {
+    sol::load_result chunk = m_luaState.load(std::string_view(*bytecode), chunkName, sol::load_mode::binary);
+
+    if (chunk.valid()) {
+      return chunk.get<sol::protected_function>();
+    }
 
+    spdlog::warn("Script {} bytecode cache is incompatible with the Lua runtime, the script will be compiled",
+      scriptName);
+  }
+
+  sol::load_result chunk = m_luaState.load(std::string_view(source), chunkName, sol::load_mode::text);
+
+  if (!chunk.valid()) {
+    sol::error error = chunk;
+
+    THROW_EXCEPTION(EngineRuntimeException,
+      fmt::format("Script can not be loaded, name {}, error {}", scriptName, error.what()));
+  }
+
+  auto chunkFunction = chunk.get<sol::protected_function>();
+
+  sol::bytecode bytecode = chunkFunction.dump();
+  writeBytecodeCache(cachePath, sourceHash, bytecode.as_string_view());
+
+  return chunkFunction;
 }
 
-const sol::state& ScriptsExecutor::getLuaState() const
+uint64_t ScriptsExecutor::getSourceHash(std::string_view source)
 {
-  return m_luaState;
+  // FNV-1a hash is used as it is stable between the standard library implementations and builds
+  uint64_t hash = 0xcbf29ce484222325;
+
+  for (char character : source) {
+    hash ^= static_cast<uint8_t>(character);
+    hash *= 0x100000001b3;
+  }
+
+  return hash;
 }
 
-sol::state& ScriptsExecutor::getLuaState()
+std::optional<std::string> ScriptsExecutor::readBytecodeCache(const std::string& cachePath, uint64_t sourceHash)
 {
-  return m_luaState;
+  std::ifstream cacheFile(cachePath, std::ios::binary);
+
+  if (!cacheFile.is_open()) {
+    return {};
+  }
+
+  BytecodeCacheHeader header{};
+  cacheFile.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+  if (!cacheFile || header.magic != BYTECODE_CACHE_MAGIC ||
+    header.formatVersion != BYTECODE_CACHE_FORMAT_VERSION || header.sourceHash != sourceHash) {
+    return {};
+  }
+
+  return std::string((std::istreambuf_iterator<char>(cacheFile)), std::istreambuf_iterator<char>());
+}
+
+void ScriptsExecutor::writeBytecodeCache(const std::string& cachePath, uint64_t sourceHash,
+  std::string_view bytecode)
+{
+  std::error_code errorCode;
+  std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), errorCode);
+
+  std::ofstream cacheFile(cachePath, std::ios::binary | std::ios::trunc);
+
+  if (errorCode || !cacheFile.is_open()) {
+    // The cache is optional, the script is just compiled again on the next startup
+    spdlog::warn("Script bytecode cache {} can not be written", cachePath);
+    return;
+  }
+
+  BytecodeCacheHeader header{
+    .magic = BYTECODE_CACHE_MAGIC,
+    .formatVersion = BYTECODE_CACHE_FORMAT_VERSION,
+    .sourceHash = sourceHash,
+  };
+
+  cacheFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  cacheFile.write(bytecode.data(), static_cast<std::streamsize>(bytecode.size()));
 }
 
 void ScriptsExecutor::registerCommonTypes()
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <string_view>
+
 #include "Modules/ECS/ECS.h"
 
 DISABLE_WARNINGS()
@@ -11,6 +14,12 @@ ENABLE_WARNINGS()
 
 #include "Bindings/ScriptsGameWorld.h"
 
+/*!
+ * \brief Lua state with the game scripts and the engine bindings
+ *
+ * Scripts are compiled once and their bytecode is cached on the disk with the source hash,
+ * so unchanged scripts are loaded without parsing on the next startups.
+ */
 class ScriptsExecutor {
  public:
   explicit ScriptsExecutor(std::shared_ptr<GameWorld> gameWorld);
@@ -19,14 +28,60 @@ class ScriptsExecutor {
   [[nodiscard]] const sol::state& getLuaState() const;
   [[nodiscard]] sol::state& getLuaState();
 
+  /*!
+   * \brief Executes the game scripts again, the functions resolved before the reload should be resolved again
+   */
+  void reloadScripts();
+
+  /*!
+   * \brief Returns the counter of the scripts reloads, it is used to invalidate the cached functions
+   */
+  [[nodiscard]] size_t getScriptsRevision() const;
+
  private:
   void registerCommonTypes();
   void registerGameWorld();
 
+  void loadScripts();
+
+  /*!
+   * \brief Loads the compiled script chunk from the bytecode cache or compiles it from the source
+   */
+  [[nodiscard]] sol::protected_function loadScriptChunk(const std::string& scriptName);
+
+  [[nodiscard]] static uint64_t getSourceHash(std::string_view source);
+
+  /*!
+   * \brief Wraps the Lua state allocator to report the scripts memory to the memory tracker
+   */
+  void installTrackedAllocator();
+
+  static void* allocateTrackedMemory(void* userData, void* pointer, size_t oldSize, size_t newSize);
+
+  [[nodiscard]] static std::optional<std::string> readBytecodeCache(const std::string& cachePath,
+    uint64_t sourceHash);
+  static void writeBytecodeCache(const std::string& cachePath, uint64_t sourceHash, std::string_view bytecode);
+
  private:
   std::shared_ptr<GameWorld> m_gameWorld;
 
+  // The original allocator of the state, it should outlive the state
+  lua_Alloc m_luaAllocator = nullptr;
+  void* m_luaAllocatorUserData = nullptr;
+
   sol::state m_luaState;
 
   std::shared_ptr<ScriptsGameWorld> m_scriptsGameWorld;
+
+  size_t m_scriptsRevision = 0;
+
+ private:
+  struct BytecodeCacheHeader {
+    uint32_t magic;
+    uint32_t formatVersion;
+    uint64_t sourceHash;
+  };
+
+  static constexpr uint32_t BYTECODE_CACHE_MAGIC = 0x424C5753;
+  static constexpr uint32_t BYTECODE_CACHE_FORMAT_VERSION = 1;
 };
@@ -4,12 +4,14 @@
 #include <vector>
 
 #include "swdebug.h"
+#include "Modules/Profiling/MemoryTracker.h"
 
 class DynamicDataPool {
  public:
-  explicit DynamicDataPool(size_t objectSize, size_t chunkCapacity)
+  explicit DynamicDataPool(size_t objectSize, size_t chunkCapacity, MemoryCounterId memoryCounterId)
     : m_objectSize(objectSize),
-      m_chunkSize(chunkCapacity)
+      m_chunkSize(chunkCapacity),
+      m_memoryCounterId(memoryCounterId)
   {
 
   }
@@ -17,6 +19,7 @@ class DynamicDataPool {
   virtual ~DynamicDataPool()
   {
     for (std::byte* chunkPtr : m_chunks) {
+      MemoryTracker::registerDeallocation(m_memoryCounterId, m_objectSize * m_chunkSize);
       delete[] chunkPtr;
     }
   }
@@ -35,6 +38,8 @@ class DynamicDataPool {
     if (objectsCount > m_capacity) {
       while (m_capacity < objectsCount) {
         m_chunks.push_back(new std::byte[m_objectSize * m_chunkSize]);
+        MemoryTracker::registerAllocation(m_memoryCounterId, m_objectSize * m_chunkSize);
+
         m_capacity += m_chunkSize;
       }
     }
@@ -69,6 +74,8 @@ class DynamicDataPool {
   const size_t m_objectSize;
   const size_t m_chunkSize;
 
+  const MemoryCounterId m_memoryCounterId;
+
   size_t m_size{};
   size_t m_capacity{};
 };
@@ -76,8 +83,8 @@ class DynamicDataPool {
 template<class ObjectType>
 class DynamicObjectsPool final : public DynamicDataPool {
  public:
-  explicit DynamicObjectsPool(size_t chunkSize)
-    : DynamicDataPool(sizeof(ObjectType), chunkSize)
+  explicit DynamicObjectsPool(size_t chunkSize, MemoryCounterId memoryCounterId)
+    : DynamicDataPool(sizeof(ObjectType), chunkSize, memoryCounterId)
   {
 
   }
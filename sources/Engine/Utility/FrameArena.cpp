@@ -0,0 +1,139 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "FrameArena.h"
+
+#include <array>
+
+#include "Modules/Profiling/MemoryTracker.h"
+
+namespace {
+
+std::array<LinearArena, 2> g_frameArenas = {
+  LinearArena(FrameArena::CHUNK_SIZE),
+  LinearArena(FrameArena::CHUNK_SIZE),
+};
+
+uint64_t g_frameIndex = 0;
+size_t g_lastFrameAllocatedSize = 0;
+
+MemoryCounterId getFrameArenaMemoryCounterId()
+{
+  static MemoryCounterId memoryCounterId = MemoryTracker::registerCounter("frame_arena");
+
+  return memoryCounterId;
+}
+
+}
+
+LinearArena::LinearArena(size_t chunkSize)
+  : m_chunkSize(chunkSize)
+{
+
+}
+
+LinearArena::~LinearArena()
+{
+  for (const Chunk& chunk : m_chunks) {
+    MemoryTracker::registerDeallocation(getFrameArenaMemoryCounterId(), chunk.size);
+  }
+}
+
+void* LinearArena::allocate(size_t size, size_t alignment)
+{
+  SW_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+  while (m_currentChunkIndex < m_chunks.size()) {
+    Chunk& chunk = m_chunks[m_currentChunkIndex];
+
+    auto chunkAddress = reinterpret_cast<uintptr_t>(chunk.data.get());
+    uintptr_t alignedAddress = (chunkAddress + m_currentChunkOffset + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    size_t alignedOffset = alignedAddress - chunkAddress;
+
+    if (alignedOffset + size <= chunk.size) {
+      m_currentChunkOffset = alignedOffset + size;
+      m_allocatedSize += size;
+
+      return chunk.data.get() + alignedOffset;
+    }
+
+    // The tail of the chunk is wasted until the reset
+    m_currentChunkIndex++;
+    m_currentChunkOffset = 0;
+  }
+
+  addChunk(size + alignment);
+
+  return allocate(size, alignment);
+}
+
+void LinearArena::reset()
+{
+  if (m_chunks.size() > 1) {
+    size_t capacity = getCapacity();
+
+    for (const Chunk& chunk : m_chunks) {
+      MemoryTracker::registerDeallocation(getFrameArenaMemoryCounterId(), chunk.size);
+    }
+
+    m_chunks.clear();
+    addChunk(capacity);
+  }
+
+  m_currentChunkIndex = 0;
+  m_currentChunkOffset = 0;
+  m_allocatedSize = 0;
+}
+
+size_t LinearArena::getAllocatedSize() const
+{
+  return m_allocatedSize;
+}
+
+size_t LinearArena::getCapacity() const
+{
+  size_t capacity = 0;
+
+  for (const Chunk& chunk : m_chunks) {
+    capacity += chunk.size;
+  }
+
+  return capacity;
+}
+
+void LinearArena::addChunk(size_t minSize)
+{
+  size_t chunkSize = std::max(m_chunkSize, minSize);
+
+  m_chunks.push_back(Chunk{.data = std::make_unique<std::byte[]>(chunkSize), .size = chunkSize});
+  MemoryTracker::registerAllocation(getFrameArenaMemoryCounterId(), chunkSize);
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment)
+{
+  return g_frameArenas[g_frameIndex % 2].allocate(size, alignment);
+}
+
+void FrameArena::finishFrame()
+{
+  g_lastFrameAllocatedSize = getFrameAllocatedSize();
+
+  g_frameIndex++;
+  g_frameArenas[g_frameIndex % 2].reset();
+}
+
+uint64_t FrameArena::getFrameIndex()
+{
+  return g_frameIndex;
+}
+
+size_t FrameArena::getFrameAllocatedSize()
+{
+  return g_frameArenas[g_frameIndex % 2].getAllocatedSize();
+}
+
+size_t FrameArena::getLastFrameAllocatedSize()
+{
+  return g_lastFrameAllocatedSize;
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "swdebug.h"
+
+/*!
+ * \brief Linear allocator that releases all its allocations at once
+ *
+ * The memory is allocated in chunks, if the arena is grown over several chunks, they are merged
+ * into a single chunk of the total size on the reset, so the arena stops allocating once
+ * the peak usage is reached.
+ */
+class LinearArena {
+ public:
+  explicit LinearArena(size_t chunkSize);
+  ~LinearArena();
+
+  LinearArena(const LinearArena&) = delete;
+  LinearArena& operator=(const LinearArena&) = delete;
+
+  [[nodiscard]] void* allocate(size_t size, size_t alignment);
+
+  /*!
+   * \brief Releases all allocations, the objects allocated from the arena are not destroyed
+   */
+  void reset();
+
+  [[nodiscard]] size_t getAllocatedSize() const;
+  [[nodiscard]] size_t getCapacity() const;
+
+ private:
+  struct Chunk {
+    std::unique_ptr<std::byte[]> data;
+    size_t size{};
+  };
+
+ private:
+  void addChunk(size_t minSize);
+
+ private:
+  size_t m_chunkSize{};
+
+  std::vector<Chunk> m_chunks;
+
+  size_t m_currentChunkIndex = 0;
+  size_t m_currentChunkOffset = 0;
+
+  size_t m_allocatedSize = 0;
+};
+
+/*!
+ * \brief Double-buffered arena for the transient data of the main thread frames
+ *
+ * The allocations are valid until the end of the next frame, so the data of the previous frame
+ * could still be read. The arena should be used only by the main thread.
+ */
+class FrameArena {
+ public:
+  FrameArena() = delete;
+
+  [[nodiscard]] static void* allocate(size_t size, size_t alignment);
+
+  /*!
+   * \brief Creates the object in the arena, the object is never destroyed, so it should be trivially destructible
+   */
+  template<class T, class... Args>
+  [[nodiscard]] static T* create(Args&& ... args);
+
+  /*!
+   * \brief Switches the arenas, the allocations of the previous frame are released
+   */
+  static void finishFrame();
+
+  [[nodiscard]] static uint64_t getFrameIndex();
+  [[nodiscard]] static size_t getFrameAllocatedSize();
+  [[nodiscard]] static size_t getLastFrameAllocatedSize();
+
+ public:
+  static constexpr size_t CHUNK_SIZE = 1024 * 1024;
+};
+
+template<class T, class... Args>
+T* FrameArena::create(Args&& ... args)
+{
+  static_assert(std::is_trivially_destructible_v<T>);
+
+  return ::new(allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Standard allocator over the frame arena, the deallocation is a no-op
+ *
+ * The containers should not outlive the next frame, the long-living containers should be
+ * replaced by the new ones every frame instead of clearing.
+ */
+template<class T>
+class FrameAllocator {
+ public:
+  using value_type = T;
+
+ public:
+  FrameAllocator() noexcept = default;
+
+  template<class U>
+  FrameAllocator(const FrameAllocator<U>& allocator) noexcept
+  {
+    ARG_UNUSED(allocator);
+  }
+
+  [[nodiscard]] T* allocate(size_t count)
+  {
+    return static_cast<T*>(FrameArena::allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* pointer, size_t count) noexcept
+  {
+    ARG_UNUSED(pointer);
+    ARG_UNUSED(count);
+  }
+
+  template<class U>
+  bool operator==(const FrameAllocator<U>& allocator) const noexcept
+  {
+    ARG_UNUSED(allocator);
+
+    return true;
+  }
+};
+
+template<class T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
@@ -0,0 +1,121 @@
+#include "precompiled.h"
+
+#pragma hdrstop
+
+#include "RangeAllocator.h"
+
+#include <iterator>
+
+#include "swdebug.h"
+
+RangeAllocator::RangeAllocator(size_t capacity)
+  : m_capacity(capacity)
+{
+  if (capacity != 0) {
+    insertFreeRange(0, capacity);
+  }
+}
+
+std::optional<size_t> RangeAllocator::allocate(size_t size)
+{
+  SW_ASSERT(size != 0);
+
+  auto bestFitIt = m_freeRangesBySize.lower_bound(size);
+
+  if (bestFitIt == m_freeRangesBySize.end()) {
+    return std::nullopt;
+  }
+
+  size_t rangeOffset = bestFitIt->second;
+  size_t rangeSize = bestFitIt->first;
+
+  eraseFreeRange(m_freeRangesByOffset.find(rangeOffset));
+
+  if (rangeSize > size) {
+    insertFreeRange(rangeOffset + size, rangeSize - size);
+  }
+
+  return rangeOffset;
+}
+
+void RangeAllocator::free(size_t offset, size_t size)
+{
+  SW_ASSERT(size != 0 && offset + size <= m_capacity);
+
+  size_t rangeOffset = offset;
+  size_t rangeSize = size;
+
+  auto nextRangeIt = m_freeRangesByOffset.lower_bound(offset);
+
+  if (nextRangeIt != m_freeRangesByOffset.begin()) {
+    auto previousRangeIt = std::prev(nextRangeIt);
+
+    SW_ASSERT(previousRangeIt->first + previousRangeIt->second <= offset && "The range is already free");
+
+    if (previousRangeIt->first + previousRangeIt->second == offset) {
+      rangeOffset = previousRangeIt->first;
+      rangeSize += previousRangeIt->second;
+
+      eraseFreeRange(previousRangeIt);
+    }
+  }
+
+  if (nextRangeIt != m_freeRangesByOffset.end()) {
+    SW_ASSERT(offset + size <= nextRangeIt->first && "The range is already free");
+
+    if (offset + size == nextRangeIt->first) {
+      rangeSize += nextRangeIt->second;
+
+      eraseFreeRange(nextRangeIt);
+    }
+  }
+
+  insertFreeRange(rangeOffset, rangeSize);
+}
+
+size_t RangeAllocator::getCapacity() const
+{
+  return m_capacity;
+}
+
+size_t RangeAllocator::getFreeSize() const
+{
+  return m_freeSize;
+}
+
+size_t RangeAllocator::getLargestFreeRangeSize() const
+{
+  if (m_freeRangesBySize.empty()) {
+    return 0;
+  }
+
+  return m_freeRangesBySize.rbegin()->first;
+}
+
+size_t RangeAllocator::getFreeRangesCount() const
+{
+  return m_freeRangesByOffset.size();
+}
+
+void RangeAllocator::insertFreeRange(size_t offset, size_t size)
+{
+  m_freeRangesByOffset.insert({offset, size});
+  m_freeRangesBySize.insert({size, offset});
+
+  m_freeSize += size;
+}
+
+void RangeAllocator::eraseFreeRange(std::map<size_t, size_t>::iterator freeRangeIt)
+{
+  auto [sizeRangesBegin, sizeRangesEnd] = m_freeRangesBySize.equal_range(freeRangeIt->second);
+
+  for (auto sizeRangeIt = sizeRangesBegin; sizeRangeIt != sizeRangesEnd; sizeRangeIt++) {
+    if (sizeRangeIt->second == freeRangeIt->first) {
+      m_freeRangesBySize.erase(sizeRangeIt);
+      break;
+    }
+  }
+
+  m_freeSize -= freeRangeIt->second;
+  m_freeRangesByOffset.erase(freeRangeIt);
+}
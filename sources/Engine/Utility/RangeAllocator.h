@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+
+/*!
+ * \brief Sub-allocator of the ranges of a fixed size storage, it does not own any memory
+ *
+ * The free ranges are selected by the best fit and are merged with the neighbours on the release,
+ * so the storage is not fragmented by the allocations of the same size.
+ */
+class RangeAllocator {
+ public:
+  explicit RangeAllocator(size_t capacity);
+
+  /*!
+   * \brief Allocates the range and returns its offset, or nothing if there is no free range of the size
+   */
+  [[nodiscard]] std::optional<size_t> allocate(size_t size);
+  void free(size_t offset, size_t size);
+
+  [[nodiscard]] size_t getCapacity() const;
+  [[nodiscard]] size_t getFreeSize() const;
+  [[nodiscard]] size_t getLargestFreeRangeSize() const;
+  [[nodiscard]] size_t getFreeRangesCount() const;
+
+ private:
+  void insertFreeRange(size_t offset, size_t size);
+  void eraseFreeRange(std::map<size_t, size_t>::iterator freeRangeIt);
+
+ private:
+  size_t m_capacity{};
+  size_t m_freeSize{};
+
+  // Offset to size and size to offset indices of the free ranges
+  std::map<size_t, size_t> m_freeRangesByOffset;
+  std::multimap<size_t, size_t> m_freeRangesBySize;
+};
@@ -65,6 +65,11 @@ std::string FileUtils::getScriptPath(const std::string& scriptName)
   return scriptPath;
 }
 
+std::string FileUtils::getScriptBytecodeCachePath(const std::string& scriptName)
+{
+  return std::string(SCRIPTS_CACHE_PATH) + "/" + scriptName + ".luac";
+}
+
 std::vector<std::string> FileUtils::getScriptsList()
 {
   std::vector<std::string> scriptsList;
@@ -21,6 +21,7 @@ class FileUtils {
   [[nodiscard]] static std::string getSpawnListPath(const std::string& spawnListName);
   [[nodiscard]] static std::string getGUISchemePath(const std::string& schemeName);
   [[nodiscard]] static std::string getScriptPath(const std::string& scriptName);
+  [[nodiscard]] static std::string getScriptBytecodeCachePath(const std::string& scriptName);
 
   [[nodiscard]] static std::string getSavePath(const std::string& saveName);
 
@@ -37,6 +38,8 @@ class FileUtils {
   static constexpr std::string_view SPAWN_LISTS_PATH = "./../resources/game/spawn";
   static constexpr std::string_view SCRIPTS_PATH = "./../resources/game/scripts";
   static constexpr std::string_view SAVES_PATH = "./saves";
+  static constexpr std::string_view SCRIPTS_CACHE_PATH = "./cache/scripts";
+  static constexpr std::string_view PROFILER_TRACE_PATH = "./profiler_trace.json";
 
   static constexpr std::string_view STARTUP_SETTINGS_PATH = "settings.xml";
 };
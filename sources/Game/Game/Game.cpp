@@ -230,6 +230,9 @@ void Game::setupGameState(bool isNewGame)
   if (isNewGame) {
     m_gameWorld->emitEvent<ExecuteScriptSimpleActionCommand>(
       ExecuteScriptSimpleActionCommand{"game.on_new_game"});
+
+    // The level state right after the new game creation is used as the baseline for delta saves
+    m_gameWorld->emitEvent<CaptureSaveBaselineCommandEvent>(CaptureSaveBaselineCommandEvent{});
   }
 }
 
@@ -14,6 +14,7 @@
 #include <Engine/Modules/Math/MathUtils.h>
 
 #include <utility>
+#include <limits>
 
 #include "PlayerComponent.h"
 #include "Game/Dynamic/InteractiveObjectComponent.h"
@@ -427,24 +428,38 @@ EventProcessStatus PlayerControlSystem::receiveEvent(const KeyboardEvent& event)
 
 GameObject PlayerControlSystem::findNearestInteractiveObject(const Transform& playerTransform)
 {
-  static std::vector<GameObject> nearestNeighbors;
-  nearestNeighbors.reserve(64);
-  nearestNeighbors.clear();
+  m_nearestNeighbors.clear();
 
-  m_graphicsScene->queryNearestDynamicNeighbors(playerTransform.getPosition(), 1.5f, nearestNeighbors);
+  glm::vec3 playerPosition = playerTransform.getPosition();
 
-  for (GameObject& object : nearestNeighbors) {
-    if (object.hasComponent<InteractiveObjectComponent>()) {
-      auto& interactiveObjectComponent = *object.getComponent<InteractiveObjectComponent>().get();
+  // All neighbors in the radius are checked, as the nearest ones could be non-interactive
+  m_graphicsScene->queryNearestDynamicNeighbors(playerPosition, 1.5f, m_nearestNeighbors);
 
-      if (interactiveObjectComponent.isUsable() || interactiveObjectComponent.isTakeable() ||
-        interactiveObjectComponent.isTalkable()) {
-        return object;
-      }
+  GameObject nearestObject;
+  float nearestObjectSquaredDistance = std::numeric_limits<float>::max();
+
+  for (GameObject& object : m_nearestNeighbors) {
+    if (!object.hasComponent<InteractiveObjectComponent>()) {
+      continue;
+    }
+
+    auto& interactiveObjectComponent = *object.getComponent<InteractiveObjectComponent>().get();
+
+    if (!interactiveObjectComponent.isUsable() && !interactiveObjectComponent.isTakeable() &&
+      !interactiveObjectComponent.isTalkable()) {
+      continue;
+    }
+
+    float squaredDistance = glm::length2(
+      object.getComponent<TransformComponent>()->getTransform().getPosition() - playerPosition);
+
+    if (squaredDistance < nearestObjectSquaredDistance) {
+      nearestObject = object;
+      nearestObjectSquaredDistance = squaredDistance;
     }
   }
 
-  return GameObject();
+  return nearestObject;
 }
 
 void PlayerControlSystem::performInteractiveAction()
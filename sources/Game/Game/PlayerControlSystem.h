@@ -79,6 +79,9 @@ class PlayerControlSystem : public GameSystem,
   std::shared_ptr<InputModule> m_inputModule;
   std::shared_ptr<GraphicsScene> m_graphicsScene;
 
+  // Scene queries result buffer, it is reused to avoid allocations on each query
+  std::vector<GameObject> m_nearestNeighbors;
+
   PlayerUILayout m_uiLayout;
 
   std::shared_ptr<GUILayout> m_activeGUIWindow;
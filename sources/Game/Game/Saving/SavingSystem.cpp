@@ -8,6 +8,7 @@
 #include <Engine/Exceptions/exceptions.h>
 
 #include <utility>
+#include <filesystem>
 
 SavingSystem::SavingSystem(std::shared_ptr<LevelsManager> levelsManager,
   std::shared_ptr<Game> game)
@@ -19,7 +20,7 @@ SavingSystem::SavingSystem(std::shared_ptr<LevelsManager> levelsManager,
 
 SavingSystem::~SavingSystem()
 {
-
+  waitForPendingSave();
 }
 
 void SavingSystem::configure()
@@ -29,15 +30,19 @@ void SavingSystem::configure()
   getGameWorld()->subscribeEventsListener<GameConsoleCommandEvent>(this);
   getGameWorld()->subscribeEventsListener<SaveCommandTriggerEvent>(this);
   getGameWorld()->subscribeEventsListener<LoadCommandTriggerEvent>(this);
+  getGameWorld()->subscribeEventsListener<CaptureSaveBaselineCommandEvent>(this);
 }
 
 void SavingSystem::unconfigure()
 {
+  waitForPendingSave();
+
   GameSystem::unconfigure();
 
   getGameWorld()->unsubscribeEventsListener<GameConsoleCommandEvent>(this);
   getGameWorld()->unsubscribeEventsListener<LoadCommandTriggerEvent>(this);
   getGameWorld()->unsubscribeEventsListener<SaveCommandTriggerEvent>(this);
+  getGameWorld()->unsubscribeEventsListener<CaptureSaveBaselineCommandEvent>(this);
 }
 
 EventProcessStatus SavingSystem::receiveEvent(const SaveCommandTriggerEvent& event)
@@ -54,40 +59,229 @@ EventProcessStatus SavingSystem::receiveEvent(const LoadCommandTriggerEvent& eve
   return EventProcessStatus::Processed;
 }
 
+EventProcessStatus SavingSystem::receiveEvent(const CaptureSaveBaselineCommandEvent& event)
+{
+  ARG_UNUSED(event);
+
+  // The baseline is required for delta saves only, so it is not written otherwise
+  if (!m_isDeltaModeEnabled) {
+    return EventProcessStatus::Skipped;
+  }
+
+  captureLevelBaseline();
+
+  return EventProcessStatus::Processed;
+}
+
+void SavingSystem::setSaveFormat(SaveFileFormat format)
+{
+  m_saveFormat = format;
+}
+
+SaveFileFormat SavingSystem::getSaveFormat() const
+{
+  return m_saveFormat;
+}
+
+void SavingSystem::setDeltaMode(bool isEnabled)
+{
+  m_isDeltaModeEnabled = isEnabled;
+}
+
+bool SavingSystem::isDeltaModeEnabled() const
+{
+  return m_isDeltaModeEnabled;
+}
+
+void SavingSystem::setAsyncMode(bool isEnabled)
+{
+  m_isAsyncModeEnabled = isEnabled;
+}
+
+bool SavingSystem::isAsyncModeEnabled() const
+{
+  return m_isAsyncModeEnabled;
+}
+
+void SavingSystem::waitForPendingSave()
+{
+  if (m_pendingSaveTask.valid()) {
+    m_pendingSaveTask.get();
+  }
+}
+
+void SavingSystem::prepareGameWorldForSaving()
+{
+  for (GameObject gameObject : getGameWorld()->all()) {
+    SW_ASSERT(gameObject.hasComponent<TransformComponent>());
+
+    auto transformComponent = gameObject.getComponent<TransformComponent>();
+
+    // Serialize only dynamic level objects
+    gameObject.markAsSerializable(!transformComponent->isStatic());
+  }
+}
+
 void SavingSystem::saveGameState(const std::string& saveName)
 {
+  waitForPendingSave();
+
   std::string savePath = FileUtils::getSavePath(saveName);
 
   spdlog::info("Save game state to {}", savePath);
 
-  GameWorld* gameWorld = getGameWorld();
+  GameObject playerObject = getGameWorld()->findGameObject("player");
+
+  SaveHeader saveHeader{
+    .saveName = saveName,
+    .levelName = playerObject.getComponent<TransformComponent>()->getLevelId()
+  };
 
+  prepareGameWorldForSaving();
+
+  switch (m_saveFormat) {
+    case SaveFileFormat::XML:
+      saveXMLGameState(savePath, saveHeader);
+      break;
+
+    case SaveFileFormat::Binary:
+      saveBinaryGameState(savePath, saveHeader);
+      break;
+
+    default:
+      SW_ASSERT(false);
+  }
+}
+
+void SavingSystem::saveXMLGameState(const std::string& savePath, const SaveHeader& saveHeader)
+{
   std::ofstream saveFileStream(savePath);
   cereal::XMLOutputArchive saveArchive(saveFileStream);
 
-  GameObject playerObject = gameWorld->findGameObject("player");
+  saveArchive(saveHeader);
+  saveArchive(*getGameWorld());
+}
+
+void SavingSystem::saveBinaryGameState(const std::string& savePath, const SaveHeader& saveHeader)
+{
+  SaveFileHeader fileHeader;
+  std::shared_ptr<const GameWorldSnapshot> baseline;
+
+  if (m_isDeltaModeEnabled) {
+    if (m_levelBaseline != nullptr && m_levelBaselineName == getBaselineSaveName(saveHeader.levelName)) {
+      fileHeader.baselineName = m_levelBaselineName;
+      baseline = m_levelBaseline;
+    }
+    else {
+      spdlog::warn("Level baseline is not captured, the full save will be written");
+    }
+  }
+
+  // The snapshot is the only part that requires access to the game world,
+  // delta building and file writing could be performed in the background
+  auto snapshot = std::make_shared<GameWorldSnapshot>(getGameWorld()->createSnapshot());
+
+  auto saveTask = [savePath, fileHeader, saveHeader, snapshot, baseline]() {
+    try {
+      if (baseline != nullptr) {
+        writeBinarySave(savePath, fileHeader, saveHeader, snapshot->createDelta(*baseline));
+      }
+      else {
+        writeBinarySave(savePath, fileHeader, saveHeader, *snapshot);
+      }
+    }
+    catch (const std::exception& exception) {
+      spdlog::error("Failed to write save {}: {}", savePath, exception.what());
+    }
+  };
+
+  if (m_isAsyncModeEnabled) {
+    m_pendingSaveTask = std::async(std::launch::async, std::move(saveTask));
+  }
+  else {
+    saveTask();
+  }
+}
+
+void SavingSystem::writeBinarySave(const std::string& savePath,
+  const SaveFileHeader& fileHeader,
+  const SaveHeader& saveHeader,
+  const GameWorldSnapshot& snapshot)
+{
+  // Write to the temporary file first to keep the previous save valid in case of failure
+  std::string temporarySavePath = savePath + ".tmp";
+
+  {
+    std::ofstream saveFileStream(temporarySavePath, std::ios::binary | std::ios::trunc);
+    cereal::BinaryOutputArchive saveArchive(saveFileStream);
+
+    saveArchive(fileHeader);
+    saveArchive(saveHeader);
+    saveArchive(snapshot);
+  }
+
+  std::filesystem::rename(temporarySavePath, savePath);
+}
+
+void SavingSystem::captureLevelBaseline()
+{
+  waitForPendingSave();
+
+  GameObject playerObject = getGameWorld()->findGameObject("player");
+  std::string levelName = playerObject.getComponent<TransformComponent>()->getLevelId();
+
+  prepareGameWorldForSaving();
+
+  m_levelBaselineName = getBaselineSaveName(levelName);
+  m_levelBaseline = std::make_shared<GameWorldSnapshot>(getGameWorld()->createSnapshot());
+
+  std::string baselinePath = FileUtils::getSavePath(m_levelBaselineName);
+  spdlog::info("Save level baseline to {}", baselinePath);
 
   SaveHeader saveHeader{
-    .saveName = saveName,
-    .levelName = playerObject.getComponent<TransformComponent>()->getLevelId()
+    .saveName = m_levelBaselineName,
+    .levelName = levelName
   };
 
-  saveArchive(saveHeader);
+  writeBinarySave(baselinePath, SaveFileHeader{}, saveHeader, *m_levelBaseline);
+}
 
-  for (GameObject gameObject : gameWorld->all()) {
-    SW_ASSERT(gameObject.hasComponent<TransformComponent>());
+std::shared_ptr<const GameWorldSnapshot> SavingSystem::loadLevelBaseline(const std::string& baselineName)
+{
+  if (m_levelBaseline != nullptr && m_levelBaselineName == baselineName) {
+    return m_levelBaseline;
+  }
 
-    auto transformComponent = gameObject.getComponent<TransformComponent>();
+  std::string baselinePath = FileUtils::getSavePath(baselineName);
 
-    // Serialize only dynamic level objects
-    gameObject.markAsSerializable(!transformComponent->isStatic());
+  if (!FileUtils::isFileExists(baselinePath)) {
+    THROW_EXCEPTION(EngineRuntimeException, fmt::format("Level baseline file {} is not found", baselinePath));
   }
 
-  saveArchive(*gameWorld);
+  std::ifstream baselineFileStream(baselinePath, std::ios::binary);
+  cereal::BinaryInputArchive baselineArchive(baselineFileStream);
+
+  SaveFileHeader fileHeader;
+  baselineArchive(fileHeader);
+
+  SaveHeader saveHeader;
+  baselineArchive(saveHeader);
+
+  auto baseline = std::make_shared<GameWorldSnapshot>();
+  baselineArchive(*baseline);
+
+  return baseline;
+}
+
+std::string SavingSystem::getBaselineSaveName(const std::string& levelName)
+{
+  return levelName + "_baseline";
 }
 
 void SavingSystem::loadGameState(const std::string& saveName)
 {
+  waitForPendingSave();
+
   std::string savePath = FileUtils::getSavePath(saveName);
 
   spdlog::info("Loading game state from {}", savePath);
@@ -100,17 +294,36 @@ void SavingSystem::loadGameState(const std::string& saveName)
     m_game->unload();
   }
 
-  GameWorld* gameWorld = getGameWorld();
-
-  for (GameObject gameObject : gameWorld->all()) {
+  for (GameObject gameObject : getGameWorld()->all()) {
     ARG_UNUSED(gameObject);
     SW_ASSERT(false && "Game world should be empty after game unloading");
   }
 
-  // Unload existing game world data
+  std::ifstream loadFileStream(savePath, std::ios::binary);
 
-  std::ifstream loadFileStream(savePath);
-  cereal::XMLInputArchive loadArchive(loadFileStream);
+  // XML saves are written by the legacy saving path and always start with the declaration
+  if (loadFileStream.peek() == '<') {
+    loadXMLGameState(loadFileStream);
+  }
+  else {
+    loadBinaryGameState(loadFileStream);
+  }
+
+  for (GameObject gameObject : getGameWorld()->all()) {
+    if (gameObject.hasComponent<ObjectSceneNodeComponent>()
+      && gameObject.getComponent<ObjectSceneNodeComponent>()->isGhost()) {
+      gameObject.removeComponent<ObjectSceneNodeComponent>();
+
+      getGameWorld()->emitEvent<AddObjectToSceneCommandEvent>(AddObjectToSceneCommandEvent{.object=gameObject});
+    }
+  }
+
+  m_game->setupGameState(false);
+}
+
+void SavingSystem::loadXMLGameState(std::istream& loadStream)
+{
+  cereal::XMLInputArchive loadArchive(loadStream);
 
   SaveHeader saveHeader;
   loadArchive(saveHeader);
@@ -118,18 +331,39 @@ void SavingSystem::loadGameState(const std::string& saveName)
   m_game->createLoadedGame(saveHeader.levelName);
 
   // Only dynamic game objects are saved, so load them after static level objects loading
-  loadArchive(*gameWorld);
+  loadArchive(*getGameWorld());
+}
 
-  for (GameObject gameObject : gameWorld->all()) {
-    if (gameObject.hasComponent<ObjectSceneNodeComponent>()
-      && gameObject.getComponent<ObjectSceneNodeComponent>()->isGhost()) {
-      gameObject.removeComponent<ObjectSceneNodeComponent>();
+void SavingSystem::loadBinaryGameState(std::istream& loadStream)
+{
+  cereal::BinaryInputArchive loadArchive(loadStream);
 
-      gameWorld->emitEvent<AddObjectToSceneCommandEvent>(AddObjectToSceneCommandEvent{.object=gameObject});
-    }
+  SaveFileHeader fileHeader;
+  loadArchive(fileHeader);
+
+  if (fileHeader.magic != SaveFileHeader::MAGIC || fileHeader.version != SaveFileHeader::VERSION) {
+    THROW_EXCEPTION(EngineRuntimeException, "Save file has invalid format or version");
   }
 
-  m_game->setupGameState(false);
+  SaveHeader saveHeader;
+  loadArchive(saveHeader);
+
+  GameWorldSnapshot snapshot;
+  loadArchive(snapshot);
+
+  if (snapshot.isDelta()) {
+    std::shared_ptr<const GameWorldSnapshot> baseline = loadLevelBaseline(fileHeader.baselineName);
+    snapshot.applyBaseline(*baseline);
+
+    // Keep the baseline to allow further delta saves in the loaded game
+    m_levelBaseline = baseline;
+    m_levelBaselineName = fileHeader.baselineName;
+  }
+
+  m_game->createLoadedGame(saveHeader.levelName);
+
+  // Only dynamic game objects are saved, so load them after static level objects loading
+  getGameWorld()->restoreSnapshot(snapshot);
 }
 
 void SavingSystem::activate()
@@ -143,6 +377,35 @@ void SavingSystem::deactivate()
 
 EventProcessStatus SavingSystem::receiveEvent(const GameConsoleCommandEvent& event)
 {
+  // Saving options commands start with the save command name, so they are checked first
+  std::vector<std::string> commandParts = StringUtils::split(event.command, ' ');
+
+  if (commandParts.size() == 2) {
+    const std::string& commandName = commandParts[0];
+    const std::string& commandArgument = commandParts[1];
+
+    if (commandName == "save-format") {
+      if (commandArgument == "xml") {
+        setSaveFormat(SaveFileFormat::XML);
+      }
+      else if (commandArgument == "binary") {
+        setSaveFormat(SaveFileFormat::Binary);
+      }
+
+      return EventProcessStatus::Processed;
+    }
+    else if (commandName == "save-delta") {
+      setDeltaMode(commandArgument == "on");
+
+      return EventProcessStatus::Processed;
+    }
+    else if (commandName == "save-async") {
+      setAsyncMode(commandArgument == "on");
+
+      return EventProcessStatus::Processed;
+    }
+  }
+
   if (event.command.starts_with("save")) {
     std::string saveName = StringUtils::split(event.command, ' ')[1];
 
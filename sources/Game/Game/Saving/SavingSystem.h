@@ -1,6 +1,7 @@
 #pragma once
 
 #include <utility>
+#include <future>
 
 #include <Engine/Modules/ECS/ECS.h>
 #include <Engine/Modules/ResourceManagement/ResourcesManager.h>
@@ -42,6 +43,35 @@ struct LoadCommandTriggerEvent {
   std::string m_saveName;
 };
 
+struct CaptureSaveBaselineCommandEvent {
+};
+
+enum class SaveFileFormat {
+  XML,
+  Binary
+};
+
+/*!
+ * \brief Header of binary save files
+ *
+ * Delta saves store only components changed since the level baseline,
+ * the baseline save name is stored in the header.
+ */
+struct SaveFileHeader {
+  static constexpr uint32_t MAGIC = 0x42535753; // "SWSB"
+  static constexpr uint16_t VERSION = 1;
+
+  uint32_t magic = MAGIC;
+  uint16_t version = VERSION;
+  std::string baselineName;
+
+  template<class Archive>
+  void serialize(Archive& archive)
+  {
+    archive(magic, version, baselineName);
+  };
+};
+
 struct SaveHeader {
   std::string saveName;
   std::string levelName;
@@ -59,7 +89,8 @@ struct SaveHeader {
 class SavingSystem : public GameSystem,
                      public EventsListener<GameConsoleCommandEvent>,
                      public EventsListener<SaveCommandTriggerEvent>,
-                     public EventsListener<LoadCommandTriggerEvent> {
+                     public EventsListener<LoadCommandTriggerEvent>,
+                     public EventsListener<CaptureSaveBaselineCommandEvent> {
  public:
   SavingSystem(std::shared_ptr<LevelsManager> levelsManager,
     std::shared_ptr<Game> game);
@@ -74,12 +105,68 @@ class SavingSystem : public GameSystem,
   EventProcessStatus receiveEvent(const GameConsoleCommandEvent& event) override;
   EventProcessStatus receiveEvent(const SaveCommandTriggerEvent& event) override;
   EventProcessStatus receiveEvent(const LoadCommandTriggerEvent& event) override;
+  EventProcessStatus receiveEvent(const CaptureSaveBaselineCommandEvent& event) override;
+
+  void setSaveFormat(SaveFileFormat format);
+  [[nodiscard]] SaveFileFormat getSaveFormat() const;
+
+  /*!
+   * \brief Enables saving of components changed since the level baseline only
+   *
+   * Delta mode is applied to binary saves only and requires the level baseline to be captured,
+   * the baseline is captured on the new game start while the mode is enabled.
+   *
+   * \param isEnabled delta mode flag
+   */
+  void setDeltaMode(bool isEnabled);
+  [[nodiscard]] bool isDeltaModeEnabled() const;
+
+  /*!
+   * \brief Enables writing of binary saves on a background thread
+   *
+   * \param isEnabled async mode flag
+   */
+  void setAsyncMode(bool isEnabled);
+  [[nodiscard]] bool isAsyncModeEnabled() const;
+
+  /*!
+   * \brief Blocks until the pending asynchronous save is written
+   */
+  void waitForPendingSave();
 
  private:
   void saveGameState(const std::string& saveName);
   void loadGameState(const std::string& saveName);
 
+  void captureLevelBaseline();
+
+  void prepareGameWorldForSaving();
+
+  void saveXMLGameState(const std::string& savePath, const SaveHeader& saveHeader);
+  void saveBinaryGameState(const std::string& savePath, const SaveHeader& saveHeader);
+
+  void loadXMLGameState(std::istream& loadStream);
+  void loadBinaryGameState(std::istream& loadStream);
+
+  [[nodiscard]] std::shared_ptr<const GameWorldSnapshot> loadLevelBaseline(const std::string& baselineName);
+
+  static void writeBinarySave(const std::string& savePath,
+    const SaveFileHeader& fileHeader,
+    const SaveHeader& saveHeader,
+    const GameWorldSnapshot& snapshot);
+
+  [[nodiscard]] static std::string getBaselineSaveName(const std::string& levelName);
+
  private:
   std::shared_ptr<LevelsManager> m_levelsManager;
   std::shared_ptr<Game> m_game;
+
+  SaveFileFormat m_saveFormat = SaveFileFormat::XML;
+  bool m_isDeltaModeEnabled = false;
+  bool m_isAsyncModeEnabled = false;
+
+  std::shared_ptr<const GameWorldSnapshot> m_levelBaseline;
+  std::string m_levelBaselineName;
+
+  std::future<void> m_pendingSaveTask;
 };
@@ -80,9 +80,11 @@ void GameScreen::update(float delta)
 
   const FrameStats& stats = m_graphicsScene->getFrameStats();
 
-  m_primitivesCountText->setText("Primitives: " + std::to_string(stats.getPrimitivesCount()));
+  m_primitivesCountText->setText("Primitives: " + std::to_string(stats.getPrimitivesCount()) +
+    " (LODs saved " + std::to_string(stats.getSavedPrimitivesCount()) + ")");
   m_subMeshesCountText->setText("Meshes: " + std::to_string(stats.getSubMeshesCount()));
-  m_culledSubMeshesCountText->setText("Culled: " + std::to_string(stats.getCulledSubMeshesCount()));
+  m_culledSubMeshesCountText->setText("Culled: " + std::to_string(stats.getCulledSubMeshesCount()) +
+    " (occluded " + std::to_string(stats.getOccludedObjectsCount()) + ")");
 }
 
 void GameScreen::render()
@@ -28,7 +28,7 @@ void AssetsDump::dumpAssetData(const std::string& assetPath)
 
 void AssetsDump::dumpMesh(const RawMesh& mesh)
 {
-  static_assert(MESH_FORMAT_VERSION == 116 && "Do not forget to update dump logic");
+  static_assert(MESH_FORMAT_VERSION == 118 && "Do not forget to update dump logic");
 
   std::unordered_map<size_t, std::string> meshAttributesNames = {
     {0, "None"},
@@ -55,10 +55,12 @@ void AssetsDump::dumpMesh(const RawMesh& mesh)
              "    verticesCount: {1}\n"
              "    attributesMask: {2}, transcription {3}\n"
              "    subMeshesCount: {4}\n"
+             "    quantizedAttributesMask: {5}\n"
              "  Mesh data:\n"
              "", mesh.header.formatVersion,
     mesh.header.verticesCount,
-    mesh.header.storedAttributesMask, StringUtils::join(meshAttributesList), mesh.header.subMeshesCount);
+    mesh.header.storedAttributesMask, StringUtils::join(meshAttributesList), mesh.header.subMeshesCount,
+    mesh.header.quantizedAttributesMask);
 
   dumpVectorSection("    vertices:", mesh.positions);
   dumpVectorSection("    normals:", mesh.normals);
@@ -75,6 +77,19 @@ void AssetsDump::dumpMesh(const RawMesh& mesh)
       fmt::join(mesh.subMeshesDescriptions[subMeshIndex].indices, ", "));
   }
 
+  fmt::print("  LODs:\n");
+
+  for (size_t lodIndex = 0; lodIndex < mesh.lods.size(); lodIndex++) {
+    const RawMeshLodDescription& lod = mesh.lods[lodIndex];
+
+    fmt::print("    LOD #{0}:\n      Min screen size: {1}\n", lodIndex, lod.minScreenSize);
+
+    for (size_t subMeshIndex = 0; subMeshIndex < lod.subMeshesRanges.size(); subMeshIndex++) {
+      fmt::print("      Submesh #{0}: offset {1}, count {2}\n", subMeshIndex,
+        lod.subMeshesRanges[subMeshIndex].indicesOffset, lod.subMeshesRanges[subMeshIndex].indicesCount);
+    }
+  }
+
   fmt::print("  AABB:\n"
              "    Min: {0}\n"
              "    Max: {1}\n"
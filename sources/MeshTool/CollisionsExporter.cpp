@@ -1,9 +1,13 @@
 #include "CollisionsExporter.h"
 
 #include <fstream>
+#include <map>
+#include <tuple>
 #include <spdlog/spdlog.h>
 
 #include <Engine/swdebug.h>
+#include <Engine/Utility/memory.h>
+#include <Engine/Modules/Physics/BulletBackend/BulletCollisionShapesCache.h>
 
 CollisionsExporter::CollisionsExporter()
 {
@@ -14,8 +18,60 @@ void CollisionsExporter::exportToFile(const std::string& path,
   const RawMeshCollisionData& collisionData,
   const CollisionsExportOptions& options)
 {
-  ARG_UNUSED(options);
+  RawMeshCollisionData preparedCollisionData = collisionData;
+
+  for (auto& shape : preparedCollisionData.collisionShapes) {
+    if (shape.type == RawMeshCollisionShapeType::TriangleMesh) {
+      prepareTriangleMesh(shape.triangleMesh, options);
+    }
+  }
 
   spdlog::info("Save collision data to file: {}", path);
-  RawMeshCollisionData::writeToFile(path, collisionData);
+  RawMeshCollisionData::writeToFile(path, preparedCollisionData);
+}
+
+void CollisionsExporter::prepareTriangleMesh(RawMeshCollisionShapeTriangleMesh& triangleMesh,
+  const CollisionsExportOptions& options)
+{
+  if (triangleMesh.indices.empty()) {
+    // Importers produce the triangles list, so identical vertices are welded to indexed geometry
+    std::map<std::tuple<float, float, float>, uint32_t> verticesLookup;
+    std::vector<RawVector3> vertices;
+    std::vector<uint32_t> indices;
+
+    indices.reserve(triangleMesh.vertices.size());
+
+    for (const RawVector3& vertex : triangleMesh.vertices) {
+      auto [vertexIt, isInserted] = verticesLookup.insert({std::make_tuple(vertex.x, vertex.y, vertex.z),
+        static_cast<uint32_t>(vertices.size())});
+
+      if (isInserted) {
+        vertices.push_back(vertex);
+      }
+
+      indices.push_back(vertexIt->second);
+    }
+
+    spdlog::info("Collision triangle mesh is indexed: {} vertices are welded to {} vertices, {} triangles",
+      triangleMesh.vertices.size(), vertices.size(), indices.size() / 3);
+
+    triangleMesh.vertices = std::move(vertices);
+    triangleMesh.indices = std::move(indices);
+  }
+
+  triangleMesh.optimizedBvh.clear();
+
+  if (options.bakeOptimizedBvh) {
+    CollisionShapeTriangleMesh collisionMesh(
+      MemoryUtils::createBinaryCompatibleVector<RawVector3, glm::vec3>(triangleMesh.vertices),
+      triangleMesh.indices);
+
+    triangleMesh.optimizedBvh = BulletCollisionShapesCache::bakeOptimizedBvh(collisionMesh);
+
+    spdlog::info("Collision triangle mesh BVH is baked, size = {} bytes", triangleMesh.optimizedBvh.size());
+  }
+
+  triangleMesh.header.verticesCount = static_cast<uint32_t>(triangleMesh.vertices.size());
+  triangleMesh.header.indicesCount = static_cast<uint32_t>(triangleMesh.indices.size());
+  triangleMesh.header.optimizedBvhSize = static_cast<uint32_t>(triangleMesh.optimizedBvh.size());
 }
@@ -5,7 +5,8 @@
 #include <Engine/Modules/Physics/Resources/Raw/RawMeshCollisionData.h>
 
 struct CollisionsExportOptions {
-  char unused_padding[1];
+  // Triangle meshes BVH is stored with the collision data, so it is not built on the level loading
+  bool bakeOptimizedBvh = true;
 };
 
 class CollisionsExporter {
@@ -15,4 +16,8 @@ class CollisionsExporter {
   void exportToFile(const std::string& path,
     const RawMeshCollisionData& collisionData,
     const CollisionsExportOptions& options);
+
+ private:
+  static void prepareTriangleMesh(RawMeshCollisionShapeTriangleMesh& triangleMesh,
+    const CollisionsExportOptions& options);
 };
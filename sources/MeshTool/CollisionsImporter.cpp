@@ -171,7 +171,7 @@ RawMeshCollisionShape CollisionsImporter::importCollisionTriangleMeshShape(const
 
   RawMeshCollisionShape rawShape{};
   rawShape.type = RawMeshCollisionShapeType::TriangleMesh;
-  rawShape.triangleMesh.header.verticesCount = static_cast<uint16_t>(vertices.size());
+  rawShape.triangleMesh.header.verticesCount = static_cast<uint32_t>(vertices.size());
   rawShape.triangleMesh.vertices = MemoryUtils::createBinaryCompatibleVector<glm::vec3, RawVector3>(vertices);
 
   return rawShape;
@@ -19,6 +19,10 @@ void MeshExporter::exportToFile(const std::string& path, const RawMesh& mesh, co
   RawMeshAttributes targetAttributesMask = RawMeshAttributes::Empty;
 
   switch (options.format) {
+    case Pos3:
+      targetAttributesMask = RawMeshAttributes::Positions;
+      break;
+
     case Pos3Norm3UV:
       targetAttributesMask = RawMeshAttributes::Positions | RawMeshAttributes::Normals
         | RawMeshAttributes::UV;
@@ -52,6 +56,11 @@ void MeshExporter::exportToFile(const std::string& path, const RawMesh& mesh, co
   // Update stored attributes mask according to target format
   RawMesh exportedMesh = mesh;
   exportedMesh.header.storedAttributesMask = static_cast<bitmask64>(targetAttributesMask);
+  exportedMesh.header.quantizedAttributesMask = static_cast<bitmask64>(options.quantization);
+
+  if (options.optimize) {
+    MeshOptimizer::optimizeMesh(exportedMesh, options.optimizationOptions);
+  }
 
   spdlog::info("Save mesh to file: {}", path);
 
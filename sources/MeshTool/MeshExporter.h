@@ -3,7 +3,10 @@
 #include <memory>
 #include <Engine/Modules/Graphics/Resources/Raw/RawMesh.h>
 
+#include "Processing/MeshOptimizer.h"
+
 enum MeshExportFormat {
+  Pos3,
   Pos3Norm3UV,
   Pos3Norm3UVSkinned,
   Pos3Norm3Tan3UV,
@@ -12,6 +15,13 @@ enum MeshExportFormat {
 
 struct MeshExportOptions {
   MeshExportFormat format;
+
+  // The vertex cache, overdraw and vertex fetch optimizations are applied before the mesh writing
+  bool optimize = true;
+  MeshOptimizationOptions optimizationOptions;
+
+  // Compact encodings of the stored vertex attributes, the attributes are decoded on the mesh loading
+  RawMeshQuantization quantization = RawMeshQuantization::None;
 };
 
 class MeshExporter {
@@ -81,7 +81,7 @@ std::unique_ptr<RawMesh> MeshImporter::convertSceneToMesh(const aiScene& scene,
   std::vector<glm::vec4> bonesWeights;
   std::vector<RawU8Vector4> convertedBonesWeights;
 
-  std::vector<std::vector<std::uint16_t>> subMeshesIndices;
+  std::vector<std::vector<std::uint32_t>> subMeshesIndices;
 
   glm::vec3 aabbMin(std::numeric_limits<float>::max());
   glm::vec3 aabbMax(std::numeric_limits<float>::min());
@@ -152,7 +152,7 @@ std::unique_ptr<RawMesh> MeshImporter::convertSceneToMesh(const aiScene& scene,
 
     size_t indicesOffset = verticesAddIndex;
 
-    std::vector<uint16_t> indices;
+    std::vector<uint32_t> indices;
 
     for (size_t faceIndex = 0; faceIndex < subMesh.mNumFaces; faceIndex++) {
       const aiFace& face = subMesh.mFaces[faceIndex];
@@ -163,7 +163,7 @@ std::unique_ptr<RawMesh> MeshImporter::convertSceneToMesh(const aiScene& scene,
       }
 
       for (size_t indexNumber = 0; indexNumber < 3; indexNumber++) {
-        indices.push_back(static_cast<uint16_t>(face.mIndices[indexNumber] + indicesOffset));
+        indices.push_back(static_cast<uint32_t>(face.mIndices[indexNumber] + indicesOffset));
       }
     }
 
@@ -256,7 +256,7 @@ std::unique_ptr<RawMesh> MeshImporter::convertSceneToMesh(const aiScene& scene,
 
   for (const auto& subMeshIndices : subMeshesIndices) {
     mesh->subMeshesDescriptions.push_back(RawSubMeshDescription{
-      .indicesCount = static_cast<uint16_t>(subMeshIndices.size()),
+      .indicesCount = static_cast<uint32_t>(subMeshIndices.size()),
       .indices = subMeshIndices
     });
   }
@@ -264,7 +264,7 @@ std::unique_ptr<RawMesh> MeshImporter::convertSceneToMesh(const aiScene& scene,
   mesh->aabb = RawAABB{glmVector3ToRawVector3(aabbMin), glmVector3ToRawVector3(aabbMax)};
 
   mesh->header.formatVersion = MESH_FORMAT_VERSION;
-  mesh->header.verticesCount = static_cast<uint16_t>(mesh->positions.size());
+  mesh->header.verticesCount = static_cast<uint32_t>(mesh->positions.size());
   mesh->header.subMeshesCount = static_cast<uint16_t>(subMeshesIndices.size());
 
   RawMeshAttributes storedAttributesMask = RawMeshAttributes::Positions | RawMeshAttributes::Normals |
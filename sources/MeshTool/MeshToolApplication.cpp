@@ -7,6 +7,8 @@
 
 #include "MeshImporter.h"
 #include "MeshExporter.h"
+#include "Processing/MeshLodGenerator.h"
+#include "Processing/MeshOccluderGenerator.h"
 
 #include "SkeletonImporter.h"
 #include "SkeletonExporter.h"
@@ -37,10 +39,29 @@ void MeshToolApplication::execute(int argc, char* argv[])
     ("a,action", "Action (import, dump)", cxxopts::value<std::string>()->default_value("import"))
     ("t,type", "Import type (mesh, skeleton, animation, collisions, scene)",
       cxxopts::value<std::string>()->default_value("mesh"))
-    ("format", "Output mesh format (pos3_norm3_uv, pos3_norm3_uv_skinned,"
+    ("format", "Output mesh format (pos3, pos3_norm3_uv, pos3_norm3_uv_skinned,"
                "pos3_norm3_tan3_uv, pos3_norm3_tan3_uv_skinned)",
       cxxopts::value<std::string>()->default_value("pos3_norm3_uv"))
-    ("clip-name", "Skeletal animation clip name to import", cxxopts::value<std::string>());
+    ("clip-name", "Skeletal animation clip name to import", cxxopts::value<std::string>())
+    ("lods", "Mesh LODs count including the full detail one", cxxopts::value<size_t>()->default_value("1"))
+    ("lods-ratio", "Triangles count of every mesh LOD relative to the previous one",
+      cxxopts::value<float>()->default_value("0.5"))
+    ("lods-screen-sizes", "Minimal screen sizes of the mesh LODs except the last one (0.5,0.25,...)",
+      cxxopts::value<std::vector<float>>())
+    ("lods-max-error", "Maximal mesh LODs simplification error relative to the mesh size",
+      cxxopts::value<float>()->default_value("0.02"))
+    ("occluder", "Export the simplified positions only mesh for the software occlusion culling")
+    ("occluder-ratio", "Triangles count of the occluder relative to the source mesh",
+      cxxopts::value<float>()->default_value("0.1"))
+    ("occluder-max-error", "Maximal occluder simplification error relative to the mesh size",
+      cxxopts::value<float>()->default_value("0.02"))
+    ("skip-optimization", "Skip mesh vertex cache, overdraw and vertex fetch optimization")
+    ("overdraw-threshold", "Maximal vertex cache efficiency degradation for the overdraw optimization",
+      cxxopts::value<float>()->default_value("1.05"))
+    ("quantize-positions", "Store mesh positions as 16-bit values relative to the mesh bounds")
+    ("quantize-directions", "Mesh normals and tangents quantization (none, oct8, oct16)",
+      cxxopts::value<std::string>()->default_value("none"))
+    ("quantize-uv", "Store mesh UV as half floats");
 
   auto parsedArgs = options.parse(argc, argv);
 
@@ -48,6 +69,12 @@ void MeshToolApplication::execute(int argc, char* argv[])
     std::cout << options.help() << std::endl << std::endl;
     std::cout << "Examples: " << std::endl;
     std::cout << "./MeshTool -i mesh.dae -o mesh.mesh -a import -t mesh --format pos3_norm3_uv" << std::endl;
+    std::cout << "./MeshTool -i mesh.dae -o mesh.mesh -a import -t mesh --lods 3 --lods-screen-sizes 0.4,0.15"
+      << std::endl;
+    std::cout << "./MeshTool -i mesh.dae -o mesh.mesh -a import -t mesh --quantize-positions"
+      " --quantize-directions oct16 --quantize-uv" << std::endl;
+    std::cout << "./MeshTool -i mesh.dae -o mesh_occluder.mesh -a import -t mesh --occluder --occluder-ratio 0.05"
+      << std::endl;
     std::cout << "./MeshTool -i mesh.dae -o mesh.skeleton -a import -t skeleton" << std::endl;
     std::cout << "./MeshTool -i mesh.dae -o mesh.anim -a import -t animation --clip-name idle" << std::endl;
     std::cout << "./MeshTool -i mesh.dae -o mesh.collision -a import -t collisions" << std::endl;
@@ -97,12 +124,19 @@ void MeshToolApplication::importMesh(const cxxopts::ParseResult& options)
   spdlog::info("Conversion started");
 
   MeshExportFormat exportFormat = StringUtils::filterValue(options["format"].as<std::string>(), {
+    {"pos3", MeshExportFormat::Pos3},
     {"pos3_norm3_uv", MeshExportFormat::Pos3Norm3UV},
     {"pos3_norm3_uv_skinned", MeshExportFormat::Pos3Norm3UVSkinned},
     {"pos3_norm3_tan3_uv", MeshExportFormat::Pos3Norm3Tan3UV},
     {"pos3_norm3_tan3_uv_skinned", MeshExportFormat::Pos3Norm3Tan3UVSkinned},
   }, MeshExportFormat::Pos3Norm3UV);
 
+  const bool isOccluder = options.count("occluder") > 0;
+
+  if (isOccluder) {
+    exportFormat = MeshExportFormat::Pos3;
+  }
+
   // Import mesh as raw mesh data
   MeshImportOptions importOptions;
   importOptions.flipUV = false;
@@ -120,12 +154,52 @@ void MeshToolApplication::importMesh(const cxxopts::ParseResult& options)
   const std::string inputPath = options["input"].as<std::string>();
   std::unique_ptr<RawMesh> mesh = importer.importFromFile(inputPath, importOptions);
 
+  // Generate LODs chain
+  MeshLodGenerationOptions lodGenerationOptions;
+  lodGenerationOptions.lodsCount = options["lods"].as<size_t>();
+  lodGenerationOptions.trianglesRatio = options["lods-ratio"].as<float>();
+  lodGenerationOptions.maxError = options["lods-max-error"].as<float>();
+
+  if (options.count("lods-screen-sizes") > 0) {
+    lodGenerationOptions.screenSizes = options["lods-screen-sizes"].as<std::vector<float>>();
+  }
+
+  // The occluders are rasterized without LODs, so the mesh is replaced with the single simplified occluder
+  if (isOccluder) {
+    MeshOccluderGenerator::generateOccluder(*mesh, MeshOccluderGenerationOptions{
+      .trianglesRatio = options["occluder-ratio"].as<float>(),
+      .maxError = options["occluder-max-error"].as<float>(),
+    });
+  }
+  else {
+    MeshLodGenerator::generateLods(*mesh, lodGenerationOptions);
+  }
+
   // Save raw mesh data
   MeshExportOptions exportOptions;
 
   // Export format
   exportOptions.format = exportFormat;
 
+  // Vertices and indices order optimization
+  exportOptions.optimize = options.count("skip-optimization") == 0;
+  exportOptions.optimizationOptions.overdrawThreshold = options["overdraw-threshold"].as<float>();
+
+  // Vertex attributes quantization
+  exportOptions.quantization = StringUtils::filterValue(options["quantize-directions"].as<std::string>(), {
+    {"none", RawMeshQuantization::None},
+    {"oct8", RawMeshQuantization::Normals8 | RawMeshQuantization::Tangents8},
+    {"oct16", RawMeshQuantization::Normals16 | RawMeshQuantization::Tangents16},
+  }, RawMeshQuantization::None);
+
+  if (options.count("quantize-positions") > 0) {
+    exportOptions.quantization = exportOptions.quantization | RawMeshQuantization::Positions16;
+  }
+
+  if (options.count("quantize-uv") > 0) {
+    exportOptions.quantization = exportOptions.quantization | RawMeshQuantization::UVHalf;
+  }
+
   MeshExporter exporter;
 
   const std::string outputPath = options["output"].as<std::string>();
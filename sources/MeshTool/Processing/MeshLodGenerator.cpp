@@ -0,0 +1,109 @@
+#include "MeshLodGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <spdlog/spdlog.h>
+
+#include <Engine/Exceptions/exceptions.h>
+
+#include "MeshSimplifier.h"
+
+void MeshLodGenerator::generateLods(RawMesh& mesh, const MeshLodGenerationOptions& options)
+{
+  if (options.lodsCount == 0 || options.lodsCount > MESH_MAX_LODS_COUNT) {
+    THROW_EXCEPTION(EngineRuntimeException, fmt::format("LODs count should be in range [1, {}]",
+      MESH_MAX_LODS_COUNT));
+  }
+
+  std::vector<float> screenSizes = options.screenSizes;
+
+  if (screenSizes.empty()) {
+    for (size_t lodIndex = 0; lodIndex + 1 < options.lodsCount; lodIndex++) {
+      screenSizes.push_back(0.5f / static_cast<float>(1 << lodIndex));
+    }
+  }
+
+  if (screenSizes.size() != options.lodsCount - 1) {
+    THROW_EXCEPTION(EngineRuntimeException, "LODs screen sizes should be set for all LODs except the last one");
+  }
+
+  if (!std::is_sorted(screenSizes.rbegin(), screenSizes.rend())) {
+    THROW_EXCEPTION(EngineRuntimeException, "LODs screen sizes should be decreasing");
+  }
+
+  std::vector<glm::vec3> positions;
+  positions.reserve(mesh.positions.size());
+
+  for (const RawVector3& position : mesh.positions) {
+    positions.push_back(rawVector3ToGLMVector3(position));
+  }
+
+  mesh.lods.clear();
+  mesh.lods.push_back(RawMesh::getFullDetailLod(mesh));
+
+  // Full detail indices of the sub-meshes, they are kept separately as the LODs are appended
+  std::vector<std::vector<uint32_t>> previousLodIndices;
+
+  for (const RawSubMeshDescription& subMeshDescription : mesh.subMeshesDescriptions) {
+    previousLodIndices.push_back(subMeshDescription.indices);
+  }
+
+  auto getTotalIndicesCount = [](const std::vector<std::vector<uint32_t>>& subMeshesIndices) {
+    return std::accumulate(subMeshesIndices.begin(), subMeshesIndices.end(), size_t(0),
+      [](size_t sum, const std::vector<uint32_t>& indices) {
+        return sum + indices.size();
+      });
+  };
+
+  for (size_t lodIndex = 1; lodIndex < options.lodsCount; lodIndex++) {
+    std::vector<std::vector<uint32_t>> lodIndices;
+
+    for (const std::vector<uint32_t>& subMeshIndices : previousLodIndices) {
+      auto targetTrianglesCount = static_cast<size_t>(std::floor(static_cast<float>(subMeshIndices.size() / 3) *
+        options.trianglesRatio));
+
+      lodIndices.push_back(MeshSimplifier::simplify(positions, subMeshIndices, MeshSimplificationOptions{
+        .targetIndicesCount = targetTrianglesCount * 3,
+        .maxError = options.maxError,
+      }));
+    }
+
+    size_t previousIndicesCount = getTotalIndicesCount(previousLodIndices);
+    size_t indicesCount = getTotalIndicesCount(lodIndices);
+
+    if (static_cast<float>(indicesCount) > static_cast<float>(previousIndicesCount) * (1.0f - MIN_LOD_REDUCTION)) {
+      spdlog::info("LOD #{} reduces the triangles count insufficiently, the LODs chain is stopped", lodIndex);
+      break;
+    }
+
+    RawMeshLodDescription lodDescription{.minScreenSize = 0.0f};
+
+    for (size_t subMeshIndex = 0; subMeshIndex < mesh.subMeshesDescriptions.size(); subMeshIndex++) {
+      RawSubMeshDescription& subMeshDescription = mesh.subMeshesDescriptions[subMeshIndex];
+
+      lodDescription.subMeshesRanges.push_back(RawMeshIndicesRange{
+        .indicesOffset = static_cast<uint32_t>(subMeshDescription.indices.size()),
+        .indicesCount = static_cast<uint32_t>(lodIndices[subMeshIndex].size()),
+      });
+
+      subMeshDescription.indices.insert(subMeshDescription.indices.end(),
+        lodIndices[subMeshIndex].begin(), lodIndices[subMeshIndex].end());
+      subMeshDescription.indicesCount = static_cast<uint32_t>(subMeshDescription.indices.size());
+    }
+
+    spdlog::info("LOD #{} is generated ({} indices, {} indices in the previous LOD)", lodIndex,
+      indicesCount, previousIndicesCount);
+
+    mesh.lods.push_back(std::move(lodDescription));
+    previousLodIndices = std::move(lodIndices);
+  }
+
+  // The last LOD is used for any smaller screen size
+  for (size_t lodIndex = 0; lodIndex + 1 < mesh.lods.size(); lodIndex++) {
+    mesh.lods[lodIndex].minScreenSize = screenSizes[lodIndex];
+  }
+
+  mesh.lods.back().minScreenSize = 0.0f;
+}
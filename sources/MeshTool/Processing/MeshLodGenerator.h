@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+
+#include <Engine/Modules/Graphics/Resources/Raw/RawMesh.h>
+
+struct MeshLodGenerationOptions {
+  // LODs count including the full detail one
+  size_t lodsCount = 1;
+
+  // Triangles count of every LOD relative to the previous one
+  float trianglesRatio = 0.5f;
+
+  // Minimal screen sizes of the LODs except the last one, the sizes are halved from 0.5 if they are not set
+  std::vector<float> screenSizes;
+
+  // Maximal simplification error relative to the mesh extent
+  float maxError = 0.02f;
+};
+
+/*!
+ * \brief Generates the LODs chain of the raw mesh by the quadric error simplification
+ *
+ * Every LOD is simplified from the previous one, its indices are appended to the sub-meshes
+ * indices and the LOD is described by the indices ranges. The chain is cut if the next LOD
+ * could not reduce the triangles count noticeably.
+ */
+class MeshLodGenerator {
+ public:
+  MeshLodGenerator() = delete;
+
+  static void generateLods(RawMesh& mesh, const MeshLodGenerationOptions& options);
+
+ public:
+  // Minimal triangles count reduction of the next LOD to keep it in the chain
+  static constexpr float MIN_LOD_REDUCTION = 0.1f;
+};
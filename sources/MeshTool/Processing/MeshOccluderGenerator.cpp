@@ -0,0 +1,87 @@
+#include "MeshOccluderGenerator.h"
+
+#include <cmath>
+#include <map>
+#include <tuple>
+
+#include <spdlog/spdlog.h>
+
+#include <Engine/Exceptions/exceptions.h>
+
+#include "MeshSimplifier.h"
+
+void MeshOccluderGenerator::generateOccluder(RawMesh& mesh, const MeshOccluderGenerationOptions& options)
+{
+  if (options.trianglesRatio <= 0.0f || options.trianglesRatio > 1.0f) {
+    THROW_EXCEPTION(EngineRuntimeException, "Occluder triangles ratio should be in range (0, 1]");
+  }
+
+  // The vertices split by the normals and UV seams are welded, so only the positions are compared
+  std::map<std::tuple<float, float, float>, uint32_t> weldedVerticesIndices;
+  std::vector<uint32_t> verticesRemap(mesh.positions.size());
+  std::vector<glm::vec3> positions;
+
+  for (size_t vertexIndex = 0; vertexIndex < mesh.positions.size(); vertexIndex++) {
+    glm::vec3 position = rawVector3ToGLMVector3(mesh.positions[vertexIndex]);
+
+    auto [vertexIt, isInserted] = weldedVerticesIndices.insert({
+      {position.x, position.y, position.z},
+      static_cast<uint32_t>(positions.size()),
+    });
+
+    if (isInserted) {
+      positions.push_back(position);
+    }
+
+    verticesRemap[vertexIndex] = vertexIt->second;
+  }
+
+  // Only the full detail indices of the sub-meshes are merged, the other LODs are dropped
+  RawMeshLodDescription fullDetailLod = RawMesh::getFullDetailLod(mesh);
+  std::vector<uint32_t> indices;
+
+  for (size_t subMeshIndex = 0; subMeshIndex < mesh.subMeshesDescriptions.size(); subMeshIndex++) {
+    const RawMeshIndicesRange& range = fullDetailLod.subMeshesRanges[subMeshIndex];
+    const std::vector<uint32_t>& subMeshIndices = mesh.subMeshesDescriptions[subMeshIndex].indices;
+
+    for (size_t index = range.indicesOffset; index < range.indicesOffset + range.indicesCount; index++) {
+      indices.push_back(verticesRemap[subMeshIndices[index]]);
+    }
+  }
+
+  auto targetTrianglesCount = static_cast<size_t>(std::ceil(static_cast<float>(indices.size() / 3) *
+    options.trianglesRatio));
+
+  std::vector<uint32_t> occluderIndices = MeshSimplifier::simplify(positions, indices, MeshSimplificationOptions{
+    .targetIndicesCount = targetTrianglesCount * 3,
+    .maxError = options.maxError,
+  });
+
+  spdlog::info("Occluder is generated ({} indices, {} indices in the source mesh)", occluderIndices.size(),
+    indices.size());
+
+  // The simplified indices reference a part of the welded vertices, the unused ones are removed by the export
+  // optimization
+  mesh.positions.clear();
+
+  for (const glm::vec3& position : positions) {
+    mesh.positions.push_back(glmVector3ToRawVector3(position));
+  }
+
+  mesh.normals.clear();
+  mesh.tangents.clear();
+  mesh.uv.clear();
+  mesh.bonesIds.clear();
+  mesh.bonesWeights.clear();
+
+  mesh.subMeshesDescriptions = {RawSubMeshDescription{
+    .indicesCount = static_cast<uint32_t>(occluderIndices.size()),
+    .indices = std::move(occluderIndices),
+  }};
+
+  mesh.lods.clear();
+
+  mesh.header.verticesCount = static_cast<uint32_t>(mesh.positions.size());
+  mesh.header.subMeshesCount = 1;
+  mesh.header.storedAttributesMask = static_cast<bitmask64>(RawMeshAttributes::Positions);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Engine/Modules/Graphics/Resources/Raw/RawMesh.h>
+
+struct MeshOccluderGenerationOptions {
+  // Triangles count of the occluder relative to the source mesh
+  float trianglesRatio = 0.1f;
+
+  // Maximal simplification error relative to the mesh size
+  float maxError = 0.02f;
+};
+
+/*!
+ * \brief Converts the raw mesh to the simplified occluder mesh for the software occlusion culling
+ *
+ * The sub-meshes are merged into a single one, the vertices are welded by their positions to simplify
+ * the mesh across the attributes seams, and only the positions are kept. The occluder could slightly go out
+ * of the source mesh silhouette by the simplification error, so the error limit should be kept low.
+ */
+class MeshOccluderGenerator {
+ public:
+  MeshOccluderGenerator() = delete;
+
+  static void generateOccluder(RawMesh& mesh, const MeshOccluderGenerationOptions& options);
+};
@@ -0,0 +1,537 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <set>
+#include <utility>
+
+#include <glm/glm.hpp>
+#include <spdlog/spdlog.h>
+
+#include <Engine/swdebug.h>
+
+namespace {
+
+// Forsyth algorithm scoring parameters
+constexpr float CACHE_DECAY_POWER = 1.5f;
+constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+constexpr float VALENCE_BOOST_SCALE = 2.0f;
+constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+float getVertexScore(int cachePosition, uint32_t remainingTrianglesCount)
+{
+  if (remainingTrianglesCount == 0) {
+    return -1.0f;
+  }
+
+  float score = 0.0f;
+
+  if (cachePosition >= 0) {
+    if (cachePosition < 3) {
+      // The vertices of the last triangle are scored lower to avoid the strips-like order
+      score = LAST_TRIANGLE_SCORE;
+    }
+    else {
+      float cacheScale = 1.0f / static_cast<float>(MeshOptimizer::OPTIMIZATION_CACHE_SIZE - 3);
+      score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * cacheScale, CACHE_DECAY_POWER);
+    }
+  }
+
+  // The vertices with a few remaining triangles are boosted to get rid of them fast
+  score += VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingTrianglesCount), -VALENCE_BOOST_POWER);
+
+  return score;
+}
+
+/*!
+ * \brief FIFO post-transform cache simulation, the cached vertices are detected by their insertion timestamps
+ */
+class VertexCacheSimulator {
+ public:
+  VertexCacheSimulator(size_t verticesCount, size_t cacheSize)
+    : m_cacheSize(static_cast<uint32_t>(cacheSize)),
+      m_timestamps(verticesCount, 0),
+      m_timestamp(static_cast<uint32_t>(cacheSize) + 1)
+  {
+
+  }
+
+  /*!
+   * \brief Processes the triangle and returns its vertices cache misses count
+   */
+  uint32_t processTriangle(const uint32_t* triangle)
+  {
+    uint32_t missesCount = 0;
+
+    for (size_t vertexNumber = 0; vertexNumber < 3; vertexNumber++) {
+      uint32_t vertex = triangle[vertexNumber];
+
+      if (m_timestamp - m_timestamps[vertex] > m_cacheSize) {
+        m_timestamps[vertex] = m_timestamp++;
+        missesCount++;
+      }
+    }
+
+    return missesCount;
+  }
+
+  void reset()
+  {
+    m_timestamp += m_cacheSize + 1;
+  }
+
+ private:
+  uint32_t m_cacheSize{};
+
+  std::vector<uint32_t> m_timestamps;
+  uint32_t m_timestamp{};
+};
+
+std::vector<RawMeshIndicesRange> getUniqueIndicesRanges(const RawMesh& mesh, size_t subMeshIndex)
+{
+  std::vector<RawMeshLodDescription> lods = mesh.lods.empty() ?
+    std::vector<RawMeshLodDescription>{RawMesh::getFullDetailLod(mesh)} : mesh.lods;
+
+  std::vector<RawMeshIndicesRange> ranges;
+  std::set<std::pair<uint32_t, uint32_t>> rangesKeys;
+
+  for (const RawMeshLodDescription& lod : lods) {
+    const RawMeshIndicesRange& range = lod.subMeshesRanges[subMeshIndex];
+
+    if (range.indicesCount != 0 && rangesKeys.insert({range.indicesOffset, range.indicesCount}).second) {
+      ranges.push_back(range);
+    }
+  }
+
+  return ranges;
+}
+
+VertexCacheStatistics analyzeMeshVertexCache(const RawMesh& mesh)
+{
+  VertexCacheStatistics meshStatistics{};
+
+  for (size_t subMeshIndex = 0; subMeshIndex < mesh.subMeshesDescriptions.size(); subMeshIndex++) {
+    const std::vector<uint32_t>& indices = mesh.subMeshesDescriptions[subMeshIndex].indices;
+
+    // Every LOD is drawn separately, so the cache is not shared between them
+    for (const RawMeshIndicesRange& range : getUniqueIndicesRanges(mesh, subMeshIndex)) {
+      VertexCacheStatistics rangeStatistics = MeshOptimizer::analyzeVertexCache(
+        std::span(indices).subspan(range.indicesOffset, range.indicesCount), mesh.positions.size());
+
+      meshStatistics.trianglesCount += rangeStatistics.trianglesCount;
+      meshStatistics.verticesCount += rangeStatistics.verticesCount;
+      meshStatistics.cacheMissesCount += rangeStatistics.cacheMissesCount;
+    }
+  }
+
+  if (meshStatistics.trianglesCount != 0) {
+    meshStatistics.acmr = static_cast<float>(meshStatistics.cacheMissesCount) /
+      static_cast<float>(meshStatistics.trianglesCount);
+    meshStatistics.atvr = static_cast<float>(meshStatistics.cacheMissesCount) /
+      static_cast<float>(meshStatistics.verticesCount);
+  }
+
+  return meshStatistics;
+}
+
+template<class T>
+void remapVertexAttribute(std::vector<T>& attribute, const std::vector<uint32_t>& remap, size_t verticesCount)
+{
+  if (attribute.size() != remap.size()) {
+    return;
+  }
+
+  std::vector<T> remappedAttribute(verticesCount);
+
+  for (size_t vertexIndex = 0; vertexIndex < remap.size(); vertexIndex++) {
+    if (remap[vertexIndex] != MeshOptimizer::UNUSED_VERTEX) {
+      remappedAttribute[remap[vertexIndex]] = attribute[vertexIndex];
+    }
+  }
+
+  attribute = std::move(remappedAttribute);
+}
+
+}
+
+std::vector<uint32_t> MeshOptimizer::optimizeVertexCache(std::span<const uint32_t> indices,
+  size_t verticesCount)
+{
+  SW_ASSERT(indices.size() % 3 == 0);
+
+  size_t trianglesCount = indices.size() / 3;
+
+  // Triangles adjacency of the vertices, the emitted triangles are moved to the end of the vertex range
+  std::vector<uint32_t> remainingTrianglesCounts(verticesCount, 0);
+
+  for (uint32_t vertex : indices) {
+    SW_ASSERT(vertex < verticesCount);
+
+    remainingTrianglesCounts[vertex]++;
+  }
+
+  std::vector<uint32_t> adjacencyOffsets(verticesCount + 1, 0);
+
+  for (size_t vertexIndex = 0; vertexIndex < verticesCount; vertexIndex++) {
+    adjacencyOffsets[vertexIndex + 1] = adjacencyOffsets[vertexIndex] + remainingTrianglesCounts[vertexIndex];
+  }
+
+  std::vector<uint32_t> adjacentTriangles(indices.size());
+  std::vector<uint32_t> adjacencyFillOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+
+  for (size_t index = 0; index < indices.size(); index++) {
+    adjacentTriangles[adjacencyFillOffsets[indices[index]]++] = static_cast<uint32_t>(index / 3);
+  }
+
+  std::vector<int> cachePositions(verticesCount, -1);
+  std::vector<float> verticesScores(verticesCount);
+
+  for (size_t vertexIndex = 0; vertexIndex < verticesCount; vertexIndex++) {
+    verticesScores[vertexIndex] = getVertexScore(-1, remainingTrianglesCounts[vertexIndex]);
+  }
+
+  auto getTriangleScore = [&](size_t triangleIndex) {
+    return verticesScores[indices[triangleIndex * 3]] + verticesScores[indices[triangleIndex * 3 + 1]] +
+      verticesScores[indices[triangleIndex * 3 + 2]];
+  };
+
+  std::vector<float> trianglesScores(trianglesCount);
+  std::vector<bool> isTriangleEmitted(trianglesCount, false);
+
+  for (size_t triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex++) {
+    trianglesScores[triangleIndex] = getTriangleScore(triangleIndex);
+  }
+
+  std::vector<uint32_t> optimizedIndices;
+  optimizedIndices.reserve(indices.size());
+
+  std::vector<uint32_t> cache;
+  std::vector<uint32_t> updatedCache;
+
+  cache.reserve(OPTIMIZATION_CACHE_SIZE + 3);
+  updatedCache.reserve(OPTIMIZATION_CACHE_SIZE + 3);
+
+  auto bestTriangleIt = std::max_element(trianglesScores.begin(), trianglesScores.end());
+  int bestTriangle = (bestTriangleIt != trianglesScores.end()) ?
+    static_cast<int>(std::distance(trianglesScores.begin(), bestTriangleIt)) : -1;
+
+  size_t nextTriangleLookupIndex = 0;
+
+  for (size_t emittedTrianglesCount = 0; emittedTrianglesCount < trianglesCount; emittedTrianglesCount++) {
+    if (bestTriangle < 0) {
+      // There are no triangles adjacent to the cached vertices, so the next one is taken in the source order
+      while (isTriangleEmitted[nextTriangleLookupIndex]) {
+        nextTriangleLookupIndex++;
+      }
+
+      bestTriangle = static_cast<int>(nextTriangleLookupIndex);
+    }
+
+    const uint32_t* triangle = &indices[static_cast<size_t>(bestTriangle) * 3];
+
+    optimizedIndices.insert(optimizedIndices.end(), triangle, triangle + 3);
+    isTriangleEmitted[static_cast<size_t>(bestTriangle)] = true;
+
+    updatedCache.clear();
+
+    for (size_t vertexNumber = 0; vertexNumber < 3; vertexNumber++) {
+      uint32_t vertex = triangle[vertexNumber];
+
+      // Move the emitted triangle out of the active adjacency range
+      uint32_t* vertexTriangles = &adjacentTriangles[adjacencyOffsets[vertex]];
+      uint32_t* vertexTrianglesEnd = vertexTriangles + remainingTrianglesCounts[vertex];
+
+      std::iter_swap(std::find(vertexTriangles, vertexTrianglesEnd, static_cast<uint32_t>(bestTriangle)),
+        vertexTrianglesEnd - 1);
+      remainingTrianglesCounts[vertex]--;
+
+      updatedCache.push_back(vertex);
+    }
+
+    for (uint32_t cachedVertex : cache) {
+      if (cachedVertex != triangle[0] && cachedVertex != triangle[1] && cachedVertex != triangle[2]) {
+        updatedCache.push_back(cachedVertex);
+      }
+    }
+
+    // The vertices beyond the cache size are evicted, but their scores are updated as well
+    for (size_t cachePosition = 0; cachePosition < updatedCache.size(); cachePosition++) {
+      uint32_t vertex = updatedCache[cachePosition];
+
+      cachePositions[vertex] = (cachePosition < OPTIMIZATION_CACHE_SIZE) ? static_cast<int>(cachePosition) : -1;
+      verticesScores[vertex] = getVertexScore(cachePositions[vertex], remainingTrianglesCounts[vertex]);
+    }
+
+    bestTriangle = -1;
+    float bestTriangleScore = -1.0f;
+
+    for (uint32_t vertex : updatedCache) {
+      for (uint32_t adjacencyIndex = adjacencyOffsets[vertex];
+           adjacencyIndex < adjacencyOffsets[vertex] + remainingTrianglesCounts[vertex]; adjacencyIndex++) {
+        uint32_t triangleIndex = adjacentTriangles[adjacencyIndex];
+
+        trianglesScores[triangleIndex] = getTriangleScore(triangleIndex);
+
+        if (cachePositions[vertex] >= 0 && trianglesScores[triangleIndex] > bestTriangleScore) {
+          bestTriangle = static_cast<int>(triangleIndex);
+          bestTriangleScore = trianglesScores[triangleIndex];
+        }
+      }
+    }
+
+    updatedCache.resize(std::min(updatedCache.size(), OPTIMIZATION_CACHE_SIZE));
+    std::swap(cache, updatedCache);
+  }
+
+  return optimizedIndices;
+}
+
+std::vector<uint32_t> MeshOptimizer::optimizeOverdraw(const std::vector<glm::vec3>& positions,
+  std::span<const uint32_t> indices,
+  float threshold)
+{
+  SW_ASSERT(indices.size() % 3 == 0);
+
+  size_t trianglesCount = indices.size() / 3;
+
+  if (trianglesCount == 0) {
+    return {};
+  }
+
+  VertexCacheSimulator cacheSimulator(positions.size(), ANALYSIS_CACHE_SIZE);
+
+  // Hard boundaries are the triangles with all vertices missed in the cache, the order could be changed there freely.
+  // The first triangle always starts a cluster, it could be degenerate and miss less than three vertices.
+  std::vector<size_t> hardBoundaries = {0};
+
+  cacheSimulator.processTriangle(&indices[0]);
+
+  for (size_t triangleIndex = 1; triangleIndex < trianglesCount; triangleIndex++) {
+    if (cacheSimulator.processTriangle(&indices[triangleIndex * 3]) == 3) {
+      hardBoundaries.push_back(triangleIndex);
+    }
+  }
+
+  hardBoundaries.push_back(trianglesCount);
+
+  // Soft boundaries split the hard clusters further while the clusters cache efficiency is close to the source one
+  std::vector<size_t> clustersBoundaries;
+
+  for (size_t hardClusterIndex = 0; hardClusterIndex + 1 < hardBoundaries.size(); hardClusterIndex++) {
+    size_t clusterBegin = hardBoundaries[hardClusterIndex];
+    size_t clusterEnd = hardBoundaries[hardClusterIndex + 1];
+
+    cacheSimulator.reset();
+
+    size_t clusterMissesCount = 0;
+
+    for (size_t triangleIndex = clusterBegin; triangleIndex < clusterEnd; triangleIndex++) {
+      clusterMissesCount += cacheSimulator.processTriangle(&indices[triangleIndex * 3]);
+    }
+
+    float clusterThreshold = threshold * static_cast<float>(clusterMissesCount) /
+      static_cast<float>(clusterEnd - clusterBegin);
+
+    clustersBoundaries.push_back(clusterBegin);
+    cacheSimulator.reset();
+
+    size_t runningMissesCount = 0;
+    size_t runningTrianglesCount = 0;
+
+    for (size_t triangleIndex = clusterBegin; triangleIndex < clusterEnd; triangleIndex++) {
+      runningMissesCount += cacheSimulator.processTriangle(&indices[triangleIndex * 3]);
+      runningTrianglesCount++;
+
+      if (triangleIndex + 1 < clusterEnd &&
+        static_cast<float>(runningMissesCount) / static_cast<float>(runningTrianglesCount) <= clusterThreshold) {
+        clustersBoundaries.push_back(triangleIndex + 1);
+        cacheSimulator.reset();
+
+        runningMissesCount = 0;
+        runningTrianglesCount = 0;
+      }
+    }
+  }
+
+  clustersBoundaries.push_back(trianglesCount);
+
+  size_t clustersCount = clustersBoundaries.size() - 1;
+
+  // Clusters are sorted by their distance from the mesh center along their normals, so the outer ones are first
+  glm::vec3 meshCentroid(0.0f);
+
+  for (uint32_t vertex : indices) {
+    meshCentroid += positions[vertex];
+  }
+
+  meshCentroid /= static_cast<float>(indices.size());
+
+  std::vector<float> clustersSortKeys(clustersCount);
+
+  for (size_t clusterIndex = 0; clusterIndex < clustersCount; clusterIndex++) {
+    glm::vec3 clusterCentroid(0.0f);
+    glm::vec3 clusterNormal(0.0f);
+    float clusterArea = 0.0f;
+
+    for (size_t triangleIndex = clustersBoundaries[clusterIndex];
+         triangleIndex < clustersBoundaries[clusterIndex + 1]; triangleIndex++) {
+      const glm::vec3& p0 = positions[indices[triangleIndex * 3]];
+      const glm::vec3& p1 = positions[indices[triangleIndex * 3 + 1]];
+      const glm::vec3& p2 = positions[indices[triangleIndex * 3 + 2]];
+
+      glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+      float area = glm::length(normal);
+
+      clusterCentroid += (p0 + p1 + p2) * (area / 3.0f);
+      clusterNormal += normal;
+      clusterArea += area;
+    }
+
+    if (clusterArea > 0.0f) {
+      clusterCentroid /= clusterArea;
+    }
+
+    float clusterNormalLength = glm::length(clusterNormal);
+
+    if (clusterNormalLength > 0.0f) {
+      clusterNormal /= clusterNormalLength;
+    }
+
+    clustersSortKeys[clusterIndex] = glm::dot(clusterCentroid - meshCentroid, clusterNormal);
+  }
+
+  std::vector<size_t> clustersOrder(clustersCount);
+  std::iota(clustersOrder.begin(), clustersOrder.end(), 0);
+
+  std::stable_sort(clustersOrder.begin(), clustersOrder.end(), [&clustersSortKeys](size_t first, size_t second) {
+    return clustersSortKeys[first] > clustersSortKeys[second];
+  });
+
+  std::vector<uint32_t> optimizedIndices;
+  optimizedIndices.reserve(indices.size());
+
+  for (size_t clusterIndex : clustersOrder) {
+    optimizedIndices.insert(optimizedIndices.end(),
+      indices.begin() + static_cast<std::ptrdiff_t>(clustersBoundaries[clusterIndex] * 3),
+      indices.begin() + static_cast<std::ptrdiff_t>(clustersBoundaries[clusterIndex + 1] * 3));
+  }
+
+  return optimizedIndices;
+}
+
+std::vector<uint32_t> MeshOptimizer::generateVertexFetchRemap(std::span<const uint32_t> indices,
+  size_t verticesCount)
+{
+  std::vector<uint32_t> remap(verticesCount, UNUSED_VERTEX);
+  uint32_t nextVertexIndex = 0;
+
+  for (uint32_t vertex : indices) {
+    SW_ASSERT(vertex < verticesCount);
+
+    if (remap[vertex] == UNUSED_VERTEX) {
+      remap[vertex] = nextVertexIndex++;
+    }
+  }
+
+  return remap;
+}
+
+VertexCacheStatistics MeshOptimizer::analyzeVertexCache(std::span<const uint32_t> indices,
+  size_t verticesCount,
+  size_t cacheSize)
+{
+  SW_ASSERT(indices.size() % 3 == 0);
+
+  VertexCacheStatistics statistics{.trianglesCount = indices.size() / 3};
+
+  VertexCacheSimulator cacheSimulator(verticesCount, cacheSize);
+  std::vector<bool> isVertexUsed(verticesCount, false);
+
+  for (size_t triangleIndex = 0; triangleIndex < statistics.trianglesCount; triangleIndex++) {
+    statistics.cacheMissesCount += cacheSimulator.processTriangle(&indices[triangleIndex * 3]);
+  }
+
+  for (uint32_t vertex : indices) {
+    if (!isVertexUsed[vertex]) {
+      isVertexUsed[vertex] = true;
+      statistics.verticesCount++;
+    }
+  }
+
+  if (statistics.trianglesCount != 0) {
+    statistics.acmr = static_cast<float>(statistics.cacheMissesCount) / static_cast<float>(statistics.trianglesCount);
+    statistics.atvr = static_cast<float>(statistics.cacheMissesCount) / static_cast<float>(statistics.verticesCount);
+  }
+
+  return statistics;
+}
+
+void MeshOptimizer::optimizeMesh(RawMesh& mesh, const MeshOptimizationOptions& options)
+{
+  VertexCacheStatistics sourceStatistics = analyzeMeshVertexCache(mesh);
+
+  std::vector<glm::vec3> positions;
+  positions.reserve(mesh.positions.size());
+
+  for (const RawVector3& position : mesh.positions) {
+    positions.push_back(rawVector3ToGLMVector3(position));
+  }
+
+  for (size_t subMeshIndex = 0; subMeshIndex < mesh.subMeshesDescriptions.size(); subMeshIndex++) {
+    std::vector<uint32_t>& indices = mesh.subMeshesDescriptions[subMeshIndex].indices;
+
+    for (const RawMeshIndicesRange& range : getUniqueIndicesRanges(mesh, subMeshIndex)) {
+      std::vector<uint32_t> optimizedIndices = optimizeVertexCache(
+        std::span(indices).subspan(range.indicesOffset, range.indicesCount), positions.size());
+
+      if (options.optimizeOverdraw) {
+        optimizedIndices = optimizeOverdraw(positions, optimizedIndices, options.overdrawThreshold);
+      }
+
+      SW_ASSERT(optimizedIndices.size() == range.indicesCount);
+
+      std::copy(optimizedIndices.begin(), optimizedIndices.end(),
+        indices.begin() + static_cast<std::ptrdiff_t>(range.indicesOffset));
+    }
+  }
+
+  if (options.optimizeVertexFetch) {
+    // The vertices are shared by all sub-meshes and LODs, so they are remapped by the first use in any of them
+    std::vector<uint32_t> allIndices;
+
+    for (const RawSubMeshDescription& subMeshDescription : mesh.subMeshesDescriptions) {
+      allIndices.insert(allIndices.end(), subMeshDescription.indices.begin(), subMeshDescription.indices.end());
+    }
+
+    std::vector<uint32_t> remap = generateVertexFetchRemap(allIndices, mesh.positions.size());
+
+    auto usedVerticesCount = static_cast<size_t>(std::count_if(remap.begin(), remap.end(), [](uint32_t vertex) {
+      return vertex != UNUSED_VERTEX;
+    }));
+
+    if (usedVerticesCount < mesh.positions.size()) {
+      spdlog::info("{} unused vertices are removed", mesh.positions.size() - usedVerticesCount);
+    }
+
+    remapVertexAttribute(mesh.positions, remap, usedVerticesCount);
+    remapVertexAttribute(mesh.normals, remap, usedVerticesCount);
+    remapVertexAttribute(mesh.tangents, remap, usedVerticesCount);
+    remapVertexAttribute(mesh.uv, remap, usedVerticesCount);
+    remapVertexAttribute(mesh.bonesIds, remap, usedVerticesCount);
+    remapVertexAttribute(mesh.bonesWeights, remap, usedVerticesCount);
+
+    for (RawSubMeshDescription& subMeshDescription : mesh.subMeshesDescriptions) {
+      for (uint32_t& vertex : subMeshDescription.indices) {
+        vertex = remap[vertex];
+      }
+    }
+
+    mesh.header.verticesCount = static_cast<uint32_t>(usedVerticesCount);
+  }
+
+  VertexCacheStatistics optimizedStatistics = analyzeMeshVertexCache(mesh);
+
+  spdlog::info("Vertex cache is optimized: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}",
+    sourceStatistics.acmr, optimizedStatistics.acmr, sourceStatistics.atvr, optimizedStatistics.atvr);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+#include <Engine/Modules/Graphics/Resources/Raw/RawMesh.h>
+
+struct VertexCacheStatistics {
+  size_t trianglesCount{};
+  size_t verticesCount{};
+  size_t cacheMissesCount{};
+
+  // Average cache misses count per triangle
+  float acmr{};
+
+  // Average transforms count per vertex, it is 1.0 for the ideal order
+  float atvr{};
+};
+
+struct MeshOptimizationOptions {
+  bool optimizeOverdraw = true;
+  bool optimizeVertexFetch = true;
+
+  // Maximal vertex cache efficiency degradation allowed for the overdraw ordering
+  float overdrawThreshold = 1.05f;
+};
+
+/*!
+ * \brief Optimizations of the mesh indices and vertices order for the GPU vertex processing
+ *
+ * The triangles are reordered for the post-transform vertex cache by the Forsyth algorithm, then
+ * the clusters of the triangles are ordered from the outer ones to reduce the overdraw, and finally
+ * the vertices are reordered by their first use to make the vertex fetch linear.
+ */
+class MeshOptimizer {
+ public:
+  MeshOptimizer() = delete;
+
+  /*!
+   * \brief Reorders the triangles of the indices range for the post-transform vertex cache
+   */
+  [[nodiscard]] static std::vector<uint32_t> optimizeVertexCache(std::span<const uint32_t> indices,
+    size_t verticesCount);
+
+  /*!
+   * \brief Reorders the clusters of the cache optimized triangles so that the outer ones are drawn first
+   */
+  [[nodiscard]] static std::vector<uint32_t> optimizeOverdraw(const std::vector<glm::vec3>& positions,
+    std::span<const uint32_t> indices,
+    float threshold);
+
+  /*!
+   * \brief Generates the new vertices indices in the first use order, the unused vertices are marked
+   */
+  [[nodiscard]] static std::vector<uint32_t> generateVertexFetchRemap(std::span<const uint32_t> indices,
+    size_t verticesCount);
+
+  [[nodiscard]] static VertexCacheStatistics analyzeVertexCache(std::span<const uint32_t> indices,
+    size_t verticesCount,
+    size_t cacheSize = ANALYSIS_CACHE_SIZE);
+
+  /*!
+   * \brief Optimizes all LODs of all sub-meshes of the raw mesh and reports the vertex cache statistics
+   */
+  static void optimizeMesh(RawMesh& mesh, const MeshOptimizationOptions& options);
+
+ public:
+  // FIFO cache size of the most of the hardware
+  static constexpr size_t ANALYSIS_CACHE_SIZE = 16;
+
+  // LRU cache size of the Forsyth algorithm scoring
+  static constexpr size_t OPTIMIZATION_CACHE_SIZE = 32;
+
+  static constexpr uint32_t UNUSED_VERTEX = std::numeric_limits<uint32_t>::max();
+};
@@ -0,0 +1,317 @@
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+
+#include <glm/glm.hpp>
+
+#include <Engine/swdebug.h>
+
+namespace {
+
+/*!
+ * \brief Symmetric matrix of the weighted squared distances to the set of planes
+ */
+struct Quadric {
+  double a2{};
+  double ab{};
+  double ac{};
+  double ad{};
+  double b2{};
+  double bc{};
+  double bd{};
+  double c2{};
+  double cd{};
+  double d2{};
+
+  double weight{};
+
+  void addPlane(const glm::dvec3& normal, double distance, double planeWeight)
+  {
+    a2 += planeWeight * normal.x * normal.x;
+    ab += planeWeight * normal.x * normal.y;
+    ac += planeWeight * normal.x * normal.z;
+    ad += planeWeight * normal.x * distance;
+    b2 += planeWeight * normal.y * normal.y;
+    bc += planeWeight * normal.y * normal.z;
+    bd += planeWeight * normal.y * distance;
+    c2 += planeWeight * normal.z * normal.z;
+    cd += planeWeight * normal.z * distance;
+    d2 += planeWeight * distance * distance;
+
+    weight += planeWeight;
+  }
+
+  Quadric& operator+=(const Quadric& other)
+  {
+    a2 += other.a2;
+    ab += other.ab;
+    ac += other.ac;
+    ad += other.ad;
+    b2 += other.b2;
+    bc += other.bc;
+    bd += other.bd;
+    c2 += other.c2;
+    cd += other.cd;
+    d2 += other.d2;
+
+    weight += other.weight;
+
+    return *this;
+  }
+
+  /*!
+   * \brief Returns the weighted average of the squared distances from the point to the planes
+   */
+  [[nodiscard]] double getError(const glm::dvec3& point) const
+  {
+    double x = point.x;
+    double y = point.y;
+    double z = point.z;
+
+    double error = a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x +
+      b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y +
+      c2 * z * z + 2.0 * cd * z + d2;
+
+    return std::max(error, 0.0) / std::max(weight, std::numeric_limits<double>::epsilon());
+  }
+};
+
+struct CollapseCandidate {
+  double error{};
+
+  uint32_t sourceVertex{};
+  uint32_t targetVertex{};
+
+  // Versions of the vertices at the moment of the candidate evaluation, the outdated candidates are skipped
+  uint32_t sourceVersion{};
+  uint32_t targetVersion{};
+
+  bool operator>(const CollapseCandidate& other) const
+  {
+    return error > other.error;
+  }
+};
+
+inline uint64_t getEdgeKey(uint32_t firstVertex, uint32_t secondVertex)
+{
+  if (firstVertex > secondVertex) {
+    std::swap(firstVertex, secondVertex);
+  }
+
+  return (static_cast<uint64_t>(firstVertex) << 32) | secondVertex;
+}
+
+}
+
+std::vector<uint32_t> MeshSimplifier::simplify(const std::vector<glm::vec3>& positions,
+  const std::vector<uint32_t>& indices,
+  const MeshSimplificationOptions& options)
+{
+  SW_ASSERT(indices.size() % 3 == 0);
+
+  size_t trianglesCount = indices.size() / 3;
+  size_t targetTrianglesCount = options.targetIndicesCount / 3;
+
+  if (trianglesCount <= targetTrianglesCount) {
+    return indices;
+  }
+
+  size_t verticesCount = positions.size();
+
+  std::vector<uint32_t> triangles(indices.begin(), indices.end());
+  std::vector<bool> isTriangleRemoved(trianglesCount, false);
+
+  std::vector<Quadric> quadrics(verticesCount);
+  std::vector<std::vector<uint32_t>> verticesTriangles(verticesCount);
+  std::unordered_map<uint64_t, uint32_t> edgesTrianglesCount;
+
+  glm::vec3 aabbMin(std::numeric_limits<float>::max());
+  glm::vec3 aabbMax(std::numeric_limits<float>::lowest());
+
+  for (uint32_t triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex++) {
+    const uint32_t* triangle = &triangles[triangleIndex * 3];
+
+    SW_ASSERT(triangle[0] < verticesCount && triangle[1] < verticesCount && triangle[2] < verticesCount);
+
+    glm::dvec3 p0 = positions[triangle[0]];
+    glm::dvec3 p1 = positions[triangle[1]];
+    glm::dvec3 p2 = positions[triangle[2]];
+
+    glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+    double normalLength = glm::length(normal);
+
+    for (size_t vertexNumber = 0; vertexNumber < 3; vertexNumber++) {
+      uint32_t vertex = triangle[vertexNumber];
+
+      if (normalLength > 0.0) {
+        // The planes are weighted by the triangles areas, so the small triangles are collapsed first
+        quadrics[vertex].addPlane(normal / normalLength, -glm::dot(normal / normalLength, p0), normalLength * 0.5);
+      }
+
+      verticesTriangles[vertex].push_back(triangleIndex);
+      edgesTrianglesCount[getEdgeKey(vertex, triangle[(vertexNumber + 1) % 3])]++;
+
+      aabbMin = glm::min(aabbMin, positions[vertex]);
+      aabbMax = glm::max(aabbMax, positions[vertex]);
+    }
+  }
+
+  // The border and non-manifold edges vertices are not moved to keep the silhouette and the seams
+  std::vector<bool> isVertexLocked(verticesCount, false);
+
+  for (const auto& [edgeKey, edgeTrianglesCount] : edgesTrianglesCount) {
+    if (edgeTrianglesCount != 2) {
+      isVertexLocked[static_cast<uint32_t>(edgeKey >> 32)] = true;
+      isVertexLocked[static_cast<uint32_t>(edgeKey & 0xFFFFFFFF)] = true;
+    }
+  }
+
+  double maxError = static_cast<double>(options.maxError) * glm::distance(aabbMin, aabbMax);
+  double maxQuadricError = maxError * maxError;
+
+  std::vector<uint32_t> verticesVersions(verticesCount, 0);
+  std::priority_queue<CollapseCandidate, std::vector<CollapseCandidate>, std::greater<>> candidates;
+
+  auto pushCandidate = [&](uint32_t sourceVertex, uint32_t targetVertex) {
+    if (isVertexLocked[sourceVertex]) {
+      return;
+    }
+
+    Quadric quadric = quadrics[sourceVertex];
+    quadric += quadrics[targetVertex];
+
+    candidates.push(CollapseCandidate{
+      .error = quadric.getError(positions[targetVertex]),
+      .sourceVertex = sourceVertex,
+      .targetVertex = targetVertex,
+      .sourceVersion = verticesVersions[sourceVertex],
+      .targetVersion = verticesVersions[targetVertex],
+    });
+  };
+
+  auto pushVertexCandidates = [&](uint32_t vertex) {
+    for (uint32_t triangleIndex : verticesTriangles[vertex]) {
+      if (isTriangleRemoved[triangleIndex]) {
+        continue;
+      }
+
+      for (size_t vertexNumber = 0; vertexNumber < 3; vertexNumber++) {
+        uint32_t neighbourVertex = triangles[triangleIndex * 3 + vertexNumber];
+
+        if (neighbourVertex != vertex) {
+          pushCandidate(vertex, neighbourVertex);
+          pushCandidate(neighbourVertex, vertex);
+        }
+      }
+    }
+  };
+
+  for (uint32_t triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex++) {
+    for (size_t vertexNumber = 0; vertexNumber < 3; vertexNumber++) {
+      uint32_t vertex = triangles[triangleIndex * 3 + vertexNumber];
+      uint32_t nextVertex = triangles[triangleIndex * 3 + (vertexNumber + 1) % 3];
+
+      pushCandidate(vertex, nextVertex);
+      pushCandidate(nextVertex, vertex);
+    }
+  }
+
+  auto isCollapseValid = [&](uint32_t sourceVertex, uint32_t targetVertex) {
+    for (uint32_t triangleIndex : verticesTriangles[sourceVertex]) {
+      if (isTriangleRemoved[triangleIndex]) {
+        continue;
+      }
+
+      const uint32_t* triangle = &triangles[triangleIndex * 3];
+
+      if (triangle[0] == targetVertex || triangle[1] == targetVertex || triangle[2] == targetVertex) {
+        continue;
+      }
+
+      glm::vec3 trianglePositions[3] = {positions[triangle[0]], positions[triangle[1]], positions[triangle[2]]};
+      glm::vec3 normal = glm::cross(trianglePositions[1] - trianglePositions[0],
+        trianglePositions[2] - trianglePositions[0]);
+
+      for (size_t vertexNumber = 0; vertexNumber < 3; vertexNumber++) {
+        if (triangle[vertexNumber] == sourceVertex) {
+          trianglePositions[vertexNumber] = positions[targetVertex];
+        }
+      }
+
+      glm::vec3 collapsedNormal = glm::cross(trianglePositions[1] - trianglePositions[0],
+        trianglePositions[2] - trianglePositions[0]);
+
+      // The collapse should not flip or degenerate the remaining triangles
+      if (glm::dot(normal, collapsedNormal) <= 0.0f) {
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  size_t remainingTrianglesCount = trianglesCount;
+
+  while (remainingTrianglesCount > targetTrianglesCount && !candidates.empty()) {
+    CollapseCandidate candidate = candidates.top();
+    candidates.pop();
+
+    uint32_t sourceVertex = candidate.sourceVertex;
+    uint32_t targetVertex = candidate.targetVertex;
+
+    if (candidate.sourceVersion != verticesVersions[sourceVertex] ||
+      candidate.targetVersion != verticesVersions[targetVertex]) {
+      continue;
+    }
+
+    if (candidate.error > maxQuadricError) {
+      break;
+    }
+
+    if (!isCollapseValid(sourceVertex, targetVertex)) {
+      continue;
+    }
+
+    for (uint32_t triangleIndex : verticesTriangles[sourceVertex]) {
+      if (isTriangleRemoved[triangleIndex]) {
+        continue;
+      }
+
+      uint32_t* triangle = &triangles[triangleIndex * 3];
+
+      if (triangle[0] == targetVertex || triangle[1] == targetVertex || triangle[2] == targetVertex) {
+        isTriangleRemoved[triangleIndex] = true;
+        remainingTrianglesCount--;
+
+        continue;
+      }
+
+      std::replace(triangle, triangle + 3, sourceVertex, targetVertex);
+      verticesTriangles[targetVertex].push_back(triangleIndex);
+    }
+
+    quadrics[targetVertex] += quadrics[sourceVertex];
+    verticesTriangles[sourceVertex].clear();
+
+    verticesVersions[sourceVertex]++;
+    verticesVersions[targetVertex]++;
+
+    pushVertexCandidates(targetVertex);
+  }
+
+  std::vector<uint32_t> simplifiedIndices;
+  simplifiedIndices.reserve(remainingTrianglesCount * 3);
+
+  for (size_t triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex++) {
+    if (!isTriangleRemoved[triangleIndex]) {
+      for (size_t vertexNumber = 0; vertexNumber < 3; vertexNumber++) {
+        simplifiedIndices.push_back(triangles[triangleIndex * 3 + vertexNumber]);
+      }
+    }
+  }
+
+  return simplifiedIndices;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+struct MeshSimplificationOptions {
+  // Indices count to stop the simplification at, it could be not reached if the error limit is exceeded
+  size_t targetIndicesCount = 0;
+
+  // Maximal allowed geometric error relative to the mesh extent
+  float maxError = 0.01f;
+};
+
+/*!
+ * \brief Quadric error metric simplification of the triangles list
+ *
+ * The edges are collapsed to one of their vertices, so the simplified indices reference the
+ * original vertices. The vertices of the border edges are locked, the attribute seams are
+ * the borders after the identical vertices joining, so the seams are preserved as well.
+ */
+class MeshSimplifier {
+ public:
+  MeshSimplifier() = delete;
+
+  [[nodiscard]] static std::vector<uint32_t> simplify(const std::vector<glm::vec3>& positions,
+    const std::vector<uint32_t>& indices,
+    const MeshSimplificationOptions& options);
+};
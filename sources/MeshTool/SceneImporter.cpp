@@ -219,9 +219,11 @@ void SceneImporter::validateSceneNode(const tinygltf::Model& model,
       raiseImportError("Sparse accessors are not supported yet, so it is needed to flatten the index buffers");
     }
 
-    if (indexAccessor.normalized || indexAccessor.componentType != TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT ||
-      indexAccessor.type != TINYGLTF_TYPE_SCALAR) {
-      raiseImportError("Index accessors should not be normalized and should have scalar unsigned short type");
+    bool isIndexComponentTypeSupported = indexAccessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT ||
+      indexAccessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT;
+
+    if (indexAccessor.normalized || !isIndexComponentTypeSupported || indexAccessor.type != TINYGLTF_TYPE_SCALAR) {
+      raiseImportError("Index accessors should not be normalized and should have scalar unsigned short or int type");
     }
 
     const tinygltf::BufferView& indexBufferView = model.bufferViews[indexAccessor.bufferView];
@@ -440,19 +442,6 @@ std::vector<RawMeshNodeImportData> SceneImporter::convertSceneToRawData(const ti
       commonAttributesMask |= currentRawMeshNode.rawNode.rawMesh.header.storedAttributesMask;
     }
 
-    size_t totalVerticesCount = 0;
-
-    for (unsigned long long skinMeshIndex : skinMeshesList) {
-      auto& rawMeshNode = rawNodesList[skinMeshIndex].rawNode;
-      auto& rawMesh = rawMeshNode.rawMesh;
-
-      totalVerticesCount += rawMesh.header.verticesCount;
-    }
-
-    if (totalVerticesCount > std::numeric_limits<uint16_t>::max()) {
-      raiseImportError(fmt::format("Max vertices count for merged mesh is {}", std::numeric_limits<uint16_t>::max()));
-    }
-
     std::string mergedMeshNodeName = std::string("merged_") + rawNodesList[*skinMeshesList.begin()].rawNode.name;
 
     RawMeshNode mergedRawNode{};
@@ -518,8 +507,8 @@ std::vector<RawMeshNodeImportData> SceneImporter::convertSceneToRawData(const ti
            subMeshIndex++) {
         RawSubMeshDescription& subMesh = mergedRawMesh.subMeshesDescriptions[subMeshIndex];
 
-        for (uint16_t& indexValue: subMesh.indices) {
-          indexValue += static_cast<uint16_t>(verticesOffset);
+        for (uint32_t& indexValue: subMesh.indices) {
+          indexValue += static_cast<uint32_t>(verticesOffset);
         }
       }
 
@@ -646,13 +635,15 @@ RawMeshNode SceneImporter::convertMeshNodeToRawData(const tinygltf::Model& model
     size_t indicesCount = indexAccessor.count;
 
     RawSubMeshDescription subMeshDescription{.indicesCount = static_cast<uint32_t>(indicesCount),
-      .indices = std::vector<uint16_t>(indicesCount, 0)};
+      .indices = std::vector<uint32_t>(indicesCount, 0)};
 
     auto[indicesBufferPtr, indicesBufferStride] = getAttributeBufferStorage(model, indexAccessor);
 
     for (size_t indexNumber = 0; indexNumber < indexAccessor.count; indexNumber++) {
-      subMeshDescription.indices[indexNumber] = reinterpret_cast<const uint16_t*>(
-        indicesBufferPtr)[0] + static_cast<uint16_t>(rawMeshVerticesOffset);
+      uint32_t indexValue = (indexAccessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT) ?
+        reinterpret_cast<const uint32_t*>(indicesBufferPtr)[0] : reinterpret_cast<const uint16_t*>(indicesBufferPtr)[0];
+
+      subMeshDescription.indices[indexNumber] = indexValue + static_cast<uint32_t>(rawMeshVerticesOffset);
       indicesBufferPtr += indicesBufferStride;
     }
 
@@ -932,7 +923,7 @@ RawMeshNode SceneImporter::convertMeshNodeToRawData(const tinygltf::Model& model
 
       RawMeshCollisionShape shape{};
       shape.type = RawMeshCollisionShapeType::TriangleMesh;
-      shape.triangleMesh.header.verticesCount = static_cast<uint16_t>(collisionMeshVertices.size());
+      shape.triangleMesh.header.verticesCount = static_cast<uint32_t>(collisionMeshVertices.size());
 
       for (const auto& vertex : collisionMeshVertices) {
         shape.triangleMesh.vertices.push_back({vertex.x, vertex.y, vertex.z});
@@ -959,7 +950,7 @@ RawMeshNode SceneImporter::convertMeshNodeToRawData(const tinygltf::Model& model
 
   rawNode.collisionsResolutionEnabled = !collisionsResolutionDisabled;
 
-  rawNode.rawMesh.header.verticesCount = static_cast<uint16_t>(rawNode.rawMesh.positions.size());
+  rawNode.rawMesh.header.verticesCount = static_cast<uint32_t>(rawNode.rawMesh.positions.size());
 
   size_t rawMeshVerticesCount = rawNode.rawMesh.positions.size();
 
@@ -138,6 +138,16 @@ TEST_CASE("game_objects_components_management", "[ecs]")
 
   REQUIRE(object.hasComponent<TestHealthComponent>());
   REQUIRE(object.getComponent<TestHealthComponent>()->health == 50);
+
+  GameObjectId objectId = object.getId();
+
+  REQUIRE(gameWorld->findComponent<TestHealthComponent>(objectId)->health == 50);
+  REQUIRE(gameWorld->findComponent<TestMeshComponent>(objectId) == nullptr);
+  REQUIRE(gameWorld->findComponent<TestHealthComponent>(objectId + 1) == nullptr);
+
+  gameWorld->removeGameObject(object);
+
+  REQUIRE(gameWorld->findComponent<TestSpeedComponent>(objectId) == nullptr);
 }
 
 TEST_CASE("game_objects_management", "[ecs]")
@@ -0,0 +1,135 @@
+#include <catch2/catch.hpp>
+
+#include "utility/audioUtility.h"
+
+namespace {
+
+constexpr float UPDATE_DELTA = 0.1f;
+
+void setEmitterOnlineMode(GameWorld& gameWorld, GameObject& emitter, bool isOnline)
+{
+  emitter.getComponent<TransformComponent>()->setOnlineMode(isOnline);
+  gameWorld.emitEvent(GameObjectOnlineStatusChangeEvent{emitter, isOnline});
+}
+
+}
+
+TEST_CASE("audio_static_emitters_culling", "[audio]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateAudioTestResourcesManager();
+
+  auto gameWorld = GameWorld::createInstance();
+  auto audioSystem = createLoopbackAudioSystem(*gameWorld, 8);
+
+  audioSystem->setStaticEmittersCullingRadius(20.0f);
+  audioSystem->getListener().setPosition({0.0f, 0.0f, 0.0f});
+
+  ResourceHandle<AudioClip> clip = createSilentStreamedClip(*resourcesManager, "swengine_audio_culling.ogg", 5.0f);
+
+  // All emitters are closer than the max distance, so only the culling radius limits the static ones
+  GameObject nearStaticEmitter = createPlayingAudioEmitter(*gameWorld, clip, {5.0f, 0.0f, 0.0f}, true);
+  GameObject farStaticEmitter = createPlayingAudioEmitter(*gameWorld, clip, {50.0f, 0.0f, 0.0f}, true);
+  GameObject relativeEmitter = createPlayingAudioEmitter(*gameWorld, clip, {60.0f, 0.0f, 0.0f}, true);
+  GameObject dynamicEmitter = createPlayingAudioEmitter(*gameWorld, clip, {70.0f, 0.0f, 0.0f});
+
+  getEmitterSource(relativeEmitter).setRelativeToListenerMode(true);
+
+  const AudioVoicesStatistics& statistics = audioSystem->getVoicesStatistics();
+
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE(audioSystem->getEmittersCount() == 4);
+  REQUIRE(statistics.processedEmittersCount == 3);
+
+  REQUIRE_FALSE(getEmitterSource(nearStaticEmitter).isVirtual());
+  REQUIRE(getEmitterSource(farStaticEmitter).isVirtual());
+  REQUIRE_FALSE(getEmitterSource(relativeEmitter).isVirtual());
+  REQUIRE_FALSE(getEmitterSource(dynamicEmitter).isVirtual());
+
+  // The static emitter out of the radius is not processed, so it loses the voice even though it is audible
+  audioSystem->getListener().setPosition({50.0f, 0.0f, 0.0f});
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE(statistics.processedEmittersCount == 3);
+  REQUIRE(statistics.stolenVoicesCount == 0);
+
+  REQUIRE(getEmitterSource(nearStaticEmitter).isVirtual());
+  REQUIRE(getEmitterSource(nearStaticEmitter).isPlaying());
+  REQUIRE_FALSE(getEmitterSource(farStaticEmitter).isVirtual());
+  REQUIRE_FALSE(getEmitterSource(relativeEmitter).isVirtual());
+  REQUIRE_FALSE(getEmitterSource(dynamicEmitter).isVirtual());
+
+  // Dynamic and listener relative emitters are processed wherever the listener is
+  audioSystem->getListener().setPosition({-500.0f, 0.0f, 0.0f});
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE(statistics.processedEmittersCount == 2);
+  REQUIRE(statistics.activeVoicesCount == 1);
+
+  REQUIRE(getEmitterSource(nearStaticEmitter).isVirtual());
+  REQUIRE(getEmitterSource(farStaticEmitter).isVirtual());
+  REQUIRE_FALSE(getEmitterSource(relativeEmitter).isVirtual());
+
+  // The dynamic emitter is processed, but it is out of the max distance
+  REQUIRE(getEmitterSource(dynamicEmitter).isVirtual());
+}
+
+TEST_CASE("audio_emitters_online_status", "[audio]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateAudioTestResourcesManager();
+
+  auto gameWorld = GameWorld::createInstance();
+  auto audioSystem = createLoopbackAudioSystem(*gameWorld, 8);
+
+  audioSystem->setStaticEmittersCullingRadius(20.0f);
+  audioSystem->getListener().setPosition({0.0f, 0.0f, 0.0f});
+
+  ResourceHandle<AudioClip> clip = createSilentStreamedClip(*resourcesManager, "swengine_audio_online.ogg", 5.0f);
+
+  GameObject staticEmitter = createPlayingAudioEmitter(*gameWorld, clip, {5.0f, 0.0f, 0.0f}, true);
+  GameObject dynamicEmitter = createPlayingAudioEmitter(*gameWorld, clip, {10.0f, 0.0f, 0.0f});
+
+  // Emitters are indexed on the update after they are added
+  REQUIRE(audioSystem->getEmittersCount() == 0);
+
+  const AudioVoicesStatistics& statistics = audioSystem->getVoicesStatistics();
+
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE(audioSystem->getEmittersCount() == 2);
+  REQUIRE(statistics.processedEmittersCount == 2);
+  REQUIRE(statistics.activeVoicesCount == 2);
+
+  // Offline emitters are unregistered and their sources are stopped
+  setEmitterOnlineMode(*gameWorld, staticEmitter, false);
+  setEmitterOnlineMode(*gameWorld, dynamicEmitter, false);
+
+  REQUIRE(audioSystem->getEmittersCount() == 0);
+  REQUIRE(getEmitterSource(staticEmitter).isStopped());
+  REQUIRE(getEmitterSource(dynamicEmitter).isStopped());
+
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE(statistics.processedEmittersCount == 0);
+  REQUIRE(statistics.activeVoicesCount == 0);
+
+  // Emitters are registered again when they are back online
+  setEmitterOnlineMode(*gameWorld, staticEmitter, true);
+  setEmitterOnlineMode(*gameWorld, dynamicEmitter, true);
+
+  getEmitterSource(staticEmitter).play();
+  getEmitterSource(dynamicEmitter).play();
+
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE(audioSystem->getEmittersCount() == 2);
+  REQUIRE(statistics.processedEmittersCount == 2);
+  REQUIRE(statistics.activeVoicesCount == 2);
+
+  // Repeated online notification does not register the emitter twice
+  setEmitterOnlineMode(*gameWorld, dynamicEmitter, true);
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE(audioSystem->getEmittersCount() == 2);
+  REQUIRE(statistics.processedEmittersCount == 2);
+}
@@ -0,0 +1,178 @@
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include <Engine/Modules/Audio/AudioStream.h>
+#include <Engine/Modules/Audio/AudioStreamer.h>
+
+#include "utility/audioUtility.h"
+
+namespace {
+
+// The chunk is shorter than the stream buffer, so at most one buffer is processed per rendered chunk
+constexpr size_t RENDERED_CHUNK_FRAMES_COUNT = 4096;
+constexpr size_t STREAM_RING_FRAMES_COUNT = AudioStream::BUFFERS_COUNT * AudioStream::BUFFER_FRAMES_COUNT;
+
+ALint getSourceInteger(ALuint source, ALenum parameter)
+{
+  ALint value = 0;
+  alGetSourcei(source, parameter, &value);
+
+  return value;
+}
+
+size_t getClipFramesCount(const AudioClip& clip)
+{
+  return static_cast<size_t>(std::lround(clip.getDuration() * static_cast<float>(clip.getFrequency())));
+}
+
+/*!
+ * \brief Waits until the streaming thread refills and queues all processed buffers
+ */
+bool waitForStreamRefill(ALuint source)
+{
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+
+  while (std::chrono::steady_clock::now() < deadline) {
+    if (getSourceInteger(source, AL_BUFFERS_PROCESSED) == 0 &&
+      getSourceInteger(source, AL_BUFFERS_QUEUED) == static_cast<ALint>(AudioStream::BUFFERS_COUNT)) {
+      return true;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  return false;
+}
+
+}
+
+TEST_CASE("audio_stream_buffers_refill", "[audio]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateAudioTestResourcesManager();
+
+  auto gameWorld = GameWorld::createInstance();
+  auto audioSystem = createLoopbackAudioSystem(*gameWorld, 4);
+
+  ResourceHandle<AudioClip> clip = createSilentStreamedClip(*resourcesManager, "swengine_audio_stream.ogg", 2.0f);
+  size_t clipFramesCount = getClipFramesCount(*clip);
+
+  REQUIRE(clipFramesCount > STREAM_RING_FRAMES_COUNT * 2);
+
+  ALuint source = 0;
+  alGenSources(1, &source);
+
+  {
+    AudioStream stream(*clip, source);
+
+    SECTION("finite_stream") {
+      stream.start();
+
+      REQUIRE(getSourceInteger(source, AL_BUFFERS_QUEUED) == static_cast<ALint>(AudioStream::BUFFERS_COUNT));
+
+      alSourcePlay(source);
+
+      size_t renderedFramesCount = 0;
+
+      // The decoder is not ended yet, so every processed buffer is refilled
+      while (renderedFramesCount + RENDERED_CHUNK_FRAMES_COUNT + STREAM_RING_FRAMES_COUNT <= clipFramesCount) {
+        audioSystem->renderLoopbackFrames(RENDERED_CHUNK_FRAMES_COUNT);
+        renderedFramesCount += RENDERED_CHUNK_FRAMES_COUNT;
+
+        stream.update();
+
+        REQUIRE(getSourceInteger(source, AL_SOURCE_STATE) == AL_PLAYING);
+        REQUIRE(getSourceInteger(source, AL_BUFFERS_PROCESSED) == 0);
+        REQUIRE(getSourceInteger(source, AL_BUFFERS_QUEUED) == static_cast<ALint>(AudioStream::BUFFERS_COUNT));
+      }
+
+      // The source is not starved before the end of the stream
+      while (renderedFramesCount + RENDERED_CHUNK_FRAMES_COUNT < clipFramesCount) {
+        audioSystem->renderLoopbackFrames(RENDERED_CHUNK_FRAMES_COUNT);
+        renderedFramesCount += RENDERED_CHUNK_FRAMES_COUNT;
+
+        stream.update();
+
+        REQUIRE(getSourceInteger(source, AL_SOURCE_STATE) == AL_PLAYING);
+      }
+
+      // The ended stream is not restarted
+      for (size_t chunkIndex = 0; chunkIndex < 4; chunkIndex++) {
+        audioSystem->renderLoopbackFrames(RENDERED_CHUNK_FRAMES_COUNT);
+        stream.update();
+      }
+
+      REQUIRE(getSourceInteger(source, AL_SOURCE_STATE) == AL_STOPPED);
+      REQUIRE(getSourceInteger(source, AL_BUFFERS_PROCESSED) == getSourceInteger(source, AL_BUFFERS_QUEUED));
+    }
+
+    SECTION("looped_stream") {
+      stream.setLooped(true);
+      stream.start();
+
+      alSourcePlay(source);
+
+      size_t renderedFramesCount = 0;
+
+      while (renderedFramesCount < clipFramesCount * 2 + STREAM_RING_FRAMES_COUNT) {
+        audioSystem->renderLoopbackFrames(RENDERED_CHUNK_FRAMES_COUNT);
+        renderedFramesCount += RENDERED_CHUNK_FRAMES_COUNT;
+
+        stream.update();
+
+        REQUIRE(getSourceInteger(source, AL_SOURCE_STATE) == AL_PLAYING);
+        REQUIRE(getSourceInteger(source, AL_BUFFERS_QUEUED) == static_cast<ALint>(AudioStream::BUFFERS_COUNT));
+      }
+    }
+  }
+
+  alDeleteSources(1, &source);
+}
+
+TEST_CASE("audio_streamer_background_refill", "[audio]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateAudioTestResourcesManager();
+
+  auto gameWorld = GameWorld::createInstance();
+  auto audioSystem = createLoopbackAudioSystem(*gameWorld, 4);
+
+  ResourceHandle<AudioClip> clip = createSilentStreamedClip(*resourcesManager, "swengine_audio_streamer.ogg", 2.0f);
+  size_t clipFramesCount = getClipFramesCount(*clip);
+
+  ALuint source = 0;
+  alGenSources(1, &source);
+
+  {
+    AudioStream stream(*clip, source);
+    stream.start();
+
+    alSourcePlay(source);
+    AudioStreamer::addStream(&stream);
+
+    size_t renderedFramesCount = 0;
+
+    while (renderedFramesCount + RENDERED_CHUNK_FRAMES_COUNT + STREAM_RING_FRAMES_COUNT <= clipFramesCount) {
+      audioSystem->renderLoopbackFrames(RENDERED_CHUNK_FRAMES_COUNT);
+      renderedFramesCount += RENDERED_CHUNK_FRAMES_COUNT;
+
+      REQUIRE(waitForStreamRefill(source));
+      REQUIRE(getSourceInteger(source, AL_SOURCE_STATE) == AL_PLAYING);
+    }
+
+    // The last buffers are not refilled, so the streaming thread is given a few intervals instead of the refill wait
+    while (renderedFramesCount + RENDERED_CHUNK_FRAMES_COUNT < clipFramesCount) {
+      audioSystem->renderLoopbackFrames(RENDERED_CHUNK_FRAMES_COUNT);
+      renderedFramesCount += RENDERED_CHUNK_FRAMES_COUNT;
+
+      REQUIRE(getSourceInteger(source, AL_SOURCE_STATE) == AL_PLAYING);
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    }
+
+    AudioStreamer::removeStream(&stream);
+  }
+
+  alDeleteSources(1, &source);
+}
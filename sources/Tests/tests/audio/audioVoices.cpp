@@ -0,0 +1,131 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/Math/MathUtils.h>
+
+#include "utility/audioUtility.h"
+
+namespace {
+
+constexpr float UPDATE_DELTA = 0.1f;
+
+void setEmitterPosition(GameObject& emitter, const glm::vec3& position)
+{
+  emitter.getComponent<TransformComponent>()->getTransform().setPosition(position);
+}
+
+}
+
+TEST_CASE("audio_voices_priority_and_audibility", "[audio]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateAudioTestResourcesManager();
+
+  auto gameWorld = GameWorld::createInstance();
+  auto audioSystem = createLoopbackAudioSystem(*gameWorld, 3);
+  audioSystem->getListener().setPosition({0.0f, 0.0f, 0.0f});
+
+  ResourceHandle<AudioClip> clip = createSilentStreamedClip(*resourcesManager, "swengine_audio_priority.ogg", 5.0f);
+
+  std::vector<GameObject> emitters;
+
+  for (float distance : {40.0f, 3.0f, 20.0f, 2.0f, 10.0f}) {
+    emitters.push_back(createPlayingAudioEmitter(*gameWorld, clip, {distance, 0.0f, 0.0f}));
+  }
+
+  // The farthest source is important, so it gets the voice before the more audible ones
+  getEmitterSource(emitters[0]).setPriority(1);
+
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE_FALSE(getEmitterSource(emitters[0]).isVirtual());
+  REQUIRE_FALSE(getEmitterSource(emitters[1]).isVirtual());
+  REQUIRE(getEmitterSource(emitters[2]).isVirtual());
+  REQUIRE_FALSE(getEmitterSource(emitters[3]).isVirtual());
+  REQUIRE(getEmitterSource(emitters[4]).isVirtual());
+
+  const AudioVoicesStatistics& statistics = audioSystem->getVoicesStatistics();
+
+  REQUIRE(statistics.activeVoicesCount == 3);
+  REQUIRE(statistics.virtualVoicesCount == 2);
+  REQUIRE(statistics.stolenVoicesCount == 0);
+
+  // Sources out of the max distance are inaudible and do not take the voices even if the voices are free
+  for (GameObject& emitter : emitters) {
+    getEmitterSource(emitter).setMaxDistance(5.0f);
+  }
+
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE(getEmitterSource(emitters[0]).isVirtual());
+  REQUIRE_FALSE(getEmitterSource(emitters[1]).isVirtual());
+  REQUIRE_FALSE(getEmitterSource(emitters[3]).isVirtual());
+
+  REQUIRE(statistics.activeVoicesCount == 2);
+  REQUIRE(statistics.virtualVoicesCount == 3);
+  REQUIRE(statistics.stolenVoicesCount == 0);
+}
+
+TEST_CASE("audio_voices_stealing", "[audio]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateAudioTestResourcesManager();
+
+  auto gameWorld = GameWorld::createInstance();
+  auto audioSystem = createLoopbackAudioSystem(*gameWorld, 2);
+  audioSystem->getListener().setPosition({0.0f, 0.0f, 0.0f});
+
+  ResourceHandle<AudioClip> clip = createSilentStreamedClip(*resourcesManager, "swengine_audio_stealing.ogg", 5.0f);
+
+  GameObject importantEmitter = createPlayingAudioEmitter(*gameWorld, clip, {50.0f, 0.0f, 0.0f});
+  GameObject nearEmitter = createPlayingAudioEmitter(*gameWorld, clip, {2.0f, 0.0f, 0.0f});
+  GameObject farEmitter = createPlayingAudioEmitter(*gameWorld, clip, {10.0f, 0.0f, 0.0f});
+
+  getEmitterSource(importantEmitter).setPriority(1);
+
+  AudioSource& nearSource = getEmitterSource(nearEmitter);
+  AudioSource& farSource = getEmitterSource(farEmitter);
+
+  const AudioVoicesStatistics& statistics = audioSystem->getVoicesStatistics();
+
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE_FALSE(nearSource.isVirtual());
+  REQUIRE(farSource.isVirtual());
+
+  // The source that becomes more audible steals the voice of the less audible one
+  setEmitterPosition(farEmitter, {1.0f, 0.0f, 0.0f});
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE_FALSE(getEmitterSource(importantEmitter).isVirtual());
+  REQUIRE_FALSE(farSource.isVirtual());
+  REQUIRE(nearSource.isVirtual());
+
+  REQUIRE(statistics.stolenVoicesCount == 1);
+  REQUIRE(statistics.activeVoicesCount == 2);
+  REQUIRE(statistics.virtualVoicesCount == 1);
+
+  // The virtual source keeps playing without the voice
+  for (size_t updateIndex = 0; updateIndex < 3; updateIndex++) {
+    updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+    REQUIRE(nearSource.isVirtual());
+    REQUIRE(statistics.stolenVoicesCount == 0);
+  }
+
+  REQUIRE(MathUtils::isEqual(nearSource.getPlaybackTime(), UPDATE_DELTA * 5.0f, 1e-3f));
+
+  // The source gets the voice back and continues from the tracked playback time instead of the restart
+  setEmitterPosition(farEmitter, {10.0f, 0.0f, 0.0f});
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE_FALSE(nearSource.isVirtual());
+  REQUIRE(farSource.isVirtual());
+  REQUIRE(statistics.stolenVoicesCount == 1);
+
+  REQUIRE(MathUtils::isEqual(nearSource.getPlaybackTime(), UPDATE_DELTA * 6.0f, 1e-3f));
+  REQUIRE(MathUtils::isEqual(farSource.getPlaybackTime(), UPDATE_DELTA * 6.0f, 1e-3f));
+
+  updateLoopbackAudio(*gameWorld, *audioSystem, UPDATE_DELTA);
+
+  REQUIRE(nearSource.isPlaying());
+  REQUIRE_FALSE(nearSource.isVirtual());
+  REQUIRE(MathUtils::isEqual(nearSource.getPlaybackTime(), UPDATE_DELTA * 7.0f, 1e-3f));
+}
@@ -46,3 +46,61 @@ TEST_CASE("game_world_saving_loading", "[game]")
   REQUIRE(MathUtils::isEqual(loadedEnemyObject.getComponent<TransformComponent>()->getTransform().getPosition(),
     glm::vec3(-10, -20, -30)));
 }
+
+TEST_CASE("game_world_binary_delta_snapshots", "[game]")
+{
+  auto gameWorld = GameWorld::createInstance();
+
+  gameWorld->registerComponentBinderFactory<TransformComponent>(
+    std::make_shared<GameObjectsComponentsGenericBindersFactory<TransformComponent, TransformComponentBinder>>());
+
+  GameObject playerObject = gameWorld->createGameObject("player");
+  playerObject.markAsSerializable(true);
+  playerObject.addComponent<TransformComponent>()->getTransform().setPosition(10, 20, 30);
+
+  GameObject enemyObject = gameWorld->createGameObject("enemy");
+  enemyObject.markAsSerializable(true);
+  enemyObject.addComponent<TransformComponent>()->getTransform().setPosition(-10, -20, -30);
+
+  GameWorldSnapshot baseline = gameWorld->createSnapshot();
+  REQUIRE(baseline.getGameObjects().size() == 2);
+
+  playerObject.getComponent<TransformComponent>()->getTransform().setPosition(1, 2, 3);
+
+  GameWorldSnapshot delta = gameWorld->createSnapshot().createDelta(baseline);
+  REQUIRE(delta.isDelta());
+  REQUIRE(delta.getDataSize() < baseline.getDataSize());
+
+  std::stringstream saveStream;
+
+  {
+    cereal::BinaryOutputArchive saveArchive(saveStream);
+    saveArchive(delta);
+  }
+
+  GameWorldSnapshot loadedSnapshot;
+
+  {
+    cereal::BinaryInputArchive loadArchive(saveStream);
+    loadArchive(loadedSnapshot);
+  }
+
+  loadedSnapshot.applyBaseline(baseline);
+  REQUIRE_FALSE(loadedSnapshot.isDelta());
+
+  for (GameObject gameObject : gameWorld->all()) {
+    gameWorld->removeGameObject(gameObject);
+  }
+
+  gameWorld->restoreSnapshot(loadedSnapshot);
+
+  GameObject loadedPlayerObject = gameWorld->findGameObject("player");
+  REQUIRE(loadedPlayerObject.isAlive());
+  REQUIRE(MathUtils::isEqual(loadedPlayerObject.getComponent<TransformComponent>()->getTransform().getPosition(),
+    glm::vec3(1, 2, 3)));
+
+  GameObject loadedEnemyObject = gameWorld->findGameObject("enemy");
+  REQUIRE(loadedEnemyObject.isAlive());
+  REQUIRE(MathUtils::isEqual(loadedEnemyObject.getComponent<TransformComponent>()->getTransform().getPosition(),
+    glm::vec3(-10, -20, -30)));
+}
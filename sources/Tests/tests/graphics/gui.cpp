@@ -0,0 +1,154 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+
+#include <Engine/Modules/Graphics/GUI/GUIDrawList.h>
+#include <Engine/Modules/Graphics/GUI/GUIHitTestingIndex.h>
+#include <Engine/Modules/Graphics/GUI/GUILayout.h>
+
+TEST_CASE("gui_draw_list_batching", "[graphics][gui]")
+{
+  GUIDrawState backgroundState{.color = {0.0f, 0.0f, 0.0f, 1.0f}, .scissorsRect = RectI(0, 0, 100, 100)};
+  GUIDrawState textState{.color = {1.0f, 1.0f, 1.0f, 1.0f}, .scissorsRect = RectI(0, 0, 100, 100)};
+  GUIDrawState clippedTextState{.color = {1.0f, 1.0f, 1.0f, 1.0f}, .scissorsRect = RectI(10, 10, 50, 50)};
+
+  GUIDrawList drawList;
+  drawList.addQuad(backgroundState, {0.0f, 0.0f}, {100.0f, 100.0f}, {0.0f, 0.0f}, {1.0f, 1.0f});
+  drawList.addQuad(textState, {10.0f, 10.0f}, {20.0f, 20.0f}, {0.0f, 0.0f}, {0.5f, 0.5f});
+  drawList.addQuad(textState, {20.0f, 10.0f}, {30.0f, 20.0f}, {0.5f, 0.0f}, {1.0f, 0.5f});
+
+  SECTION("sequential quads with the same state are merged") {
+    REQUIRE(drawList.getQuadsCount() == 3);
+    REQUIRE(drawList.getPositions().size() == 3 * GUIDrawList::QUAD_VERTICES_COUNT);
+    REQUIRE(drawList.getUV().size() == 3 * GUIDrawList::QUAD_VERTICES_COUNT);
+
+    const auto& commands = drawList.getCommands();
+
+    REQUIRE(commands.size() == 2);
+    REQUIRE(commands[0].firstQuadIndex == 0);
+    REQUIRE(commands[0].quadsCount == 1);
+    REQUIRE(commands[1].firstQuadIndex == 1);
+    REQUIRE(commands[1].quadsCount == 2);
+
+    REQUIRE(drawList.getPositions()[4] == glm::vec3(10.0f, 10.0f, 0.0f));
+    REQUIRE(drawList.getPositions()[6] == glm::vec3(20.0f, 20.0f, 0.0f));
+  }
+
+  SECTION("appended list is merged with the last command") {
+    GUIDrawList widgetDrawList;
+    widgetDrawList.addQuad(textState, {30.0f, 10.0f}, {40.0f, 20.0f}, {0.0f, 0.0f}, {0.5f, 0.5f});
+    widgetDrawList.addQuad(clippedTextState, {10.0f, 30.0f}, {20.0f, 40.0f}, {0.0f, 0.0f}, {0.5f, 0.5f});
+
+    drawList.append(widgetDrawList);
+
+    const auto& commands = drawList.getCommands();
+
+    REQUIRE(drawList.getQuadsCount() == 5);
+    REQUIRE(commands.size() == 3);
+    REQUIRE(commands[1].quadsCount == 3);
+    REQUIRE(commands[2].firstQuadIndex == 4);
+    REQUIRE(commands[2].quadsCount == 1);
+  }
+
+  SECTION("glyphs runs are written as moved quads") {
+    std::array<GUIGlyphQuad, 2> glyphs{
+      GUIGlyphQuad{.topLeft = {0.0f, 0.0f}, .bottomRight = {10.0f, 10.0f},
+        .uvTopLeft = {0.0f, 0.0f}, .uvBottomRight = {0.5f, 0.5f}},
+      GUIGlyphQuad{.topLeft = {10.0f, 0.0f}, .bottomRight = {20.0f, 10.0f},
+        .uvTopLeft = {0.5f, 0.0f}, .uvBottomRight = {1.0f, 0.5f}},
+    };
+
+    drawList.addGlyphQuads(textState, glyphs, {30.0f, 10.0f});
+
+    REQUIRE(drawList.getQuadsCount() == 5);
+    REQUIRE(drawList.getCommands().size() == 2);
+    REQUIRE(drawList.getCommands()[1].quadsCount == 4);
+
+    REQUIRE(drawList.getPositions()[12] == glm::vec3(30.0f, 10.0f, 0.0f));
+    REQUIRE(drawList.getPositions()[14] == glm::vec3(40.0f, 20.0f, 0.0f));
+    REQUIRE(drawList.getPositions()[17] == glm::vec3(50.0f, 10.0f, 0.0f));
+    REQUIRE(drawList.getUV()[18] == glm::vec2(1.0f, 0.5f));
+  }
+
+  SECTION("the order of states is preserved") {
+    drawList.addQuad(backgroundState, {0.0f, 50.0f}, {100.0f, 100.0f}, {0.0f, 0.0f}, {1.0f, 1.0f});
+
+    REQUIRE(drawList.getCommands().size() == 3);
+    REQUIRE(drawList.getCommands()[2].state.isBatchableWith(backgroundState));
+  }
+
+  drawList.clear();
+
+  REQUIRE(drawList.isEmpty());
+  REQUIRE(drawList.getQuadsCount() == 0);
+}
+
+TEST_CASE("gui_hit_testing_index", "[graphics][gui]")
+{
+  auto rootLayout = std::make_shared<GUILayout>();
+  rootLayout->setSize({1000, 800});
+
+  auto panel = std::make_shared<GUILayout>();
+  panel->setOrigin({100, 100});
+  panel->setSize({300, 200});
+  rootLayout->addChildWidget(panel);
+
+  auto button = std::make_shared<GUILayout>();
+  button->setOrigin({10, 10});
+  button->setSize({50, 20});
+  panel->addChildWidget(button);
+
+  auto overlay = std::make_shared<GUILayout>();
+  overlay->setOrigin({700, 500});
+  overlay->setSize({100, 100});
+  rootLayout->addChildWidget(overlay);
+
+  REQUIRE(button->getAbsoluteOrigin() == glm::ivec2(110, 110));
+
+  GUIHitTestingIndex hitTestingIndex;
+  hitTestingIndex.build(*rootLayout);
+
+  REQUIRE(hitTestingIndex.getEntries().size() == 4);
+
+  auto queryWidgets = [&hitTestingIndex](const glm::ivec2& point) {
+    std::vector<size_t> entries;
+    hitTestingIndex.queryEntriesAtPoint(point, entries);
+
+    std::vector<GUIWidget*> widgets;
+
+    for (size_t entryIndex : entries) {
+      widgets.push_back(hitTestingIndex.getEntries()[entryIndex].widget);
+    }
+
+    return widgets;
+  };
+
+  SECTION("widgets are found in the drawing order") {
+    REQUIRE(queryWidgets({120, 120}) == std::vector<GUIWidget*>{rootLayout.get(), panel.get(), button.get()});
+    REQUIRE(queryWidgets({750, 550}) == std::vector<GUIWidget*>{rootLayout.get(), overlay.get()});
+    REQUIRE(queryWidgets({5, 5}) == std::vector<GUIWidget*>{rootLayout.get()});
+    REQUIRE(queryWidgets({1500, 5}).empty());
+    REQUIRE(queryWidgets({-5, 5}).empty());
+  }
+
+  SECTION("only the innermost hit widgets are exclusive") {
+    std::vector<size_t> entries;
+    hitTestingIndex.queryEntriesAtPoint({120, 120}, entries);
+
+    REQUIRE_FALSE(hitTestingIndex.isEntryExclusive(entries[0], entries));
+    REQUIRE_FALSE(hitTestingIndex.isEntryExclusive(entries[1], entries));
+    REQUIRE(hitTestingIndex.isEntryExclusive(entries[2], entries));
+  }
+
+  SECTION("the index reflects the rebuilt layout") {
+    panel->setOrigin({200, 100});
+    REQUIRE(button->getAbsoluteOrigin() == glm::ivec2(210, 110));
+
+    overlay->hide();
+    hitTestingIndex.build(*rootLayout);
+
+    REQUIRE(hitTestingIndex.getEntries().size() == 3);
+    REQUIRE(queryWidgets({215, 115}) == std::vector<GUIWidget*>{rootLayout.get(), panel.get(), button.get()});
+    REQUIRE(queryWidgets({750, 550}) == std::vector<GUIWidget*>{rootLayout.get()});
+  }
+}
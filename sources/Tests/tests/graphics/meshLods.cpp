@@ -0,0 +1,86 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/Graphics/GraphicsSystem/MeshLodSelector.h>
+
+namespace {
+
+std::shared_ptr<Mesh> createLodsMesh()
+{
+  auto mesh = std::make_shared<Mesh>();
+
+  mesh->setVertices({{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f}});
+
+  // Two triangles of the full detail LOD and a single triangle of the coarse ones
+  mesh->addSubMesh({0, 2, 1, 1, 2, 3, 0, 2, 1, 0, 2, 1});
+
+  mesh->setLods({
+    MeshLodDescription{.minScreenSize = 0.5f, .subMeshesRanges = {{.indicesOffset = 0, .indicesCount = 6}}},
+    MeshLodDescription{.minScreenSize = 0.2f, .subMeshesRanges = {{.indicesOffset = 6, .indicesCount = 3}}},
+    MeshLodDescription{.minScreenSize = 0.0f, .subMeshesRanges = {{.indicesOffset = 9, .indicesCount = 3}}},
+  });
+
+  return mesh;
+}
+
+}
+
+TEST_CASE("mesh_lods_ranges", "[graphics]")
+{
+  std::shared_ptr<Mesh> mesh = createLodsMesh();
+
+  REQUIRE(mesh->getLodsCount() == 3);
+
+  REQUIRE(mesh->getSubMeshIndicesOffset(0, 0) == 0);
+  REQUIRE(mesh->getSubMeshIndicesCount(0, 0) == 6);
+
+  REQUIRE(mesh->getSubMeshIndicesOffset(0, 1) == 6);
+  REQUIRE(mesh->getSubMeshIndicesCount(0, 1) == 3);
+
+  REQUIRE(mesh->getLodMinScreenSize(2) == 0.0f);
+
+  REQUIRE_THROWS(mesh->setLods({
+    MeshLodDescription{.minScreenSize = 0.0f, .subMeshesRanges = {{.indicesOffset = 9, .indicesCount = 6}}},
+  }));
+}
+
+TEST_CASE("mesh_lods_projected_size", "[graphics]")
+{
+  Sphere sphere({0.0f, 0.0f, -10.0f}, 1.0f);
+
+  float fovY = glm::radians(90.0f);
+
+  REQUIRE(MeshLodSelector::getProjectedScreenSize(sphere, {0.0f, 0.0f, 0.0f}, fovY) == Approx(0.1f));
+  REQUIRE(MeshLodSelector::getProjectedScreenSize(sphere, {0.0f, 0.0f, 10.0f}, fovY) == Approx(0.05f));
+
+  // The camera inside the sphere
+  REQUIRE(MeshLodSelector::getProjectedScreenSize(sphere, {0.0f, 0.0f, -10.5f}, fovY) >= 1.0f);
+}
+
+TEST_CASE("mesh_lods_selection", "[graphics]")
+{
+  std::shared_ptr<Mesh> mesh = createLodsMesh();
+
+  const float hysteresis = 0.1f;
+
+  REQUIRE(MeshLodSelector::selectLod(*mesh, 1.0f, 0, hysteresis) == 0);
+  REQUIRE(MeshLodSelector::selectLod(*mesh, 0.3f, 0, hysteresis) == 1);
+  REQUIRE(MeshLodSelector::selectLod(*mesh, 0.01f, 0, hysteresis) == 2);
+  REQUIRE(MeshLodSelector::selectLod(*mesh, 1.0f, 2, hysteresis) == 0);
+
+  SECTION("the LOD is kept near the threshold") {
+    REQUIRE(MeshLodSelector::selectLod(*mesh, 0.48f, 0, hysteresis) == 0);
+    REQUIRE(MeshLodSelector::selectLod(*mesh, 0.44f, 0, hysteresis) == 1);
+
+    REQUIRE(MeshLodSelector::selectLod(*mesh, 0.52f, 1, hysteresis) == 1);
+    REQUIRE(MeshLodSelector::selectLod(*mesh, 0.56f, 1, hysteresis) == 0);
+  }
+
+  SECTION("the mesh without LODs has the single LOD") {
+    auto singleLodMesh = std::make_shared<Mesh>();
+    singleLodMesh->setVertices({{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}});
+    singleLodMesh->addSubMesh({0, 2, 1});
+
+    REQUIRE(singleLodMesh->getLodsCount() == 1);
+    REQUIRE(MeshLodSelector::selectLod(*singleLodMesh, 0.01f, 0, hysteresis) == 0);
+  }
+}
@@ -0,0 +1,129 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <Engine/Modules/Graphics/GraphicsSystem/Culling/OcclusionCuller.h>
+
+namespace {
+
+const std::vector<glm::vec3> WALL_VERTICES = {{-4.0f, -3.0f, 0.0f}, {4.0f, -3.0f, 0.0f},
+  {-4.0f, 3.0f, 0.0f}, {4.0f, 3.0f, 0.0f}};
+
+const std::vector<uint32_t> WALL_INDICES = {0, 1, 2, 2, 1, 3};
+
+glm::mat4 getViewProjection()
+{
+  glm::mat4 projection = glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 100.0f);
+  glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+  return projection * view;
+}
+
+void rasterizeWall(OcclusionCuller& occlusionCuller)
+{
+  occlusionCuller.beginFrame(getViewProjection());
+  occlusionCuller.addOccluder(WALL_VERTICES, WALL_INDICES,
+    glm::translate(glm::identity<glm::mat4>(), {0.0f, 0.0f, -5.0f}));
+  occlusionCuller.rasterizeOccluders();
+}
+
+}
+
+TEST_CASE("occlusion_culling_objects_behind_occluder", "[graphics]")
+{
+  OcclusionCuller occlusionCuller(OcclusionCullingOptions{.depthBufferWidth = 256, .depthBufferHeight = 128});
+
+  SECTION("objects are visible without occluders") {
+    occlusionCuller.beginFrame(getViewProjection());
+    occlusionCuller.rasterizeOccluders();
+
+    REQUIRE(occlusionCuller.isAABBVisible(AABB({-1.0f, -1.0f, -12.0f}, {1.0f, 1.0f, -10.0f})));
+  }
+
+  rasterizeWall(occlusionCuller);
+
+  REQUIRE(occlusionCuller.getOccludersTrianglesCount() == 2);
+  REQUIRE(occlusionCuller.getHierarchicalDepthLevelsCount() == 9);
+
+  glm::vec4 wallCenter = getViewProjection() * glm::vec4(0.0f, 0.0f, -5.0f, 1.0f);
+  REQUIRE(occlusionCuller.getDepth(128, 64) == Approx(wallCenter.z / wallCenter.w * 0.5f + 0.5f));
+  REQUIRE(occlusionCuller.getDepth(0, 0) == 1.0f);
+
+  // Behind the wall
+  REQUIRE_FALSE(occlusionCuller.isAABBVisible(AABB({-1.0f, -1.0f, -12.0f}, {1.0f, 1.0f, -10.0f})));
+
+  // In front of the wall
+  REQUIRE(occlusionCuller.isAABBVisible(AABB({-1.0f, -1.0f, -4.0f}, {1.0f, 1.0f, -3.0f})));
+
+  // Beside the wall
+  REQUIRE(occlusionCuller.isAABBVisible(AABB({10.0f, -1.0f, -12.0f}, {11.0f, 1.0f, -10.0f})));
+
+  // Behind the wall, but larger than it
+  REQUIRE(occlusionCuller.isAABBVisible(AABB({-12.0f, -1.0f, -12.0f}, {12.0f, 1.0f, -10.0f})));
+
+  // Crossing the near plane
+  REQUIRE(occlusionCuller.isAABBVisible(AABB({-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f})));
+}
+
+TEST_CASE("occlusion_culling_near_plane_clipping", "[graphics]")
+{
+  OcclusionCuller occlusionCuller;
+
+  // The floor goes behind the camera, so its triangles are clipped by the near plane
+  const std::vector<glm::vec3> floorVertices = {{-10.0f, -1.0f, 10.0f}, {10.0f, -1.0f, 10.0f},
+    {-10.0f, -1.0f, -50.0f}, {10.0f, -1.0f, -50.0f}};
+
+  occlusionCuller.beginFrame(getViewProjection());
+  occlusionCuller.addOccluder(floorVertices, WALL_INDICES, glm::identity<glm::mat4>());
+  occlusionCuller.rasterizeOccluders();
+
+  REQUIRE(occlusionCuller.getOccludersTrianglesCount() >= 2);
+
+  // Under the floor
+  REQUIRE_FALSE(occlusionCuller.isAABBVisible(AABB({-1.0f, -4.0f, -12.0f}, {1.0f, -3.0f, -10.0f})));
+
+  // Above the floor
+  REQUIRE(occlusionCuller.isAABBVisible(AABB({-1.0f, 0.0f, -12.0f}, {1.0f, 1.0f, -10.0f})));
+}
+
+TEST_CASE("occlusion_culling_parallel_rasterization", "[graphics]")
+{
+  OcclusionCuller serialOcclusionCuller(OcclusionCullingOptions{
+    .depthBufferWidth = 97,
+    .depthBufferHeight = 61,
+    .workersCount = 0,
+  });
+
+  OcclusionCuller parallelOcclusionCuller(OcclusionCullingOptions{
+    .depthBufferWidth = 97,
+    .depthBufferHeight = 61,
+    .workersCount = 3,
+    .minParallelTrianglesCount = 0,
+  });
+
+  auto requireEqualDepth = [&serialOcclusionCuller, &parallelOcclusionCuller]() {
+    for (size_t y = 0; y < 61; y++) {
+      for (size_t x = 0; x < 97; x++) {
+        REQUIRE(serialOcclusionCuller.getDepth(x, y) == parallelOcclusionCuller.getDepth(x, y));
+      }
+    }
+  };
+
+  rasterizeWall(serialOcclusionCuller);
+
+  // The workers are kept between the frames
+  for (size_t frameIndex = 0; frameIndex < 3; frameIndex++) {
+    rasterizeWall(parallelOcclusionCuller);
+    requireEqualDepth();
+  }
+
+  // The workers are restarted when their count is changed
+  OcclusionCullingOptions options = parallelOcclusionCuller.getOptions();
+  options.workersCount = 5;
+  parallelOcclusionCuller.setOptions(options);
+
+  rasterizeWall(parallelOcclusionCuller);
+  requireEqualDepth();
+}
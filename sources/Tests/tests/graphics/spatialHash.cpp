@@ -0,0 +1,198 @@
+#include <catch2/catch.hpp>
+
+#include <random>
+
+#include <Engine/Modules/ECS/ECS.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/Culling/SpatialHashGrid.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/Culling/LinearSceneStructure.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
+
+namespace {
+
+std::vector<GameObjectId> getSortedIds(const std::vector<GameObject>& objects)
+{
+  std::vector<GameObjectId> ids;
+
+  for (const GameObject& object : objects) {
+    ids.push_back(object.getId());
+  }
+
+  std::sort(ids.begin(), ids.end());
+
+  return ids;
+}
+
+}
+
+TEST_CASE("spatial_hash_grid_queries", "[graphics]")
+{
+  auto gameWorld = GameWorld::createInstance();
+
+  SpatialHashGrid grid(2.0f);
+
+  std::mt19937 randomGenerator(42);
+  std::uniform_real_distribution<float> coordinateDistribution(-20.0f, 20.0f);
+
+  std::vector<std::pair<GameObject, glm::vec3>> objects;
+
+  for (size_t objectIndex = 0; objectIndex < 500; objectIndex++) {
+    GameObject object = gameWorld->createGameObject();
+    glm::vec3 position(coordinateDistribution(randomGenerator),
+      coordinateDistribution(randomGenerator),
+      coordinateDistribution(randomGenerator));
+
+    grid.insertObject(object, position);
+    objects.emplace_back(object, position);
+  }
+
+  REQUIRE(grid.getObjectsCount() == objects.size());
+
+  auto queryBruteForce = [&objects](const glm::vec3& origin, float radius) {
+    std::vector<GameObject> result;
+
+    for (auto&[object, position] : objects) {
+      if (glm::length2(position - origin) <= radius * radius) {
+        result.push_back(object);
+      }
+    }
+
+    return result;
+  };
+
+  glm::vec3 origin(1.0f, -3.0f, 5.0f);
+
+  SECTION("radius_query") {
+    std::vector<GameObject> result;
+    grid.queryObjectsInRadius(origin, 7.5f, result);
+
+    REQUIRE(getSortedIds(result) == getSortedIds(queryBruteForce(origin, 7.5f)));
+  }
+
+  SECTION("nearest_query") {
+    std::vector<GameObject> expected = queryBruteForce(origin, 10.0f);
+    std::sort(expected.begin(), expected.end(), [&objects, &origin](GameObject lhs, GameObject rhs) {
+      auto getDistance = [&objects, &origin](GameObject object) {
+        auto it = std::find_if(objects.begin(), objects.end(), [object](const auto& entry) {
+          return entry.first == object;
+        });
+
+        return glm::length2(it->second - origin);
+      };
+
+      return getDistance(lhs) < getDistance(rhs);
+    });
+
+    expected.resize(std::min(expected.size(), size_t(5)));
+
+    std::vector<GameObject> result;
+    grid.queryNearestObjects(origin, 10.0f, 5, result);
+
+    REQUIRE(result.size() == expected.size());
+
+    for (size_t resultIndex = 0; resultIndex < result.size(); resultIndex++) {
+      REQUIRE(result[resultIndex] == expected[resultIndex]);
+    }
+  }
+
+  SECTION("batch_query") {
+    std::vector<glm::vec3> origins = {origin, {0.0f, 0.0f, 0.0f}, {15.0f, 15.0f, 15.0f}, {0.5f, 0.5f, 0.5f}};
+
+    std::vector<GameObject> result;
+    std::vector<size_t> resultOffsets;
+    grid.queryObjectsInRadius(origins, 4.0f, result, resultOffsets);
+
+    REQUIRE(resultOffsets.size() == origins.size() + 1);
+
+    for (size_t originIndex = 0; originIndex < origins.size(); originIndex++) {
+      std::vector<GameObject> originResult(result.begin() + resultOffsets[originIndex],
+        result.begin() + resultOffsets[originIndex + 1]);
+
+      REQUIRE(getSortedIds(originResult) == getSortedIds(queryBruteForce(origins[originIndex], 4.0f)));
+    }
+  }
+
+  SECTION("incremental_updates") {
+    for (size_t objectIndex = 0; objectIndex < objects.size(); objectIndex += 2) {
+      auto&[object, position] = objects[objectIndex];
+      position += glm::vec3(3.0f, -1.0f, 0.5f);
+
+      grid.updateObject(object, position);
+    }
+
+    for (size_t objectIndex = 1; objectIndex < objects.size(); objectIndex += 3) {
+      grid.removeObject(objects[objectIndex].first);
+    }
+
+    std::erase_if(objects, [&grid](const auto& entry) {
+      return !grid.hasObject(entry.first);
+    });
+
+    REQUIRE(grid.getObjectsCount() == objects.size());
+
+    std::vector<GameObject> result;
+    grid.queryObjectsInRadius(origin, 12.0f, result);
+
+    REQUIRE(getSortedIds(result) == getSortedIds(queryBruteForce(origin, 12.0f)));
+  }
+}
+
+TEST_CASE("scene_structure_moved_objects_update", "[graphics]")
+{
+  auto gameWorld = GameWorld::createInstance();
+
+  LinearSceneStructure sceneStructure;
+
+  auto createObject = [&gameWorld, &sceneStructure](const glm::vec3& position) {
+    GameObject object = gameWorld->createGameObject();
+    object.addComponent<TransformComponent>()->getTransform().setPosition(position);
+
+    sceneStructure.addObject(object);
+
+    return object;
+  };
+
+  GameObject boundsUpdatedObject = createObject({0.0f, 0.0f, 0.0f});
+  GameObject movedObject = createObject({1.0f, 0.0f, 0.0f});
+
+  auto queryObjects = [&sceneStructure](const glm::vec3& origin) {
+    std::vector<GameObject> result;
+    sceneStructure.queryNearestDynamicNeighbors(origin, 2.0f, result);
+
+    return getSortedIds(result);
+  };
+
+  glm::vec3 newPosition(20.0f, 0.0f, 0.0f);
+
+  auto& updatedTransformComponent = *boundsUpdatedObject.getComponent<TransformComponent>().get();
+  updatedTransformComponent.getTransform().setPosition(newPosition);
+  updatedTransformComponent.updateBounds(updatedTransformComponent.getTransform().getTransformationMatrix());
+
+  sceneStructure.update();
+
+  REQUIRE(queryObjects(newPosition) == std::vector<GameObjectId>{boundsUpdatedObject.getId()});
+  REQUIRE(queryObjects({0.0f, 0.0f, 0.0f}) == std::vector<GameObjectId>{movedObject.getId()});
+
+  // Objects moved by the transform only are relocated as well
+  movedObject.getComponent<TransformComponent>()->getTransform().setPosition(newPosition);
+
+  sceneStructure.update();
+
+  REQUIRE(queryObjects(newPosition) == getSortedIds({boundsUpdatedObject, movedObject}));
+  REQUIRE(queryObjects({0.0f, 0.0f, 0.0f}).empty());
+
+  movedObject.getComponent<TransformComponent>()->getTransform().setPosition({0.0f, 0.0f, 0.0f});
+
+  sceneStructure.update();
+
+  REQUIRE(queryObjects(newPosition) == std::vector<GameObjectId>{boundsUpdatedObject.getId()});
+  REQUIRE(queryObjects({0.0f, 0.0f, 0.0f}) == std::vector<GameObjectId>{movedObject.getId()});
+
+  // Removed objects are not relocated anymore
+  sceneStructure.removeObject(movedObject);
+  movedObject.getComponent<TransformComponent>()->getTransform().setPosition(newPosition);
+
+  sceneStructure.update();
+
+  REQUIRE(sceneStructure.getObjectsCount() == 1);
+  REQUIRE(queryObjects(newPosition) == std::vector<GameObjectId>{boundsUpdatedObject.getId()});
+}
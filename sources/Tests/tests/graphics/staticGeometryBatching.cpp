@@ -0,0 +1,99 @@
+#include <catch2/catch.hpp>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <Engine/Modules/Graphics/GraphicsSystem/StaticGeometryBatcher.h>
+
+namespace {
+
+std::shared_ptr<Mesh> createQuadMesh()
+{
+  auto mesh = std::make_shared<Mesh>();
+
+  mesh->setVertices({{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f}});
+  mesh->setNormals({{0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}});
+  mesh->setUV({{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 1.0f}});
+
+  // The second sub-mesh references a part of the mesh vertices
+  mesh->addSubMesh({0, 2, 1, 1, 2, 3});
+  mesh->addSubMesh({0, 2, 1});
+
+  return mesh;
+}
+
+StaticGeometryBatchSource createSource(const Mesh& mesh, size_t subMeshIndex, size_t materialIndex,
+  const glm::vec3& position)
+{
+  return StaticGeometryBatchSource{
+    .mesh = &mesh,
+    .subMeshIndex = subMeshIndex,
+    .materialIndex = materialIndex,
+    .transform = glm::translate(glm::identity<glm::mat4>(), position),
+    .origin = position,
+  };
+}
+
+}
+
+TEST_CASE("static_geometry_batching_cells_and_materials", "[graphics]")
+{
+  std::shared_ptr<Mesh> mesh = createQuadMesh();
+
+  std::vector<StaticGeometryBatch> batches = StaticGeometryBatcher::buildBatches({
+    createSource(*mesh, 0, 0, {1.0f, 0.0f, 1.0f}),
+    createSource(*mesh, 0, 0, {5.0f, 0.0f, 5.0f}),
+    createSource(*mesh, 1, 1, {5.0f, 0.0f, 5.0f}),
+    createSource(*mesh, 0, 0, {40.0f, 0.0f, 1.0f}),
+  }, StaticGeometryBatchingOptions{.cellSize = 32.0f});
+
+  REQUIRE(batches.size() == 3);
+
+  REQUIRE(batches[0].sourcesIndices == std::vector<size_t>{0, 1});
+  REQUIRE(batches[0].positions.size() == 8);
+  REQUIRE(batches[0].indices == std::vector<uint32_t>{0, 1, 2, 2, 1, 3, 4, 5, 6, 6, 5, 7});
+  REQUIRE(batches[0].positions[4] == glm::vec3(5.0f, 0.0f, 5.0f));
+
+  REQUIRE(batches[0].bounds.getMin() == glm::vec3(1.0f, 0.0f, 1.0f));
+  REQUIRE(batches[0].bounds.getMax() == glm::vec3(6.0f, 0.0f, 6.0f));
+
+  // Only the vertices referenced by the sub-mesh are copied
+  REQUIRE(batches[1].materialIndex == 1);
+  REQUIRE(batches[1].positions.size() == 3);
+  REQUIRE(batches[1].indices == std::vector<uint32_t>{0, 1, 2});
+
+  REQUIRE(batches[2].sourcesIndices == std::vector<size_t>{3});
+}
+
+TEST_CASE("static_geometry_batching_vertices_limit", "[graphics]")
+{
+  std::shared_ptr<Mesh> mesh = createQuadMesh();
+
+  std::vector<StaticGeometryBatch> batches = StaticGeometryBatcher::buildBatches({
+    createSource(*mesh, 0, 0, {1.0f, 0.0f, 1.0f}),
+    createSource(*mesh, 0, 0, {2.0f, 0.0f, 2.0f}),
+    createSource(*mesh, 0, 0, {3.0f, 0.0f, 3.0f}),
+  }, StaticGeometryBatchingOptions{.cellSize = 32.0f, .maxBatchVerticesCount = 8});
+
+  REQUIRE(batches.size() == 2);
+  REQUIRE(batches[0].positions.size() == 8);
+  REQUIRE(batches[1].sourcesIndices == std::vector<size_t>{2});
+
+  SECTION("mirrored sub-meshes keep the triangles winding") {
+    StaticGeometryBatchSource mirroredSource = createSource(*mesh, 0, 0, {});
+    mirroredSource.transform = glm::scale(glm::identity<glm::mat4>(), {-1.0f, 1.0f, 1.0f});
+
+    std::vector<StaticGeometryBatch> mirroredBatches =
+      StaticGeometryBatcher::buildBatches({mirroredSource}, StaticGeometryBatchingOptions{});
+
+    const StaticGeometryBatch& batch = mirroredBatches.front();
+
+    for (size_t index = 0; index < batch.indices.size(); index += 3) {
+      const glm::vec3& firstVertex = batch.positions[batch.indices[index]];
+
+      glm::vec3 triangleNormal = glm::cross(batch.positions[batch.indices[index + 1]] - firstVertex,
+        batch.positions[batch.indices[index + 2]] - firstVertex);
+
+      REQUIRE(glm::dot(triangleNormal, batch.normals[batch.indices[index]]) > 0.0f);
+    }
+  }
+}
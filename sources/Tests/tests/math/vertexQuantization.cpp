@@ -0,0 +1,90 @@
+#include <catch2/catch.hpp>
+
+#include <vector>
+#include <glm/gtc/constants.hpp>
+
+#include <Engine/Modules/Math/VertexQuantization.h>
+#include <Engine/Modules/Math/MathUtils.h>
+
+namespace {
+
+std::vector<glm::vec3> generateDirections()
+{
+  std::vector<glm::vec3> directions = {
+    MathUtils::AXIS_X, -MathUtils::AXIS_X,
+    MathUtils::AXIS_Y, -MathUtils::AXIS_Y,
+    MathUtils::AXIS_Z, -MathUtils::AXIS_Z,
+  };
+
+  constexpr size_t STEPS_COUNT = 32;
+
+  for (size_t latitudeStep = 0; latitudeStep <= STEPS_COUNT; latitudeStep++) {
+    float latitude = glm::pi<float>() * static_cast<float>(latitudeStep) / STEPS_COUNT;
+
+    for (size_t longitudeStep = 0; longitudeStep < STEPS_COUNT * 2; longitudeStep++) {
+      float longitude = glm::pi<float>() * static_cast<float>(longitudeStep) / STEPS_COUNT;
+
+      directions.emplace_back(glm::sin(latitude) * glm::cos(longitude),
+        glm::sin(latitude) * glm::sin(longitude),
+        glm::cos(latitude));
+    }
+  }
+
+  return directions;
+}
+
+}
+
+TEST_CASE("vertex_quantization_positions", "[math]")
+{
+  glm::vec3 boundsMin = {-10.0f, 0.0f, 5.0f};
+  glm::vec3 boundsMax = {10.0f, 2.0f, 5.0f};
+
+  // The flat bounds axis is stored as zero
+  glm::vec3 maxError = (boundsMax - boundsMin) / 65535.0f;
+
+  for (const glm::vec3& position : {glm::vec3{-10.0f, 0.0f, 5.0f}, glm::vec3{10.0f, 2.0f, 5.0f},
+                                    glm::vec3{1.2345f, 0.777f, 5.0f}, glm::vec3{-3.3f, 1.999f, 5.0f}}) {
+    glm::u16vec3 quantizedPosition = VertexQuantization::quantizePosition(position, boundsMin, boundsMax);
+    glm::vec3 restoredPosition = VertexQuantization::dequantizePosition(quantizedPosition, boundsMin, boundsMax);
+
+    REQUIRE(glm::abs(restoredPosition.x - position.x) <= maxError.x);
+    REQUIRE(glm::abs(restoredPosition.y - position.y) <= maxError.y);
+    REQUIRE(restoredPosition.z == position.z);
+  }
+
+  REQUIRE(VertexQuantization::quantizePosition(boundsMax, boundsMin, boundsMax) == glm::u16vec3(65535, 65535, 0));
+}
+
+TEST_CASE("vertex_quantization_directions", "[math]")
+{
+  for (const glm::vec3& direction : generateDirections()) {
+    glm::vec3 octahedralDirection =
+      VertexQuantization::decodeOctahedral(VertexQuantization::encodeOctahedral(direction));
+
+    REQUIRE(MathUtils::isEqual(octahedralDirection, direction, 1e-5f));
+
+    glm::vec3 direction8 = VertexQuantization::dequantizeDirection8(VertexQuantization::quantizeDirection8(direction));
+    glm::vec3 direction16 =
+      VertexQuantization::dequantizeDirection16(VertexQuantization::quantizeDirection16(direction));
+
+    // About one degree error for 8-bit directions
+    REQUIRE(glm::dot(direction8, direction) > 0.9995f);
+    REQUIRE(glm::dot(direction16, direction) > 0.99999f);
+
+    REQUIRE(MathUtils::isEqual(glm::length(direction8), 1.0f, 1e-5f));
+    REQUIRE(MathUtils::isEqual(glm::length(direction16), 1.0f, 1e-5f));
+  }
+}
+
+TEST_CASE("vertex_quantization_half_floats", "[math]")
+{
+  for (const glm::vec2& uv : {glm::vec2{0.0f, 1.0f}, glm::vec2{0.5f, 0.25f}, glm::vec2{0.123f, 0.987f},
+                              glm::vec2{-2.0f, 3.5f}}) {
+    glm::vec2 restoredUV = VertexQuantization::dequantizeHalf(VertexQuantization::quantizeHalf(uv));
+
+    // Half floats have 11 significant bits
+    REQUIRE(glm::abs(restoredUV.x - uv.x) <= glm::abs(uv.x) / 2048.0f);
+    REQUIRE(glm::abs(restoredUV.y - uv.y) <= glm::abs(uv.y) / 2048.0f);
+  }
+}
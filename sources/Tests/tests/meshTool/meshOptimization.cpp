@@ -0,0 +1,213 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+
+#include <glm/glm.hpp>
+
+#include <MeshTool/Processing/MeshOptimizer.h>
+
+namespace {
+
+constexpr size_t GRID_SIZE = 32;
+
+std::vector<glm::vec3> generateGridPositions(size_t layersCount)
+{
+  std::vector<glm::vec3> positions;
+
+  for (size_t layer = 0; layer < layersCount; layer++) {
+    for (size_t z = 0; z < GRID_SIZE; z++) {
+      for (size_t x = 0; x < GRID_SIZE; x++) {
+        positions.emplace_back(static_cast<float>(x), static_cast<float>(layer), static_cast<float>(z));
+      }
+    }
+  }
+
+  return positions;
+}
+
+std::vector<uint32_t> generateGridIndices(size_t layersCount)
+{
+  std::vector<uint32_t> indices;
+
+  for (size_t layer = 0; layer < layersCount; layer++) {
+    for (size_t z = 0; z + 1 < GRID_SIZE; z++) {
+      for (size_t x = 0; x + 1 < GRID_SIZE; x++) {
+        auto topLeft = static_cast<uint32_t>(layer * GRID_SIZE * GRID_SIZE + z * GRID_SIZE + x);
+        auto topRight = static_cast<uint32_t>(topLeft + 1);
+        auto bottomLeft = static_cast<uint32_t>(topLeft + GRID_SIZE);
+        auto bottomRight = static_cast<uint32_t>(bottomLeft + 1);
+
+        indices.insert(indices.end(), {topLeft, bottomLeft, topRight, topRight, bottomLeft, bottomRight});
+      }
+    }
+  }
+
+  return indices;
+}
+
+std::vector<uint32_t> shuffleTriangles(const std::vector<uint32_t>& indices)
+{
+  std::vector<size_t> trianglesOrder(indices.size() / 3);
+
+  for (size_t triangleIndex = 0; triangleIndex < trianglesOrder.size(); triangleIndex++) {
+    trianglesOrder[triangleIndex] = triangleIndex;
+  }
+
+  std::shuffle(trianglesOrder.begin(), trianglesOrder.end(), std::mt19937(42));
+
+  std::vector<uint32_t> shuffledIndices;
+
+  for (size_t triangleIndex : trianglesOrder) {
+    shuffledIndices.insert(shuffledIndices.end(), indices.begin() + static_cast<std::ptrdiff_t>(triangleIndex * 3),
+      indices.begin() + static_cast<std::ptrdiff_t>(triangleIndex * 3 + 3));
+  }
+
+  return shuffledIndices;
+}
+
+std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> getSortedTriangles(const std::vector<uint32_t>& indices)
+{
+  std::vector<std::tuple<uint32_t, uint32_t, uint32_t>> triangles;
+
+  for (size_t index = 0; index < indices.size(); index += 3) {
+    triangles.emplace_back(indices[index], indices[index + 1], indices[index + 2]);
+  }
+
+  std::sort(triangles.begin(), triangles.end());
+
+  return triangles;
+}
+
+}
+
+TEST_CASE("mesh_vertex_cache_analysis", "[meshTool]")
+{
+  std::vector<uint32_t> indices = {0, 1, 2, 2, 1, 3};
+
+  VertexCacheStatistics statistics = MeshOptimizer::analyzeVertexCache(indices, 4);
+
+  REQUIRE(statistics.trianglesCount == 2);
+  REQUIRE(statistics.verticesCount == 4);
+  REQUIRE(statistics.cacheMissesCount == 4);
+  REQUIRE(statistics.acmr == Approx(2.0f));
+  REQUIRE(statistics.atvr == Approx(1.0f));
+
+  SECTION("evicted vertices are transformed again") {
+    std::vector<uint32_t> evictingIndices = {0, 1, 2, 3, 4, 5, 0, 1, 2};
+
+    VertexCacheStatistics evictingStatistics = MeshOptimizer::analyzeVertexCache(evictingIndices, 6, 3);
+
+    REQUIRE(evictingStatistics.cacheMissesCount == 9);
+    REQUIRE(evictingStatistics.atvr == Approx(1.5f));
+  }
+}
+
+TEST_CASE("mesh_vertex_cache_optimization", "[meshTool]")
+{
+  std::vector<glm::vec3> positions = generateGridPositions(1);
+  std::vector<uint32_t> indices = shuffleTriangles(generateGridIndices(1));
+
+  VertexCacheStatistics sourceStatistics = MeshOptimizer::analyzeVertexCache(indices, positions.size());
+
+  std::vector<uint32_t> optimizedIndices = MeshOptimizer::optimizeVertexCache(indices, positions.size());
+  VertexCacheStatistics optimizedStatistics = MeshOptimizer::analyzeVertexCache(optimizedIndices, positions.size());
+
+  REQUIRE(getSortedTriangles(optimizedIndices) == getSortedTriangles(indices));
+
+  REQUIRE(sourceStatistics.acmr > 2.5f);
+  REQUIRE(optimizedStatistics.acmr < 0.8f);
+  REQUIRE(optimizedStatistics.atvr < 1.5f);
+}
+
+TEST_CASE("mesh_overdraw_optimization", "[meshTool]")
+{
+  // Two parallel layers, the upper one occludes the lower one from the above
+  std::vector<glm::vec3> positions = generateGridPositions(2);
+  std::vector<uint32_t> indices = MeshOptimizer::optimizeVertexCache(generateGridIndices(2), positions.size());
+
+  const float threshold = 1.05f;
+
+  std::vector<uint32_t> optimizedIndices = MeshOptimizer::optimizeOverdraw(positions, indices, threshold);
+
+  REQUIRE(getSortedTriangles(optimizedIndices) == getSortedTriangles(indices));
+
+  // The outer layer is drawn first
+  REQUIRE(positions[optimizedIndices.front()].y == 1.0f);
+  REQUIRE(positions[optimizedIndices.back()].y == 0.0f);
+
+  VertexCacheStatistics sourceStatistics = MeshOptimizer::analyzeVertexCache(indices, positions.size());
+  VertexCacheStatistics optimizedStatistics = MeshOptimizer::analyzeVertexCache(optimizedIndices, positions.size());
+
+  REQUIRE(optimizedStatistics.acmr <= sourceStatistics.acmr * threshold + 0.01f);
+}
+
+TEST_CASE("mesh_overdraw_optimization_degenerate_first_triangle", "[meshTool]")
+{
+  std::vector<glm::vec3> positions = generateGridPositions(1);
+
+  // The degenerate first triangle misses only two vertices in the cache
+  std::vector<uint32_t> indices = {0, 0, 1};
+  std::vector<uint32_t> gridIndices = MeshOptimizer::optimizeVertexCache(generateGridIndices(1), positions.size());
+
+  indices.insert(indices.end(), gridIndices.begin(), gridIndices.end());
+
+  std::vector<uint32_t> optimizedIndices = MeshOptimizer::optimizeOverdraw(positions, indices, 1.05f);
+
+  REQUIRE(optimizedIndices.size() == indices.size());
+  REQUIRE(getSortedTriangles(optimizedIndices) == getSortedTriangles(indices));
+}
+
+TEST_CASE("mesh_vertex_fetch_optimization", "[meshTool]")
+{
+  std::vector<uint32_t> indices = {4, 2, 0, 0, 2, 3};
+
+  std::vector<uint32_t> remap = MeshOptimizer::generateVertexFetchRemap(indices, 5);
+
+  REQUIRE(remap == std::vector<uint32_t>{2, MeshOptimizer::UNUSED_VERTEX, 1, 3, 0});
+
+  SECTION("raw mesh vertices are reordered and unused ones are removed") {
+    std::vector<glm::vec3> positions = generateGridPositions(1);
+
+    RawMesh mesh{};
+
+    for (const glm::vec3& position : positions) {
+      mesh.positions.push_back(glmVector3ToRawVector3(position));
+    }
+
+    // The unused vertex
+    mesh.positions.push_back(RawVector3{100.0f, 100.0f, 100.0f});
+
+    std::vector<uint32_t> gridIndices = shuffleTriangles(generateGridIndices(1));
+
+    mesh.subMeshesDescriptions.push_back(RawSubMeshDescription{
+      .indicesCount = static_cast<uint32_t>(gridIndices.size()),
+      .indices = gridIndices,
+    });
+
+    mesh.header.verticesCount = static_cast<uint32_t>(mesh.positions.size());
+    mesh.header.subMeshesCount = 1;
+
+    MeshOptimizer::optimizeMesh(mesh, MeshOptimizationOptions{});
+
+    REQUIRE(mesh.header.verticesCount == positions.size());
+    REQUIRE(mesh.positions.size() == positions.size());
+
+    const std::vector<uint32_t>& optimizedIndices = mesh.subMeshesDescriptions[0].indices;
+    REQUIRE(optimizedIndices.size() == gridIndices.size());
+
+    // The vertices are referenced in the increasing order of their first use
+    uint32_t nextVertex = 0;
+
+    for (uint32_t vertex : optimizedIndices) {
+      REQUIRE(vertex <= nextVertex);
+
+      if (vertex == nextVertex) {
+        nextVertex++;
+      }
+    }
+
+    REQUIRE(MeshOptimizer::analyzeVertexCache(optimizedIndices, mesh.positions.size()).acmr < 0.8f);
+  }
+}
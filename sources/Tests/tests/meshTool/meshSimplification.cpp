@@ -0,0 +1,215 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/glm.hpp>
+
+#include <MeshTool/Processing/MeshSimplifier.h>
+#include <MeshTool/Processing/MeshLodGenerator.h>
+#include <MeshTool/Processing/MeshOccluderGenerator.h>
+
+namespace {
+
+constexpr size_t GRID_SIZE = 11;
+
+std::vector<glm::vec3> generateGridPositions(float heightScale)
+{
+  std::vector<glm::vec3> positions;
+
+  for (size_t z = 0; z < GRID_SIZE; z++) {
+    for (size_t x = 0; x < GRID_SIZE; x++) {
+      auto xCoordinate = static_cast<float>(x);
+      auto zCoordinate = static_cast<float>(z);
+
+      positions.emplace_back(xCoordinate, std::sin(xCoordinate) * std::cos(zCoordinate) * heightScale, zCoordinate);
+    }
+  }
+
+  return positions;
+}
+
+std::vector<uint32_t> generateGridIndices()
+{
+  std::vector<uint32_t> indices;
+
+  for (size_t z = 0; z + 1 < GRID_SIZE; z++) {
+    for (size_t x = 0; x + 1 < GRID_SIZE; x++) {
+      auto topLeft = static_cast<uint32_t>(z * GRID_SIZE + x);
+      auto topRight = static_cast<uint32_t>(topLeft + 1);
+      auto bottomLeft = static_cast<uint32_t>(topLeft + GRID_SIZE);
+      auto bottomRight = static_cast<uint32_t>(bottomLeft + 1);
+
+      indices.insert(indices.end(), {topLeft, bottomLeft, topRight, topRight, bottomLeft, bottomRight});
+    }
+  }
+
+  return indices;
+}
+
+}
+
+TEST_CASE("mesh_simplification_flat_grid", "[meshTool]")
+{
+  std::vector<glm::vec3> positions = generateGridPositions(0.0f);
+  std::vector<uint32_t> indices = generateGridIndices();
+
+  std::vector<uint32_t> simplifiedIndices = MeshSimplifier::simplify(positions, indices, MeshSimplificationOptions{
+    .targetIndicesCount = indices.size() / 2,
+    .maxError = 0.01f,
+  });
+
+  REQUIRE(simplifiedIndices.size() == indices.size() / 2);
+
+  // The flat grid triangles should not be flipped or degenerated
+  for (size_t index = 0; index < simplifiedIndices.size(); index += 3) {
+    glm::vec3 normal = glm::cross(positions[simplifiedIndices[index + 1]] - positions[simplifiedIndices[index]],
+      positions[simplifiedIndices[index + 2]] - positions[simplifiedIndices[index]]);
+
+    REQUIRE(normal.y > 0.0f);
+  }
+
+  SECTION("border vertices are locked") {
+    std::vector<uint32_t> minimalIndices = MeshSimplifier::simplify(positions, indices, MeshSimplificationOptions{
+      .targetIndicesCount = 0,
+      .maxError = 0.01f,
+    });
+
+    for (size_t vertexIndex = 0; vertexIndex < positions.size(); vertexIndex++) {
+      size_t x = vertexIndex % GRID_SIZE;
+      size_t z = vertexIndex / GRID_SIZE;
+
+      if (x == 0 || z == 0 || x == GRID_SIZE - 1 || z == GRID_SIZE - 1) {
+        REQUIRE(std::find(minimalIndices.begin(), minimalIndices.end(), vertexIndex) != minimalIndices.end());
+      }
+    }
+  }
+}
+
+TEST_CASE("mesh_simplification_error_limit", "[meshTool]")
+{
+  std::vector<glm::vec3> positions = generateGridPositions(2.0f);
+  std::vector<uint32_t> indices = generateGridIndices();
+
+  std::vector<uint32_t> preciseIndices = MeshSimplifier::simplify(positions, indices, MeshSimplificationOptions{
+    .targetIndicesCount = 0,
+    .maxError = 0.0001f,
+  });
+
+  std::vector<uint32_t> coarseIndices = MeshSimplifier::simplify(positions, indices, MeshSimplificationOptions{
+    .targetIndicesCount = 0,
+    .maxError = 0.05f,
+  });
+
+  REQUIRE(preciseIndices.size() == indices.size());
+  REQUIRE(coarseIndices.size() < indices.size());
+}
+
+TEST_CASE("mesh_lods_generation", "[meshTool]")
+{
+  std::vector<glm::vec3> positions = generateGridPositions(0.0f);
+  std::vector<uint32_t> indices = generateGridIndices();
+
+  RawMesh mesh{};
+
+  for (const glm::vec3& position : positions) {
+    mesh.positions.push_back(glmVector3ToRawVector3(position));
+  }
+
+  mesh.subMeshesDescriptions.push_back(RawSubMeshDescription{
+    .indicesCount = static_cast<uint32_t>(indices.size()),
+    .indices = indices,
+  });
+
+  mesh.header.subMeshesCount = 1;
+
+  MeshLodGenerator::generateLods(mesh, MeshLodGenerationOptions{
+    .lodsCount = 5,
+    .trianglesRatio = 0.5f,
+    .screenSizes = {},
+    .maxError = 0.01f,
+  });
+
+  // The flat grid could not be simplified below the locked border, so the chain is cut
+  REQUIRE(mesh.lods.size() == 4);
+
+  REQUIRE(mesh.lods[0].minScreenSize == Approx(0.5f));
+  REQUIRE(mesh.lods[1].minScreenSize == Approx(0.25f));
+  REQUIRE(mesh.lods[2].minScreenSize == Approx(0.125f));
+  REQUIRE(mesh.lods[3].minScreenSize == 0.0f);
+
+  REQUIRE(mesh.lods[0].subMeshesRanges[0].indicesOffset == 0);
+  REQUIRE(mesh.lods[0].subMeshesRanges[0].indicesCount == indices.size());
+
+  REQUIRE(mesh.lods[1].subMeshesRanges[0].indicesOffset == indices.size());
+  REQUIRE(mesh.lods[1].subMeshesRanges[0].indicesCount == indices.size() / 2);
+
+  REQUIRE(mesh.lods[2].subMeshesRanges[0].indicesOffset == indices.size() + indices.size() / 2);
+
+  const RawMeshIndicesRange& lastLodRange = mesh.lods.back().subMeshesRanges[0];
+
+  REQUIRE(mesh.subMeshesDescriptions[0].indicesCount == mesh.subMeshesDescriptions[0].indices.size());
+  REQUIRE(mesh.subMeshesDescriptions[0].indices.size() == lastLodRange.indicesOffset + lastLodRange.indicesCount);
+}
+
+TEST_CASE("mesh_occluder_generation", "[meshTool]")
+{
+  std::vector<glm::vec3> positions = generateGridPositions(0.0f);
+  std::vector<uint32_t> indices = generateGridIndices();
+
+  RawMesh mesh{};
+
+  // The grid halves are stored as the sub-meshes with the separate vertices, as they are split by a seam
+  for (size_t copyIndex = 0; copyIndex < 2; copyIndex++) {
+    for (const glm::vec3& position : positions) {
+      mesh.positions.push_back(glmVector3ToRawVector3(position));
+      mesh.normals.push_back(glmVector3ToRawVector3({0.0f, 1.0f, 0.0f}));
+    }
+  }
+
+  std::vector<uint32_t> secondHalfIndices(indices.begin() + static_cast<std::ptrdiff_t>(indices.size() / 2),
+    indices.end());
+
+  for (uint32_t& vertexIndex : secondHalfIndices) {
+    vertexIndex += static_cast<uint32_t>(positions.size());
+  }
+
+  indices.resize(indices.size() / 2);
+
+  mesh.subMeshesDescriptions.push_back(RawSubMeshDescription{
+    .indicesCount = static_cast<uint32_t>(indices.size()),
+    .indices = indices,
+  });
+
+  mesh.subMeshesDescriptions.push_back(RawSubMeshDescription{
+    .indicesCount = static_cast<uint32_t>(secondHalfIndices.size()),
+    .indices = secondHalfIndices,
+  });
+
+  mesh.header.subMeshesCount = 2;
+  mesh.header.verticesCount = static_cast<uint32_t>(mesh.positions.size());
+  mesh.header.storedAttributesMask = static_cast<bitmask64>(RawMeshAttributes::Positions | RawMeshAttributes::Normals);
+
+  MeshOccluderGenerator::generateOccluder(mesh, MeshOccluderGenerationOptions{
+    .trianglesRatio = 0.1f,
+    .maxError = 0.01f,
+  });
+
+  REQUIRE(mesh.header.subMeshesCount == 1);
+  REQUIRE(mesh.subMeshesDescriptions.size() == 1);
+  REQUIRE(mesh.lods.empty());
+
+  REQUIRE(mesh.header.storedAttributesMask == static_cast<bitmask64>(RawMeshAttributes::Positions));
+  REQUIRE(mesh.normals.empty());
+
+  // The seam vertices are welded, so the occluder is simplified as the single grid
+  REQUIRE(mesh.positions.size() == positions.size());
+
+  const std::vector<uint32_t>& occluderIndices = mesh.subMeshesDescriptions[0].indices;
+
+  REQUIRE(occluderIndices.size() == mesh.subMeshesDescriptions[0].indicesCount);
+  REQUIRE(occluderIndices.size() < (GRID_SIZE - 1) * (GRID_SIZE - 1) * 6 / 2);
+  REQUIRE(std::all_of(occluderIndices.begin(), occluderIndices.end(), [&positions](uint32_t vertexIndex) {
+    return vertexIndex < positions.size();
+  }));
+}
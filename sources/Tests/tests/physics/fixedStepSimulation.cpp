@@ -0,0 +1,154 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/Physics/PhysicsSystem.h>
+#include <Engine/Modules/Math/MathUtils.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
+
+#include "utility/resourcesUtility.h"
+
+namespace {
+
+GameObject createMovingBody(GameWorld& gameWorld, ResourcesManager& resourcesManager)
+{
+  GameObject body = gameWorld.createGameObject();
+  body.addComponent<TransformComponent>()->getTransform().setPosition(0.0f, 0.0f, 0.0f);
+
+  body.addComponent<RigidBodyComponent>(RigidBodyComponent(1.0f,
+    resourcesManager.createResourceInPlace<CollisionShape>(CollisionShapeSphere(1.0f))));
+
+  body.getComponent<RigidBodyComponent>()->setLinearVelocity({2.0f, 0.0f, 0.0f});
+
+  return body;
+}
+
+float getPositionX(GameObject& object)
+{
+  return object.getComponent<TransformComponent>()->getTransform().getPosition().x;
+}
+
+}
+
+TEST_CASE("physics_fixed_step_interpolation", "[physics]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateTestResourcesManager();
+
+  PhysicsSimulationSettings simulationSettings;
+  simulationSettings.fixedTimeStep = 0.1f;
+
+  auto gameWorld = GameWorld::createInstance();
+  auto physicsSystem = std::make_shared<PhysicsSystem>(simulationSettings);
+
+  gameWorld->getGameSystemsGroup()->addGameSystem(physicsSystem);
+  physicsSystem->setGravity({0.0f, 0.0f, 0.0f});
+
+  GameObject body = createMovingBody(*gameWorld, *resourcesManager);
+
+  // The first step has no previous state to interpolate from
+  gameWorld->update(0.15f);
+  REQUIRE(MathUtils::isEqual(getPositionX(body), 0.2f, 1e-3f));
+
+  // Half of the step is left in the accumulator after the second step
+  gameWorld->update(0.1f);
+  REQUIRE(MathUtils::isEqual(getPositionX(body), 0.3f, 1e-3f));
+
+  // The update without steps still moves the rendered transform
+  gameWorld->update(0.025f);
+  REQUIRE(MathUtils::isEqual(getPositionX(body), 0.35f, 1e-3f));
+
+  // Fixed updates see the exact state of the last step
+  std::vector<float> fixedUpdatePositions;
+
+  physicsSystem->setUpdateStepCallback([&body, &fixedUpdatePositions](float delta) {
+    ARG_UNUSED(delta);
+    fixedUpdatePositions.push_back(getPositionX(body));
+  });
+
+  gameWorld->update(0.025f);
+
+  REQUIRE(fixedUpdatePositions.size() == 1);
+  REQUIRE(MathUtils::isEqual(fixedUpdatePositions[0], 0.4f, 1e-3f));
+
+  // The accumulator is empty, so the state of the previous step is rendered
+  REQUIRE(MathUtils::isEqual(getPositionX(body), 0.4f, 1e-3f));
+}
+
+TEST_CASE("physics_dedicated_thread_latency", "[physics]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateTestResourcesManager();
+
+  PhysicsSimulationSettings simulationSettings;
+  simulationSettings.fixedTimeStep = 0.1f;
+  simulationSettings.isDedicatedThreadEnabled = true;
+
+  auto gameWorld = GameWorld::createInstance();
+  auto physicsSystem = std::make_shared<PhysicsSystem>(simulationSettings);
+
+  gameWorld->getGameSystemsGroup()->addGameSystem(physicsSystem);
+  physicsSystem->setGravity({0.0f, 0.0f, 0.0f});
+
+  GameObject body = createMovingBody(*gameWorld, *resourcesManager);
+
+  std::vector<float> fixedUpdatePositions;
+
+  physicsSystem->setUpdateStepCallback([&body, &fixedUpdatePositions](float delta) {
+    ARG_UNUSED(delta);
+    fixedUpdatePositions.push_back(getPositionX(body));
+  });
+
+  // Fixed updates of the frame are called in a row before the steps, so they see the same state
+  gameWorld->update(0.25f);
+  gameWorld->beforeRender();
+
+  REQUIRE(fixedUpdatePositions == std::vector<float>{0.0f, 0.0f});
+
+  // Results of the steps simulated during rendering are applied on the next update only
+  gameWorld->afterRender();
+  REQUIRE(MathUtils::isEqual(getPositionX(body), 0.0f));
+
+  // They are interpolated with the time left after the update that requested the steps
+  gameWorld->update(0.05f);
+  REQUIRE(MathUtils::isEqual(getPositionX(body), 0.3f, 1e-3f));
+
+  gameWorld->beforeRender();
+  gameWorld->afterRender();
+
+  REQUIRE(fixedUpdatePositions.size() == 3);
+  REQUIRE(MathUtils::isEqual(fixedUpdatePositions[2], 0.4f, 1e-3f));
+
+  // The rendered transform is kept interpolated after the fixed updates
+  REQUIRE(MathUtils::isEqual(getPositionX(body), 0.3f, 1e-3f));
+}
+
+TEST_CASE("physics_external_transform_changes", "[physics]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateTestResourcesManager();
+
+  PhysicsSimulationSettings simulationSettings;
+  simulationSettings.fixedTimeStep = 0.1f;
+
+  auto gameWorld = GameWorld::createInstance();
+  auto physicsSystem = std::make_shared<PhysicsSystem>(simulationSettings);
+
+  gameWorld->getGameSystemsGroup()->addGameSystem(physicsSystem);
+  physicsSystem->setGravity({0.0f, 0.0f, 0.0f});
+
+  GameObject body = createMovingBody(*gameWorld, *resourcesManager);
+
+  gameWorld->update(0.1f);
+  REQUIRE(MathUtils::isEqual(getPositionX(body), 0.2f, 1e-3f));
+
+  // The teleported object is not moved back, the body continues the simulation from the new position
+  body.getComponent<TransformComponent>()->getTransform().setPosition(10.0f, 0.0f, 0.0f);
+
+  gameWorld->update(0.1f);
+  REQUIRE(MathUtils::isEqual(getPositionX(body), 10.2f, 1e-3f));
+
+  // The objects moved by the fixed update are moved before the step
+  physicsSystem->setUpdateStepCallback([&body](float delta) {
+    ARG_UNUSED(delta);
+    body.getComponent<TransformComponent>()->getTransform().setPosition(-10.0f, 0.0f, 0.0f);
+  });
+
+  gameWorld->update(0.1f);
+  REQUIRE(MathUtils::isEqual(getPositionX(body), -9.8f, 1e-3f));
+}
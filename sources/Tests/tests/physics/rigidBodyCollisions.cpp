@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 
+#include <algorithm>
 #include <unordered_set>
 #include <Engine/Modules/Physics/PhysicsSystem.h>
 
@@ -7,6 +8,7 @@
 #include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
 
 #include "utility/resourcesUtility.h"
+#include "utility/ecsUtility.h"
 
 std::shared_ptr<GameWorld> createCollisionsPhysicsGameWorld()
 {
@@ -104,3 +106,125 @@ TEST_CASE("rigid_bodies_collision_callback", "[physics]")
   REQUIRE(collisionDetected2);
   REQUIRE(collisionVerified2);
 }
+
+TEST_CASE("rigid_bodies_collision_events", "[physics]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateTestResourcesManager();
+  std::shared_ptr<GameWorld> gameWorld = createCollisionsFloorSimulation(*resourcesManager);
+
+  GameObject fallingBody = gameWorld->findGameObject(1);
+  GameObject floorBody = gameWorld->findGameObject(2);
+
+  fallingBody.getComponent<RigidBodyComponent>()->enableCollisionEvents(true);
+
+  std::vector<CollisionEventType> eventsTypes;
+  bool isEventsObjectsVerified = true;
+
+  auto collisionEventsListener = ECSUtility::makeEventsListener<CollisionEvent>(
+    [&eventsTypes, &isEventsObjectsVerified, fallingBody, floorBody](const CollisionEvent& event) {
+      eventsTypes.push_back(event.type);
+
+      isEventsObjectsVerified = isEventsObjectsVerified &&
+        event.firstGameObject == fallingBody && event.secondGameObject == floorBody;
+    });
+
+  gameWorld->subscribeEventsListener<CollisionEvent>(collisionEventsListener.get());
+
+  for (int timeStepIndex = 0; timeStepIndex < 60; timeStepIndex++) {
+    gameWorld->update(5.0f / 60.0f);
+  }
+
+  REQUIRE(isEventsObjectsVerified);
+  REQUIRE(eventsTypes.size() > 1);
+  REQUIRE(eventsTypes.front() == CollisionEventType::Begin);
+  REQUIRE(std::all_of(eventsTypes.begin() + 1, eventsTypes.end(), [](CollisionEventType type) {
+    return type == CollisionEventType::Persist;
+  }));
+
+  eventsTypes.clear();
+
+  Transform liftedTransform;
+  liftedTransform.setPosition(0.0f, 10.0f, 0.0f);
+  fallingBody.getComponent<RigidBodyComponent>()->setTransform(liftedTransform);
+
+  // The body is probably asleep, it should be woken to refresh its contacts
+  fallingBody.getComponent<RigidBodyComponent>()->enableSimulation(true);
+
+  gameWorld->update(1.0f / 60.0f);
+
+  REQUIRE(isEventsObjectsVerified);
+  REQUIRE(eventsTypes == std::vector<CollisionEventType>{CollisionEventType::End});
+
+  gameWorld->unsubscribeEventsListener<CollisionEvent>(collisionEventsListener.get());
+}
+
+TEST_CASE("physics_scene_queries", "[physics]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateTestResourcesManager();
+  std::shared_ptr<GameWorld> gameWorld = createCollisionsFloorSimulation(*resourcesManager);
+
+  auto physicsSystem = gameWorld->getGameSystemsGroup()->getGameSystem<PhysicsSystem>();
+
+  GameObject fallingBody = gameWorld->findGameObject(1);
+  GameObject floorBody = gameWorld->findGameObject(2);
+
+  SECTION("raycast") {
+    PhysicsQueryHit hit = physicsSystem->raycast({.from = {0.0f, 20.0f, 0.0f}, .to = {0.0f, -5.0f, 0.0f}});
+
+    REQUIRE(hit.isHit);
+    REQUIRE(hit.gameObject == fallingBody);
+    REQUIRE(MathUtils::isEqual(hit.position, {0.0f, 11.0f, 0.0f}, 0.05f));
+
+    PhysicsQueryHit filteredHit = physicsSystem->raycast({.from = {0.0f, 20.0f, 0.0f}, .to = {0.0f, -5.0f, 0.0f},
+      .filter = {.ignoredObject = fallingBody}});
+
+    REQUIRE(filteredHit.isHit);
+    REQUIRE(filteredHit.gameObject == floorBody);
+    REQUIRE(MathUtils::isEqual(filteredHit.position, {0.0f, 0.5f, 0.0f}, 0.05f));
+  }
+
+  SECTION("raycast_batch") {
+    std::vector<PhysicsRaycastQuery> queries = {
+      {.from = {0.0f, 20.0f, 0.0f}, .to = {0.0f, -5.0f, 0.0f}},
+      {.from = {5.0f, 20.0f, 0.0f}, .to = {5.0f, -5.0f, 0.0f}},
+      {.from = {0.0f, 5.0f, 0.0f}, .to = {0.0f, -5.0f, 0.0f}},
+    };
+
+    std::vector<PhysicsQueryHit> hits;
+    physicsSystem->raycast(queries, hits);
+
+    REQUIRE(hits.size() == queries.size());
+    REQUIRE((hits[0].isHit && hits[0].gameObject == fallingBody));
+    REQUIRE_FALSE(hits[1].isHit);
+    REQUIRE((hits[2].isHit && hits[2].gameObject == floorBody));
+  }
+
+  SECTION("sweep") {
+    PhysicsQueryHit hit = physicsSystem->sweep({.shape = CollisionShapeSphere(0.5f),
+      .from = {0.0f, 5.0f, 0.0f}, .to = {0.0f, -5.0f, 0.0f}});
+
+    REQUIRE(hit.isHit);
+    REQUIRE(hit.gameObject == floorBody);
+  }
+
+  SECTION("overlap") {
+    std::vector<GameObject> overlappingObjects;
+    physicsSystem->overlap({.shape = CollisionShapeBox({2.0f, 0.2f, 2.0f}), .position = {0.0f, 0.5f, 0.0f}},
+      overlappingObjects);
+
+    REQUIRE(overlappingObjects.size() == 1);
+    REQUIRE(overlappingObjects[0] == floorBody);
+
+    std::vector<PhysicsOverlapQuery> queries = {
+      {.shape = CollisionShapeSphere(1.5f), .position = {0.0f, 10.0f, 0.0f}},
+      {.shape = CollisionShapeSphere(1.5f), .position = {10.0f, 10.0f, 0.0f}},
+    };
+
+    std::vector<GameObject> batchResult;
+    std::vector<size_t> batchResultOffsets;
+    physicsSystem->overlap(queries, batchResult, batchResultOffsets);
+
+    REQUIRE(batchResultOffsets == std::vector<size_t>{0, 1, 1});
+    REQUIRE(batchResult[0] == fallingBody);
+  }
+}
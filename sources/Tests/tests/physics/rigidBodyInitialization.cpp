@@ -2,6 +2,9 @@
 
 #include <unordered_set>
 #include <Engine/Modules/Physics/PhysicsSystem.h>
+#include <Engine/Modules/Physics/BulletBackend/BulletRigidBodyComponent.h>
+#include <Engine/Modules/Physics/BulletBackend/BulletCollisionShapesCache.h>
+#include <Engine/Modules/Physics/BulletBackend/BulletUtils.h>
 
 #include <Engine/Modules/Math/MathUtils.h>
 #include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
@@ -58,3 +61,41 @@ TEST_CASE("rigid_body_gravity_affection", "[physics]")
   REQUIRE(MathUtils::isEqual(transform.getPosition(), {0.0f, 0.0f, 0.0f}, 0.25f));
   REQUIRE(MathUtils::isEqual(rigidBodyComponent.getLinearVelocity(), {0.0f, -14.1421f, 0.0f}, 0.25f));
 }
+
+TEST_CASE("rigid_body_collision_shapes_sharing", "[physics]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateTestResourcesManager();
+  std::shared_ptr<GameWorld> gameWorld = createPhysicsGameWorld();
+
+  CollisionShapeTriangleMesh triangleMesh({{0.0f, 0.0f, 0.0f}, {10.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 10.0f},
+    {10.0f, 0.0f, 10.0f}}, {0, 2, 1, 1, 2, 3});
+  triangleMesh.setOptimizedBvhData(BulletCollisionShapesCache::bakeOptimizedBvh(triangleMesh));
+
+  REQUIRE_FALSE(triangleMesh.getOptimizedBvhData().empty());
+
+  ResourceHandle<CollisionShape> collisionShape =
+    resourcesManager->createResourceInPlace<CollisionShape>(triangleMesh);
+
+  auto createBody = [&gameWorld, &collisionShape](const glm::vec3& scale) {
+    GameObject body = gameWorld->createGameObject();
+    body.addComponent<TransformComponent>()->getTransform().setScale(scale);
+    body.addComponent<RigidBodyComponent>(RigidBodyComponent(0.0f, collisionShape));
+
+    return dynamic_cast<const BulletRigidBodyComponent&>(
+      body.getComponent<RigidBodyComponent>()->getBackend()).getBtCollisionShape();
+  };
+
+  btCollisionShape* firstShape = createBody({1.0f, 1.0f, 1.0f});
+  btCollisionShape* secondShape = createBody({1.0f, 1.0f, 1.0f});
+  btCollisionShape* scaledShape = createBody({2.0f, 2.0f, 2.0f});
+
+  REQUIRE(firstShape == secondShape);
+  REQUIRE(firstShape != scaledShape);
+  REQUIRE(BulletCollisionShapesCache::getTriangleMeshesCount() == 1);
+
+  btVector3 aabbMin;
+  btVector3 aabbMax;
+  scaledShape->getAabb(btTransform::getIdentity(), aabbMin, aabbMax);
+
+  REQUIRE(MathUtils::isEqual(BulletUtils::btVec3ToGlm(aabbMax), {20.0f, 0.0f, 20.0f}, 0.1f));
+}
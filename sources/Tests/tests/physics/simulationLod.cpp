@@ -0,0 +1,71 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/Physics/PhysicsSystem.h>
+#include <Engine/Modules/Math/MathUtils.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
+
+#include "utility/resourcesUtility.h"
+
+TEST_CASE("physics_simulation_lod", "[physics]")
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateTestResourcesManager();
+
+  PhysicsSimulationSettings simulationSettings;
+  simulationSettings.lod.isEnabled = true;
+  simulationSettings.lod.reducedRateRadius = 40.0f;
+  simulationSettings.lod.reducedRateStepsInterval = 4;
+  simulationSettings.lod.farRadius = 80.0f;
+
+  auto gameWorld = GameWorld::createInstance();
+  auto physicsSystem = std::make_shared<PhysicsSystem>(simulationSettings);
+
+  gameWorld->getGameSystemsGroup()->addGameSystem(physicsSystem);
+  physicsSystem->setGravity({0.0f, -10.0f, 0.0f});
+  physicsSystem->setSimulationLodOrigins({{0.0f, 100.0f, 0.0f}});
+
+  ResourceHandle<CollisionShape> bodyShape =
+    resourcesManager->createResourceInPlace<CollisionShape>(CollisionShapeSphere(1.0f));
+
+  auto createBody = [&gameWorld, &bodyShape](const glm::vec3& position) {
+    GameObject body = gameWorld->createGameObject();
+    body.addComponent<TransformComponent>()->getTransform().setPosition(position);
+    body.addComponent<RigidBodyComponent>(RigidBodyComponent(1.0f, bodyShape));
+
+    return body;
+  };
+
+  GameObject nearBody = createBody({0.0f, 100.0f, 0.0f});
+  GameObject middleBody = createBody({60.0f, 100.0f, 0.0f});
+  GameObject farBody = createBody({200.0f, 100.0f, 0.0f});
+
+  gameWorld->update(1.0f);
+
+  PhysicsSimulationLodStatistics statistics = physicsSystem->getSimulationLodStatistics();
+
+  REQUIRE(statistics.bodiesCount[static_cast<size_t>(PhysicsSimulationLod::Full)] == 1);
+  REQUIRE(statistics.bodiesCount[static_cast<size_t>(PhysicsSimulationLod::ReducedRate)] == 1);
+  REQUIRE(statistics.bodiesCount[static_cast<size_t>(PhysicsSimulationLod::Sleeping)] == 1);
+  REQUIRE(statistics.activeBodiesCount[static_cast<size_t>(PhysicsSimulationLod::Sleeping)] == 0);
+
+  // Reduced rate bodies are stepped less often, but cover the same simulation time
+  glm::vec3 expectedVelocity(0.0f, -10.0f, 0.0f);
+
+  REQUIRE(MathUtils::isEqual(nearBody.getComponent<RigidBodyComponent>()->getLinearVelocity(),
+    expectedVelocity, 0.25f));
+  REQUIRE(MathUtils::isEqual(middleBody.getComponent<RigidBodyComponent>()->getLinearVelocity(),
+    expectedVelocity, 0.5f));
+
+  REQUIRE(MathUtils::isEqual(farBody.getComponent<RigidBodyComponent>()->getLinearVelocity(), glm::vec3(0.0f)));
+  REQUIRE(MathUtils::isEqual(farBody.getComponent<TransformComponent>()->getTransform().getPosition(),
+    {200.0f, 100.0f, 0.0f}));
+
+  // The far body is woken once the origin approaches it
+  physicsSystem->setSimulationLodOrigins({{200.0f, 100.0f, 0.0f}});
+  gameWorld->update(0.5f);
+
+  statistics = physicsSystem->getSimulationLodStatistics();
+
+  REQUIRE(statistics.bodiesCount[static_cast<size_t>(PhysicsSimulationLod::Full)] == 1);
+  REQUIRE(statistics.bodiesCount[static_cast<size_t>(PhysicsSimulationLod::Sleeping)] == 2);
+  REQUIRE(farBody.getComponent<RigidBodyComponent>()->getLinearVelocity().y < -1.0f);
+}
@@ -0,0 +1,107 @@
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+
+#include <Engine/Modules/Graphics/Resources/Raw/RawMesh.h>
+#include <Engine/Modules/Math/MathUtils.h>
+
+namespace {
+
+RawMesh createStripMesh(size_t verticesCount)
+{
+  RawMesh mesh{};
+
+  mesh.header.formatVersion = MESH_FORMAT_VERSION;
+  mesh.header.verticesCount = static_cast<uint32_t>(verticesCount);
+  mesh.header.storedAttributesMask = static_cast<bitmask64>(RawMeshAttributes::Positions |
+    RawMeshAttributes::Normals | RawMeshAttributes::UV);
+  mesh.header.subMeshesCount = 1;
+
+  for (size_t vertexIndex = 0; vertexIndex < verticesCount; vertexIndex++) {
+    auto column = static_cast<float>(vertexIndex / 2);
+    auto row = static_cast<float>(vertexIndex % 2);
+
+    mesh.positions.push_back(RawVector3{column * 0.01f, 0.0f, row});
+    mesh.normals.push_back(RawVector3{0.0f, 1.0f, 0.0f});
+    mesh.uv.push_back(RawVector2{column / static_cast<float>(verticesCount), row});
+  }
+
+  RawSubMeshDescription subMeshDescription{};
+
+  for (uint32_t vertexIndex = 0; vertexIndex + 2 < verticesCount; vertexIndex += 2) {
+    subMeshDescription.indices.insert(subMeshDescription.indices.end(),
+      {vertexIndex, vertexIndex + 1, vertexIndex + 2, vertexIndex + 2, vertexIndex + 1, vertexIndex + 3});
+  }
+
+  subMeshDescription.indicesCount = static_cast<uint32_t>(subMeshDescription.indices.size());
+  mesh.subMeshesDescriptions.push_back(subMeshDescription);
+
+  mesh.aabb = RawAABB{.min = mesh.positions.front(), .max = mesh.positions.back()};
+  mesh.inverseSceneTransform = glmMatrix4ToRawMatrix4(MathUtils::IDENTITY_MATRIX4);
+
+  return mesh;
+}
+
+}
+
+TEST_CASE("raw_mesh_wide_indices", "[resources]")
+{
+  REQUIRE(RawMesh::getStoredIndexSize(65536) == sizeof(uint16_t));
+  REQUIRE(RawMesh::getStoredIndexSize(65537) == sizeof(uint32_t));
+
+  const std::string meshPath = (std::filesystem::temp_directory_path() / "raw_mesh_wide_indices.mesh").string();
+
+  RawMesh mesh = createStripMesh(70000);
+  RawMesh::writeToFile(meshPath, mesh);
+
+  RawMesh restoredMesh = RawMesh::readFromFile(meshPath);
+  std::filesystem::remove(meshPath);
+
+  REQUIRE(restoredMesh.header.verticesCount == 70000);
+  REQUIRE(restoredMesh.subMeshesDescriptions[0].indices == mesh.subMeshesDescriptions[0].indices);
+  REQUIRE(restoredMesh.subMeshesDescriptions[0].indices.back() == 69999);
+
+  REQUIRE(restoredMesh.lods.size() == 1);
+  REQUIRE(restoredMesh.lods[0].subMeshesRanges[0].indicesCount == mesh.subMeshesDescriptions[0].indicesCount);
+}
+
+TEST_CASE("raw_mesh_quantized_attributes", "[resources]")
+{
+  const std::string meshPath = (std::filesystem::temp_directory_path() / "raw_mesh_quantized.mesh").string();
+
+  RawMesh mesh = createStripMesh(1000);
+  RawMesh::writeToFile(meshPath, mesh);
+
+  auto fullSize = std::filesystem::file_size(meshPath);
+
+  mesh.header.quantizedAttributesMask = static_cast<bitmask64>(RawMeshQuantization::Positions16 |
+    RawMeshQuantization::Normals8 | RawMeshQuantization::UVHalf);
+  RawMesh::writeToFile(meshPath, mesh);
+
+  auto quantizedSize = std::filesystem::file_size(meshPath);
+
+  RawMesh restoredMesh = RawMesh::readFromFile(meshPath);
+  std::filesystem::remove(meshPath);
+
+  // 32 bytes of the vertex are stored in 12 bytes
+  REQUIRE(fullSize - quantizedSize == 1000 * 20 - sizeof(RawAABB));
+
+  REQUIRE(restoredMesh.positions.size() == mesh.positions.size());
+
+  glm::vec3 maxPositionError = (rawVector3ToGLMVector3(mesh.positions.back()) -
+    rawVector3ToGLMVector3(mesh.positions.front())) / 65535.0f;
+
+  for (size_t vertexIndex = 0; vertexIndex < mesh.positions.size(); vertexIndex++) {
+    glm::vec3 positionError = glm::abs(rawVector3ToGLMVector3(restoredMesh.positions[vertexIndex]) -
+      rawVector3ToGLMVector3(mesh.positions[vertexIndex]));
+
+    REQUIRE(positionError.x <= maxPositionError.x + 1e-6f);
+    REQUIRE(positionError.z <= maxPositionError.z + 1e-6f);
+
+    REQUIRE(MathUtils::isEqual(rawVector3ToGLMVector3(restoredMesh.normals[vertexIndex]),
+      rawVector3ToGLMVector3(mesh.normals[vertexIndex]), 1e-4f));
+
+    REQUIRE(glm::abs(restoredMesh.uv[vertexIndex].x - mesh.uv[vertexIndex].x) <= 1.0f / 2048.0f);
+    REQUIRE(restoredMesh.uv[vertexIndex].y == mesh.uv[vertexIndex].y);
+  }
+}
@@ -5,6 +5,7 @@
 
 #include <Engine/Modules/ECS/ECS.h>
 #include <Engine/Modules/Scripting/ScriptsExecutor.h>
+#include <Engine/Modules/Scripting/ScriptingSystem.h>
 
 TEST_CASE("scripts_executor_loading_scripts", "[resources]")
 {
@@ -14,3 +15,29 @@ TEST_CASE("scripts_executor_loading_scripts", "[resources]")
   sol::function sumFunction = scriptsExecutor.getLuaState()["sum"];
   REQUIRE(static_cast<int>(sumFunction(45, 55)) == 100);
 }
+
+TEST_CASE("scripting_system_action_handlers_caching", "[resources]")
+{
+  std::shared_ptr<GameWorld> gameWorld = GameWorld::createInstance();
+
+  auto scriptingSystem = std::make_shared<ScriptingSystem>(gameWorld);
+  gameWorld->getGameSystemsGroup()->addGameSystem(scriptingSystem);
+
+  sol::state& luaState = scriptingSystem->getScriptsExecutor()->getLuaState();
+  luaState.script("test_actions = { calls = 0 }\n"
+                  "function test_actions.on_action() test_actions.calls = test_actions.calls + 1 end");
+
+  gameWorld->emitEvent(ExecuteScriptSimpleActionCommand{.actionName = "test_actions.on_action"});
+  REQUIRE(luaState["test_actions"]["calls"].get<int>() == 1);
+
+  // The handler is resolved once, so the redefined function is called only after the scripts reload
+  luaState.script("function test_actions.on_action() test_actions.calls = test_actions.calls + 10 end");
+
+  gameWorld->emitEvent(ExecuteScriptSimpleActionCommand{.actionName = "test_actions.on_action"});
+  REQUIRE(luaState["test_actions"]["calls"].get<int>() == 2);
+
+  scriptingSystem->reloadScripts();
+
+  gameWorld->emitEvent(ExecuteScriptSimpleActionCommand{.actionName = "test_actions.on_action"});
+  REQUIRE(luaState["test_actions"]["calls"].get<int>() == 12);
+}
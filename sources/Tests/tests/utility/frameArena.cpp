@@ -0,0 +1,95 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+
+#include <Engine/Utility/FrameArena.h>
+
+TEST_CASE("linear_arena_allocations", "[utility]")
+{
+  LinearArena arena(256);
+
+  SECTION("allocations are aligned and do not overlap") {
+    auto* first = static_cast<std::byte*>(arena.allocate(3, 1));
+    auto* second = static_cast<std::byte*>(arena.allocate(16, 16));
+    auto* third = static_cast<std::byte*>(arena.allocate(8, 8));
+
+    REQUIRE(reinterpret_cast<uintptr_t>(second) % 16 == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(third) % 8 == 0);
+
+    REQUIRE(second >= first + 3);
+    REQUIRE(third >= second + 16);
+
+    REQUIRE(arena.getAllocatedSize() == 27);
+  }
+
+  SECTION("grown arena is merged into a single chunk on reset") {
+    for (size_t allocationIndex = 0; allocationIndex < 8; allocationIndex++) {
+      ARG_UNUSED(arena.allocate(128, 8));
+    }
+
+    size_t grownCapacity = arena.getCapacity();
+    REQUIRE(grownCapacity >= 1024);
+
+    arena.reset();
+
+    REQUIRE(arena.getAllocatedSize() == 0);
+    REQUIRE(arena.getCapacity() == grownCapacity);
+
+    for (size_t allocationIndex = 0; allocationIndex < 8; allocationIndex++) {
+      ARG_UNUSED(arena.allocate(128, 8));
+    }
+
+    REQUIRE(arena.getCapacity() == grownCapacity);
+  }
+
+  SECTION("allocations larger than the chunk size are supported") {
+    void* allocation = arena.allocate(1000, 64);
+
+    REQUIRE(allocation != nullptr);
+    REQUIRE(reinterpret_cast<uintptr_t>(allocation) % 64 == 0);
+    REQUIRE(arena.getCapacity() >= 1000);
+  }
+}
+
+TEST_CASE("frame_arena_double_buffering", "[utility]")
+{
+  FrameArena::finishFrame();
+
+  uint64_t frameIndex = FrameArena::getFrameIndex();
+
+  auto* previousFrameValue = FrameArena::create<int>(42);
+  REQUIRE(FrameArena::getFrameAllocatedSize() >= sizeof(int));
+
+  FrameArena::finishFrame();
+
+  REQUIRE(FrameArena::getFrameIndex() == frameIndex + 1);
+  REQUIRE(FrameArena::getLastFrameAllocatedSize() >= sizeof(int));
+  REQUIRE(FrameArena::getFrameAllocatedSize() == 0);
+
+  // The allocations of the previous frame are still valid
+  auto* currentFrameValue = FrameArena::create<int>(7);
+
+  REQUIRE(*previousFrameValue == 42);
+  REQUIRE(*currentFrameValue == 7);
+
+  FrameArena::finishFrame();
+}
+
+TEST_CASE("frame_arena_vectors", "[utility]")
+{
+  FrameArena::finishFrame();
+
+  FrameVector<int> values;
+
+  for (int value = 0; value < 1000; value++) {
+    values.push_back(value);
+  }
+
+  REQUIRE(values.size() == 1000);
+  REQUIRE(values.front() == 0);
+  REQUIRE(values.back() == 999);
+
+  REQUIRE(FrameArena::getFrameAllocatedSize() >= 1000 * sizeof(int));
+
+  FrameArena::finishFrame();
+}
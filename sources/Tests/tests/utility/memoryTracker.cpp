@@ -0,0 +1,128 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <new>
+
+#include <Engine/Modules/Profiling/MemoryTracker.h>
+#include <Engine/Utility/DynamicObjectsPool.h>
+
+TEST_CASE("memory_tracker_counters", "[utility]")
+{
+  MemoryCounterId counterId = MemoryTracker::registerCounter("test_counter");
+
+  REQUIRE(MemoryTracker::registerCounter("test_counter") == counterId);
+  REQUIRE(MemoryTracker::getCounterName(counterId) == "test_counter");
+  REQUIRE(MemoryTracker::getCounterName(MemoryCounters::Physics) == "physics");
+
+  MemoryCounterStatistics initialStatistics = MemoryTracker::getCounterStatistics(counterId);
+
+  MemoryTracker::registerAllocation(counterId, 256);
+  MemoryTracker::registerAllocation(counterId, 64);
+  MemoryTracker::registerDeallocation(counterId, 256);
+
+  MemoryCounterStatistics statistics = MemoryTracker::getCounterStatistics(counterId);
+
+  REQUIRE(statistics.liveBytes == initialStatistics.liveBytes + 64);
+  REQUIRE(statistics.liveAllocationsCount == initialStatistics.liveAllocationsCount + 1);
+  REQUIRE(statistics.allocationsCount == initialStatistics.allocationsCount + 2);
+
+  MemoryTracker::finishFrame();
+  REQUIRE(MemoryTracker::getCounterStatistics(counterId).frameAllocationsCount == 2);
+
+  MemoryTracker::finishFrame();
+  REQUIRE(MemoryTracker::getCounterStatistics(counterId).frameAllocationsCount == 0);
+
+  MemoryTracker::registerDeallocation(counterId, 64);
+}
+
+TEST_CASE("memory_tracker_allocators", "[utility]")
+{
+  SECTION("tracked vectors report their buffers") {
+    size_t initialLiveBytes = MemoryTracker::getCounterStatistics(MemoryCounters::GUI).liveBytes;
+
+    {
+      TrackedVector<uint64_t, MemoryCounters::GUI> values;
+      values.reserve(100);
+
+      REQUIRE(MemoryTracker::getCounterStatistics(MemoryCounters::GUI).liveBytes ==
+        initialLiveBytes + 100 * sizeof(uint64_t));
+    }
+
+    REQUIRE(MemoryTracker::getCounterStatistics(MemoryCounters::GUI).liveBytes == initialLiveBytes);
+  }
+
+  SECTION("objects pools report their chunks") {
+    MemoryCounterId counterId = MemoryTracker::registerCounter("test_pool");
+    size_t initialLiveBytes = MemoryTracker::getCounterStatistics(counterId).liveBytes;
+
+    {
+      DynamicObjectsPool<uint32_t> pool(16, counterId);
+      pool.fit(20);
+
+      REQUIRE(MemoryTracker::getCounterStatistics(counterId).liveBytes == initialLiveBytes + 32 * sizeof(uint32_t));
+    }
+
+    REQUIRE(MemoryTracker::getCounterStatistics(counterId).liveBytes == initialLiveBytes);
+  }
+}
+
+TEST_CASE("memory_tracker_heap_allocations", "[utility]")
+{
+  if (!MemoryTracker::isHeapAllocationsTrackingEnabled()) {
+    return;
+  }
+
+  // The allocation functions are called directly, as the allocations of the new expressions could be elided
+  auto requireCountedAllocation = [](auto&& allocate) {
+    size_t initialAllocationsCount = MemoryTracker::getHeapAllocationsCount();
+
+    void* pointer = allocate();
+    size_t allocationsCount = MemoryTracker::getHeapAllocationsCount();
+
+    REQUIRE(pointer != nullptr);
+    REQUIRE(allocationsCount == initialAllocationsCount + 1);
+
+    return pointer;
+  };
+
+  constexpr size_t SIZE = 48;
+
+  ::operator delete(requireCountedAllocation([] { return ::operator new(SIZE); }), SIZE);
+  ::operator delete[](requireCountedAllocation([] { return ::operator new[](SIZE); }));
+  ::operator delete[](requireCountedAllocation([] { return ::operator new[](SIZE); }), SIZE);
+
+  ::operator delete(requireCountedAllocation([] { return ::operator new(SIZE, std::nothrow); }), std::nothrow);
+  ::operator delete[](requireCountedAllocation([] { return ::operator new[](SIZE, std::nothrow); }), std::nothrow);
+
+  constexpr auto ALIGNMENT = std::align_val_t{64};
+
+  auto requireAligned = [](void* pointer) {
+    REQUIRE(reinterpret_cast<std::uintptr_t>(pointer) % static_cast<size_t>(ALIGNMENT) == 0);
+
+    return pointer;
+  };
+
+  ::operator delete(requireAligned(requireCountedAllocation([] {
+    return ::operator new(SIZE, ALIGNMENT);
+  })), ALIGNMENT);
+
+  ::operator delete(requireAligned(requireCountedAllocation([] {
+    return ::operator new(SIZE, ALIGNMENT);
+  })), SIZE, ALIGNMENT);
+
+  ::operator delete[](requireAligned(requireCountedAllocation([] {
+    return ::operator new[](SIZE, ALIGNMENT);
+  })), ALIGNMENT);
+
+  ::operator delete[](requireAligned(requireCountedAllocation([] {
+    return ::operator new[](SIZE, ALIGNMENT);
+  })), SIZE, ALIGNMENT);
+
+  ::operator delete(requireAligned(requireCountedAllocation([] {
+    return ::operator new(SIZE, ALIGNMENT, std::nothrow);
+  })), ALIGNMENT, std::nothrow);
+
+  ::operator delete[](requireAligned(requireCountedAllocation([] {
+    return ::operator new[](SIZE, ALIGNMENT, std::nothrow);
+  })), ALIGNMENT, std::nothrow);
+}
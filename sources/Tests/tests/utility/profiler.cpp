@@ -0,0 +1,71 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Modules/Profiling/CPUProfiler.h>
+
+TEST_CASE("cpu_profiler_frame_statistics", "[utility]")
+{
+  ProfilerScopeId frameScopeId = CPUProfiler::registerScope("test_frame");
+  ProfilerScopeId updateScopeId = CPUProfiler::registerScope("test_update");
+  ProfilerScopeId systemScopeId = CPUProfiler::registerScope("test_system");
+
+  REQUIRE(CPUProfiler::registerScope("test_update") == updateScopeId);
+  REQUIRE(CPUProfiler::getScopeName(systemScopeId) == "test_system");
+
+  // Events of the previous tests are dropped with the first frame
+  CPUProfiler::finishFrame();
+
+  {
+    CPUProfilerScope frameScope(frameScopeId);
+
+    for (size_t updateIndex = 0; updateIndex < 2; updateIndex++) {
+      CPUProfilerScope updateScope(updateScopeId);
+
+      for (size_t systemIndex = 0; systemIndex < 3; systemIndex++) {
+        CPUProfilerScope systemScope(systemScopeId);
+      }
+    }
+  }
+
+  CPUProfiler::finishFrame();
+
+  const std::vector<ProfilerScopeStatistics>& frameStatistics = CPUProfiler::getFrameStatistics();
+
+  REQUIRE(frameStatistics.size() == 3);
+
+  REQUIRE(frameStatistics[0].scopeId == frameScopeId);
+  REQUIRE(frameStatistics[0].depth == 0);
+  REQUIRE(frameStatistics[0].callsCount == 1);
+
+  REQUIRE(frameStatistics[1].scopeId == updateScopeId);
+  REQUIRE(frameStatistics[1].depth == 1);
+  REQUIRE(frameStatistics[1].callsCount == 2);
+
+  REQUIRE(frameStatistics[2].scopeId == systemScopeId);
+  REQUIRE(frameStatistics[2].depth == 2);
+  REQUIRE(frameStatistics[2].callsCount == 6);
+
+  REQUIRE(frameStatistics[0].totalTime >= frameStatistics[1].totalTime);
+  REQUIRE(frameStatistics[1].totalTime >= frameStatistics[2].totalTime);
+}
+
+TEST_CASE("cpu_profiler_disabled_scopes", "[utility]")
+{
+  ProfilerScopeId scopeId = CPUProfiler::registerScope("test_disabled_scope");
+
+  CPUProfiler::finishFrame();
+
+  {
+    CPUProfilerScope outerScope(scopeId);
+
+    // The state change inside of an opened scope should not break the scopes nesting
+    CPUProfiler::setEnabled(false);
+
+    CPUProfilerScope innerScope(scopeId);
+  }
+
+  CPUProfiler::setEnabled(true);
+  CPUProfiler::finishFrame();
+
+  REQUIRE(CPUProfiler::getFrameStatistics().size() == 1);
+  REQUIRE(CPUProfiler::getFrameStatistics()[0].callsCount == 1);
+}
@@ -0,0 +1,75 @@
+#include <catch2/catch.hpp>
+
+#include <Engine/Utility/RangeAllocator.h>
+
+TEST_CASE("range_allocator_allocations", "[utility]")
+{
+  RangeAllocator allocator(100);
+
+  std::optional<size_t> first = allocator.allocate(30);
+  std::optional<size_t> second = allocator.allocate(30);
+  std::optional<size_t> third = allocator.allocate(30);
+
+  REQUIRE(first == 0);
+  REQUIRE(second == 30);
+  REQUIRE(third == 60);
+
+  REQUIRE(allocator.getFreeSize() == 10);
+  REQUIRE_FALSE(allocator.allocate(20).has_value());
+
+  SECTION("the best fitting range is selected") {
+    allocator.free(*second, 30);
+
+    REQUIRE(allocator.getFreeRangesCount() == 2);
+    REQUIRE(allocator.allocate(10) == 90);
+    REQUIRE(allocator.allocate(20) == 30);
+  }
+
+  SECTION("released ranges are merged with the neighbours") {
+    allocator.free(*first, 30);
+    allocator.free(*third, 30);
+
+    REQUIRE(allocator.getFreeRangesCount() == 2);
+    REQUIRE(allocator.getLargestFreeRangeSize() == 40);
+
+    allocator.free(*second, 30);
+
+    REQUIRE(allocator.getFreeRangesCount() == 1);
+    REQUIRE(allocator.getFreeSize() == 100);
+    REQUIRE(allocator.getLargestFreeRangeSize() == 100);
+
+    REQUIRE(allocator.allocate(100) == 0);
+  }
+}
+
+TEST_CASE("range_allocator_fragmentation", "[utility]")
+{
+  RangeAllocator allocator(1024);
+
+  std::vector<size_t> offsets;
+
+  for (size_t allocationIndex = 0; allocationIndex < 64; allocationIndex++) {
+    std::optional<size_t> offset = allocator.allocate(16);
+
+    REQUIRE(offset.has_value());
+    offsets.push_back(*offset);
+  }
+
+  REQUIRE(allocator.getFreeSize() == 0);
+
+  // Every second range is released, so the storage is fragmented
+  for (size_t allocationIndex = 0; allocationIndex < offsets.size(); allocationIndex += 2) {
+    allocator.free(offsets[allocationIndex], 16);
+  }
+
+  REQUIRE(allocator.getFreeSize() == 512);
+  REQUIRE(allocator.getLargestFreeRangeSize() == 16);
+  REQUIRE_FALSE(allocator.allocate(32).has_value());
+
+  for (size_t allocationIndex = 1; allocationIndex < offsets.size(); allocationIndex += 2) {
+    allocator.free(offsets[allocationIndex], 16);
+  }
+
+  REQUIRE(allocator.getFreeRangesCount() == 1);
+  REQUIRE(allocator.allocate(1024) == 0);
+}
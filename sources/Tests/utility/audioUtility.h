@@ -0,0 +1,322 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Engine/Modules/Audio/AudioClip.h>
+#include <Engine/Modules/Audio/AudioSystem.h>
+#include <Engine/Modules/Audio/Resources/AudioClipResourceManager.h>
+#include <Engine/Modules/Graphics/GraphicsSystem/TransformComponent.h>
+
+#include "resourcesUtility.h"
+
+/*!
+ * \brief Packs values into bytes in the Vorbis bit order, from the least significant bit
+ */
+class VorbisBitWriter {
+ public:
+  void write(uint32_t value, size_t bitsCount)
+  {
+    for (size_t bitIndex = 0; bitIndex < bitsCount; bitIndex++) {
+      if (m_bitOffset == 0) {
+        m_bytes.push_back(0);
+      }
+
+      m_bytes.back() = static_cast<uint8_t>(m_bytes.back() | (((value >> bitIndex) & 1U) << m_bitOffset));
+      m_bitOffset = (m_bitOffset + 1) % 8;
+    }
+  }
+
+  void write(const std::string& text)
+  {
+    for (char character : text) {
+      write(static_cast<uint8_t>(character), 8);
+    }
+  }
+
+  [[nodiscard]] const std::vector<uint8_t>& getBytes() const
+  {
+    return m_bytes;
+  }
+
+ private:
+  std::vector<uint8_t> m_bytes;
+  size_t m_bitOffset = 0;
+};
+
+inline uint32_t computeOggCrc(const std::vector<uint8_t>& data)
+{
+  uint32_t crc = 0;
+
+  for (uint8_t byte : data) {
+    crc ^= static_cast<uint32_t>(byte) << 24;
+
+    for (size_t bitIndex = 0; bitIndex < 8; bitIndex++) {
+      crc = ((crc & 0x80000000U) != 0) ? (crc << 1) ^ 0x04c11db7U : (crc << 1);
+    }
+  }
+
+  return crc;
+}
+
+inline void appendOggPage(std::vector<uint8_t>& stream,
+  const std::vector<std::vector<uint8_t>>& packets,
+  uint8_t headerType,
+  uint64_t granulePosition,
+  uint32_t pageIndex)
+{
+  std::vector<uint8_t> page = {'O', 'g', 'g', 'S', 0, headerType};
+
+  auto appendValue = [&page](uint64_t value, size_t bytesCount) {
+    for (size_t byteIndex = 0; byteIndex < bytesCount; byteIndex++) {
+      page.push_back(static_cast<uint8_t>(value >> (byteIndex * 8)));
+    }
+  };
+
+  appendValue(granulePosition, 8);
+
+  // Stream serial number, page index and CRC placeholder
+  appendValue(1, 4);
+  appendValue(pageIndex, 4);
+  appendValue(0, 4);
+
+  std::vector<uint8_t> segmentsTable;
+
+  for (const std::vector<uint8_t>& packet : packets) {
+    size_t packetSize = packet.size();
+
+    while (packetSize >= 255) {
+      segmentsTable.push_back(255);
+      packetSize -= 255;
+    }
+
+    segmentsTable.push_back(static_cast<uint8_t>(packetSize));
+  }
+
+  page.push_back(static_cast<uint8_t>(segmentsTable.size()));
+  page.insert(page.end(), segmentsTable.begin(), segmentsTable.end());
+
+  for (const std::vector<uint8_t>& packet : packets) {
+    page.insert(page.end(), packet.begin(), packet.end());
+  }
+
+  uint32_t crc = computeOggCrc(page);
+
+  for (size_t byteIndex = 0; byteIndex < 4; byteIndex++) {
+    page[22 + byteIndex] = static_cast<uint8_t>(crc >> (byteIndex * 8));
+  }
+
+  stream.insert(stream.end(), page.begin(), page.end());
+}
+
+/*!
+ * \brief Writes the mono Ogg Vorbis file with silence
+ *
+ * The setup header describes the minimal codec configuration, every audio packet has an unused floor,
+ * so it is decoded into a block of silence. Vorbis output is produced by blocks, so the duration is
+ * rounded up to the block frames count.
+ *
+ * \return frames count of the written stream
+ */
+inline size_t writeSilentVorbisFile(const std::filesystem::path& path, size_t minFramesCount, uint32_t frequency)
+{
+  // Both short and long blocks have 2048 frames, each audio packet after the first one gives a half of a block
+  constexpr uint32_t BLOCK_SIZE_EXPONENT = 11;
+  constexpr size_t PACKET_FRAMES_COUNT = 1024;
+  constexpr size_t PACKETS_PER_PAGE = 32;
+
+  VorbisBitWriter identificationHeader;
+  identificationHeader.write(1, 8);
+  identificationHeader.write("vorbis");
+  identificationHeader.write(0, 32);
+  identificationHeader.write(1, 8);
+  identificationHeader.write(frequency, 32);
+  identificationHeader.write(0, 32);
+  identificationHeader.write(0, 32);
+  identificationHeader.write(0, 32);
+  identificationHeader.write(BLOCK_SIZE_EXPONENT, 4);
+  identificationHeader.write(BLOCK_SIZE_EXPONENT, 4);
+  identificationHeader.write(1, 1);
+
+  std::string vendor = "swengine tests";
+
+  VorbisBitWriter commentHeader;
+  commentHeader.write(3, 8);
+  commentHeader.write("vorbis");
+  commentHeader.write(static_cast<uint32_t>(vendor.size()), 32);
+  commentHeader.write(vendor);
+  commentHeader.write(0, 32);
+  commentHeader.write(1, 1);
+
+  VorbisBitWriter setupHeader;
+  setupHeader.write(5, 8);
+  setupHeader.write("vorbis");
+
+  // The single scalar codebook with two entries of one bit length
+  setupHeader.write(0, 8);
+  setupHeader.write(0x564342, 24);
+  setupHeader.write(1, 16);
+  setupHeader.write(2, 24);
+  setupHeader.write(0, 1);
+  setupHeader.write(0, 1);
+  setupHeader.write(0, 5);
+  setupHeader.write(0, 5);
+  setupHeader.write(0, 4);
+
+  // The unused time domain transform
+  setupHeader.write(0, 6);
+  setupHeader.write(0, 16);
+
+  // The floor of the type 1 without partitions
+  setupHeader.write(0, 6);
+  setupHeader.write(1, 16);
+  setupHeader.write(0, 5);
+  setupHeader.write(1, 2);
+  setupHeader.write(10, 4);
+
+  // The empty residue
+  setupHeader.write(0, 6);
+  setupHeader.write(0, 16);
+  setupHeader.write(0, 24);
+  setupHeader.write(0, 24);
+  setupHeader.write(0, 24);
+  setupHeader.write(0, 6);
+  setupHeader.write(0, 8);
+  setupHeader.write(0, 3);
+  setupHeader.write(0, 1);
+
+  // The single mapping without channels coupling
+  setupHeader.write(0, 6);
+  setupHeader.write(0, 16);
+  setupHeader.write(0, 1);
+  setupHeader.write(0, 1);
+  setupHeader.write(0, 2);
+  setupHeader.write(0, 8);
+  setupHeader.write(0, 8);
+  setupHeader.write(0, 8);
+
+  // The single mode of short blocks
+  setupHeader.write(0, 6);
+  setupHeader.write(0, 1);
+  setupHeader.write(0, 16);
+  setupHeader.write(0, 16);
+  setupHeader.write(0, 8);
+  setupHeader.write(1, 1);
+
+  constexpr uint8_t FIRST_PAGE_FLAG = 0x02;
+  constexpr uint8_t LAST_PAGE_FLAG = 0x04;
+
+  std::vector<uint8_t> stream;
+  uint32_t pageIndex = 0;
+
+  appendOggPage(stream, {identificationHeader.getBytes()}, FIRST_PAGE_FLAG, 0, pageIndex++);
+  appendOggPage(stream, {commentHeader.getBytes(), setupHeader.getBytes()}, 0, 0, pageIndex++);
+
+  // The first packet only primes the overlap of the blocks, so it does not give frames
+  size_t packetsCount = (minFramesCount + PACKET_FRAMES_COUNT - 1) / PACKET_FRAMES_COUNT + 1;
+
+  // The packet consists of the audio packet type bit and the unused floor bit
+  const std::vector<uint8_t> silentPacket = {0};
+
+  for (size_t firstPacketIndex = 0; firstPacketIndex < packetsCount; firstPacketIndex += PACKETS_PER_PAGE) {
+    size_t pagePacketsCount = std::min(PACKETS_PER_PAGE, packetsCount - firstPacketIndex);
+    size_t decodedPacketsCount = firstPacketIndex + pagePacketsCount;
+
+    bool isLastPage = decodedPacketsCount == packetsCount;
+
+    appendOggPage(stream,
+      std::vector<std::vector<uint8_t>>(pagePacketsCount, silentPacket),
+      isLastPage ? LAST_PAGE_FLAG : uint8_t(0),
+      (decodedPacketsCount - 1) * PACKET_FRAMES_COUNT,
+      pageIndex++);
+  }
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(stream.data()), static_cast<std::streamsize>(stream.size()));
+
+  return (packetsCount - 1) * PACKET_FRAMES_COUNT;
+}
+
+inline std::shared_ptr<ResourcesManager> generateAudioTestResourcesManager()
+{
+  std::shared_ptr<ResourcesManager> resourcesManager = generateTestResourcesManager();
+
+  resourcesManager->registerResourceType<AudioClip>("audio",
+    std::make_unique<AudioClipResourceManager>(resourcesManager.get()));
+
+  return resourcesManager;
+}
+
+/*!
+ * \brief Creates the streamed clip of silence, the streamed clips do not own AL buffers, so they could outlive
+ * the audio context
+ */
+inline ResourceHandle<AudioClip> createSilentStreamedClip(ResourcesManager& resourcesManager,
+  const std::string& fileName,
+  float duration)
+{
+  constexpr uint32_t FREQUENCY = 44100;
+
+  std::filesystem::path path = std::filesystem::temp_directory_path() / fileName;
+  size_t framesCount = writeSilentVorbisFile(path,
+    static_cast<size_t>(duration * static_cast<float>(FREQUENCY)), FREQUENCY);
+
+  return resourcesManager.createResourceInPlace<AudioClip>(AudioClipFormat::MONO_16, path.string(),
+    framesCount, FREQUENCY);
+}
+
+/*!
+ * \brief Creates the audio system with the loopback output, so the playback is advanced only by the explicit
+ * rendering and does not depend on the audio hardware
+ */
+inline std::shared_ptr<AudioSystem> createLoopbackAudioSystem(GameWorld& gameWorld, size_t voicesCount)
+{
+  auto audioSystem = std::make_shared<AudioSystem>(std::make_shared<GraphicsScene>(), voicesCount,
+    AudioOutputType::Loopback);
+
+  gameWorld.getGameSystemsGroup()->addGameSystem(audioSystem);
+
+  return audioSystem;
+}
+
+/*!
+ * \brief Updates the world and renders the loopback output for the same time
+ */
+inline void updateLoopbackAudio(GameWorld& gameWorld, AudioSystem& audioSystem, float delta)
+{
+  // The loopback output frequency of the audio system
+  constexpr float LOOPBACK_FREQUENCY = 44100.0f;
+
+  gameWorld.update(delta);
+  audioSystem.renderLoopbackFrames(static_cast<size_t>(delta * LOOPBACK_FREQUENCY));
+}
+
+/*!
+ * \brief Creates the online emitter that starts to play on the next audio system update
+ */
+inline GameObject createPlayingAudioEmitter(GameWorld& gameWorld,
+  const ResourceHandle<AudioClip>& clip,
+  const glm::vec3& position,
+  bool isStatic = false)
+{
+  GameObject emitter = gameWorld.createGameObject();
+
+  auto transformComponent = emitter.addComponent<TransformComponent>();
+  transformComponent->getTransform().setPosition(position);
+  transformComponent->setStaticMode(isStatic);
+  transformComponent->setOnlineMode(true);
+
+  emitter.addComponent<AudioSourceComponent>(clip)->getSource().play();
+
+  return emitter;
+}
+
+inline AudioSource& getEmitterSource(GameObject& emitter)
+{
+  return emitter.getComponent<AudioSourceComponent>()->getSource();
+}